@@ -78,6 +78,8 @@ namespace castor3d
 	*	Updated to submesh components system.
 	*\version 1.7
 	*	Moved to little endian, added support for Mikkelsen tangent space.
+	*\version 2.0
+	*	64 bits chunk sizes, compressed chunks, encoded and quantised submesh data.
 	*\~french
 	*	La version actuelle du format.
 	*\version 1.2
@@ -90,8 +92,10 @@ namespace castor3d
 	*	Mise à jour pour les composants de submesh.
 	*\version 1.7
 	*	Passage à little endian, ajout du support de l'espace tangent de Mikkelsen.
+	*\version 2.0
+	*	Tailles de chunk sur 64 bits, chunks compressés, données de submesh encodées et quantifiées.
 	*/
-	uint32_t constexpr CurrentCmshVersion = makeCmshVersion( 0x01u, 0x07u, 0x0000u );
+	uint32_t constexpr CurrentCmshVersion = makeCmshVersion( 0x02u, 0x00u, 0x0000u );
 	/**
 	*\~english
 	*\brief		Creates a chunk ID.
@@ -213,6 +217,45 @@ namespace castor3d
 		eMorphTargetTangentsMikkt = makeChunkID( 'S', 'M', 'S', 'M', 'K', 'M', 'T', 'A' ),
 		eSubmeshBitangents = makeChunkID( 'S', 'M', 'S', 'M', 'K', 'B', 'I', 'T' ),
 		eMorphTargetBitangents = makeChunkID( 'S', 'M', 'S', 'M', 'K', 'M', 'B', 'I' ),
+		// Version 2.0
+		// The file chunk, and all its subchunks, have 64 bits sizes.
+		eCmshFileV2 = makeChunkID( 'C', 'M', 'S', 'H', 'F', 'I', 'L', '2' ),
+		// Holds a deflated chunk: the compressed chunk type, its data size, then the compressed data.
+		eCompressed = makeChunkID( 'C', 'M', 'P', 'R', 'S', 'S', 'E', 'D' ),
+		// Holds an encoded vertex or index buffer: the decoded chunk type, the encoding, then the encoded data.
+		eSubmeshEncoded = makeChunkID( 'S', 'M', 'S', 'H', 'E', 'N', 'C', 'D' ),
+		// Submesh levels of detail, stored from the finest to the coarsest.
+		eLodComponent = makeChunkID( 'L', 'O', 'D', 'S', 'C', 'O', 'M', 'P' ),
+		eLodPixelError = makeChunkID( 'L', 'O', 'D', 'S', 'P', 'X', 'E', 'R' ),
+		eLodLevelError = makeChunkID( 'L', 'O', 'D', 'S', 'L', 'E', 'R', 'R' ),
+		eLodLevelIndexCount = makeChunkID( 'L', 'O', 'D', 'S', 'I', 'C', 'N', 'T' ),
+		eLodLevelIndices = makeChunkID( 'L', 'O', 'D', 'S', 'I', 'D', 'C', 'S' ),
+		// Tells that the submesh vertices are packed for the GPU, the packed data is built from the vertices when loaded.
+		ePackedVerticesComponent = makeChunkID( 'P', 'A', 'C', 'K', 'C', 'O', 'M', 'P' ),
+	};
+	/**
+	\~english
+	\brief		The options used when writing a cmsh file.
+	\~french
+	\brief		Les options utilisées lors de l'écriture d'un fichier cmsh.
+	*/
+	struct CmshWriteOptions
+	{
+		//!\~english	Deflates the data chunks bigger than compressionThreshold, when it makes them smaller.
+		//!\~french		Compresse les chunks de données plus grands que compressionThreshold, quand ça les rend plus petits.
+		bool compress{ true };
+		//!\~english	The deflate level, from 1 (fastest) to 9 (smallest).
+		//!\~french		Le niveau de compression, de 1 (le plus rapide) à 9 (le plus petit).
+		int32_t compressionLevel{ 6 };
+		//!\~english	The minimal data size for a chunk to be compressed.
+		//!\~french		La taille minimale des données d'un chunk pour qu'il soit compressé.
+		uint64_t compressionThreshold{ 4096u };
+		//!\~english	Encodes the submeshes vertex and index buffers with meshoptimizer codecs (lossless).
+		//!\~french		Encode les tampons de sommets et d'indices des submeshes avec les codecs de meshoptimizer (sans perte).
+		bool encode{ true };
+		//!\~english	Quantises positions and texcoords to 16 bits in their bounds, normals and tangents to 16 bits octahedral (lossy).
+		//!\~french		Quantifie les positions et coordonnées de texture sur 16 bits dans leurs limites, les normales et tangentes en octaédrique 16 bits (avec perte).
+		bool quantise{ false };
 	};
 	/**
 	 *\~english
@@ -272,7 +315,7 @@ namespace castor3d
 		 *\param[in]	data	Le tampon de données
 		 *\param[in]	size	La taille du tampon
 		 */
-		C3D_API void add( uint8_t * data, uint32_t size );
+		C3D_API void add( uint8_t * data, uint64_t size );
 		/**
 		 *\~english
 		 *\brief		Retrieves data from the chunk
@@ -283,7 +326,7 @@ namespace castor3d
 		 *\param[in]	data	Le tampon de données à remplir
 		 *\param[in]	size	La taille du tampon
 		 */
-		C3D_API void get( uint8_t * data, uint32_t size );
+		C3D_API void get( uint8_t * data, uint64_t size );
 		/**
 		 *\~english
 		 *\brief		Checks that the remaining place can hold the given size
@@ -292,7 +335,7 @@ namespace castor3d
 		 *\brief		Vérifie que la place restante peut contenir la taille donnée
 		 *\param[in]	size	La taille
 		 */
-		C3D_API bool checkAvailable( uint32_t size = 0 )const;
+		C3D_API bool checkAvailable( uint64_t size = 0 )const;
 		/**
 		 *\~english
 		 *\brief		Retrieves the remaining place
@@ -301,7 +344,7 @@ namespace castor3d
 		 *\brief		Récupère la place restante
 		 *\return		La valeur
 		 */
-		C3D_API uint32_t getRemaining()const;
+		C3D_API uint64_t getRemaining()const;
 		/**
 		 *\~english
 		 *\brief		Retrieves a subchunk
@@ -324,6 +367,17 @@ namespace castor3d
 		 *\return		\p false si une erreur quelconque est arrivée
 		 */
 		C3D_API bool addSubChunk( BinaryChunk const & subchunk );
+		/**
+		 *\~english
+		 *\brief		Replaces the chunk by an eCompressed chunk holding its deflated data.
+		 *\remarks		Nothing is done if the options disable compression, if the chunk is too small, or if it wouldn't be smaller.
+		 *\param[in]	options	The write options.
+		 *\~french
+		 *\brief		Remplace le chunk par un chunk eCompressed contenant ses données compressées.
+		 *\remarks		Rien n'est fait si les options désactivent la compression, si le chunk est trop petit, ou s'il ne serait pas plus petit.
+		 *\param[in]	options	Les options d'écriture.
+		 */
+		C3D_API void compress( CmshWriteOptions const & options );
 		/**
 		 *\~english
 		 *\brief		To chunk writer function
@@ -346,6 +400,35 @@ namespace castor3d
 		 *\return		\p false si une erreur quelconque est arrivée
 		 */
 		C3D_API bool read( castor::BinaryFile & file );
+		/**
+		 *\~english
+		 *\brief		From memory reader function.
+		 *\remarks		The chunk doesn't copy its data, it only references it, so the memory must outlive the parsing.
+		 *\param[in]	data	The memory holding the chunk.
+		 *\param[in]	size	The memory size.
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir de la mémoire.
+		 *\remarks		Le chunk ne copie pas ses données, il ne fait que les référencer, la mémoire doit donc survivre à l'analyse.
+		 *\param[in]	data	La mémoire contenant le chunk.
+		 *\param[in]	size	La taille de la mémoire.
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		C3D_API bool read( uint8_t const * data
+			, uint64_t size );
+		/**
+		 *\~english
+		 *\brief		From memory mapped file reader function.
+		 *\remarks		The chunk references the mapped memory, so the file must outlive the parsing.
+		 *\param[in]	file	The mapped file containing the chunk
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir d'un fichier mappé en mémoire.
+		 *\remarks		Le chunk référence la mémoire mappée, le fichier doit donc survivre à l'analyse.
+		 *\param[in]	file	Le fichier mappé qui contient le chunk
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		C3D_API bool read( castor::MappedFile const & file );
 		/**
 		 *\~english
 		 *\brief		Retrieves the remaining data
@@ -356,7 +439,7 @@ namespace castor3d
 		 */
 		uint8_t const * getRemainingData()const
 		{
-			return &m_data[m_index];
+			return doGetBegin() + m_index;
 		}
 		/**
 		 *\~english
@@ -378,9 +461,9 @@ namespace castor3d
 		 *\brief		Récupère la taille des données du chunk
 		 *\return		La valeur
 		 */
-		uint32_t getDataSize()const
+		uint64_t getDataSize()const
 		{
-			return uint32_t( m_data.size() );
+			return doGetSize();
 		}
 		/**
 		 *\~english
@@ -392,7 +475,7 @@ namespace castor3d
 		 */
 		uint8_t const * getData()const
 		{
-			return m_data.data();
+			return doGetBegin();
 		}
 		/**
 		 *\~english
@@ -408,6 +491,22 @@ namespace castor3d
 			, uint8_t const * end )
 		{
 			m_data.assign( begin, end );
+			m_view = nullptr;
+			m_viewSize = 0u;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the chunk's data
+		 *\param[in]	data	The data buffer
+		 *\~french
+		 *\brief		Définit les données du chunk
+		 *\param[in]	data	Le tampon de données
+		 */
+		void setData( castor::ByteArray data )
+		{
+			m_data = castor::move( data );
+			m_view = nullptr;
+			m_viewSize = 0u;
 		}
 		/**
 		 *\~english
@@ -417,7 +516,7 @@ namespace castor3d
 		 */
 		void endParse()
 		{
-			m_index = uint32_t( m_data.size() );
+			m_index = doGetSize();
 		}
 		/**
 		 *\~english
@@ -434,8 +533,44 @@ namespace castor3d
 		{
 			return m_isLittleEndian;
 		}
+		/**
+		 *\~english
+		 *\return		\p true if the chunk references data it doesn't own (mapped file or parent chunk).
+		 *\~french
+		 *\return		\p true si le chunk référence des données qu'il ne possède pas (fichier mappé ou chunk parent).
+		 */
+		bool isView()const noexcept
+		{
+			return m_view != nullptr;
+		}
+
+		void setWriteOptions( CmshWriteOptions const & options )noexcept
+		{
+			m_writeOptions = options;
+		}
+
+		CmshWriteOptions const & getWriteOptions()const noexcept
+		{
+			return m_writeOptions;
+		}
 
 	private:
+		uint8_t const * doGetBegin()const noexcept
+		{
+			return m_view
+				? m_view
+				: m_data.data();
+		}
+
+		uint64_t doGetSize()const noexcept
+		{
+			return m_view
+				? m_viewSize
+				: uint64_t( m_data.size() );
+		}
+
+		bool doDecompress( BinaryChunk & subchunk );
+
 		C3D_API void binaryError( castor::StringView view )const;
 
 	private:
@@ -443,21 +578,17 @@ namespace castor3d
 		bool doRead( T * values
 			, uint32_t count )
 		{
-			auto size = count * uint32_t( sizeof( T ) );
-			bool result{ m_index + size <= m_data.size() };
+			auto size = count * uint64_t( sizeof( T ) );
+			bool result{ m_index + size <= doGetSize() };
 
 			if ( result )
 			{
-				using TPtr = T *;
-				auto begin = reinterpret_cast< TPtr >( &m_data[m_index] );
-				auto end = begin + count;
-				auto value = values;
+				// The data may be unaligned, when it comes from a mapped file.
+				std::memcpy( values, doGetBegin() + m_index, size );
 
-				for ( auto it = begin; it != end; ++it )
+				for ( auto value = values; value != values + count; ++value )
 				{
-					( *value ) = *it;
 					prepareChunkDataT( this, *value );
-					++value;
 				}
 
 				m_index += size;
@@ -472,10 +603,20 @@ namespace castor3d
 
 	private:
 		ChunkType m_type{};
+		//!\~english	The owned data, used when the chunk is written, or read from a stream.
+		//!\~french		Les données possédées, utilisées quand le chunk est écrit, ou lu depuis un flux.
 		castor::ByteArray m_data;
-		uint32_t m_index{};
+		//!\~english	The referenced data, when the chunk is read from memory, or is a subchunk of such a chunk.
+		//!\~french		Les données référencées, quand le chunk est lu depuis la mémoire, ou est un sous-chunk d'un tel chunk.
+		uint8_t const * m_view{};
+		uint64_t m_viewSize{};
+		uint64_t m_index{};
 		castor::List< castor::ByteArray > m_addedData;
 		bool m_isLittleEndian{ true };
+		//!\~english	Tells if the subchunks sizes are stored on 64 bits (from cmsh 2.0), always true when writing.
+		//!\~french		Dit si les tailles des sous-chunks sont stockées sur 64 bits (depuis cmsh 2.0), toujours vrai en écriture.
+		bool m_wideSizes{ true };
+		CmshWriteOptions m_writeOptions{};
 	};
 }
 
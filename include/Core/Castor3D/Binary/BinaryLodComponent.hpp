@@ -0,0 +1,75 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_BinaryLodComponent_H___
+#define ___C3D_BinaryLodComponent_H___
+
+#include "Castor3D/Binary/BinaryParser.hpp"
+#include "Castor3D/Binary/BinaryWriter.hpp"
+
+#include "Castor3D/Model/Mesh/Submesh/Component/ComponentModule.hpp"
+
+namespace castor3d
+{
+	/**
+	\~english
+	\brief		Helper structure to find ChunkType from a type.
+	\remarks	Specialisation for LodComponent.
+	\~french
+	\brief		Classe d'aide pour récupéer un ChunkType depuis un type.
+	\remarks	Spécialisation pour LodComponent.
+	*/
+	template<>
+	struct ChunkTyper< LodComponent >
+	{
+		static ChunkType const Value = ChunkType::eLodComponent;
+	};
+	/**
+	\~english
+	\brief		LodComponent loader.
+	\~english
+	\brief		Loader de LodComponent.
+	*/
+	template<>
+	class BinaryWriter< LodComponent >
+		: public BinaryWriterBase< LodComponent >
+	{
+	private:
+		/**
+		 *\~english
+		 *\brief		Function used to fill the chunk from specific data.
+		 *\param[in]	obj	The object to write.
+		 *\return		\p false if any error occured.
+		 *\~french
+		 *\brief		Fonction utilisée afin de remplir le chunk de données spécifiques.
+		 *\param[in]	obj	L'objet à écrire.
+		 *\return		\p false si une erreur quelconque est arrivée.
+		 */
+		C3D_API bool doWrite( LodComponent const & obj )override;
+	};
+	/**
+	\~english
+	\brief		LodComponent loader.
+	\~english
+	\brief		Loader de LodComponent.
+	*/
+	template<>
+	class BinaryParser< LodComponent >
+		: public BinaryParserBase< LodComponent >
+	{
+	private:
+		/**
+		 *\~english
+		 *\brief		Function used to retrieve specific data from the chunk.
+		 *\param[out]	obj	The object to read.
+		 *\return		\p false if any error occured.
+		 *\~french
+		 *\brief		Fonction utilisée afin de récupérer des données spécifiques à partir d'un chunk.
+		 *\param[out]	obj	L'objet à lire.
+		 *\return		\p false si une erreur quelconque est arrivée.
+		 */
+		C3D_API bool doParse( LodComponent & obj )override;
+	};
+}
+
+#endif
@@ -55,39 +55,28 @@ namespace castor3d
 		{
 			BinaryChunk header{ true };
 			bool result = header.read( file );
-
-			if ( header.getChunkType() != ChunkType::eCmshFile )
-			{
-				result = false;
-				checkError( result, cuT( "Not a valid CMSH file." ) );
-			}
-
-			if ( result )
-			{
-				result = doParseHeader( header );
-			}
-
-			if ( result )
-			{
-				result = header.checkAvailable( 1 );
-				checkError( result, cuT( "No more data in chunk." ) );
-			}
-
-			BinaryChunk chunk{ isLittleEndian( header ) };
-
-			if ( result )
-			{
-				result = header.getSubChunk( chunk );
-				checkError( result, cuT( "Couldn't retrieve subchunk." ) );
-			}
-
-			if ( result )
-			{
-				result = parse( obj, chunk );
-				checkError( result, cuT( "Couldn't parse chunk." ) );
-			}
-
-			return result;
+			return doParseFile( obj, header, result );
+		}
+		/**
+		 *\~english
+		 *\brief		From memory mapped file reader function.
+		 *\remarks		The chunks reference the mapped memory, without copying it.
+		 *\param[out]	obj		The object to read
+		 *\param[in]	file	The mapped file containing the chunk
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir d'un fichier mappé en mémoire.
+		 *\remarks		Les chunks référencent la mémoire mappée, sans la copier.
+		 *\param[out]	obj		L'objet à lire
+		 *\param[in]	file	Le fichier mappé qui contient le chunk
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		bool parse( TParsed & obj
+			, castor::MappedFile const & file )
+		{
+			BinaryChunk header{ true };
+			bool result = header.read( file );
+			return doParseFile( obj, header, result );
 		}
 		/**
 		 *\~english
@@ -165,6 +154,46 @@ namespace castor3d
 			return result;
 		}
 
+	private:
+		bool doParseFile( TParsed & obj
+			, BinaryChunk & header
+			, bool result )
+		{
+			if ( header.getChunkType() != ChunkType::eCmshFile
+				&& header.getChunkType() != ChunkType::eCmshFileV2 )
+			{
+				result = false;
+				checkError( result, cuT( "Not a valid CMSH file." ) );
+			}
+
+			if ( result )
+			{
+				result = doParseHeader( header );
+			}
+
+			if ( result )
+			{
+				result = header.checkAvailable( 1 );
+				checkError( result, cuT( "No more data in chunk." ) );
+			}
+
+			BinaryChunk chunk{ isLittleEndian( header ) };
+
+			if ( result )
+			{
+				result = header.getSubChunk( chunk );
+				checkError( result, cuT( "Couldn't retrieve subchunk." ) );
+			}
+
+			if ( result )
+			{
+				result = parse( obj, chunk );
+				checkError( result, cuT( "Couldn't parse chunk." ) );
+			}
+
+			return result;
+		}
+
 	protected:
 		bool doIsLittleEndian()const noexcept
 		{
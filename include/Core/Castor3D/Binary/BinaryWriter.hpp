@@ -19,17 +19,21 @@ namespace castor3d
 		 *\brief			Writes an object to a file.
 		 *\param[in]		obj		The object to write.
 		 *\param[in,out]	file	The file.
+		 *\param[in]		options	The compression and encoding options.
 		 *\return			\p false if any error occured.
 		 *\~french
 		 *\brief			Fonction d'écriture dans un fichier.
 		 *\param[in]		obj		L'objet à écrire.
 		 *\param[in,out]	file	Le fichier.
+		 *\param[in]		options	Les options de compression et d'encodage.
 		 *\return			\p false si une erreur quelconque est arrivée.
 		 */
 		inline bool write( TWritten const & obj
-			, castor::BinaryFile & file )
+			, castor::BinaryFile & file
+			, CmshWriteOptions const & options = {} )
 		{
-			BinaryChunk chunk{ ChunkType::eCmshFile };
+			BinaryChunk chunk{ ChunkType::eCmshFileV2 };
+			chunk.setWriteOptions( options );
 			bool result = doWriteHeader( chunk );
 
 			if ( result )
@@ -59,6 +63,8 @@ namespace castor3d
 		inline bool write( TWritten const & obj
 			, BinaryChunk & chunk )
 		{
+			// The options are given from parent to child chunks.
+			m_chunk.setWriteOptions( chunk.getWriteOptions() );
 			bool result{ doWrite( obj ) };
 
 			if ( result )
@@ -84,6 +90,7 @@ namespace castor3d
 		inline bool doWriteHeader( BinaryChunk & chunk )const
 		{
 			BinaryChunk schunk{ ChunkType::eCmshHeader };
+			schunk.setWriteOptions( chunk.getWriteOptions() );
 			bool result = doWriteChunk( CurrentCmshVersion, ChunkType::eCmshVersion, schunk );
 
 			if ( result )
@@ -31,11 +31,11 @@ namespace castor3d
 			, size_t size
 			, BinaryChunk & chunk )
 		{
-			bool result = chunk.checkAvailable( uint32_t( size ) );
+			bool result = chunk.checkAvailable( uint64_t( size ) );
 
 			if ( result )
 			{
-				chunk.get( values, uint32_t( size ) );
+				chunk.get( values, uint64_t( size ) );
 			}
 
 			return result;
@@ -135,7 +135,7 @@ namespace castor3d
 			, BinaryChunk & chunk )
 		{
 			bool result = chunk.checkAvailable( 1 );
-			uint32_t size = chunk.getRemaining();
+			auto size = size_t( chunk.getRemaining() );
 
 			if ( result )
 			{
@@ -180,7 +180,7 @@ namespace castor3d
 			, BinaryChunk & chunk )
 		{
 			bool result = chunk.checkAvailable( 1 );
-			uint32_t size = chunk.getRemaining();
+			auto size = size_t( chunk.getRemaining() );
 
 			if ( result )
 			{
@@ -40,6 +40,7 @@ namespace castor3d
 			{
 				BinaryChunk schunk{ type };
 				schunk.setData( begin, end );
+				schunk.compress( chunk.getWriteOptions() );
 				result = chunk.addSubChunk( schunk );
 			}
 			catch ( ... )
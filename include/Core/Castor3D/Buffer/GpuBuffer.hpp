@@ -381,6 +381,18 @@ namespace castor3d
 		{
 			return *m_buffer;
 		}
+		/**
+		*\~english
+		*\return
+		*	The allocator.
+		*\~french
+		*\return
+		*	L'allocateur.
+		*/
+		AllocatorT const & getAllocator()const noexcept
+		{
+			return m_allocator;
+		}
 
 	private:
 		RenderDevice const & m_device;
@@ -6,7 +6,7 @@ See LICENSE file in root folder
 
 #include "BufferModule.hpp"
 
-#include <vector>
+#include <CastorUtils/Pool/TlsfAllocator.hpp>
 
 namespace castor3d
 {
@@ -27,10 +27,12 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Allocates memory.
+		 *\remarks		Constant time, the chunk is taken from the best fitting free list.
 		 *\param[in]	size	The requested memory size.
 		 *\return		The memory chunk.
 		 *\~french
 		 *\brief		Alloue de la mémoire.
+		 *\remarks		En temps constant, la zone est prise dans la liste libre la plus adaptée.
 		 *\param[in]	size	La taille requiese pour la mémoire.
 		 *\return		La zone mémoire.
 		 */
@@ -38,9 +40,11 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Deallocates memory.
+		 *\remarks		The chunk is immediately merged with its free neighbours.
 		 *\param[in]	pointer	The memory chunk.
 		 *\~french
 		 *\brief		Désalloue de la mémoire.
+		 *\remarks		La zone est immédiatement fusionnée avec ses voisines libres.
 		 *\param[in]	pointer	La zone mémoire.
 		 */
 		C3D_API void deallocate( VkDeviceSize pointer );
@@ -72,23 +76,23 @@ namespace castor3d
 		 */
 		bool hasAvailable( size_t size )const
 		{
-			return size <= m_allocatedSize
-				&& m_allocatedSize - size >= m_currentAllocated;
+			return m_allocator.hasAvailable( size );
+		}
+		/**
+		 *\~english
+		 *\return		The allocation and fragmentation statistics.
+		 *\~french
+		 *\return		Les statistiques d'allocation et de fragmentation.
+		 */
+		castor::TlsfStatistics getStatistics()const
+		{
+			return m_allocator.getStatistics();
 		}
 
 	private:
 		size_t m_allocatedSize{};
 		size_t m_alignSize{};
-		struct MemChunkCompare
-		{
-			bool operator()( MemChunk const & lhs, MemChunk const & rhs )const
-			{
-				return lhs.offset < rhs.offset;
-			}
-		};
-		castor::Set< MemChunk, MemChunkCompare > m_allocated;
-		castor::Vector< MemChunk > m_deallocated;
-		VkDeviceSize m_currentAllocated{};
+		castor::TlsfAllocator m_allocator;
 	};
 }
 
@@ -145,7 +145,9 @@ namespace castor3d
 
 		size_t hash{};
 		castor::Array< GpuBufferChunk, size_t( SubmeshData::eCount ) > buffers{};
-		uint16_t id{};
+		//!\~english	The size of one vertex in the per vertex attributes buffers (smaller when the vertices are packed).
+		//!\~french	La taille d'un sommet dans les buffers d'attributs par sommet (plus petite quand les sommets sont compactés).
+		uint32_t vertexStride{ sizeof( castor::Point4f ) };
 
 		explicit operator bool()const
 		{
@@ -162,11 +164,6 @@ namespace castor3d
 			return buffers[uint32_t( data )];
 		}
 
-		uint16_t getID()const
-		{
-			return id;
-		}
-
 		void reset()
 		{
 			for ( auto & buffer : buffers )
@@ -213,10 +210,14 @@ namespace castor3d
 			return getFirst< IndexT >( SubmeshData::eIndex );
 		}
 
-		template< typename PositionT >
 		uint32_t getFirstVertex()const
 		{
-			return getFirst< PositionT >( SubmeshData::ePositions );
+			return uint32_t( getOffset( SubmeshData::ePositions ) / vertexStride );
+		}
+
+		uint32_t getVertexCount()const
+		{
+			return getAskedSize( SubmeshData::ePositions ) / vertexStride;
 		}
 
 		void setBufferChunkSize( SubmeshData data, uint32_t size )
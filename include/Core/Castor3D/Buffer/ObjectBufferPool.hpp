@@ -10,6 +10,7 @@ See LICENSE file in root folder
 
 #include <CastorUtils/Design/OwnedBy.hpp>
 
+#include <atomic>
 #include <unordered_map>
 
 namespace castor3d
@@ -163,9 +164,37 @@ namespace castor3d
 			}
 
 			castor::Array< GpuPackedBaseBufferUPtr, size_t( SubmeshData::eCount ) > buffers;
+			//!\~english	The number of relocatable allocations in these buffers.
+			//!\~french		Le nombre d'allocations déplaçables dans ces buffers.
+			uint32_t relocatable{};
+			//!\~english	Tells if these buffers are being emptied by the compaction (no allocation is made in them, then).
+			//!\~french		Dit si ces buffers sont en train d'être vidés par le compactage (aucune allocation n'y est alors faite).
+			bool evacuating{};
+			//!\~english	The number of compaction passes these buffers have been empty.
+			//!\~french		Le nombre de passes de compactage pendant lesquelles ces buffers ont été vides.
+			uint32_t emptyPasses{};
 		};
 		using BufferArray = castor::Vector< ModelBuffers >;
 
+		struct CompactionStats
+		{
+			//!\~english	The size of the ranges moved by the last compaction pass, in bytes.
+			//!\~french		La taille des intervalles déplacés par la dernière passe de compactage, en octets.
+			VkDeviceSize movedSize{};
+			//!\~english	The number of ranges moved by the last compaction pass.
+			//!\~french		Le nombre d'intervalles déplacés par la dernière passe de compactage.
+			uint32_t movedCount{};
+			//!\~english	The size of the moved ranges given back to their buffers by the last compaction pass, in bytes.
+			//!\~french		La taille des intervalles déplacés rendus à leurs buffers par la dernière passe de compactage, en octets.
+			VkDeviceSize freedSize{};
+			//!\~english	The size of the buffers released by the last compaction pass, in bytes.
+			//!\~french		La taille des buffers libérés par la dernière passe de compactage, en octets.
+			VkDeviceSize releasedSize{};
+			//!\~english	The number of buffers released by the last compaction pass.
+			//!\~french		Le nombre de buffers libérés par la dernière passe de compactage.
+			uint32_t releasedBuffers{};
+		};
+
 	public:
 		/**
 		 *\~english
@@ -250,8 +279,83 @@ namespace castor3d
 		 *\param[in]	bufferOffset	Le tampon à libérer.
 		 */
 		C3D_API void putBuffer( ObjectBufferOffset const & bufferOffset )noexcept;
+		/**
+		 *\~english
+		 *\brief		Allows the compaction to move the given buffer offset.
+		 *\remarks		The offset must stay alive until unregisterRelocatable is called.
+		 *\param[in]	bufferOffset	The buffer offset, patched in place when moved.
+		 *\param[in]	onMoved			The callback called after the offset has been moved.
+		 *\~french
+		 *\brief		Permet au compactage de déplacer le décalage de tampon donné.
+		 *\remarks		Le décalage doit rester vivant jusqu'à l'appel à unregisterRelocatable.
+		 *\param[in]	bufferOffset	Le décalage de tampon, mis à jour sur place lorsqu'il est déplacé.
+		 *\param[in]	onMoved			Le callback appelé une fois que le décalage a été déplacé.
+		 */
+		C3D_API void registerRelocatable( ObjectBufferOffset & bufferOffset
+			, castor::Function< void() > onMoved );
+		/**
+		 *\~english
+		 *\brief		Prevents the compaction from moving the given buffer offset.
+		 *\remarks		Must be called before putBuffer, for registered offsets.
+		 *\param[in]	bufferOffset	The buffer offset.
+		 *\~french
+		 *\brief		Empêche le compactage de déplacer le décalage de tampon donné.
+		 *\remarks		Doit être appelée avant putBuffer, pour les décalages enregistrés.
+		 *\param[in]	bufferOffset	Le décalage de tampon.
+		 */
+		C3D_API void unregisterRelocatable( ObjectBufferOffset const & bufferOffset )noexcept;
+		/**
+		 *\~english
+		 *\brief		Runs an incremental compaction pass.
+		 *\remarks		Sparsely used buffers which only hold relocatable ranges are emptied into the other buffers
+		 *				of the same layout, using GPU copies, and released once empty.
+		 *				<br />Moved ranges are kept allocated a few frames, to let the users update their references.
+		 *\param[in]	uploader		Receives the buffer to buffer copies.
+		 *\param[in]	maxMovedSize	The maximum size moved by this pass.
+		 *\~french
+		 *\brief		Lance une passe incrémentale de compactage.
+		 *\remarks		Les buffers peu utilisés qui ne contiennent que des intervalles déplaçables sont vidés dans les autres buffers
+		 *				de même disposition, via des copies GPU, et libérés une fois vides.
+		 *				<br />Les intervalles déplacés restent alloués quelques frames, pour laisser les utilisateurs mettre à jour leurs références.
+		 *\param[in]	uploader		Reçoit les copies de tampon à tampon.
+		 *\param[in]	maxMovedSize	La taille maximale déplacée par cette passe.
+		 */
+		C3D_API void compact( UploadData & uploader
+			, VkDeviceSize maxMovedSize );
+		/**
+		 *\~english
+		 *\return		The compaction statistics.
+		 *\~french
+		 *\return		Les statistiques de compactage.
+		 */
+		CompactionStats const & getCompactionStats()const noexcept
+		{
+			return m_compactionStats;
+		}
+		/**
+		 *\~english
+		 *\return		The pool generation, incremented each time ranges are moved or buffers are released.
+		 *\~french
+		 *\return		La génération du pool, incrémentée à chaque fois que des intervalles sont déplacés ou que des buffers sont libérés.
+		 */
+		uint32_t getGeneration()const noexcept
+		{
+			return m_generation;
+		}
 
 	private:
+		struct Relocatable
+		{
+			ObjectBufferOffset * bufferOffset;
+			castor::Function< void() > onMoved;
+		};
+
+		struct PendingRelease
+		{
+			ObjectBufferOffset bufferOffset;
+			uint32_t delay;
+		};
+
 		C3D_API ObjectBufferOffset doGetBuffer( VkDeviceSize vertexCount
 			, VkDeviceSize indexCount
 			, VkDeviceSize meshletCount
@@ -260,13 +364,29 @@ namespace castor3d
 		C3D_API BufferArray::iterator doFindBuffer( VkDeviceSize vertexCount
 			, VkDeviceSize indexCount
 			, VkDeviceSize meshletCount
+			, bool packed
+			, BufferArray & array )const;
+		C3D_API BufferArray::iterator doFindBuffers( ObjectBufferOffset const & bufferOffset
 			, BufferArray & array )const;
+		C3D_API void doPutBuffer( ObjectBufferOffset const & bufferOffset )noexcept;
+		C3D_API void doProcessPendingReleases();
+		C3D_API void doReleaseEmptyBuffers();
+		C3D_API bool doSelectEvacuated();
+		C3D_API bool doMove( ObjectBufferOffset & bufferOffset
+			, BufferArray & array
+			, BufferArray::iterator source
+			, UploadData & uploader );
 
 	private:
 		RenderDevice const & m_device;
 		castor::String m_debugName;
 		castor::UnorderedMap< size_t, BufferArray > m_buffers;
 		castor::UnorderedMap< ashes::BufferBase const * , ashes::BufferBase const * > m_indexBuffers;
+		castor::Mutex m_mutex;
+		castor::UnorderedMap< ObjectBufferOffset const *, Relocatable > m_relocatables;
+		castor::Vector< PendingRelease > m_pendingReleases;
+		CompactionStats m_compactionStats;
+		std::atomic< uint32_t > m_generation{};
 	};
 }
 
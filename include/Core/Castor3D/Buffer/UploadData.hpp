@@ -42,6 +42,73 @@ namespace castor3d
 			, VkImageSubresourceRange dstRange
 			, VkImageLayout dstImageLayout
 			, VkPipelineStageFlags dstPipelineFlags );
+		/**
+		 *\~english
+		 *\brief		Registers an upload to a region of an image.
+		 *\remarks		Only the first mip level and layer of \p dstRange are updated.
+		 *				The image must already be in \p dstImageLayout, its content outside of the region is kept.
+		 *\param[in]	srcData				The source data, starting at the region's first texel.
+		 *\param[in]	srcSize				The source data size.
+		 *\param[in]	srcRowLength		The source data row length, in texels.
+		 *\param[in]	dstImage			The destination image.
+		 *\param[in]	dstLayout			The destination image layout.
+		 *\param[in]	dstRange			The destination subresource range.
+		 *\param[in]	dstOffset			The region offset, in texels.
+		 *\param[in]	dstExtent			The region dimensions, in texels.
+		 *\param[in]	dstImageLayout		The destination image layout, before and after the upload.
+		 *\param[in]	dstPipelineFlags	The destination pipeline stage flags, before and after the upload.
+		 *\~french
+		 *\brief		Enregistre un upload vers une région d'une image.
+		 *\remarks		Seuls le premier niveau de mip et la première couche de \p dstRange sont mis à jour.
+		 *				L'image doit déjà être dans \p dstImageLayout, son contenu hors de la région est conservé.
+		 *\param[in]	srcData				Les données source, commençant au premier texel de la région.
+		 *\param[in]	srcSize				La taille des données source.
+		 *\param[in]	srcRowLength		La longueur d'une ligne des données source, en texels.
+		 *\param[in]	dstImage			L'image destination.
+		 *\param[in]	dstLayout			Le layout de l'image destination.
+		 *\param[in]	dstRange			L'intervalle de sous-ressources destination.
+		 *\param[in]	dstOffset			La position de la région, en texels.
+		 *\param[in]	dstExtent			Les dimensions de la région, en texels.
+		 *\param[in]	dstImageLayout		Le layout de l'image destination, avant et après l'upload.
+		 *\param[in]	dstPipelineFlags	Les flags d'étape de pipeline de la destination, avant et après l'upload.
+		 */
+		C3D_API void pushUpload( void const * srcData
+			, VkDeviceSize srcSize
+			, uint32_t srcRowLength
+			, ashes::Image const & dstImage
+			, castor::ImageLayout dstLayout
+			, VkImageSubresourceRange dstRange
+			, VkOffset3D dstOffset
+			, VkExtent3D dstExtent
+			, VkImageLayout dstImageLayout
+			, VkPipelineStageFlags dstPipelineFlags );
+		/**
+		 *\~english
+		 *\brief		Registers a GPU buffer to GPU buffer copy, recorded before the uploads.
+		 *\param[in]	srcBuffer			The source buffer.
+		 *\param[in]	srcOffset			The offset in the source buffer.
+		 *\param[in]	srcSize				The copied size.
+		 *\param[in]	dstBuffer			The destination buffer.
+		 *\param[in]	dstOffset			The offset in the destination buffer.
+		 *\param[in]	dstAccessFlags		The destination access flags, after the copy.
+		 *\param[in]	dstPipelineFlags	The destination pipeline stage flags, after the copy.
+		 *\~french
+		 *\brief		Enregistre une copie de tampon GPU à tampon GPU, enregistrée avant les uploads.
+		 *\param[in]	srcBuffer			Le tampon source.
+		 *\param[in]	srcOffset			Le décalage dans le tampon source.
+		 *\param[in]	srcSize				La taille copiée.
+		 *\param[in]	dstBuffer			Le tampon destination.
+		 *\param[in]	dstOffset			Le décalage dans le tampon destination.
+		 *\param[in]	dstAccessFlags		Les flags d'accès de la destination, après la copie.
+		 *\param[in]	dstPipelineFlags	Les flags d'étape de pipeline de la destination, après la copie.
+		 */
+		C3D_API void pushCopy( ashes::BufferBase const & srcBuffer
+			, VkDeviceSize srcOffset
+			, VkDeviceSize srcSize
+			, ashes::BufferBase const & dstBuffer
+			, VkDeviceSize dstOffset
+			, VkAccessFlags dstAccessFlags
+			, VkPipelineStageFlags dstPipelineFlags );
 		C3D_API void process();
 		C3D_API SemaphoreUsed end( ashes::Queue const & queue
 			, ashes::Fence const * fence = nullptr
@@ -133,6 +200,17 @@ namespace castor3d
 			VkPipelineStageFlags dstPipelineFlags{};
 		};
 
+		struct BufferCopyRange
+		{
+			ashes::BufferBase const * srcBuffer{};
+			VkDeviceSize srcOffset{};
+			VkDeviceSize srcSize{};
+			ashes::BufferBase const * dstBuffer{};
+			VkDeviceSize dstOffset{};
+			VkAccessFlags dstAccessFlags{};
+			VkPipelineStageFlags dstPipelineFlags{};
+		};
+
 		struct ImageDataRange
 		{
 			void const * srcData{};
@@ -142,6 +220,10 @@ namespace castor3d
 			VkImageSubresourceRange dstRange{};
 			VkImageLayout dstImageLayout{};
 			VkPipelineStageFlags dstPipelineFlags{};
+			// Set for region uploads only.
+			uint32_t srcRowLength{};
+			VkOffset3D dstOffset{};
+			VkExtent3D dstExtent{};
 		};
 
 		C3D_API UploadData( RenderDevice const & device
@@ -155,6 +237,7 @@ namespace castor3d
 		C3D_API void doUploadBuffer( BufferDataRange const & data
 			, ashes::BufferBase const * srcBuffer
 			, VkDeviceSize srcOffset )const;
+		C3D_API void doCopyBuffer( BufferCopyRange const & data )const;
 		C3D_API void doUploadImage( ImageDataRange & data
 			, ashes::BufferBase const & srcBuffer
 			, VkDeviceSize srcOffset )const;
@@ -163,6 +246,7 @@ namespace castor3d
 		castor::String m_debugName;
 		ashes::CommandBuffer const * m_commandBuffer;
 		castor::Vector< BufferDataRange > m_pendingBuffers;
+		castor::Vector< BufferCopyRange > m_pendingCopies;
 		castor::Vector< ImageDataRange > m_pendingImages;
 
 	private:
@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Castor3D/Cache/ObjectCache.hpp"
 #include "Castor3D/Scene/SceneModule.hpp"
+#include "Castor3D/Scene/SceneNodeTransforms.hpp"
 
 namespace castor3d
 {
@@ -83,6 +84,16 @@ namespace castor3d
 		 *\return		L'élément réel (ajouté, ou original du doublon).
 		 */
 		C3D_API ElementObsT add( ElementKeyT const & name );
+		/**
+		 *\~english
+		 *\return		The nodes transforms.
+		 *\~french
+		 *\return		Les transformations des noeuds.
+		 */
+		SceneNodeTransforms & getTransforms()noexcept
+		{
+			return m_transforms;
+		}
 
 	private:
 		void doReparentNode( SceneNode & node );
@@ -95,6 +106,7 @@ namespace castor3d
 	private:
 		castor::Vector< SceneNode * > m_linearNodes;
 		castor::Map< SceneNode * , OnSceneNodeReparentConnection > m_connections;
+		SceneNodeTransforms m_transforms;
 	};
 }
 
@@ -8,6 +8,10 @@ See LICENSE file in root folder
 #include "Castor3D/Render/RenderModule.hpp"
 #include "Castor3D/Shader/ShaderModule.hpp"
 
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
+#include <exception>
+
 namespace castor3d
 {
 	class ShaderProgramCache
@@ -61,6 +65,31 @@ namespace castor3d
 		 */
 		C3D_API ShaderProgramRPtr getAutomaticProgram( RenderNodesPass const & renderPass
 			, PipelineFlags const & flags );
+		/**
+		 *\~english
+		 *\brief		Looks for an automatically generated program corresponding to given flags, without waiting for it.
+		 *\remarks		If none exists, its generation and compilation are queued on the engine's CPU jobs.
+		 *\param[in]	renderPass	The pass from which the program code is retrieved.
+		 *\param[in]	flags		The pipeline flags.
+		 *\return		The program, \p nullptr if it is not ready yet.
+		 *\~french
+		 *\brief		Cherche un programme automatiquement généré correspondant aux flags donnés, sans l'attendre.
+		 *\remarks		S'il n'existe pas, sa génération et sa compilation sont mises en file sur les tâches CPU du moteur.
+		 *\param[in]	renderPass	La passe a partir de laquelle est récupéré le code du programme.
+		 *\param[in]	flags		Les flags de pipeline.
+		 *\return		Le programme, \p nullptr s'il n'est pas encore prêt.
+		 */
+		C3D_API ShaderProgramRPtr tryGetAutomaticProgram( RenderNodesPass const & renderPass
+			, PipelineFlags const & flags );
+		/**
+		 *\~english
+		 *\brief		Waits for the programs being generated for given render pass.
+		 *\param[in]	renderPass	The render pass.
+		 *\~french
+		 *\brief		Attend les programmes en cours de génération pour la passe de rendu donnée.
+		 *\param[in]	renderPass	La passe de rendu.
+		 */
+		C3D_API void waitAutomaticPrograms( RenderNodesPass const & renderPass );
 		/**
 		 *\~english
 		 *\brief		Locks the collection mutex
@@ -131,13 +160,21 @@ namespace castor3d
 		}
 
 	private:
-		ShaderProgramRPtr doFindAutomaticProgram( RenderNodesPass const & renderPass
+		struct ProgramBuild
+		{
+			RenderNodesPass const * renderPass{};
+			castor::JobHandle job;
+			ShaderProgramRPtr program{};
+			std::exception_ptr error;
+		};
+		using ProgramBuildPtr = castor::RawUniquePtr< ProgramBuild >;
+
+		ProgramBuild & doGetAutomaticProgram( RenderNodesPass const & renderPass
+			, PipelineFlags const & flags );
+		ProgramBuild * doFindAutomaticProgram( RenderNodesPass const & renderPass
 			, PipelineFlags const & flags );
 		ShaderProgramUPtr doCreateAutomaticProgram( RenderNodesPass const & renderPass
 			, PipelineFlags const & flags )const;
-		void doAddAutomaticProgram( ShaderProgramUPtr program
-			, RenderNodesPass const & renderPass
-			, PipelineFlags const & flags );
 		void doAddProgram( ShaderProgramUPtr program );
 
 	private:
@@ -146,18 +183,20 @@ namespace castor3d
 			AutoGeneratedProgram( PipelineFlags flags
 				, DeferredLightingFilter deferredLightingFilter
 				, ParallaxOcclusionFilter parallaxOcclusionFilter
-				, ShaderProgramRPtr program )noexcept
+				, ProgramBuildPtr build )noexcept
 				: flags{ castor::move( flags ) }
 				, deferredLightingFilter{ deferredLightingFilter }
 				, parallaxOcclusionFilter{ parallaxOcclusionFilter }
-				, program{ program }
+				, build{ castor::move( build ) }
 			{
 			}
 
 			PipelineFlags flags;
 			DeferredLightingFilter deferredLightingFilter;
 			ParallaxOcclusionFilter parallaxOcclusionFilter;
-			ShaderProgramRPtr program;
+			//!\~english	The build state, kept behind a pointer so that running jobs can reference it.
+			//!\~french		L'état de construction, gardé derrière un pointeur pour que les tâches en cours puissent le référencer.
+			ProgramBuildPtr build;
 		};
 		using ShaderProgramCont = castor::Vector< AutoGeneratedProgram >;
 
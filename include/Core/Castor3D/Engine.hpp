@@ -49,6 +49,7 @@ See LICENSE file in root folder
 #include <CastorUtils/Math/Length.hpp>
 #include <CastorUtils/Miscellaneous/CpuInformations.hpp>
 #include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
+#include <CastorUtils/Multithreading/JobSystem.hpp>
 
 #include <ashespp/Core/RendererList.hpp>
 
@@ -140,6 +141,36 @@ namespace castor3d
 		*	\p true pour activer la visualisation des debug targets.
 		*/
 		bool enableDebugTargets{ false };
+		/**
+		*\~english
+		*	\p true to keep the loaded images (decoded, mipmapped and compressed) in a disk cache, to speed up the next loads.
+		*\~french
+		*	\p true pour garder les images chargées (décodées, mipmappées et compressées) dans un cache disque, pour accélérer les chargements suivants.
+		*/
+		bool enableImageDiskCache{ true };
+		/**
+		*\~english
+		*	\p true to keep the SPIR-V binaries generated from the shaders in a disk cache, to skip their compilation on the next runs.
+		*\~french
+		*	\p true pour garder les binaires SPIR-V générés à partir des shaders dans un cache disque, pour éviter leur compilation lors des lancements suivants.
+		*/
+		bool enableSpirVDiskCache{ true };
+		/**
+		*\~english
+		*	\p true to save the Vulkan pipeline cache on disk, and to reload it on the next runs.
+		*\~french
+		*	\p true pour sauvegarder le cache de pipelines Vulkan sur disque, et le recharger lors des lancements suivants.
+		*/
+		bool enablePipelineDiskCache{ true };
+		/**
+		*\~english
+		*	\p true to generate and compile the render passes programs on the CPU jobs.
+		*	The nodes using a program that is not ready yet are not drawn.
+		*\~french
+		*	\p true pour générer et compiler les programmes des passes de rendu sur les tâches CPU.
+		*	Les noeuds utilisant un programme pas encore prêt ne sont pas dessinés.
+		*/
+		bool enableAsyncShaderCompilation{ true };
 	};
 
 	class Engine
@@ -821,6 +852,21 @@ namespace castor3d
 		{
 			return m_config.enableDebugTargets;
 		}
+
+		bool isSpirVDiskCacheEnabled()const noexcept
+		{
+			return m_config.enableSpirVDiskCache;
+		}
+
+		bool isPipelineDiskCacheEnabled()const noexcept
+		{
+			return m_config.enablePipelineDiskCache;
+		}
+
+		bool isAsyncShaderCompilationEnabled()const noexcept
+		{
+			return m_config.enableAsyncShaderCompilation;
+		}
 		
 		castor::ImageCache const & getImageCache()const noexcept
 		{
@@ -912,6 +958,16 @@ namespace castor3d
 			return m_cpuInformations;
 		}
 
+		castor::JobSystem & getFrameJobs()noexcept
+		{
+			return m_frameJobs;
+		}
+
+		castor::JobSystem & getCpuJobs()noexcept
+		{
+			return m_cpuJobs.getJobSystem();
+		}
+
 		LightingModelID getDefaultLightingModel()const noexcept
 		{
 			return m_lightingModelId;
@@ -1246,6 +1302,7 @@ namespace castor3d
 		uint32_t m_lpvGridSize{ 32u };
 		uint32_t m_maxImageSize{ 0xFFFFFFFF };
 		castor::AsyncJobQueue m_cpuJobs;
+		castor::JobSystem m_frameJobs;
 		crg::ResourceHandler m_resourceHandler;
 		crg::ResourcesCache m_resources;
 		LightingModelFactoryUPtr m_lightingModelFactory;
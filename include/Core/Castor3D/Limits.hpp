@@ -37,6 +37,12 @@ namespace castor3d
 	//@{
 	// Base count for objects buffers pool
 	static uint32_t constexpr BaseObjectPoolBufferCount = 1'048'576u;
+	// Objects buffers pool compaction: maximum size moved per frame.
+	static uint64_t constexpr MaxObjectPoolCompactionSize = 4'194'304ULL;
+	// Objects buffers pool compaction: buffers used below this ratio are emptied.
+	static float constexpr ObjectPoolCompactionThreshold = 0.5f;
+	// Objects buffers pool compaction: frames count before a moved range or an empty buffer is released.
+	static uint32_t constexpr ObjectPoolReleaseDelay = 4u;
 	// Maximum pipelines count.
 	static uint64_t constexpr MaxPipelines = 2'048ULL;
 	// Maximum Nodes ID per pipeline.
@@ -17,12 +17,12 @@ namespace castor3d
 	C3D_API void uploadBaseData( SubmeshData submeshData
 		, Submesh const & submesh
 		, castor::Point4fArray const & data
-		, castor::Point4fArray & up
+		, castor::ByteArray & up
 		, UploadData & uploader );
 	C3D_API void uploadBaseData( SubmeshData submeshData
 		, Submesh const & submesh
 		, castor::Point3fArray const & data
-		, castor::Point4fArray & up
+		, castor::ByteArray & up
 		, UploadData & uploader );
 	C3D_API void gatherBaseDataBuffer( SubmeshData submeshData
 		, ObjectBufferOffset const & bufferOffsets
@@ -131,7 +131,7 @@ namespace castor3d
 
 		private:
 			castor::Vector< DataT > m_data;
-			castor::Point4fArray m_up;
+			castor::ByteArray m_up;
 			castor::UnorderedMap< size_t, ashes::PipelineVertexInputStateCreateInfo > m_layouts;
 		};
 
@@ -46,6 +46,7 @@ namespace castor3d
 		bool hasMorphFlag{};
 		bool hasPassMaskFlag{};
 		bool hasVelocityFlag{};
+		bool hasPackedVerticesFlag{};
 		bool hasRenderFlag{};
 	};
 
@@ -93,6 +94,13 @@ namespace castor3d
 	class PassMasksComponent;
 	/**
 	\~english
+	\brief		Submesh component telling the vertex attributes are stored in compact formats.
+	\~french
+	\brief		Composant de sous-maillage indiquant que les attributs de sommets sont stockés dans des formats compacts.
+	*/
+	class PackedVerticesComponent;
+	/**
+	\~english
 	\brief		The submesh component used for skinning.
 	\~french
 	\brief		Le composant de sous-maillage pour le skinning.
@@ -158,6 +166,20 @@ namespace castor3d
 	class LinesMapping;
 	/**
 	\~english
+	\brief		A simplified version of a submesh's triangles.
+	\~french
+	\brief		Une version simplifiée des triangles d'un sous-maillage.
+	*/
+	struct SubmeshLod;
+	/**
+	\~english
+	\brief		The submesh component holding the levels of detail.
+	\~french
+	\brief		Le composant de sous-maillage contenant les niveaux de détail.
+	*/
+	class LodComponent;
+	/**
+	\~english
 	\brief		The submesh component used for meshlets.
 	\~french
 	\brief		Le composant de sous-maillage pour les meshlets.
@@ -287,8 +309,10 @@ namespace castor3d
 	CU_DeclareSmartPtr( castor3d, IndexMapping, C3D_API );
 	CU_DeclareSmartPtr( castor3d, InstantiationComponent, C3D_API );
 	CU_DeclareSmartPtr( castor3d, LinesMapping, C3D_API );
+	CU_DeclareSmartPtr( castor3d, LodComponent, C3D_API );
 	CU_DeclareSmartPtr( castor3d, MeshletComponent, C3D_API );
 	CU_DeclareSmartPtr( castor3d, MorphComponent, C3D_API );
+	CU_DeclareSmartPtr( castor3d, PackedVerticesComponent, C3D_API );
 	CU_DeclareSmartPtr( castor3d, PassMasksComponent, C3D_API );
 	CU_DeclareSmartPtr( castor3d, SkinComponent, C3D_API );
 	CU_DeclareSmartPtr( castor3d, SubmeshComponent, C3D_API );
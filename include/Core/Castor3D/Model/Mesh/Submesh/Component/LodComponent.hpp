@@ -0,0 +1,189 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_LodComponent_H___
+#define ___C3D_LodComponent_H___
+
+#include "SubmeshComponent.hpp"
+#include "Castor3D/Binary/BinaryModule.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/Face.hpp"
+
+namespace castor3d
+{
+	struct SubmeshLod
+	{
+		/**
+		 *\~english
+		 *\return		The indices count for this level.
+		 *\~french
+		 *\return		Le nombre d'indices pour ce niveau.
+		 */
+		uint32_t getIndexCount()const noexcept
+		{
+			return uint32_t( faces.size() * 3u );
+		}
+
+		//!\~english	The simplified triangles, using the submesh vertices.
+		//!\~french		Les triangles simplifiés, utilisant les sommets du sous-maillage.
+		FaceArray faces;
+		//!\~english	The simplification error, relative to the submesh extent.
+		//!\~french		L'erreur de simplification, relative à l'étendue du sous-maillage.
+		float error{};
+	};
+
+	class LodComponent
+		: public SubmeshComponent
+	{
+	public:
+		struct ComponentData
+			: public SubmeshComponentData
+		{
+			using SubmeshComponentData::SubmeshComponentData;
+			/**
+			 *\copydoc		castor3d::SubmeshComponentData::gather
+			 */
+			void gather( PipelineFlags const & flags
+				, Pass const & pass
+				, ObjectBufferOffset const & bufferOffsets
+				, ashes::BufferCRefArray & buffers
+				, castor::Vector< uint64_t > & offsets
+				, ashes::PipelineVertexInputStateCreateInfoCRefArray & layouts
+				, uint32_t & currentBinding
+				, uint32_t & currentLocation )override
+			{
+			}
+			/**
+			 *\copydoc		castor3d::SubmeshComponentData::copy
+			 */
+			void copy( SubmeshComponentDataRPtr data )const override;
+			/**
+			 *\~english
+			 *\return		The indices count for all the levels, the submesh one excluded.
+			 *\~french
+			 *\return		Le nombre d'indices pour tous les niveaux, hormis celui du sous-maillage.
+			 */
+			C3D_API uint32_t getIndexCount()const noexcept;
+			/**
+			 *\~english
+			 *\param[in]	level	The level of detail, 0 being the submesh itself.
+			 *\return		The indices count for given level.
+			 *\~french
+			 *\param[in]	level	Le niveau de détail, 0 étant le sous-maillage lui-même.
+			 *\return		Le nombre d'indices pour le niveau donné.
+			 */
+			C3D_API uint32_t getIndexCount( uint32_t level )const noexcept;
+			/**
+			 *\~english
+			 *\param[in]	level	The level of detail, 0 being the submesh itself.
+			 *\return		The first index of given level, relative to the submesh indices.
+			 *\~french
+			 *\param[in]	level	Le niveau de détail, 0 étant le sous-maillage lui-même.
+			 *\return		Le premier indice du niveau donné, relatif aux indices du sous-maillage.
+			 */
+			C3D_API uint32_t getFirstIndex( uint32_t level )const noexcept;
+			/**
+			 *\~english
+			 *\brief		Selects the coarsest level whose error stays under the pixel error threshold.
+			 *\param[in]	pixelRadius	The submesh bounding sphere radius, projected on screen, in pixels.
+			 *\return		The level of detail, 0 being the submesh itself.
+			 *\~french
+			 *\brief		Sélectionne le niveau le plus grossier dont l'erreur reste sous le seuil d'erreur en pixels.
+			 *\param[in]	pixelRadius	Le rayon de la sphère englobante du sous-maillage, projeté à l'écran, en pixels.
+			 *\return		Le niveau de détail, 0 étant le sous-maillage lui-même.
+			 */
+			C3D_API uint32_t selectLevel( float pixelRadius )const noexcept;
+
+			bool hasData()const noexcept
+			{
+				return !m_lods.empty();
+			}
+
+			uint32_t getLevelsCount()const noexcept
+			{
+				return uint32_t( m_lods.size() );
+			}
+
+			castor::Vector< SubmeshLod > const & getLods()const noexcept
+			{
+				return m_lods;
+			}
+
+			castor::Vector< SubmeshLod > & getLods()noexcept
+			{
+				needsUpdate();
+				return m_lods;
+			}
+
+			float getPixelError()const noexcept
+			{
+				return m_pixelError;
+			}
+
+			void setPixelError( float value )noexcept
+			{
+				m_pixelError = value;
+			}
+
+		private:
+			bool doInitialise( RenderDevice const & device )override;
+			void doCleanup( RenderDevice const & device )override;
+			void doUpload( UploadData & uploader )override;
+
+		private:
+			castor::Vector< SubmeshLod > m_lods;
+			float m_pixelError{ 1.0f };
+		};
+
+		class Plugin
+			: public SubmeshComponentPlugin
+		{
+		public:
+			using SubmeshComponentPlugin::SubmeshComponentPlugin;
+
+			SubmeshComponentUPtr createComponent( Submesh & submesh )const override
+			{
+				return castor::makeUniqueDerived< SubmeshComponent, LodComponent >( submesh );
+			}
+		};
+
+		static SubmeshComponentPluginUPtr createPlugin( SubmeshComponentRegister const & submeshComponents )
+		{
+			return castor::makeUniqueDerived< SubmeshComponentPlugin, Plugin >( submeshComponents );
+		}
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	submesh	The parent submesh.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	submesh	Le sous-maillage parent.
+		 */
+		C3D_API explicit LodComponent( Submesh & submesh );
+		/**
+		 *\copydoc		castor3d::SubmeshComponent::clone
+		 */
+		C3D_API SubmeshComponentUPtr clone( Submesh & submesh )const override;
+		/**
+		 *\copydoc		castor3d::SubmeshComponent::getSubmeshFlags
+		 */
+		SubmeshComponentFlag getSubmeshFlags()const noexcept override
+		{
+			// The levels only live in the index buffer, the pipelines don't need to know about them.
+			return makeSubmeshComponentFlag( 0u );
+		}
+
+		ComponentData & getData()const noexcept
+		{
+			return *getDataT< ComponentData >();
+		}
+
+	public:
+		C3D_API static castor::String const TypeName;
+
+	private:
+		friend class BinaryWriter< LodComponent >;
+		friend class BinaryParser< LodComponent >;
+	};
+}
+
+#endif
@@ -0,0 +1,152 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_PackedVerticesComponent_H___
+#define ___C3D_PackedVerticesComponent_H___
+
+#include "SubmeshComponent.hpp"
+#include "Castor3D/Shader/Ubos/UbosModule.hpp"
+
+namespace castor3d
+{
+	/**
+	\~english
+	\brief		Tells that the submesh vertex attributes are stored in compact formats:
+	\remarks	<ul>
+				<li>Positions: 16 bits signed normalised, quantised in the submesh bounding box.</li>
+				<li>Normals, tangents and bitangents: 16 bits signed normalised, octahedral encoded.</li>
+				<li>Texture coordinates: 16 bits floats.</li>
+				<li>Colours: 8 bits unsigned normalised.</li>
+				</ul>
+	\~french
+	\brief		Indique que les attributs de sommets du sous-maillage sont stockés dans des formats compacts :
+	\remarks	<ul>
+				<li>Positions : 16 bits signés normalisés, quantifiés dans la boîte englobante du sous-maillage.</li>
+				<li>Normales, tangentes et bitangentes : 16 bits signés normalisés, en encodage octaédrique.</li>
+				<li>Coordonnées de texture : flottants 16 bits.</li>
+				<li>Couleurs : 8 bits non signés normalisés.</li>
+				</ul>
+	*/
+	class PackedVerticesComponent
+		: public SubmeshComponent
+	{
+	public:
+		struct ComponentData
+			: public SubmeshComponentData
+		{
+			using SubmeshComponentData::SubmeshComponentData;
+			/**
+			 *\copydoc		castor3d::SubmeshComponentData::gather
+			 */
+			void gather( PipelineFlags const & flags
+				, Pass const & pass
+				, ObjectBufferOffset const & bufferOffsets
+				, ashes::BufferCRefArray & buffers
+				, castor::Vector< uint64_t > & offsets
+				, ashes::PipelineVertexInputStateCreateInfoCRefArray & layouts
+				, uint32_t & currentBinding
+				, uint32_t & currentLocation )override
+			{
+			}
+			/**
+			 *\copydoc		castor3d::SubmeshComponentData::copy
+			 */
+			void copy( SubmeshComponentDataRPtr data )const override
+			{
+			}
+			/**
+			 *\~english
+			 *\return		The offset to apply to the unpacked positions (the submesh bounding box center).
+			 *\~french
+			 *\return		Le décalage à appliquer aux positions décompactées (le centre de la boîte englobante du sous-maillage).
+			 */
+			C3D_API castor::Point4f getPositionsOffset()const noexcept;
+			/**
+			 *\~english
+			 *\return		The scale to apply to the unpacked positions (the submesh bounding box half extent).
+			 *\~french
+			 *\return		L'échelle à appliquer aux positions décompactées (la demi étendue de la boîte englobante du sous-maillage).
+			 */
+			C3D_API castor::Point4f getPositionsScale()const noexcept;
+			/**
+			 *\~english
+			 *\brief		Fills the model data with the positions unpacking values.
+			 *\param[out]	modelData	Receives the values.
+			 *\~french
+			 *\brief		Remplit les données de modèle avec les valeurs de décompactage des positions.
+			 *\param[out]	modelData	Reçoit les valeurs.
+			 */
+			C3D_API void fillModelData( ModelBufferConfiguration & modelData )const noexcept;
+
+		private:
+			bool doInitialise( RenderDevice const & device )override
+			{
+				return true;
+			}
+
+			void doCleanup( RenderDevice const & device )override
+			{
+			}
+
+			void doUpload( UploadData & uploader )override
+			{
+			}
+		};
+
+		class Plugin
+			: public SubmeshComponentPlugin
+		{
+		public:
+			using SubmeshComponentPlugin::SubmeshComponentPlugin;
+
+			SubmeshComponentUPtr createComponent( Submesh & submesh )const override
+			{
+				return castor::makeUniqueDerived< SubmeshComponent, PackedVerticesComponent >( submesh );
+			}
+
+			SubmeshComponentFlag getPackedVerticesFlag()const noexcept override
+			{
+				return getComponentFlags();
+			}
+		};
+
+		static SubmeshComponentPluginUPtr createPlugin( SubmeshComponentRegister const & submeshComponents )
+		{
+			return castor::makeUniqueDerived< SubmeshComponentPlugin, Plugin >( submeshComponents );
+		}
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	submesh	The parent submesh.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	submesh	Le sous-maillage parent.
+		 */
+		C3D_API explicit PackedVerticesComponent( Submesh & submesh );
+		/**
+		 *\copydoc		castor3d::SubmeshComponent::clone
+		 */
+		C3D_API SubmeshComponentUPtr clone( Submesh & submesh )const override;
+		/**
+		 *\~english
+		 *\brief		Tells if the vertices of given submesh can be packed.
+		 *\remarks		The vertices read from storage buffers (GPU transformed submeshes, meshlets, visibility buffer) stay unpacked.
+		 *\param[in]	submesh	The submesh.
+		 *\~french
+		 *\brief		Dit si les sommets du sous-maillage donné peuvent être compactés.
+		 *\remarks		Les sommets lus depuis des storage buffers (sous-maillages transformés sur GPU, meshlets, visibility buffer) restent non compactés.
+		 *\param[in]	submesh	Le sous-maillage.
+		 */
+		C3D_API static bool canPackVertices( Submesh const & submesh );
+
+		ComponentData & getData()const noexcept
+		{
+			return *getDataT< ComponentData >();
+		}
+
+	public:
+		C3D_API static castor::String const TypeName;
+	};
+}
+
+#endif
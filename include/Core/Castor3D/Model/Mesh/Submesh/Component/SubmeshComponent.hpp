@@ -506,6 +506,11 @@ namespace castor3d
 		{
 			return 0u;
 		}
+
+		C3D_API virtual SubmeshComponentFlag getPackedVerticesFlag()const noexcept
+		{
+			return 0u;
+		}
 		/**@}*/
 		/**
 		*\name
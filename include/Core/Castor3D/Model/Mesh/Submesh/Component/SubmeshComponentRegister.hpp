@@ -204,6 +204,11 @@ namespace castor3d
 			return m_meshletFlag;
 		}
 
+		SubmeshComponentFlag getPackedVerticesFlag()const noexcept
+		{
+			return m_packedVerticesFlag;
+		}
+
 		SubmeshComponentFlag getInstantiationFlag()const noexcept
 		{
 			return m_instantiationFlag;
@@ -257,6 +262,7 @@ namespace castor3d
 		SubmeshComponentFlag m_passMaskFlag{};
 		SubmeshComponentFlag m_velocityFlag{};
 		SubmeshComponentFlag m_meshletFlag{};
+		SubmeshComponentFlag m_packedVerticesFlag{};
 		SubmeshComponentFlag m_instantiationFlag{};
 	};
 }
@@ -368,6 +368,7 @@ namespace castor3d
 		castor::BoundingSphere const & getBoundingSphere()const noexcept;
 		castor::BoundingSphere & getBoundingSphere()noexcept;
 		bool isInitialised()const noexcept;
+		uint32_t getRelocation()const noexcept;
 		Mesh & getParent()const noexcept;
 		uint32_t getId()const noexcept;
 		bool hasComponent( castor::String const & name )const noexcept;
@@ -410,6 +411,8 @@ namespace castor3d
 		ObjectBufferOffset m_sourceBufferOffset;
 		castor::UnorderedMap< size_t, ObjectBufferOffset > m_finalBufferOffsets;
 		mutable castor::UnorderedMap< size_t, GeometryBuffers > m_geometryBuffers;
+		uint32_t m_relocation{};
+		mutable uint32_t m_geometryBuffersRelocation{};
 		bool m_needsNormalsCompute{ false };
 		bool m_disableSceneUpdate{ false };
 
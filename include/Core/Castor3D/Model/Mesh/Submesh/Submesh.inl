@@ -102,6 +102,11 @@ namespace castor3d
 		return m_initialised;
 	}
 
+	inline uint32_t Submesh::getRelocation()const noexcept
+	{
+		return m_relocation;
+	}
+
 	inline Mesh & Submesh::getParent()const noexcept
 	{
 		return *getOwner();
@@ -143,6 +143,29 @@ namespace castor3d
 			, sizeof( Meshlet ) /* SubmeshData::eMeshlets */ };
 		return uint32_t( sizes[size_t( value )] );
 	}
+	/**
+	 *\~english
+	 *\brief		The size of one vertex, in the vertex attributes buffers of submeshes using packed vertices.
+	 *\remarks		All packed attributes share this stride, so their buffers allocations stay on the same vertex index.
+	 *\~french
+	 *\brief		La taille d'un sommet, dans les buffers d'attributs de sommets des sous-maillages utilisant des sommets compactés.
+	 *\remarks		Tous les attributs compactés partagent ce pas, leurs allocations restent donc sur le même indice de sommet.
+	 */
+	static uint32_t constexpr PackedVertexStride = 8u;
+
+	constexpr bool isPackable( SubmeshData value )
+	{
+		return value >= SubmeshData::ePositions
+			&& value <= SubmeshData::eColours;
+	}
+
+	constexpr uint32_t getSize( SubmeshData value
+		, bool packedVertices )
+	{
+		return ( packedVertices && isPackable( value ) )
+			? PackedVertexStride
+			: getSize( value );
+	}
 
 	using SubmeshComponentID = uint32_t;
 	using SubmeshComponentCombineID = uint16_t;
@@ -15,6 +15,7 @@ See LICENSE file in root folder
 #include <CastorUtils/Graphics/Font.hpp>
 #include <CastorUtils/Graphics/FontCache.hpp>
 #include <CastorUtils/Graphics/Position.hpp>
+#include <CastorUtils/Graphics/GlyphAtlas.hpp>
 
 namespace castor3d
 {
@@ -210,10 +211,40 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Uploads the glyphs info buffer.
+		 *\remarks		When the atlas didn't need to be recreated, only its modified region is uploaded.
 		 *\~french
 		 *\brief		Upload le buffer d'informations des glyphes.
+		 *\remarks		Quand l'atlas n'a pas eu besoin d'être recréé, seule sa région modifiée est uploadée.
 		 */
 		C3D_API void upload( UploadData & uploader );
+		/**
+		 *\~english
+		 *\brief		References the glyphs of a text, and adds the missing ones to the atlas.
+		 *\remarks		The glyphs must have been loaded in the font.
+		 *				When the atlas is full, it grows, and when it reached its maximum size,
+		 *				the glyphs that no text uses are evicted from it.
+		 *				The new glyphs positions are available once they are in the displayed texture,
+		 *				onResourceChanged is raised when the texture is replaced.
+		 *\param[in]	text	The text.
+		 *\~french
+		 *\brief		Référence les glyphes d'un texte, et ajoute celles manquantes à l'atlas.
+		 *\remarks		Les glyphes doivent avoir été chargées dans la police.
+		 *				Quand l'atlas est plein, il grandit, et quand il a atteint sa taille maximale,
+		 *				les glyphes qu'aucun texte n'utilise en sont retirées.
+		 *				Les positions des nouvelles glyphes sont disponibles une fois qu'elles sont dans la texture affichée,
+		 *				onResourceChanged est émis quand la texture est remplacée.
+		 *\param[in]	text	Le texte.
+		 */
+		C3D_API void useGlyphs( castor::U32String const & text );
+		/**
+		 *\~english
+		 *\brief		Releases the references taken by useGlyphs on the glyphs of a text.
+		 *\param[in]	text	The text.
+		 *\~french
+		 *\brief		Libère les références prises par useGlyphs sur les glyphes d'un texte.
+		 *\param[in]	text	Le texte.
+		 */
+		C3D_API void releaseGlyphs( castor::U32String const & text );
 		/**
 		 *\~english
 		 *\brief		Converts text to glyph index array.
@@ -289,13 +320,17 @@ namespace castor3d
 		void updateResource( Resource & resource )override;
 		void swapResources()override;
 
+		void doSetSource( Resource & resource );
+
 	private:
 		castor::FontResPtr m_font{};
 		SamplerObs m_sampler{};
-		GlyphPositionMap m_glyphsPositions;
 		uint32_t m_id;
 		FontUboUPtr m_ubo;
 		castor::Map< char32_t, uint32_t > m_charIndices;
+		//!\~english	The glyphs atlas, its width is fixed, its height grows by pages.
+		//!\~french		L'atlas des glyphes, sa largeur est fixe, sa hauteur grandit par pages.
+		castor::GlyphAtlas m_atlas;
 	};
 }
 
@@ -52,6 +52,13 @@ namespace castor3d
 		 *\brief		Constructeur
 		 */
 		C3D_API TextOverlay();
+		/**
+		 *\~english
+		 *\brief		Destructor, releases the glyphs used in the font texture.
+		 *\~french
+		 *\brief		Destructeur, libère les glyphes utilisées dans la texture de police.
+		 */
+		C3D_API ~TextOverlay()noexcept override;
 		/**
 		 *\~english
 		 *\brief		Creation function, used by the factory
@@ -259,6 +266,9 @@ namespace castor3d
 	private:
 		castor::U32String m_currentCaption;
 		castor::U32String m_previousCaption;
+		//!\~english	The caption which glyphs are referenced in the font texture.
+		//!\~french		Le texte dont les glyphes sont référencées dans la texture de police.
+		castor::U32String m_usedCaption;
 		FontTextureRPtr m_fontTexture{};
 		TextWrappingMode m_wrappingMode{ TextWrappingMode::eNone };
 		TextLineSpacingMode m_lineSpacingMode{ TextLineSpacingMode::eOwnHeight };
@@ -0,0 +1,138 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_CullingVolumes_H___
+#define ___C3D_CullingVolumes_H___
+
+#include "Castor3D/Render/Culling/CullingModule.hpp"
+#include "Castor3D/Render/Frustum.hpp"
+
+#include <CastorUtils/Graphics/BoundingBox.hpp>
+#include <CastorUtils/Graphics/BoundingSphere.hpp>
+
+namespace castor3d
+{
+	/**
+	*\~english
+	*\brief
+	*	World space bounding volumes, stored as structure of arrays, to be culled in batches.
+	*\~french
+	*\brief
+	*	Volumes englobants en coordonnées monde, stockés en structure de tableaux, pour être éliminés par lots.
+	*/
+	struct CullingVolumes
+	{
+		/**
+		 *\~english
+		 *\brief		Sets the volumes count.
+		 *\param[in]	count	The new count.
+		 *\~french
+		 *\brief		Définit le nombre de volumes.
+		 *\param[in]	count	Le nouveau nombre.
+		 */
+		C3D_API void resize( size_t count );
+		/**
+		 *\~english
+		 *\brief		Transforms the given bounding volumes to world space, and stores them at given index.
+		 *\remarks		The computations are the same as Frustum::isVisible's.
+		 *\param[in]	index			The volume index.
+		 *\param[in]	sphere			The bounding sphere.
+		 *\param[in]	box				The bounding box.
+		 *\param[in]	transformations	The volumes transformations matrix.
+		 *\param[in]	scale			The scale for the bounding sphere.
+		 *\~french
+		 *\brief		Transforme les volumes englobants donnés en coordonnées monde, et les stocke à l'index donné.
+		 *\remarks		Les calculs sont les mêmes que ceux de Frustum::isVisible.
+		 *\param[in]	index			L'index du volume.
+		 *\param[in]	sphere			La sphère englobante.
+		 *\param[in]	box				La boîte englobante.
+		 *\param[in]	transformations	La matrice de transformations des volumes.
+		 *\param[in]	scale			L'échelle pour la sphère englobante.
+		 */
+		C3D_API void set( size_t index
+			, castor::BoundingSphere const & sphere
+			, castor::BoundingBox const & box
+			, castor::Matrix4x4f const & transformations
+			, castor::Point3f const & scale );
+
+		size_t size()const noexcept
+		{
+			return radius.size();
+		}
+
+		castor::Vector< float > centerX;
+		castor::Vector< float > centerY;
+		castor::Vector< float > centerZ;
+		castor::Vector< float > radius;
+		castor::Vector< float > minX;
+		castor::Vector< float > minY;
+		castor::Vector< float > minZ;
+		castor::Vector< float > maxX;
+		castor::Vector< float > maxY;
+		castor::Vector< float > maxZ;
+	};
+	/**
+	*\~english
+	*\brief
+	*	The instruction sets available to the batch culling function.
+	*\~french
+	*\brief
+	*	Les jeux d'instructions disponibles pour la fonction d'élimination par lots.
+	*/
+	enum class CullingKernel
+		: uint8_t
+	{
+		eScalar,
+		eSSE2,
+		eAVX2,
+		eNEON,
+		CU_ScopedEnumBounds( eScalar, eNEON )
+	};
+	C3D_API castor::String getName( CullingKernel value );
+	/**
+	 *\~english
+	 *\return		The fastest culling kernel supported by the running CPU.
+	 *\~french
+	 *\return		Le noyau d'élimination le plus rapide supporté par le CPU.
+	 */
+	C3D_API CullingKernel getBestCullingKernel();
+	/**
+	 *\~english
+	 *\param[in]	kernel	A culling kernel.
+	 *\return		\p true if the running CPU supports the given kernel.
+	 *\~french
+	 *\param[in]	kernel	Un noyau d'élimination.
+	 *\return		\p true si le CPU supporte le noyau donné.
+	 */
+	C3D_API bool isSupported( CullingKernel kernel );
+	/**
+	 *\~english
+	 *\brief		Checks the volumes in [begin, end) against the frustum planes.
+	 *\remarks		A volume is visible if both its sphere and its box are visible.
+	 *				All kernels give the same results as Frustum::isVisible.
+	 *\param[in]	planes	The frustum planes.
+	 *\param[in]	volumes	The volumes.
+	 *\param[in]	begin	The first volume index.
+	 *\param[in]	end		The index after the last volume.
+	 *\param[out]	visible	Receives 1 for visible volumes, 0 for the others, indexed from \p begin.
+	 *\param[in]	kernel	The instruction set to use, must be supported.
+	 *\~french
+	 *\brief		Vérifie les volumes de [begin, end) par rapport aux plans du frustum.
+	 *\remarks		Un volume est visible si sa sphère et sa boîte sont visibles.
+	 *				Tous les noyaux donnent les mêmes résultats que Frustum::isVisible.
+	 *\param[in]	planes	Les plans du frustum.
+	 *\param[in]	volumes	Les volumes.
+	 *\param[in]	begin	L'index du premier volume.
+	 *\param[in]	end		L'index après le dernier volume.
+	 *\param[out]	visible	Reçoit 1 pour les volumes visibles, 0 pour les autres, indexé depuis \p begin.
+	 *\param[in]	kernel	Le jeu d'instructions à utiliser, doit être supporté.
+	 */
+	C3D_API void cullVolumes( Frustum::Planes const & planes
+		, CullingVolumes const & volumes
+		, size_t begin
+		, size_t end
+		, uint8_t * visible
+		, CullingKernel kernel );
+}
+
+#endif
@@ -4,6 +4,7 @@ See LICENSE file in root folder
 #ifndef ___C3D_FrustumCuller_H___
 #define ___C3D_FrustumCuller_H___
 
+#include "Castor3D/Render/Culling/CullingVolumes.hpp"
 #include "Castor3D/Render/Culling/SceneCuller.hpp"
 #include "Castor3D/Render/Frustum.hpp"
 
@@ -28,8 +29,13 @@ namespace castor3d
 	private:
 		bool isSubmeshVisible( SubmeshRenderNode const & node )const override;
 		bool isBillboardVisible( BillboardRenderNode const & node )const override;
+		void areSubmeshesVisible( NodeArrayT< SubmeshRenderNode, CulledNodePtrT > const & nodes
+			, castor::Vector< uint8_t > & result )const override;
 
 		Frustum * m_frustum{};
+		CullingKernel m_kernel{ getBestCullingKernel() };
+		mutable CullingVolumes m_volumes;
+		mutable castor::Vector< uint8_t > m_states;
 	};
 }
 
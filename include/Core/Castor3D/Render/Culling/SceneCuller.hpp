@@ -126,6 +126,22 @@ namespace castor3d
 		virtual bool isSubmeshVisible( SubmeshRenderNode const & node )const = 0;
 		virtual bool isBillboardVisible( BillboardRenderNode const & node )const = 0;
 
+	protected:
+		/**
+		 *\~english
+		 *\brief		Computes the visibility of all the given nodes.
+		 *\remarks		The default implementation calls isSubmeshVisible for each node.
+		 *\param[in]	nodes	The nodes.
+		 *\param[out]	result	Receives 1 for each visible node, 0 for the others.
+		 *\~french
+		 *\brief		Calcule la visibilité de tous les noeuds donnés.
+		 *\remarks		L'implémentation par défaut appelle isSubmeshVisible pour chaque noeud.
+		 *\param[in]	nodes	Les noeuds.
+		 *\param[out]	result	Reçoit 1 pour chaque noeud visible, 0 pour les autres.
+		 */
+		C3D_API virtual void areSubmeshesVisible( NodeArrayT< SubmeshRenderNode, CulledNodePtrT > const & nodes
+			, castor::Vector< uint8_t > & result )const;
+
 	private:
 		Scene & m_scene;
 
@@ -142,6 +158,9 @@ namespace castor3d
 		RenderCounts m_total{};
 		NodeArrayT< SubmeshRenderNode, CulledNodePtrT > m_culledSubmeshes;
 		NodeArrayT< BillboardRenderNode, CulledNodePtrT > m_culledBillboards;
+		castor::UnorderedMap< SubmeshRenderNode const *, size_t > m_submeshIndices;
+		castor::UnorderedMap< BillboardRenderNode const *, size_t > m_billboardIndices;
+		castor::Vector< uint8_t > m_submeshesVisibility;
 	};
 }
 
@@ -11,6 +11,8 @@ See LICENSE file in root folder
 
 namespace castor3d
 {
+	static bool constexpr C3D_DisableFrustumCulling = false;
+
 	class Frustum
 	{
 	public:
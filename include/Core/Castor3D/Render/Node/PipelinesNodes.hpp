@@ -8,7 +8,11 @@ See LICENSE file in root folder
 #include "Castor3D/Render/Node/BillboardRenderNode.hpp"
 #include "Castor3D/Render/Node/SubmeshRenderNode.hpp"
 
+#include <CastorUtils/Design/ArrayView.hpp>
 #include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Miscellaneous/RadixSort.hpp>
+
+#include <bit>
 
 namespace castor3d
 {
@@ -346,6 +350,189 @@ namespace castor3d
 		castor::Map< uint32_t, PipelineNodes > m_pipelines;
 		castor::UnorderedMap< size_t, RenderedNode * > m_countedNodes;
 	};
+
+	/**
+	*\~english
+	*\brief		The visible nodes of a PipelinesNodesT, in a flat array sorted on 64 bits keys.
+	*\remarks	From most to least significant bits, a key holds the pipeline ID, the buffer index, the pass ID and the quantised view depth.
+	*			The nodes sharing a pipeline and a buffer are thus contiguous, and sorted by pass then depth inside their range.
+	*\~french
+	*\brief		Les noeuds visibles d'un PipelinesNodesT, dans un tableau plat trié sur des clés de 64 bits.
+	*\remarks	Des bits de poids fort à ceux de poids faible, une clé contient l'ID du pipeline, l'indice du buffer, l'ID de la passe et la profondeur quantifiée dans la vue.
+	*			Les noeuds partageant un pipeline et un buffer sont donc contigus, et triés par passe puis profondeur dans leur intervalle.
+	*/
+	template< typename NodeT >
+	class SortedNodesT
+	{
+	public:
+		using PipelinesNodes = PipelinesNodesT< NodeT >;
+		using PipelineNodes = typename PipelinesNodes::PipelineNodes;
+		using RenderedNode = RenderedNodeT< NodeT >;
+
+		struct SortedNode
+		{
+			uint64_t key{};
+			RenderedNode const * node{};
+		};
+
+		struct NodesRange
+		{
+			PipelineNodes const * pipeline{};
+			ashes::BufferBase const * buffer{};
+			castor::ArrayView< SortedNode const > nodes{};
+		};
+
+		static uint32_t constexpr DepthBits = 32u;
+		static uint32_t constexpr PassBits = 20u;
+		static uint32_t constexpr BufferBits = 5u;
+		static uint32_t constexpr PipelineBits = 7u;
+		static uint32_t constexpr RangeShift = DepthBits + PassBits;
+		static uint64_t constexpr DepthMask = ( 1ULL << DepthBits ) - 1ULL;
+		static_assert( DepthBits + PassBits + BufferBits + PipelineBits == 64u );
+		static_assert( ( 1ULL << BufferBits ) >= BuffersNodesViewT< NodeT >::maxBuffers );
+		static_assert( ( 1ULL << PipelineBits ) >= PipelinesNodes::maxPipelines );
+
+		static uint64_t makeKey( uint32_t pipelineId
+			, uint32_t bufferIndex
+			, uint32_t passId
+			, uint32_t depth )noexcept
+		{
+			return ( uint64_t( getRangeIndex( pipelineId, bufferIndex ) ) << RangeShift )
+				| ( uint64_t( passId & ( ( 1u << PassBits ) - 1u ) ) << DepthBits )
+				| uint64_t( depth );
+		}
+		/**
+		 *\~english
+		 *\return		The depth as a key part, positive floats keep their order when their bits are compared as integers.
+		 *\~french
+		 *\return		La profondeur en tant que partie d'une clé, les flottants positifs gardent leur ordre quand leurs bits sont comparés en tant qu'entiers.
+		 */
+		static uint32_t quantiseDepth( float depth
+			, bool backToFront )noexcept
+		{
+			auto result = std::bit_cast< uint32_t >( std::max( depth, 0.0f ) );
+			return backToFront ? ~result : result;
+		}
+		/**
+		 *\~english
+		 *\brief		Updates the sorted nodes.
+		 *\param[in]	nodes			The nodes.
+		 *\param[in]	nodesChanged	\p true to gather again the visible nodes, \p false to only update the depths of the previously gathered ones.
+		 *\param[in]	getDepth		Retrieves a node's quantised depth.
+		 *\~french
+		 *\brief		Met à jour les noeuds triés.
+		 *\param[in]	nodes			Les noeuds.
+		 *\param[in]	nodesChanged	\p true pour récupérer à nouveau les noeuds visibles, \p false pour seulement mettre à jour les profondeurs de ceux déjà récupérés.
+		 *\param[in]	getDepth		Récupère la profondeur quantifiée d'un noeud.
+		 */
+		template< typename DepthGetterT >
+		void update( PipelinesNodes const & nodes
+			, bool nodesChanged
+			, DepthGetterT getDepth )
+		{
+			if ( nodesChanged )
+			{
+				doGather( nodes, getDepth );
+			}
+			else
+			{
+				for ( auto & sorted : m_nodes )
+				{
+					sorted.key = ( sorted.key & ~DepthMask ) | uint64_t( getDepth( *sorted.node ) );
+				}
+			}
+
+			// The previous order is kept, so the sort does nothing when the depths didn't change.
+			castor::radixSort( m_nodes
+				, m_scratch
+				, []( SortedNode const & sorted )
+				{
+					return sorted.key;
+				} );
+			doBuildRanges();
+		}
+
+		void clear()noexcept
+		{
+			m_nodes.clear();
+			m_ranges.clear();
+		}
+
+		castor::Vector< NodesRange > const & getRanges()const noexcept
+		{
+			return m_ranges;
+		}
+
+		auto empty()const noexcept
+		{
+			return m_nodes.empty();
+		}
+
+	private:
+		static uint32_t getRangeIndex( uint32_t pipelineId
+			, uint32_t bufferIndex )noexcept
+		{
+			return ( pipelineId << BufferBits ) | bufferIndex;
+		}
+
+		template< typename DepthGetterT >
+		void doGather( PipelinesNodes const & nodes
+			, DepthGetterT getDepth )
+		{
+			m_nodes.clear();
+			m_lookup.resize( 1ULL << ( PipelineBits + BufferBits ) );
+
+			for ( auto const & [pipelineId, pipelineNodes] : nodes )
+			{
+				uint32_t bufferIndex{};
+
+				for ( auto const & [buffer, bufferNodes] : pipelineNodes.nodes )
+				{
+					m_lookup[getRangeIndex( pipelineId, bufferIndex )] = { &pipelineNodes, buffer };
+
+					for ( auto const & node : bufferNodes )
+					{
+						if ( node.visible )
+						{
+							m_nodes.push_back( { makeKey( pipelineId, bufferIndex, node.node->pass->getId(), getDepth( node ) )
+								, &node } );
+						}
+					}
+
+					++bufferIndex;
+				}
+			}
+		}
+
+		void doBuildRanges()
+		{
+			m_ranges.clear();
+			auto it = m_nodes.begin();
+
+			while ( it != m_nodes.end() )
+			{
+				auto rangeIndex = it->key >> RangeShift;
+				auto end = std::find_if( it
+					, m_nodes.end()
+					, [rangeIndex]( SortedNode const & lookup )
+					{
+						return ( lookup.key >> RangeShift ) != rangeIndex;
+					} );
+				auto & [pipeline, buffer] = m_lookup[rangeIndex];
+				auto first = &( *it );
+				m_ranges.push_back( { pipeline
+					, buffer
+					, castor::ArrayView< SortedNode const >{ first, std::next( first, std::distance( it, end ) ) } } );
+				it = end;
+			}
+		}
+
+	private:
+		castor::Vector< SortedNode > m_nodes;
+		castor::Vector< SortedNode > m_scratch;
+		castor::Vector< std::pair< PipelineNodes const *, ashes::BufferBase const * > > m_lookup;
+		castor::Vector< NodesRange > m_ranges;
+	};
 }
 
 #endif
@@ -22,6 +22,71 @@ namespace crg::ru
 
 namespace castor3d
 {
+	/**
+	*\~english
+	*\brief		A batch of sorted nodes, from a single pipeline range, which indirect commands are filled by one job.
+	*\remarks	The offsets are first the batch commands counts, then their positions in the indirect buffers.
+	*\~french
+	*\brief		Un lot de noeuds triés, d'un seul intervalle de pipeline, dont les commandes indirectes sont remplies par une tâche.
+	*\remarks	Les offsets sont d'abord les nombres de commandes du lot, puis leurs positions dans les buffers indirects.
+	*/
+	struct IndirectCommandsBatch
+	{
+		uint32_t range{};
+		uint32_t first{};
+		uint32_t count{};
+		uint32_t * pipelinesBuffer{};
+		uint32_t idxOffset{};
+		uint32_t nidxOffset{};
+		uint32_t mshOffset{};
+		RenderCounts visible{};
+	};
+	//!\~english	The maximum nodes count in an indirect commands batch.
+	//!\~french		Le nombre maximal de noeuds dans un lot de commandes indirectes.
+	static uint32_t constexpr IndirectCommandsBatchSize = 1024u;
+	/**
+	*\~english
+	*\brief		Splits a range of sorted nodes in indirect commands batches.
+	*\param[in]		range			The range index.
+	*\param[in]		count			The range nodes count.
+	*\param[in]		pipelinesBuffer	The range nodes IDs buffer.
+	*\param[in,out]	batches			Receives the batches.
+	*\~french
+	*\brief		Découpe un intervalle de noeuds triés en lots de commandes indirectes.
+	*\param[in]		range			L'indice de l'intervalle.
+	*\param[in]		count			Le nombre de noeuds de l'intervalle.
+	*\param[in]		pipelinesBuffer	Le buffer d'IDs des noeuds de l'intervalle.
+	*\param[in,out]	batches			Reçoit les lots.
+	*/
+	C3D_API void addIndirectCommandsBatches( uint32_t range
+		, uint32_t count
+		, uint32_t * pipelinesBuffer
+		, castor::Vector< IndirectCommandsBatch > & batches );
+	/**
+	*\~english
+	*\brief		Fills the indirect commands of the batches in parallel.
+	*\remarks	The batches commands are counted first, an exclusive scan then gives each batch its offsets
+	*			in the indirect buffers, so that they can be filled in parallel, in the same order as serially.
+	*\param[in]		jobs	The jobs used for the parallel count and fill.
+	*\param[in,out]	batches	The batches, with null offsets and visible counts.
+	*\param[in]		count	Adds a batch commands counts to its offsets, and its nodes to its visible counts.
+	*\param[in]		fill	Fills a batch commands, from its offsets.
+	*\return		The batch covering all the nodes, its offsets being the commands counts.
+	*\~french
+	*\brief		Remplit les commandes indirectes des lots en parallèle.
+	*\remarks	Les commandes des lots sont d'abord comptées, une somme préfixe donne ensuite à chaque lot ses offsets
+	*			dans les buffers indirects, afin qu'ils puissent être remplis en parallèle, dans le même ordre qu'en série.
+	*\param[in]		jobs	Les tâches utilisées pour le comptage et le remplissage parallèles.
+	*\param[in,out]	batches	Les lots, avec des offsets et des comptes de visibles nuls.
+	*\param[in]		count	Ajoute les nombres de commandes d'un lot à ses offsets, et ses noeuds à ses comptes de visibles.
+	*\param[in]		fill	Remplit les commandes d'un lot, depuis ses offsets.
+	*\return		Le lot couvrant tous les noeuds, ses offsets étant les nombres de commandes.
+	*/
+	C3D_API IndirectCommandsBatch fillIndirectCommandsBatches( castor::JobSystem & jobs
+		, castor::Vector< IndirectCommandsBatch > & batches
+		, castor::Function< void( IndirectCommandsBatch & ) > const & count
+		, castor::Function< void( IndirectCommandsBatch const & ) > const & fill );
+
 	struct QueueRenderNodes
 		: public castor::OwnedBy< RenderQueue const >
 	{
@@ -123,6 +188,7 @@ namespace castor3d
 		void doAddBillboard( CulledNodeT< BillboardRenderNode > const & node );
 		void doRemoveSubmesh( CulledNodeT< SubmeshRenderNode > const & node );
 		void doRemoveBillboard( CulledNodeT< BillboardRenderNode > const & node );
+		void doSortRenderedNodes();
 		uint32_t doPrepareMeshTraditionalNoDrawIDCommandBuffers( ashes::CommandBuffer const & commandBuffer
 			, ashes::Optional< VkViewport > const & viewport
 			, ashes::Optional< VkRect2D > const & scissors
@@ -194,6 +260,10 @@ namespace castor3d
 		PipelinesNodesT< SubmeshRenderNode > m_submeshNodes;
 		InstantiatedPipelinesNodesT< SubmeshRenderNode > m_instancedSubmeshNodes;
 		PipelinesNodesT< BillboardRenderNode > m_billboardNodes;
+		SortedNodesT< SubmeshRenderNode > m_sortedSubmeshNodes;
+		SortedNodesT< BillboardRenderNode > m_sortedBillboardNodes;
+		bool m_sortedNodesChanged{ true };
+		castor::Vector< IndirectCommandsBatch > m_indirectBatches;
 	};
 }
 
@@ -57,6 +57,35 @@ namespace castor3d
 		C3D_API SceneNode & getSceneNode()const;
 		C3D_API SubmeshRenderData * getRenderData()const;
 		C3D_API bool isInstanced()const;
+		/**
+		 *\~english
+		 *\brief		Selects the level of detail matching the node's size on screen.
+		 *\param[in]	camera	The camera viewing the node, can be null.
+		 *\return		The level of detail, 0 being the full detail submesh.
+		 *\~french
+		 *\brief		Sélectionne le niveau de détail correspondant à la taille du noeud à l'écran.
+		 *\param[in]	camera	La caméra regardant le noeud, peut être nulle.
+		 *\return		Le niveau de détail, 0 étant le sous-maillage complet.
+		 */
+		C3D_API uint32_t selectLod( Camera const * camera )const;
+		/**
+		 *\~english
+		 *\param[in]	lod	The level of detail.
+		 *\return		The first index of given level, relative to the submesh indices.
+		 *\~french
+		 *\param[in]	lod	Le niveau de détail.
+		 *\return		Le premier indice du niveau donné, relatif aux indices du sous-maillage.
+		 */
+		C3D_API uint32_t getLodFirstIndex( uint32_t lod )const;
+		/**
+		 *\~english
+		 *\param[in]	lod	The level of detail.
+		 *\return		The indices count of given level.
+		 *\~french
+		 *\param[in]	lod	Le niveau de détail.
+		 *\return		Le nombre d'indices du niveau donné.
+		 */
+		C3D_API uint32_t getLodIndexCount( uint32_t lod )const;
 
 		Pass * pass;
 		DataType & data;
@@ -209,6 +209,7 @@ namespace castor3d
 		BillboardPipelinesMap m_activeBillboardPipelines;
 		ClustersConfig const * m_clustersConfig{};
 		castor::ChangeTracked< uint32_t > m_maxPipelineId{};
+		uint32_t m_geometryGeneration{};
 	};
 }
 
@@ -0,0 +1,72 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_PipelineCache_H___
+#define ___C3D_PipelineCache_H___
+
+#include "RenderModule.hpp"
+
+#include <CastorUtils/Data/Path.hpp>
+#include <CastorUtils/Design/NonCopyable.hpp>
+
+namespace castor3d
+{
+	class PipelineCache
+		: public castor::NonMovable
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor, creates the Vulkan pipeline cache, filled with the file content if it was written for the same device and driver.
+		*\param[in] device
+		*	The GPU device.
+		*\param[in] file
+		*	The file where the cache content is stored.
+		*\~french
+		*\brief
+		*	Constructeur, crée le cache de pipelines Vulkan, rempli avec le contenu du fichier s'il a été écrit pour le même device et le même driver.
+		*\param[in] device
+		*	Le device GPU.
+		*\param[in] file
+		*	Le fichier où le contenu du cache est stocké.
+		*/
+		C3D_API PipelineCache( ashes::Device const & device
+			, castor::Path file );
+		/**
+		*\~english
+		*\brief
+		*	Destructor, saves the cache content and destroys the Vulkan pipeline cache.
+		*\~french
+		*\brief
+		*	Destructeur, sauvegarde le contenu du cache et détruit le cache de pipelines Vulkan.
+		*/
+		C3D_API ~PipelineCache()noexcept;
+		/**
+		*\~english
+		*\brief
+		*	Writes the cache content to the file.
+		*\~french
+		*\brief
+		*	Ecrit le contenu du cache dans le fichier.
+		*/
+		C3D_API void save()const;
+
+		VkPipelineCache getHandle()const noexcept
+		{
+			return m_cache;
+		}
+
+		operator VkPipelineCache()const noexcept
+		{
+			return m_cache;
+		}
+
+	private:
+		ashes::Device const & m_device;
+		castor::Path m_file;
+		VkPipelineCache m_cache{};
+	};
+}
+
+#endif
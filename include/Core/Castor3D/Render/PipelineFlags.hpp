@@ -319,6 +319,11 @@ namespace castor3d
 		{
 			return submesh.hasSkinFlag;
 		}
+
+		bool hasPackedVertices()const noexcept
+		{
+			return submesh.hasPackedVerticesFlag;
+		}
 		//@}
 		/**@name ProgramFlags */
 		//@{
@@ -407,6 +407,7 @@ namespace castor3d
 		IndexBufferPoolUPtr indexPools;
 		ObjectBufferPoolUPtr geometryPools;
 		UniformBufferPoolUPtr uboPool;
+		PipelineCacheUPtr pipelineCache;
 
 	private:
 		bool doTryAddExtension( castor::MbString const & name
@@ -31,6 +31,21 @@ namespace castor3d
 		//!\~english	The upload staging buffers count.
 		//!\~french		Le nombre de staging buffers pour l'upload.
 		uint32_t stagingBuffersCount{};
+		//!\~english	The size of the ranges moved by the geometry buffers compaction, this frame, in bytes.
+		//!\~french		La taille des intervalles déplacés par le compactage des buffers de géométrie, pour cette frame, en octets.
+		uint32_t compactionMovedSize{};
+		//!\~english	The size of the moved ranges freed by the geometry buffers compaction, this frame, in bytes.
+		//!\~french		La taille des intervalles déplacés libérés par le compactage des buffers de géométrie, pour cette frame, en octets.
+		uint32_t compactionFreedSize{};
+		//!\~english	The size of the geometry buffers released by the compaction, this frame, in bytes.
+		//!\~french		La taille des buffers de géométrie libérés par le compactage, pour cette frame, en octets.
+		uint32_t compactionReleasedSize{};
+		//!\~english	The CPU time spent updating the render queues (nodes sorting and indirect commands), this frame.
+		//!\~french		Le temps CPU passé à mettre à jour les files de rendu (tri des noeuds et commandes indirectes), pour cette frame.
+		castor::Nanoseconds queuesUpdateTime{};
+		//!\~english	The total CPU time of the frame update step, render queues included.
+		//!\~french		Le temps CPU total de l'étape de mise à jour de la frame, files de rendu incluses.
+		castor::Nanoseconds cpuStepTime{};
 	};
 }
 
@@ -230,7 +230,8 @@ namespace castor3d
 			, RenderDevice const & device
 			, QueueData const & queueData );
 		void doGpuStep( RenderInfo & info );
-		void doCpuStep( castor::Milliseconds tslf );
+		void doCpuStep( RenderInfo & info
+			, castor::Milliseconds tslf );
 
 	protected:
 		//!\~english	The current RenderSystem.
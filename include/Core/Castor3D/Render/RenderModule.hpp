@@ -588,6 +588,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Vulkan pipeline cache, persisted on disk between runs.
+	*\~french
+	*\brief
+	*	Cache de pipelines Vulkan, persisté sur disque entre les lancements.
+	*/
+	class PipelineCache;
+	/**
+	*\~english
+	*\brief
 	*	Holds render informations.
 	*\~french
 	*\brief
@@ -777,6 +786,7 @@ namespace castor3d
 
 	CU_DeclareSmartPtr( castor3d, Frustum, C3D_API );
 	CU_DeclareSmartPtr( castor3d, Picking, C3D_API );
+	CU_DeclareSmartPtr( castor3d, PipelineCache, C3D_API );
 	CU_DeclareSmartPtr( castor3d, RenderDevice, C3D_API );
 	CU_DeclareSmartPtr( castor3d, RenderLoop, C3D_API );
 	CU_DeclareSmartPtr( castor3d, RenderNodesPass, C3D_API );
@@ -815,8 +825,11 @@ namespace castor3d
 
 		NodeT const * node;
 		uint32_t instanceCount;
-		uint32_t indexCount;
-		uint32_t vertexCount;
+		uint32_t indexCount{};
+		uint32_t vertexCount{};
+		// The first index of the selected level of detail, relative to the node's indices.
+		uint32_t firstIndex{};
+		uint32_t lod{};
 		bool visible;
 	};
 
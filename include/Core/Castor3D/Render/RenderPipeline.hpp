@@ -88,6 +88,15 @@ namespace castor3d
 		/**
 		*\~english
 		*\brief
+		*	Destructor.
+		*\~french
+		*\brief
+		*	Destructeur.
+		*/
+		C3D_API ~RenderPipeline()noexcept;
+		/**
+		*\~english
+		*\brief
 		*	Initialises the pipeline.
 		*\param[in] device
 		*	The GPU device.
@@ -195,13 +204,13 @@ namespace castor3d
 
 		bool hasPipeline()const noexcept
 		{
-			return m_pipeline != nullptr;
+			return m_pipeline != VkPipeline{};
 		}
 
-		ashes::GraphicsPipeline const & getPipeline()const noexcept
+		VkPipeline getPipeline()const noexcept
 		{
-			hasPipeline();
-			return *m_pipeline;
+			CU_Require( hasPipeline() );
+			return m_pipeline;
 		}
 
 		ashes::PipelineLayout const & getPipelineLayout()const noexcept
@@ -252,7 +261,8 @@ namespace castor3d
 		castor::RawUniquePtr< VkViewport > m_viewport;
 		castor::RawUniquePtr< VkRect2D > m_scissor;
 		ashes::PipelineLayoutPtr m_pipelineLayout;
-		ashes::GraphicsPipelinePtr m_pipeline;
+		RenderDevice const * m_device{};
+		VkPipeline m_pipeline{};
 		ashes::DescriptorSetLayout const * m_addDescriptorLayout{};
 		ashes::DescriptorSet const * m_addDescriptorSet{};
 		ashes::DescriptorSetLayout const * m_meshletDescriptorLayout{};
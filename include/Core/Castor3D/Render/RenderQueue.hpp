@@ -231,6 +231,7 @@ namespace castor3d
 		bool m_culledChanged{};
 		bool m_fullSort{ true };
 		bool m_commandsChanged{};
+		uint32_t m_geometryGeneration{};
 		std::atomic_bool m_invalidated{};
 		castor::GroupChangeTracked< ashes::Optional< VkViewport > > m_viewport;
 		castor::GroupChangeTracked< ashes::Optional< VkRect2D > > m_scissor;
@@ -11,6 +11,7 @@ See LICENSE file in root folder
 #include "Castor3D/Miscellaneous/GpuInformations.hpp"
 #include "Castor3D/Miscellaneous/GpuObjectTracker.hpp"
 #include "Castor3D/Render/RenderDevice.hpp"
+#include "Castor3D/Shader/ShaderModule.hpp"
 
 #include <ashespp/Core/WindowHandle.hpp>
 
@@ -445,6 +446,7 @@ namespace castor3d
 		ashes::BufferPtr< castor::Point4f > m_randomStorage{};
 		castor::Mutex m_allocMutex;
 		castor::UnorderedMap< std::thread::id, castor::RawUniquePtr< ast::ShaderAllocator > > m_shaderCompileAllocator{};
+		SpirVCacheUPtr m_spirvCache{};
 	};
 }
 
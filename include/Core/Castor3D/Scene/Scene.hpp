@@ -283,6 +283,18 @@ namespace castor3d
 		 *\param[in]	object	L'objet.
 		 */
 		C3D_API void markDirty( MovableObject & object );
+		/**
+		 *\~english
+		 *\brief		Tells that a scene node has been attached or detached, the nodes transforms will be sorted again.
+		 *\remarks		Thread safe.
+		 *\~french
+		 *\brief		Indique qu'un noeud de scène a été attaché ou détaché, les transformations des noeuds seront triées à nouveau.
+		 *\remarks		Thread safe.
+		 */
+		void markNodesHierarchyChanged()noexcept
+		{
+			m_nodesHierarchyChanged = true;
+		}
 		/**
 		*\~english
 		*\name
@@ -453,7 +465,7 @@ namespace castor3d
 
 	private:
 		void doGatherDirty( CpuUpdater::DirtyObjects & sceneObjs );
-		void doUpdateSceneNodes( CpuUpdater::DirtyObjects const & sceneObjs )const;
+		void doUpdateSceneNodes( CpuUpdater::DirtyObjects const & sceneObjs );
 		void doUpdateMovables( CpuUpdater & updater
 			, CpuUpdater::DirtyObjects & sceneObjs );
 		void doUpdateLights( CpuUpdater & updater
@@ -479,8 +491,12 @@ namespace castor3d
 		bool m_initialised{ false };
 		crg::ResourcesCache m_resources;
 		castor::Vector< SceneNode * > m_dirtyNodes;
+		castor::UnorderedSet< SceneNode * > m_queuedNodes;
 		castor::Vector< BillboardBase * > m_dirtyBillboards;
 		castor::Vector< MovableObject * > m_dirtyObjects;
+		uint32_t m_geometryGeneration{};
+		// Declared before the nodes cache, its nodes being attached at construction.
+		std::atomic_bool m_nodesHierarchyChanged{ true };
 		DECLARE_OBJECT_CACHE_MEMBER( sceneNode, SceneNode );
 		SceneNodeRPtr m_rootNode;
 		SceneNodeRPtr m_rootCameraNode;
@@ -509,7 +525,7 @@ namespace castor3d
 		bool m_hasOpaqueObjects{ false };
 		bool m_hasTransparentObjects{ false };
 		castor::Map< Material *, OnMaterialChangedConnection > m_materialsListeners;
-		bool m_dirtyMaterials{ true };
+		std::atomic_bool m_dirtyMaterials{ true };
 		uint32_t m_directionalShadowCascades{ MaxDirectionalCascadesCount };
 		castor::BoundingBox m_boundingBox;
 		std::atomic_bool m_needsGlobalIllumination;
@@ -527,6 +543,7 @@ namespace castor3d
 		FramePassTimerUPtr m_timerParticlesGpu;
 		FramePassTimerUPtr m_timerGpuUpdate;
 		FramePassTimerUPtr m_timerMovables;
+		FramePassTimerUPtr m_timerCpuUpdate;
 		CpuFrameEvent * m_cleanBackground{};
 		mutable DebugConfig m_debugConfig;
 
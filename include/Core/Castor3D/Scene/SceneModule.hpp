@@ -344,6 +344,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	The scene nodes transforms, stored as structure of arrays sorted by depth.
+	*\~french
+	*\brief
+	*	Les transformations des noeuds de scène, stockées en structure de tableaux triés par profondeur.
+	*/
+	class SceneNodeTransforms;
+	/**
+	*\~english
+	*\brief
 	*	Shadows configuration class.
 	*\~french
 	*\brief
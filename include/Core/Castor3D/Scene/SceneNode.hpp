@@ -20,6 +20,8 @@ namespace castor3d
 		: public Animable
 		, public castor::Named
 	{
+		friend class SceneNodeTransforms;
+
 	public:
 		//!\~english	The total number of scene nodes.
 		//!\~french		Le nombre total de noeuds de scène.
@@ -377,7 +379,10 @@ namespace castor3d
 		castor::Matrix4x4f m_transform{ 1.0f };
 		bool m_mtxChanged{ true };
 		castor::Matrix4x4f m_derivedTransform{ 1.0f };
+		castor::Quaternion m_derivedOrientation{ castor::Quaternion::identity() };
+		castor::Point3f m_derivedScale{ 1.0f, 1.0f, 1.0f };
 		bool m_derivedMtxChanged{ true };
+		uint32_t m_transformIndex{ ~0u };
 		SceneNode * m_parent{};
 		SceneNodeMap m_children;
 		MovableArray m_objects;
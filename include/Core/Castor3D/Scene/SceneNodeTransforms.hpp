@@ -0,0 +1,118 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_SceneNodeTransforms_H___
+#define ___C3D_SceneNodeTransforms_H___
+
+#include "Castor3D/Scene/SceneModule.hpp"
+
+#include <CastorUtils/Math/Quaternion.hpp>
+#include <CastorUtils/Math/SquareMatrix.hpp>
+#include <CastorUtils/Multithreading/MultithreadingModule.hpp>
+
+namespace castor3d
+{
+	/**
+	*\~english
+	*\brief
+	*	The scene nodes transforms, stored as structure of arrays sorted by depth.
+	*\remarks
+	*	A node's parent always has a lower index than the node, hence the world matrices
+	*	are computed level by level, the nodes inside a level being independent from each other.
+	*\~french
+	*\brief
+	*	Les transformations des noeuds de scène, stockées en structure de tableaux triés par profondeur.
+	*\remarks
+	*	Le parent d'un noeud a toujours un index inférieur à celui du noeud, les matrices monde
+	*	sont donc calculées niveau par niveau, les noeuds d'un niveau étant indépendants les uns des autres.
+	*/
+	class SceneNodeTransforms
+	{
+	public:
+		static uint32_t constexpr InvalidIndex = ~0u;
+
+		struct Level
+		{
+			uint32_t begin;
+			uint32_t end;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Updates the transforms of the given dirty nodes, and of their descendants.
+		 *\param[in]	jobs				Spreads the levels updates.
+		 *\param[in]	rootNode			The hierarchy root.
+		 *\param[in]	dirtyNodes			The nodes which have been modified.
+		 *\param[in]	hierarchyChanged	\p true if nodes have been attached or detached since last update, they are then sorted again.
+		 *\~french
+		 *\brief		Met à jour les transformations des noeuds modifiés donnés, et de leurs descendants.
+		 *\param[in]	jobs				Répartit les mises à jour des niveaux.
+		 *\param[in]	rootNode			La racine de la hiérarchie.
+		 *\param[in]	dirtyNodes			Les noeuds qui ont été modifiés.
+		 *\param[in]	hierarchyChanged	\p true si des noeuds ont été attachés ou détachés depuis la dernière mise à jour, ils sont alors triés à nouveau.
+		 */
+		C3D_API void update( castor::JobSystem & jobs
+			, SceneNode & rootNode
+			, castor::Vector< SceneNode * > const & dirtyNodes
+			, bool hierarchyChanged );
+		/**
+		 *\~english
+		 *\brief		Computes \p result = \p lhs * \p rhs, using SIMD instructions when available.
+		 *\~french
+		 *\brief		Calcule \p result = \p lhs * \p rhs, en utilisant les instructions SIMD si disponibles.
+		 */
+		C3D_API static void multiply( castor::Matrix4x4f const & lhs
+			, castor::Matrix4x4f const & rhs
+			, castor::Matrix4x4f & result );
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		**/
+		/**@{*/
+		uint32_t getNodeCount()const noexcept
+		{
+			return uint32_t( m_nodes.size() );
+		}
+
+		castor::Vector< Level > const & getLevels()const noexcept
+		{
+			return m_levels;
+		}
+
+		C3D_API uint32_t getIndex( SceneNode const & node )const noexcept;
+		/**@}*/
+
+	private:
+		void doSort( SceneNode & rootNode );
+		void doGather( uint32_t index );
+		void doUpdateLevel( uint32_t begin
+			, uint32_t end );
+
+	private:
+		// Sorted by depth.
+		castor::Vector< SceneNode * > m_nodes;
+		castor::Vector< uint32_t > m_parents;
+		castor::Vector< Level > m_levels;
+		// Local transforms.
+		castor::Vector< castor::Point3f > m_positions;
+		castor::Vector< castor::Quaternion > m_orientations;
+		castor::Vector< castor::Point3f > m_scales;
+		castor::Vector< uint8_t > m_matrixSet;
+		castor::Vector< castor::Matrix4x4f > m_locals;
+		// World transforms.
+		castor::Vector< castor::Matrix4x4f > m_worlds;
+		castor::Vector< castor::Quaternion > m_derivedOrientations;
+		castor::Vector< castor::Point3f > m_derivedScales;
+		// 1 for the nodes which local transform has changed.
+		castor::Vector< uint8_t > m_dirty;
+		// 1 for the nodes which world transform has changed during current update.
+		castor::Vector< uint8_t > m_changed;
+	};
+}
+
+#endif
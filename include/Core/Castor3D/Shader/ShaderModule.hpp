@@ -173,6 +173,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Persistent on-disk cache of compiled SPIR-V binaries, addressed by content.
+	*\~french
+	*\brief
+	*	Cache persistant sur disque des binaires SPIR-V compilés, adressé par contenu.
+	*/
+	class SpirVCache;
+	/**
+	*\~english
+	*\brief
 	*	Wrapper class to select between SSBO or TBO.
 	*\remarks
 	*	Allows to user either one or the other in the same way.
@@ -189,6 +198,7 @@ namespace castor3d
 	CU_DeclareSmartPtr( castor3d, ShaderBuffer, C3D_API );
 	CU_DeclareSmartPtr( castor3d, ShaderProgram, C3D_API );
 	CU_DeclareSmartPtr( castor3d, LightingModelFactory, C3D_API );
+	CU_DeclareSmartPtr( castor3d, SpirVCache, C3D_API );
 
 	//@}
 }
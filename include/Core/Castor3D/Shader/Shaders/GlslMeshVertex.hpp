@@ -27,6 +27,22 @@ namespace castor3d::shader
 			, sdw::var::Flag flag );
 		C3D_API static sdw::type::BaseStructPtr makeType( sdw::type::TypesCache & cache
 			, SubmeshShaders const & submeshShaders );
+		/**
+		 *\~english
+		 *\name		Vertex attributes unpacking.
+		 *\remarks		When the submesh uses packed vertices, the normals, tangents and bitangents are octahedral encoded.
+		 *\~french
+		 *\name		Décompactage des attributs de sommet.
+		 *\remarks		Quand le sous-maillage utilise des sommets compactés, les normales, tangentes et bitangentes sont encodées en octaédrique.
+		 */
+		/**@{*/
+		C3D_API sdw::Vec3 getNormal( PipelineFlags const & flags
+			, Utils & utils )const;
+		C3D_API sdw::Vec4 getTangent( PipelineFlags const & flags
+			, Utils & utils )const;
+		C3D_API sdw::Vec3 getBitangent( PipelineFlags const & flags
+			, Utils & utils )const;
+		/**@}*/
 
 		// Base
 		sdw::Vec4 position;
@@ -132,6 +132,15 @@ namespace castor3d::shader
 		/**
 		*\~english
 		*\brief
+		*	Decodes a normal from its octahedral encoding, each component being in [-1, 1].
+		*\~french
+		*\brief
+		*	Décode une normale depuis son encodage octaédrique, chaque composante étant dans [-1, 1].
+		*/
+		C3D_API sdw::RetVec3 decodeOctahedral( sdw::Vec2 const & encoded );
+		/**
+		*\~english
+		*\brief
 		*	Converts a 32 bit float to store as 4 8 bit floats.
 		*/
 		C3D_API sdw::RetVec4 encodeFloatRGBA( sdw::Float const & v );
@@ -237,6 +246,8 @@ namespace castor3d::shader
 			, sdw::InUInt > m_decodeColor;
 		sdw::Function< sdw::Vec3
 			, sdw::InUInt > m_decodeNormal;
+		sdw::Function< sdw::Vec3
+			, sdw::InVec2 > m_decodeOctahedral;
 		sdw::Function< sdw::Vec4
 			, sdw::InFloat > m_encodeFloatRGBA;
 		sdw::Function< sdw::UInt
@@ -0,0 +1,89 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_SpirVCache_H___
+#define ___C3D_SpirVCache_H___
+
+#include "ShaderModule.hpp"
+
+#include <CastorUtils/Data/Path.hpp>
+#include <CastorUtils/Design/NonCopyable.hpp>
+
+namespace castor3d
+{
+	class SpirVCache
+		: public castor::NonMovable
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] folder
+		*	The folder where the SPIR-V binaries are stored.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] folder
+		*	Le dossier où les binaires SPIR-V sont stockés.
+		*/
+		C3D_API explicit SpirVCache( castor::Path folder );
+		/**
+		*\~english
+		*\brief
+		*	Looks for a SPIR-V binary in the cache.
+		*\remarks
+		*	The file is only read when requested, and is ignored if its header doesn't match.
+		*\param[in] key
+		*	The content key, computed from the shader and the compilation configuration.
+		*\param[out] spirv
+		*	Receives the SPIR-V binary.
+		*\return
+		*	\p true if a valid binary was found.
+		*\~french
+		*\brief
+		*	Recherche un binaire SPIR-V dans le cache.
+		*\remarks
+		*	Le fichier n'est lu qu'à la demande, et est ignoré si son en-tête ne correspond pas.
+		*\param[in] key
+		*	La clef du contenu, calculée à partir du shader et de la configuration de compilation.
+		*\param[out] spirv
+		*	Reçoit le binaire SPIR-V.
+		*\return
+		*	\p true si un binaire valide a été trouvé.
+		*/
+		C3D_API bool tryLoad( uint64_t key
+			, castor::UInt32Array & spirv )const;
+		/**
+		*\~english
+		*\brief
+		*	Stores a SPIR-V binary in the cache.
+		*\param[in] key
+		*	The content key.
+		*\param[in] spirv
+		*	The SPIR-V binary.
+		*\~french
+		*\brief
+		*	Stocke un binaire SPIR-V dans le cache.
+		*\param[in] key
+		*	La clef du contenu.
+		*\param[in] spirv
+		*	Le binaire SPIR-V.
+		*/
+		C3D_API void store( uint64_t key
+			, castor::UInt32Array const & spirv );
+
+		castor::Path const & getFolder()const noexcept
+		{
+			return m_folder;
+		}
+
+	private:
+		castor::Path getFile( uint64_t key )const;
+
+	private:
+		castor::Path m_folder;
+	};
+}
+
+#endif
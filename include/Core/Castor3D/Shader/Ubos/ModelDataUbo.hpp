@@ -27,7 +27,9 @@ namespace castor3d::shader
 			, sdw::UIntField< "indexOffset" >
 			, sdw::UIntField< "meshletOffset" >
 			, sdw::UIntField< "indexCount" >
-			, sdw::UIntField< "vertexCount" > >
+			, sdw::UIntField< "vertexCount" >
+			, sdw::Vec4Field< "positionsOffset" >
+			, sdw::Vec4Field< "positionsScale" > >
 	{
 		ModelData( sdw::ShaderWriter & writer
 			, ast::expr::ExprPtr expr
@@ -47,6 +49,8 @@ namespace castor3d::shader
 		C3D_API sdw::Vec4 modelToWorld( sdw::Vec4 const & pos )const;
 		C3D_API sdw::Vec4 modelToCurWorld( sdw::Vec4 const & pos )const;
 		C3D_API sdw::Vec4 modelToPrvWorld( sdw::Vec4 const & pos )const;
+		C3D_API sdw::Vec4 unpackPosition( PipelineFlags const & flags
+			, sdw::Vec4 const & pos )const;
 		C3D_API sdw::Mat4 getCurModelMtx( PipelineFlags const & flags
 			, sdw::Mat4 const & transform )const;
 		C3D_API sdw::Mat4 getCurModelMtx( SkinningData const & skinning
@@ -320,6 +320,9 @@ namespace castor3d
 		uint32_t meshletOffset{};
 		uint32_t indexCount{};
 		uint32_t vertexCount{};
+		// Used to unpack the positions of submeshes using packed vertices.
+		castor::Point4f positionsOffset{};
+		castor::Point4f positionsScale{};
 	};
 	/**
 	*\~english
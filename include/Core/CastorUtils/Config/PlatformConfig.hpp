@@ -40,6 +40,24 @@ See LICENSE file in root folder
 #	error "Yet unsupported architecture"
 #endif
 
+#if defined( CU_ArchX86_64 ) || defined( __SSE2__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define CU_SimdSSE2 1
+#else
+#	define CU_SimdSSE2 0
+#endif
+
+#if defined( __AVX__ )
+#	define CU_SimdAVX 1
+#else
+#	define CU_SimdAVX 0
+#endif
+
+#if defined( CU_ArchARM64 ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#	define CU_SimdNEON 1
+#else
+#	define CU_SimdNEON 0
+#endif
+
 #if defined( CU_PlatformWindows )
 #	if defined( CastorUtils_EXPORTS )
 #		define CU_API __declspec(dllexport)
@@ -0,0 +1,53 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_Compression_HPP___
+#define ___CU_Compression_HPP___
+
+#include "CastorUtils/Data/DataModule.hpp"
+
+namespace castor
+{
+	/**
+	 *\~english
+	 *\brief		Compresses a buffer, using deflate.
+	 *\param[in]	data	The buffer to compress.
+	 *\param[in]	size	The buffer size.
+	 *\param[out]	result	Receives the compressed data.
+	 *\param[in]	level	The compression level, from 1 (fastest) to 9 (smallest).
+	 *\return		\p false if any error occured.
+	 *\~french
+	 *\brief		Compresse un tampon, en utilisant deflate.
+	 *\param[in]	data	Le tampon à compresser.
+	 *\param[in]	size	La taille du tampon.
+	 *\param[out]	result	Reçoit les données compressées.
+	 *\param[in]	level	Le niveau de compression, de 1 (le plus rapide) à 9 (le plus petit).
+	 *\return		\p false si une erreur quelconque est arrivée.
+	 */
+	CU_API bool compressBuffer( uint8_t const * data
+		, uint64_t size
+		, ByteArray & result
+		, int32_t level = 6 );
+	/**
+	 *\~english
+	 *\brief		Decompresses a buffer compressed with compressBuffer.
+	 *\param[in]	data		The compressed buffer.
+	 *\param[in]	size		The compressed buffer size.
+	 *\param[out]	result		Receives the decompressed data.
+	 *\param[in]	resultSize	The decompressed data size, the buffer must be able to hold it.
+	 *\return		\p false if the data is corrupted, or doesn't have the expected size.
+	 *\~french
+	 *\brief		Décompresse un tampon compressé avec compressBuffer.
+	 *\param[in]	data		Le tampon compressé.
+	 *\param[in]	size		La taille du tampon compressé.
+	 *\param[out]	result		Reçoit les données décompressées.
+	 *\param[in]	resultSize	La taille des données décompressées, le tampon doit pouvoir la contenir.
+	 *\return		\p false si les données sont corrompues, ou n'ont pas la taille attendue.
+	 */
+	CU_API bool decompressBuffer( uint8_t const * data
+		, uint64_t size
+		, uint8_t * result
+		, uint64_t resultSize );
+}
+
+#endif
@@ -63,6 +63,13 @@ namespace castor
 	class File;
 	/**
 	\~english
+	\brief		Read only memory mapping of a whole file.
+	\~french
+	\brief		Mapping mémoire en lecture seule d'un fichier entier.
+	*/
+	class MappedFile;
+	/**
+	\~english
 	\brief		Partial castor::Loader specialisation for binary files
 	\~french
 	\brief		Spécialisation partielle de castor::Loader, pour les fichiers binaires
@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "CastorUtils/CastorUtils.hpp"
 #include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Design/ArrayView.hpp"
 #include "CastorUtils/Design/FlagCombination.hpp"
 #include "CastorUtils/Design/NonCopyable.hpp"
 #include "CastorUtils/Exception/Exception.hpp"
@@ -361,6 +362,22 @@ namespace castor
 		 *\return		\p true si le fichier a été supprimé correctement
 		 */
 		CU_API static bool deleteFile( Path const & filePath );
+		/**
+		 *\~english
+		 *\brief		Writes a binary file through a temporary file, renamed once complete.
+		 *\remarks		A concurrent reader never sees a partial file, and the previous content stays valid until the new one is complete.
+		 *\param[in]	filePath	File name and path.
+		 *\param[in]	data		The file content, written in order.
+		 *\return		\p true if the file has been correctly written.
+		 *\~french
+		 *\brief		Ecrit un fichier binaire via un fichier temporaire, renommé une fois complet.
+		 *\remarks		Un lecteur concurrent ne voit jamais de fichier partiel, et le contenu précédent reste valide jusqu'à ce que le nouveau soit complet.
+		 *\param[in]	filePath	Le chemin du fichier.
+		 *\param[in]	data		Le contenu du fichier, écrit dans l'ordre.
+		 *\return		\p true si le fichier a été écrit correctement.
+		 */
+		CU_API static bool writeAtomic( Path const & filePath
+			, Vector< ConstByteArrayView > const & data );
 		/**
 		 *\~english
 		 *\brief		Copy a file into a folder.
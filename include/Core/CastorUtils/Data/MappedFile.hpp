@@ -0,0 +1,87 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_MappedFile_H___
+#define ___CU_MappedFile_H___
+
+#include "CastorUtils/Data/DataModule.hpp"
+
+#include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Design/NonCopyable.hpp"
+
+namespace castor
+{
+	class MappedFile
+		: public NonMovable
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, maps the whole file in read only mode.
+		 *\remarks		Check isMapped() to know if the mapping succeeded.
+		 *\param[in]	path	The file path.
+		 *\~french
+		 *\brief		Constructeur, mappe le fichier entier en lecture seule.
+		 *\remarks		Vérifier isMapped() pour savoir si le mapping a réussi.
+		 *\param[in]	path	Le chemin du fichier.
+		 */
+		CU_API explicit MappedFile( Path path )noexcept;
+		/**
+		 *\~english
+		 *\brief		Destructor, unmaps the file.
+		 *\~french
+		 *\brief		Destructeur, démappe le fichier.
+		 */
+		CU_API ~MappedFile()noexcept;
+		/**
+		 *\~english
+		 *\return		\p true if the file content is mapped.
+		 *\~french
+		 *\return		\p true si le contenu du fichier est mappé.
+		 */
+		bool isMapped()const noexcept
+		{
+			return m_data != nullptr;
+		}
+		/**
+		 *\~english
+		 *\return		The mapped file content, null if not mapped.
+		 *\~french
+		 *\return		Le contenu mappé du fichier, nul s'il n'est pas mappé.
+		 */
+		uint8_t const * getData()const noexcept
+		{
+			return m_data;
+		}
+		/**
+		 *\~english
+		 *\return		The mapped file size.
+		 *\~french
+		 *\return		La taille du fichier mappé.
+		 */
+		uint64_t getSize()const noexcept
+		{
+			return m_size;
+		}
+
+		Path const & getPath()const noexcept
+		{
+			return m_path;
+		}
+
+	private:
+		CU_API void doMap()noexcept;
+		CU_API void doUnmap()noexcept;
+
+	private:
+		Path m_path;
+		uint8_t const * m_data{};
+		uint64_t m_size{};
+		//!\~english	The platform specific handles, for the platforms needing them to keep the mapping alive.
+		//!\~french		Les handles spécifiques à la plateforme, pour les plateformes en ayant besoin pour garder le mapping.
+		void * m_file{};
+		void * m_mapping{};
+	};
+}
+
+#endif
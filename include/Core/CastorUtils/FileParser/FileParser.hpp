@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "CastorUtils/FileParser/ParserParameter.hpp"
 
 #include "CastorUtils/Log/LogModule.hpp"
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
 
 namespace castor
 {
@@ -404,6 +405,23 @@ namespace castor
 		{
 			return m_additionalParsers;
 		}
+		/**
+		 *\~english
+		 *\brief		Sets the job system used to pre-parse the included files in parallel.
+		 *\param[in]	jobs	The job system, \p nullptr to load them sequentially.
+		 *\~french
+		 *\brief		Définit le système de tâches utilisé pour pré-analyser les fichiers inclus en parallèle.
+		 *\param[in]	jobs	Le système de tâches, \p nullptr pour les charger séquentiellement.
+		 */
+		void setJobSystem( JobSystem * jobs )noexcept
+		{
+			m_jobs = jobs;
+		}
+
+		JobSystem * getJobSystem()const noexcept
+		{
+			return m_jobs;
+		}
 
 	protected:
 		/**
@@ -457,17 +475,48 @@ namespace castor
 		CU_API virtual castor::RawUniquePtr< FileParser > doCreateParser()const = 0;
 
 	private:
+		struct TokenizedFile;
+		using TokenizedFilePtr = castor::SharedPtr< TokenizedFile >;
+		/**
+		 *\~english
+		 *\brief		An entry of the flat hashed dispatch table, built from m_parsers.
+		 *\~french
+		 *\brief		Une entrée de la table de dispatch à plat, construite depuis m_parsers.
+		 */
+		struct ParserEntry
+		{
+			uint64_t hash{};
+			SectionId section{};
+			StringView name{};
+			ParserFunctionAndParams const * parser{};
+		};
+
+		static TokenizedFilePtr doLoadFile( LoggerInstance & logger
+			, JobSystem * jobs
+			, Path const & path );
+		static void doPrefetchIncludes( LoggerInstance & logger
+			, JobSystem * jobs
+			, Path const & folder
+			, TokenizedFile & file );
+		void doProcessFile( Path const & path
+			, TokenizedFile & file
+			, PreprocessedFile & preprocessed );
+		void doProcessTokens( Path const & path
+			, TokenizedFile & file
+			, PreprocessedFile & preprocessed );
+		TokenizedFilePtr doTakePrefetchedInclude( StringView param );
+		void doBuildDispatchTable();
+		ParserFunctionAndParams const * doFindParser( SectionId section
+			, StringView name );
 		void doProcessNoBlockLine( StringView curLine
 			, PreprocessedFile & preprocessed
-			, Vector< StringView > const & work
-			, Vector< StringView > const & nextWork
+			, StringView nextToken
 			, uint64_t lineIndex
 			, SectionId & pendingSection
 			, bool & isNextOpenBrace );
 		void doProcessLine( StringView curLine
 			, PreprocessedFile & preprocessed
-			, Vector< StringView > const & work
-			, Vector< StringView > const & nextWork
+			, StringView nextToken
 			, uint64_t lineIndex
 			, SectionId & pendingSection
 			, bool & commented
@@ -504,8 +553,16 @@ namespace castor
 		int m_ignoreLevel{ 0 };
 		Path m_path;
 		String m_fileName;
+		Path m_filePath;
 		StringMap< AdditionalParsers > m_additionalParsers;
 		Deque< SectionId > m_sections{};
+		JobSystem * m_jobs{};
+		TokenizedFile * m_file{};
+		//!\~english	The (section, name) => parser open addressing table, rebuilt when parsers are added.
+		//!\~french		La table à adressage ouvert (section, nom) => parser, reconstruite quand des parsers sont ajoutés.
+		Vector< ParserEntry > m_dispatch;
+		uint64_t m_dispatchMask{};
+		bool m_dispatchDirty{ true };
 
 	protected:
 		LoggerInstance & m_logger;
@@ -12,6 +12,29 @@ namespace castor
 	{
 		static StringView const VALUE_SEPARATOR = cuT( "[ \\t]*[ \\t,;][ \\t]*" );
 		static StringView const IGNORED_END = cuT( "([^\\r\\n]*)" );
+
+		template< typename T >
+		Regex const & getValuesRegex( size_t count )
+		{
+			// Compiling a regex costs far more than matching it, so they are kept, per thread.
+			thread_local Map< size_t, Regex > regexes;
+			auto it = regexes.find( count );
+
+			if ( it == regexes.end() )
+			{
+				String regexString = RegexFormat< T >::Value;
+
+				for ( size_t i = 1; i < count; ++i )
+				{
+					regexString += String( VALUE_SEPARATOR ) + RegexFormat< T >::Value;
+				}
+
+				regexString += IGNORED_END;
+				it = regexes.emplace( count, Regex{ regexString } ).first;
+			}
+
+			return it->second;
+		}
 	}
 
 	//*************************************************************************************************
@@ -40,16 +63,7 @@ namespace castor
 
 		try
 		{
-			String regexString = RegexFormat< T >::Value;
-
-			for ( size_t i = 1; i < count; ++i )
-			{
-				regexString += String( details::VALUE_SEPARATOR ) + RegexFormat< T >::Value;
-			}
-
-			regexString += details::IGNORED_END;
-
-			const Regex regex{ regexString };
+			auto const & regex = details::getValuesRegex< T >( count );
 			auto begin = std::begin( params );
 			auto end = std::end( params );
 			const RegexIterator it( begin, end, regex );
@@ -280,10 +294,7 @@ namespace castor
 	{
 		try
 		{
-			String regexString = RegexFormat< ValueT >::Value;
-			regexString += details::IGNORED_END;
-
-			const Regex regex{ regexString };
+			static Regex const regex{ String{ RegexFormat< ValueT >::Value } + String{ details::IGNORED_END } };
 			auto begin = std::begin( params );
 			auto end = std::end( params );
 			const RegexIterator it( begin, end, regex );
@@ -846,7 +857,7 @@ namespace castor
 	inline bool ParserParameter< ParameterType::eName >::parse( CU_UnusedParam( LoggerInstance &, logger )
 		, String & params )
 	{
-		Regex regex{ cuT( "[^\"]*\"([^\"]*)\"" ) + String{ details::IGNORED_END } };
+		static Regex const regex{ cuT( "[^\"]*\"([^\"]*)\"" ) + String{ details::IGNORED_END } };
 		auto begin = std::begin( params );
 		auto end = std::end( params );
 		RegexIterator it( begin, end, regex );
@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "CastorUtils/Design/Named.hpp"
 #include "CastorUtils/Graphics/Glyph.hpp"
 #include "CastorUtils/Math/Point.hpp"
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
 
 namespace castor
 {
@@ -117,6 +118,22 @@ namespace castor
 			 *\return		Le glyphe.
 			 */
 			virtual Glyph loadGlyph( char32_t c ) = 0;
+			/**
+			 *\~english
+			 *\brief		Loads wanted glyphs.
+			 *\remarks		The default implementation loads them one after the other.
+			 *\param[in]	chars	The characters.
+			 *\param[in]	jobs	The job system used to load them in parallel, if any.
+			 *\return		The glyphs, in the characters order.
+			 *\~french
+			 *\brief		Charge les glyphes voulus.
+			 *\remarks		L'implémentation par défaut les charge l'un après l'autre.
+			 *\param[in]	chars	Les caractères.
+			 *\param[in]	jobs	Le système de tâches utilisé pour les charger en parallèle, s'il y en a un.
+			 *\return		Les glyphes, dans l'ordre des caractères.
+			 */
+			CU_API virtual GlyphArray loadGlyphs( Vector< char32_t > const & chars
+				, JobSystem * jobs );
 			/**
 			 *\~english
 			 *\brief			Completes the given kerning table for given glyph.
@@ -197,6 +214,18 @@ namespace castor
 		 *\param[in]	c	Le caractère.
 		 */
 		CU_API void loadGlyph( char32_t c );
+		/**
+		 *\~english
+		 *\brief		Loads wanted glyphs, the loader being initialised only once.
+		 *\param[in]	chars	The characters, the already loaded ones are ignored.
+		 *\param[in]	jobs	The job system used to rasterise them in parallel, if any.
+		 *\~french
+		 *\brief		Charge les glyphes voulus, le loader n'étant initialisé qu'une fois.
+		 *\param[in]	chars	Les caractères, ceux déjà chargés sont ignorés.
+		 *\param[in]	jobs	Le système de tâches utilisé pour les rastériser en parallèle, s'il y en a un.
+		 */
+		CU_API void loadGlyphs( Vector< char32_t > const & chars
+			, JobSystem * jobs = nullptr );
 		/**
 		 *\~english
 		 *\brief		Retrieves the metrics of given text.
@@ -483,6 +512,17 @@ namespace castor
 		 *\return		Le glyphe.
 		 */
 		Glyph const & doLoadGlyph( char32_t c );
+		/**
+		 *\~english
+		 *\brief		Adds a loaded glyph, and updates the font metrics and kerning table.
+		 *\param[in]	glyph	The glyph.
+		 *\return		The added glyph.
+		 *\~french
+		 *\brief		Ajoute une glyphe chargée, et met à jour les métriques et la table de kerning de la police.
+		 *\param[in]	glyph	La glyphe.
+		 *\return		La glyphe ajoutée.
+		 */
+		Glyph const & doAddGlyph( Glyph glyph );
 
 	private:
 		uint32_t m_height{};
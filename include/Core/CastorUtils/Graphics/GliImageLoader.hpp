@@ -27,6 +27,20 @@ namespace castor
 			, uint8_t const * data
 			, uint32_t size
 			, PxBufferBaseUPtr & buffer )const override;
+		/**
+		 *\copydoc castor::ImageLoaderImpl::decode
+		 */
+		CU_API void decode( String const & imageFormat
+			, uint8_t const * data
+			, uint32_t size
+			, ImagePixelsConsumer const & consumer )const override;
+		/**
+		 *\copydoc castor::ImageLoaderImpl::exposesStorage
+		 */
+		bool exposesStorage()const noexcept override
+		{
+			return true;
+		}
 	};
 }
 
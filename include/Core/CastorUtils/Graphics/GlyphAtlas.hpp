@@ -0,0 +1,223 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_GlyphAtlas_HPP___
+#define ___CU_GlyphAtlas_HPP___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Graphics/PixelFormat.hpp"
+#include "CastorUtils/Graphics/Position.hpp"
+#include "CastorUtils/Graphics/Size.hpp"
+#include "CastorUtils/Graphics/SkylinePacker.hpp"
+
+namespace castor
+{
+	class GlyphAtlas
+	{
+	public:
+		using GlyphGetter = Function< Glyph const *( char32_t ) >;
+		using PositionMap = Map< char32_t, Position >;
+
+		struct Region
+		{
+			uint32_t left{};
+			uint32_t top{};
+			uint32_t right{};
+			uint32_t bottom{};
+
+			bool empty()const noexcept
+			{
+				return right <= left || bottom <= top;
+			}
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	getGlyph	Retrieves a glyph from its character, nullptr if it is not loaded.
+		 *\param[in]	format		The atlas pixel format, the glyphs bitmaps format.
+		 *\param[in]	width		The atlas width, which is fixed.
+		 *\param[in]	pageHeight	The atlas height grows by this value.
+		 *\param[in]	maxHeight	The atlas maximum height.
+		 *\param[in]	bitmapOnly	\p true if the glyphs texture coordinates only use their bitmap size (SDF fonts),
+		 *							\p false if they also use their metrics size.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	getGlyph	Récupère une glyphe depuis son caractère, nullptr si elle n'est pas chargée.
+		 *\param[in]	format		Le format des pixels de l'atlas, celui des bitmaps des glyphes.
+		 *\param[in]	width		La largeur de l'atlas, qui est fixe.
+		 *\param[in]	pageHeight	La hauteur de l'atlas grandit de cette valeur.
+		 *\param[in]	maxHeight	La hauteur maximale de l'atlas.
+		 *\param[in]	bitmapOnly	\p true si les coordonnées de texture des glyphes n'utilisent que la taille de leur bitmap (polices SDF),
+		 *							\p false si elles utilisent aussi la taille de leurs métriques.
+		 */
+		CU_API GlyphAtlas( GlyphGetter getGlyph
+			, PixelFormat format
+			, uint32_t width
+			, uint32_t pageHeight
+			, uint32_t maxHeight
+			, bool bitmapOnly );
+		/**
+		 *\~english
+		 *\brief		Adds the missing glyphs of a text to the atlas, without referencing them.
+		 *\remarks		When the atlas is full, it grows, and when it reached its maximum size,
+		 *				the glyphs that are not referenced are evicted from it.
+		 *\param[in]	text	The text.
+		 *\return		\p true if the atlas layout has changed, and a refresh must be started.
+		 *\~french
+		 *\brief		Ajoute les glyphes manquantes d'un texte à l'atlas, sans les référencer.
+		 *\remarks		Quand l'atlas est plein, il grandit, et quand il a atteint sa taille maximale,
+		 *				les glyphes non référencées en sont retirées.
+		 *\param[in]	text	Le texte.
+		 *\return		\p true si la disposition de l'atlas a changé, et qu'un rafraîchissement doit être lancé.
+		 */
+		CU_API bool addGlyphs( U32String const & text );
+		/**
+		 *\~english
+		 *\brief		References the glyphs of a text, and adds the missing ones to the atlas.
+		 *\remarks		The referenced glyphs are never evicted.
+		 *\param[in]	text	The text.
+		 *\return		\p true if the atlas layout has changed, and a refresh must be started.
+		 *\~french
+		 *\brief		Référence les glyphes d'un texte, et ajoute celles manquantes à l'atlas.
+		 *\remarks		Les glyphes référencées ne sont jamais retirées.
+		 *\param[in]	text	Le texte.
+		 *\return		\p true si la disposition de l'atlas a changé, et qu'un rafraîchissement doit être lancé.
+		 */
+		CU_API bool useGlyphs( U32String const & text );
+		/**
+		 *\~english
+		 *\brief		Releases the references taken by useGlyphs on the glyphs of a text.
+		 *\param[in]	text	The text.
+		 *\~french
+		 *\brief		Libère les références prises par useGlyphs sur les glyphes d'un texte.
+		 *\param[in]	text	Le texte.
+		 */
+		CU_API void releaseGlyphs( U32String const & text );
+		/**
+		 *\~english
+		 *\brief		Publishes the current layout, when all the textures have received the whole atlas.
+		 *\~french
+		 *\brief		Publie la disposition actuelle, quand toutes les textures ont reçu l'atlas entier.
+		 */
+		CU_API void publish();
+		/**
+		 *\~english
+		 *\brief		To call when the back texture receives the whole atlas.
+		 *\remarks		The glyphs added from now on go to the back texture, until endRefresh.
+		 *\~french
+		 *\brief		A appeler quand la texture arrière reçoit l'atlas entier.
+		 *\remarks		Les glyphes ajoutées à partir de maintenant vont dans la texture arrière, jusqu'à endRefresh.
+		 */
+		CU_API void beginRefresh();
+		/**
+		 *\~english
+		 *\brief		To call when the back texture becomes the front one, publishes its layout.
+		 *\return		\p true if the layout has changed again since beginRefresh, and a new refresh must be started.
+		 *\~french
+		 *\brief		A appeler quand la texture arrière devient celle de devant, publie sa disposition.
+		 *\return		\p true si la disposition a encore changé depuis beginRefresh, et qu'un nouveau rafraîchissement doit être lancé.
+		 */
+		CU_API bool endRefresh();
+		/**
+		 *\~english
+		 *\brief		To call when the front region has been uploaded to the front texture.
+		 *\~french
+		 *\brief		A appeler quand la région de devant a été uploadée dans la texture de devant.
+		 */
+		CU_API void clearFrontRegion()noexcept;
+		/**
+		 *\~english
+		 *\param[in]	c	The glyph character.
+		 *\return		The glyph position in the front texture, nullptr if it isn't in it.
+		 *\~french
+		 *\param[in]	c	Le caractère de la glyphe.
+		 *\return		La position de la glyphe dans la texture de devant, nullptr si elle n'y est pas.
+		 */
+		CU_API Position const * getPosition( char32_t c )const;
+		/**
+		 *\~english
+		 *name Getters.
+		 *\~french
+		 *name Accesseurs.
+		**/
+		/**@{*/
+		bool isResident( char32_t c )const
+		{
+			return m_positions.end() != m_positions.find( c );
+		}
+
+		bool isEvicted( char32_t c )const
+		{
+			return m_evicted.end() != m_evicted.find( c );
+		}
+
+		bool isRefreshing()const noexcept
+		{
+			return m_refreshing;
+		}
+
+		Region const & getFrontRegion()const noexcept
+		{
+			return m_front.region;
+		}
+
+		Size const & getSize()const noexcept
+		{
+			return m_size;
+		}
+
+		ByteArray const & getData()const noexcept
+		{
+			return m_data;
+		}
+		/**@}*/
+
+	private:
+		struct View
+		{
+			// The glyphs positions in the texture.
+			PositionMap positions;
+			// The atlas region written since the texture received the whole atlas.
+			Region region;
+			// The glyphs in this region.
+			Vector< char32_t > pending;
+		};
+
+	private:
+		bool doIsReferenced( char32_t c )const;
+		Size doGetPaddedSize( Glyph const & glyph )const;
+		bool doInsert( Glyph const & glyph );
+		void doWrite( Glyph const & glyph
+			, Position const & position );
+		void doChangeLayout()noexcept;
+		void doGrow();
+		bool doEvict();
+
+	private:
+		GlyphGetter m_getGlyph;
+		uint32_t m_pixelSize;
+		uint32_t m_pageHeight;
+		uint32_t m_maxHeight;
+		bool m_bitmapOnly;
+		SkylinePacker m_packer;
+		ByteArray m_data;
+		Size m_size;
+		PositionMap m_positions;
+		Map< char32_t, uint32_t > m_references;
+		Set< char32_t > m_evicted;
+		//!\~english	The layouts of the front and back textures.
+		//!\~french		Les dispositions des textures de devant et arrière.
+		View m_front;
+		View m_back;
+		bool m_published{};
+		bool m_refreshing{};
+		//!\~english	The layout has changed since the last publication, and the textures need a refresh.
+		//!\~french		La disposition a changé depuis la dernière publication, et les textures doivent être rafraîchies.
+		bool m_layoutChanged{};
+	};
+}
+
+#endif
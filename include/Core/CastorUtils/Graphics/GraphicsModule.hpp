@@ -309,6 +309,13 @@ namespace castor
 	class Glyph;
 	/**
 	\~english
+	\brief		Glyphs atlas, packed with a SkylinePacker, which tracks the glyphs layout of a double buffered texture.
+	\~french
+	\brief		Atlas de glyphes, rangées avec un SkylinePacker, qui suit la disposition des glyphes d'une texture à double tampon.
+	*/
+	class GlyphAtlas;
+	/**
+	\~english
 	\brief		Scalable and movable grid.
 	\~french
 	\brief		Grille redimensionnable et déplaçable.
@@ -811,6 +818,13 @@ namespace castor
 	class Size;
 	/**
 	\~english
+	\brief		Packs rectangles in an area, following its skyline.
+	\~french
+	\brief		Range des rectangles dans une zone, en suivant sa ligne d'horizon.
+	*/
+	class SkylinePacker;
+	/**
+	\~english
 	\brief		Unsupported format exception
 	\~french
 	\brief		Unsupported format exception
@@ -11,6 +11,10 @@ See LICENSE file in root folder
 #include "CastorUtils/Design/Resource.hpp"
 #include "CastorUtils/Design/ResourceCache.hpp"
 
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <mutex>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
 namespace castor
 {
 	/**
@@ -96,6 +100,61 @@ namespace castor
 			, PxBufferBaseUPtr buffer );
 	};
 	using ImageCacheTraits = ResourceCacheTraitsT< Image, String >;
+
+	namespace details
+	{
+		struct ImageLoadState;
+		using ImageLoadStatePtr = SharedPtr< ImageLoadState >;
+	}
+	/**
+	*\~english
+	*	Handle to an asynchronous image load.
+	*\remarks
+	*	Concurrent requests for the same image share the same handle.
+	*\~french
+	*	Handle sur un chargement asynchrone d'image.
+	*\remarks
+	*	Les requêtes concurrentes pour la même image partagent le même handle.
+	*/
+	class ImageLoadHandle
+	{
+		friend class ResourceCacheT< Image, String, ImageCacheTraits >;
+
+	public:
+		ImageLoadHandle() = default;
+		/**
+		 *\~english
+		 *\return		\p true if the image load is over (successfully or not).
+		 *\~french
+		 *\return		\p true si le chargement de l'image est terminé (avec succès ou non).
+		 */
+		CU_API bool isDone()const noexcept;
+		/**
+		 *\~english
+		 *\brief		Waits for the image load end.
+		 *\remarks		Rethrows the exception thrown while loading, if any.
+		 *\return		The image, added to the cache.
+		 *\~french
+		 *\brief		Attend la fin du chargement de l'image.
+		 *\remarks		Relance l'exception lancée pendant le chargement, s'il y en a eu une.
+		 *\return		L'image, ajoutée au cache.
+		 */
+		CU_API ImageCacheTraits::ElementObsT wait()const;
+
+		bool isValid()const noexcept
+		{
+			return m_state != nullptr;
+		}
+
+	private:
+		explicit ImageLoadHandle( details::ImageLoadStatePtr state )
+			: m_state{ castor::move( state ) }
+		{
+		}
+
+	private:
+		details::ImageLoadStatePtr m_state;
+	};
 	/**
 	*\~english
 	*	Base class for an element cache.
@@ -133,9 +192,62 @@ namespace castor
 		}
 
 		CU_API PixelFormat getImageFormat( String const & name )const;
+		/**
+		 *\~english
+		 *\brief		Loads an image on the job system, and adds it to the cache.
+		 *\remarks		If the image is already loading, the pending load handle is returned.
+		 *				Without job system, the image is loaded synchronously.
+		 *\param[in]	name	The image name.
+		 *\param[in]	params	The image creation parameters.
+		 *\return		The load handle.
+		 *\~french
+		 *\brief		Charge une image sur le système de tâches, et l'ajoute au cache.
+		 *\remarks		Si l'image est déjà en cours de chargement, le handle du chargement en cours est retourné.
+		 *				Sans système de tâches, l'image est chargée de manière synchrone.
+		 *\param[in]	name	Le nom de l'image.
+		 *\param[in]	params	Les paramètres de création de l'image.
+		 *\return		Le handle du chargement.
+		 */
+		CU_API ImageLoadHandle loadAsync( String const & name
+			, ImageCreateParams params );
+		/**
+		 *\~english
+		 *\brief		Sets the job system used by loadAsync.
+		 *\~french
+		 *\brief		Définit le système de tâches utilisé par loadAsync.
+		 */
+		void setJobSystem( JobSystem * jobs )noexcept
+		{
+			m_jobs = jobs;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the folder storing the decoded, mipmapped and compressed images, keyed by content and loading options.
+		 *\remarks		An empty folder disables the disk cache.
+		 *\~french
+		 *\brief		Définit le dossier stockant les images décodées, mipmappées et compressées, indexées par contenu et options de chargement.
+		 *\remarks		Un dossier vide désactive le cache disque.
+		 */
+		void setDiskCacheFolder( Path folder )
+		{
+			m_diskCacheFolder = castor::move( folder );
+		}
+
+		Path const & getDiskCacheFolder()const noexcept
+		{
+			return m_diskCacheFolder;
+		}
+
+	private:
+		ElementObsT doLoad( String const & name
+			, ImageCreateParams const & params );
 
 	private:
 		ImageLoader const & m_loader;
+		JobSystem * m_jobs{};
+		Path m_diskCacheFolder;
+		std::mutex m_pendingMutex;
+		StringMap< details::ImageLoadStatePtr > m_pending;
 	};
 
 	using ImageCache = ResourceCacheT< Image, String, ImageCacheTraits >;
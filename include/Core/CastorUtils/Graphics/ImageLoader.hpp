@@ -13,6 +13,51 @@ See LICENSE file in root folder
 
 namespace castor
 {
+	/**
+	\~english
+	\brief		Receives the decoded pixels of an image, for all its layers and levels.
+	\remarks		The pixels are owned by the decoder, they are only valid during the call.
+	\param[in]	layout	The pixels layout.
+	\param[in]	pixels	The pixels.
+	\param[in]	flipped	\p true if the rows are stored bottom-up.
+	\~french
+	\brief		Reçoit les pixels décodés d'une image, pour toutes ses couches et tous ses niveaux.
+	\remarks		Les pixels appartiennent au décodeur, ils ne sont valides que pendant l'appel.
+	\param[in]	layout	Le layout des pixels.
+	\param[in]	pixels	Les pixels.
+	\param[in]	flipped	\p true si les lignes sont stockées de bas en haut.
+	*/
+	using ImagePixelsConsumer = castor::Function< void( ImageLayout const & layout, ConstByteArrayView pixels, bool flipped ) >;
+	/**
+	\~english
+	\brief		Gives the memory receiving a streamed image (a mapped staging buffer, for example).
+	\remarks		An empty view declines the image, which is then not written.
+	\param[in]	layout	The image layout, the memory must hold at least layout.size() bytes.
+	\~french
+	\brief		Donne la mémoire recevant une image chargée en flux (un staging buffer mappé, par exemple).
+	\remarks		Une vue vide décline l'image, qui n'est alors pas écrite.
+	\param[in]	layout	Le layout de l'image, la mémoire doit contenir au moins layout.size() octets.
+	*/
+	using ImageStagingAllocator = castor::Function< ByteArrayView( ImageLayout const & layout ) >;
+	/**
+	\~english
+	\brief		An image loaded into caller provided memory.
+	\~french
+	\brief		Une image chargée dans une mémoire fournie par l'appelant.
+	*/
+	struct StagedImage
+	{
+		//!\~english	The image layout, in the target format.
+		//!\~french		Le layout de l'image, dans le format cible.
+		ImageLayout layout;
+		//!\~english	The memory given by the staging allocator.
+		//!\~french		La mémoire donnée par l'allocateur de staging.
+		ByteArrayView data;
+		//!\~english	\p true if the rows are stored bottom-up.
+		//!\~french		\p true si les lignes sont stockées de bas en haut.
+		bool flipped{};
+	};
+
 	class ImageLoaderImpl
 		: public NonMovable
 	{
@@ -38,6 +83,36 @@ namespace castor
 			, uint8_t const * data
 			, uint32_t size
 			, PxBufferBaseUPtr & buffer )const = 0;
+		/**
+		 *\~english
+		 *\brief		Decodes an image file data and gives the decoded pixels to the consumer.
+		 *\remarks		The default implementation decodes into a PxBufferBase, loaders able to expose their own storage override it.
+		 *\param[in]	imageFormat	The image format, loader wise.
+		 *\param[in]	data		The image data.
+		 *\param[in]	size		The image data size.
+		 *\param[in]	consumer	Receives the decoded pixels.
+		 *\~french
+		 *\brief		Décode les données d'un fichier image et donne les pixels décodés au consommateur.
+		 *\remarks		L'implémentation par défaut décode dans un PxBufferBase, les loaders pouvant exposer leur propre stockage la surchargent.
+		 *\param[in]	imageFormat	Le format de l'image, niveau loader.
+		 *\param[in]	data		Les données de l'image.
+		 *\param[in]	size		La taille des données de l'image.
+		 *\param[in]	consumer	Reçoit les pixels décodés.
+		 */
+		CU_API virtual void decode( String const & imageFormat
+			, uint8_t const * data
+			, uint32_t size
+			, ImagePixelsConsumer const & consumer )const;
+		/**
+		 *\~english
+		 *\return		\p true if decode gives the decoder storage, without copy.
+		 *\~french
+		 *\return		\p true si decode donne le stockage du décodeur, sans copie.
+		 */
+		virtual bool exposesStorage()const noexcept
+		{
+			return false;
+		}
 		/**
 		 *\~english
 		 *\brief		Loads an image file data.
@@ -211,11 +286,74 @@ namespace castor
 			, uint8_t const * data
 			, uint32_t size
 			, ImageLoaderConfig const & config )const;
+		/**
+		 *\~english
+		 *\brief		Maps an image file and gives its decoded pixels to the consumer, without intermediate Image.
+		 *\remarks		For KTX, DDS and KMG files, the pixels are the decoder storage, the mip levels can be read from it with the given layout.
+		 *\param[in]	path		The image file path.
+		 *\param[in]	consumer	Receives the decoded pixels.
+		 *\~french
+		 *\brief		Mappe un fichier image et donne ses pixels décodés au consommateur, sans Image intermédiaire.
+		 *\remarks		Pour les fichiers KTX, DDS et KMG, les pixels sont le stockage du décodeur, les niveaux de mip peuvent y être lus avec le layout donné.
+		 *\param[in]	path		Le chemin d'accès au fichier image.
+		 *\param[in]	consumer	Reçoit les pixels décodés.
+		 */
+		CU_API void decode( Path const & path
+			, ImagePixelsConsumer const & consumer )const;
+		/**
+		 *\~english
+		 *\param[in]	path	The image file path.
+		 *\return		\p true if the loader for given file gives its decoded pixels without copy (KTX, DDS and KMG files).
+		 *\~french
+		 *\param[in]	path	Le chemin d'accès au fichier image.
+		 *\return		\p true si le loader du fichier donné donne ses pixels décodés sans copie (fichiers KTX, DDS et KMG).
+		 */
+		CU_API bool exposesStorage( Path const & path )const;
+		/**
+		 *\~english
+		 *\brief		Maps an image file and decodes it directly into caller provided memory, in the target format.
+		 *\param[in]	path			The image file path.
+		 *\param[in]	targetFormat	The wanted pixel format, PixelFormat::eUNDEFINED to keep the image one.
+		 *\param[in]	allocate		Gives the memory receiving the image.
+		 *\param[in]	config			The loader configuration.
+		 *\return		The image, in the memory given by \p allocate, with empty data if \p allocate declined it.
+		 *\~french
+		 *\brief		Mappe un fichier image et le décode directement dans une mémoire fournie par l'appelant, dans le format cible.
+		 *\param[in]	path			Le chemin d'accès au fichier image.
+		 *\param[in]	targetFormat	Le format de pixels voulu, PixelFormat::eUNDEFINED pour garder celui de l'image.
+		 *\param[in]	allocate		Donne la mémoire recevant l'image.
+		 *\param[in]	config			La configuration du loader.
+		 *\return		L'image, dans la mémoire donnée par \p allocate, avec des données vides si \p allocate l'a déclinée.
+		 */
+		CU_API StagedImage loadStaged( Path const & path
+			, PixelFormat targetFormat
+			, ImageStagingAllocator const & allocate
+			, ImageLoaderConfig const & config )const;
 
 		void setCompressionSupport( PxCompressionSupport support )
 		{
 			m_options.support = castor::move( support );
 		}
+		/**
+		 *\~english
+		 *\brief		Sets the job system used to compress images in parallel.
+		 *\~french
+		 *\brief		Définit le système de tâches utilisé pour compresser les images en parallèle.
+		 */
+		void setJobSystem( JobSystem * jobs )
+		{
+			m_options.jobs = jobs;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the callback receiving the block compression progress, must be thread safe.
+		 *\~french
+		 *\brief		Définit le callback recevant la progression de la compression par blocs, doit être thread safe.
+		 */
+		void setCompressionProgress( PxCompressionProgress progress )
+		{
+			m_options.progress = castor::move( progress );
+		}
 
 		PxBufferConvertOptions const & getOptions()const
 		{
@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "CastorUtils/Graphics/Size.hpp"
 #include "CastorUtils/Graphics/Position.hpp"
 #include "CastorUtils/Math/Point.hpp"
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
 
 #include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
 #include <atomic>
@@ -25,6 +26,18 @@ namespace castor
 		bool supportBC7{ false };
 	};
 
+	/**
+	 *\~english
+	 *\brief		Block compression progress callback.
+	 *\param[in]	done	The compressed blocks count.
+	 *\param[in]	total	The blocks count of the compressed image level.
+	 *\~french
+	 *\brief		Callback de progression de la compression par blocs.
+	 *\param[in]	done	Le nombre de blocs compressés.
+	 *\param[in]	total	Le nombre de blocs du niveau d'image compressé.
+	 */
+	using PxCompressionProgress = castor::Function< void( uint32_t done, uint32_t total ) >;
+
 	struct PxBufferConvertOptions
 		: public NonMovable
 	{
@@ -36,6 +49,12 @@ namespace castor
 
 		PxCompressionSupport support;
 		void * additionalOptions{ nullptr };
+		//!\~english	The job system used to compress tiles of blocks in parallel, compression is done on the calling thread if null.
+		//!\~french		Le système de tâches utilisé pour compresser des tuiles de blocs en parallèle, la compression est faite sur le thread appelant s'il est nul.
+		JobSystem * jobs{ nullptr };
+		//!\~english	Called each time a tile of blocks is compressed, possibly from a job thread.
+		//!\~french		Appelé à chaque fois qu'une tuile de blocs est compressée, potentiellement depuis un thread de tâche.
+		PxCompressionProgress progress{};
 	};
 
 	class PxBufferBase
@@ -1,4 +1,5 @@
 #include "CastorUtils/Graphics/PixelComponents.hpp"
+#include "CastorUtils/Graphics/PixelRowConverter.hpp"
 #include "CastorUtils/Graphics/UnsupportedFormatException.hpp"
 #include "CastorUtils/Miscellaneous/StringUtils.hpp"
 #include "CastorUtils/Exception/Assertion.hpp"
@@ -158,6 +159,74 @@ namespace castor
 		};
 		/**
 		\~english
+		\brief		Structure used to convert a row of pixels from one format to another one.
+		\remarks	Uses a specialised kernel when both formats are handled by one, the generic per pixel conversion otherwise.
+		\~french
+		\brief		Structure utilisée pour convertir une ligne de pixels d'un format vers un autre.
+		\remarks	Utilise un kernel spécialisé quand les deux formats sont gérés par l'un d'eux, la conversion générique par pixel sinon.
+		*/
+		template< PixelFormat PFSrc, PixelFormat PFDst >
+		struct RowConverter
+		{
+			using SrcRow = PxRowLayoutT< PFSrc >;
+			using DstRow = PxRowLayoutT< PFDst >;
+
+			static bool constexpr Specialised = PFSrc != PFDst
+				&& ( ( SrcRow::Type == PxRowType::eU8 && DstRow::Type == PxRowType::eU8 )
+					|| ( SrcRow::Type == PxRowType::eF32 && DstRow::Type == PxRowType::eF16 )
+					|| ( SrcRow::Type == PxRowType::eF16 && DstRow::Type == PxRowType::eF32 ) );
+
+			void operator()( uint8_t const * srcBuffer
+				, uint8_t * dstBuffer
+				, size_t count )const
+			{
+				if ( !count )
+				{
+					return;
+				}
+
+				// The components absent from the source are retrieved from the generic accessors,
+				// in order to give the same result as the per pixel conversion.
+				if constexpr ( !Specialised )
+				{
+					PixelConverter< PFSrc, PFDst > converter;
+
+					for ( size_t i = 0; i < count; i++ )
+					{
+						converter( srcBuffer, dstBuffer );
+					}
+				}
+				else if constexpr ( SrcRow::Type == PxRowType::eU8 )
+				{
+					convertRowU8( SrcRow::Layout
+						, srcBuffer
+						, DstRow::Layout
+						, dstBuffer
+						, { getR8U< PFSrc >( srcBuffer ), getG8U< PFSrc >( srcBuffer ), getB8U< PFSrc >( srcBuffer ), getA8U< PFSrc >( srcBuffer ) }
+						, count );
+				}
+				else if constexpr ( SrcRow::Type == PxRowType::eF32 )
+				{
+					convertRowF32ToF16( SrcRow::Layout
+						, reinterpret_cast< float const * >( srcBuffer )
+						, DstRow::Layout
+						, reinterpret_cast< int16_t * >( dstBuffer )
+						, { getR16F< PFSrc >( srcBuffer ), getG16F< PFSrc >( srcBuffer ), getB16F< PFSrc >( srcBuffer ), getA16F< PFSrc >( srcBuffer ) }
+						, count );
+				}
+				else
+				{
+					convertRowF16ToF32( SrcRow::Layout
+						, reinterpret_cast< int16_t const * >( srcBuffer )
+						, DstRow::Layout
+						, reinterpret_cast< float * >( dstBuffer )
+						, { getR32F< PFSrc >( srcBuffer ), getG32F< PFSrc >( srcBuffer ), getB32F< PFSrc >( srcBuffer ), getA32F< PFSrc >( srcBuffer ) }
+						, count );
+				}
+			}
+		};
+		/**
+		\~english
 		\brief		Structure used to convert a buffer from one pixel format to another one
 		\~french
 		\brief		Structure utilisée pour convertir un buffer d'un format de pixels vers un autre
@@ -165,7 +234,7 @@ namespace castor
 		template< PixelFormat PFSrc, PixelFormat PFDst, typename EnableT = void >
 		struct BufferConverter
 		{
-			void operator()( CU_UnusedParam( PxBufferConvertOptions const * const, options )
+			void operator()( PxBufferConvertOptions const * const options
 				, Size const & srcDimensions
 				, Size const & dstDimensions
 				, uint8_t const * srcBuffer
@@ -173,8 +242,6 @@ namespace castor
 				, uint8_t * dstBuffer
 				, uint32_t dstSize )
 			{
-				uint8_t const * src = &srcBuffer[0];
-				uint8_t * dst = &dstBuffer[0];
 				uint32_t count = uint32_t( srcSize / getBytesPerPixel( PFSrc ) );
 				CU_Require( srcSize / getBytesPerPixel( PFSrc ) == dstSize / getBytesPerPixel( PFDst ) );
 
@@ -186,12 +253,15 @@ namespace castor
 				}
 				else
 				{
-					PixelConverter< PFSrc, PFDst > converter;
-
-					for ( uint32_t i = 0; i < count; i++ )
-					{
-						converter( src, dst );
-					}
+					convertRowBands( options
+						, srcDimensions
+						, count
+						, [srcBuffer, dstBuffer]( size_t begin, size_t end )
+						{
+							RowConverter< PFSrc, PFDst >()( srcBuffer + begin * getBytesPerPixel( PFSrc )
+								, dstBuffer + begin * getBytesPerPixel( PFDst )
+								, end - begin );
+						} );
 				}
 			}
 		};
@@ -302,6 +302,41 @@ namespace castor
 		, PixelFormat dstFormat
 		, uint8_t * dstBuffer
 		, uint32_t dstSize );
+	/**
+	 *\~english
+	 *\brief		Function to perform convertion without templates.
+	 *\remarks		Large buffers are converted by bands of rows, in parallel if the options hold a job system.
+	 *\param[in]	options			The convertion options, may be null.
+	 *\param[in]	srcDimensions	The source dimensions.
+	 *\param[in]	dstDimensions	The destination dimensions (used only when block compressing).
+	 *\param[in]	srcFormat		The source format.
+	 *\param[in]	srcBuffer		The source buffer.
+	 *\param[in]	srcSize			The source size.
+	 *\param[in]	dstFormat		The destination format.
+	 *\param[in]	dstBuffer		The destination buffer.
+	 *\param[in]	dstSize			The destination size.
+	 *\~french
+	 *\brief		Fonction de conversion sans templates.
+	 *\remarks		Les buffers volumineux sont convertis par bandes de lignes, en parallèle si les options contiennent un système de tâches.
+	 *\param[in]	options			Les options de conversion, peut être nul.
+	 *\param[in]	srcDimensions	Les dimensions de la source.
+	 *\param[in]	dstDimensions	Les dimensions de la destination (utilisé uniquement lors d'une compression par blocs).
+	 *\param[in]	srcFormat		Le format de la source.
+	 *\param[in]	srcBuffer		Le buffer source.
+	 *\param[in]	srcSize			La taille de la source.
+	 *\param[in]	dstFormat		Le format de la destination.
+	 *\param[in]	dstBuffer		Le buffer destination.
+	 *\param[in]	dstSize			La taille de la destination.
+	 */
+	CU_API void convertBuffer( PxBufferConvertOptions const * options
+		, Size const & srcDimensions
+		, Size const & dstDimensions
+		, PixelFormat srcFormat
+		, uint8_t const * srcBuffer
+		, uint32_t srcSize
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize );
 	/**
 	 *\~english
 	 *\brief		Function to perform convertion without templates.
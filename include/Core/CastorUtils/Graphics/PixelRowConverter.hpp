@@ -0,0 +1,184 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_PixelRowConverter___
+#define ___CU_PixelRowConverter___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+#include "CastorUtils/Graphics/Size.hpp"
+
+namespace castor
+{
+	namespace details
+	{
+		/**
+		\~english
+		\brief		The components storage handled by the specialised row kernels.
+		\~french
+		\brief		Le stockage des composantes géré par les kernels de lignes spécialisés.
+		*/
+		enum class PxRowType
+			: uint8_t
+		{
+			//!\~english	Not handled, the generic per pixel conversion is used.
+			//!\~french		Non géré, la conversion générique par pixel est utilisée.
+			eNone,
+			//!\~english	8 bits unsigned components.
+			//!\~french		Composantes 8 bits non signées.
+			eU8,
+			//!\~english	16 bits float components (stored as 16 bits signed normalised values).
+			//!\~french		Composantes flottantes 16 bits (stockées en tant que valeurs 16 bits signées normalisées).
+			eF16,
+			//!\~english	32 bits float components.
+			//!\~french		Composantes flottantes 32 bits.
+			eF32,
+		};
+		/**
+		\~english
+		\brief		Describes the layout of a pixel, for the row kernels.
+		\~french
+		\brief		Décrit la disposition d'un pixel, pour les kernels de lignes.
+		*/
+		struct PxRowLayout
+		{
+			//!\~english	The components count of a pixel.
+			//!\~french		Le nombre de composantes d'un pixel.
+			uint32_t count{};
+			//!\~english	The index of R, G, B and A components in the pixel, -1 when the component is absent.
+			//!\~french		L'indice des composantes R, G, B et A dans le pixel, -1 quand la composante est absente.
+			Array< int8_t, 4u > indices{ -1, -1, -1, -1 };
+		};
+		/**
+		\~english
+		\brief		Row kernel description of a pixel format, not handled by default.
+		\~french
+		\brief		Description d'un format de pixels pour les kernels de lignes, non géré par défaut.
+		*/
+		template< PixelFormat PFT >
+		struct PxRowLayoutT
+		{
+			static PxRowType constexpr Type = PxRowType::eNone;
+			static PxRowLayout constexpr Layout{};
+		};
+
+#define CU_PxRowLayout( format, type, count, r, g, b, a )\
+		template<>\
+		struct PxRowLayoutT< PixelFormat::format >\
+		{\
+			static PxRowType constexpr Type = PxRowType::type;\
+			static PxRowLayout constexpr Layout{ count, { r, g, b, a } };\
+		}
+
+		// sRGB formats share the UNORM components accessors, so their conversion is a plain bytes move.
+		CU_PxRowLayout( eR8_UNORM, eU8, 1u, 0, -1, -1, -1 );
+		CU_PxRowLayout( eR8_SRGB, eU8, 1u, 0, -1, -1, -1 );
+		CU_PxRowLayout( eR8G8_UNORM, eU8, 2u, 0, 1, -1, -1 );
+		CU_PxRowLayout( eR8G8_SRGB, eU8, 2u, 0, 1, -1, -1 );
+		CU_PxRowLayout( eR8G8B8_UNORM, eU8, 3u, 0, 1, 2, -1 );
+		CU_PxRowLayout( eR8G8B8_SRGB, eU8, 3u, 0, 1, 2, -1 );
+		CU_PxRowLayout( eB8G8R8_UNORM, eU8, 3u, 2, 1, 0, -1 );
+		CU_PxRowLayout( eB8G8R8_SRGB, eU8, 3u, 2, 1, 0, -1 );
+		CU_PxRowLayout( eR8G8B8A8_UNORM, eU8, 4u, 0, 1, 2, 3 );
+		CU_PxRowLayout( eR8G8B8A8_SRGB, eU8, 4u, 0, 1, 2, 3 );
+		CU_PxRowLayout( eB8G8R8A8_UNORM, eU8, 4u, 2, 1, 0, 3 );
+		CU_PxRowLayout( eB8G8R8A8_SRGB, eU8, 4u, 2, 1, 0, 3 );
+		CU_PxRowLayout( eR16G16B16A16_SFLOAT, eF16, 4u, 0, 1, 2, 3 );
+		CU_PxRowLayout( eR32_SFLOAT, eF32, 1u, 0, -1, -1, -1 );
+		CU_PxRowLayout( eR32G32B32A32_SFLOAT, eF32, 4u, 0, 1, 2, 3 );
+
+#undef CU_PxRowLayout
+
+		/**
+		 *\~english
+		 *\brief		Converts a row of pixels with 8 bits unsigned components.
+		 *\param[in]	srcLayout	The source pixels layout.
+		 *\param[in]	src			The source pixels.
+		 *\param[in]	dstLayout	The destination pixels layout.
+		 *\param[out]	dst			The destination pixels.
+		 *\param[in]	defaults	The R, G, B and A values used for the components absent from the source.
+		 *\param[in]	count		The pixels count.
+		 *\~french
+		 *\brief		Convertit une ligne de pixels ayant des composantes 8 bits non signées.
+		 *\param[in]	srcLayout	La disposition des pixels source.
+		 *\param[in]	src			Les pixels source.
+		 *\param[in]	dstLayout	La disposition des pixels destination.
+		 *\param[out]	dst			Les pixels destination.
+		 *\param[in]	defaults	Les valeurs R, G, B et A utilisées pour les composantes absentes de la source.
+		 *\param[in]	count		Le nombre de pixels.
+		 */
+		CU_API void convertRowU8( PxRowLayout const & srcLayout
+			, uint8_t const * src
+			, PxRowLayout const & dstLayout
+			, uint8_t * dst
+			, Array< uint8_t, 4u > const & defaults
+			, size_t count );
+		/**
+		 *\~english
+		 *\brief		Converts a row of pixels with 32 bits float components to 16 bits float components.
+		 *\param[in]	srcLayout	The source pixels layout.
+		 *\param[in]	src			The source pixels.
+		 *\param[in]	dstLayout	The destination pixels layout.
+		 *\param[out]	dst			The destination pixels.
+		 *\param[in]	defaults	The R, G, B and A values used for the components absent from the source.
+		 *\param[in]	count		The pixels count.
+		 *\~french
+		 *\brief		Convertit une ligne de pixels ayant des composantes flottantes 32 bits en composantes flottantes 16 bits.
+		 *\param[in]	srcLayout	La disposition des pixels source.
+		 *\param[in]	src			Les pixels source.
+		 *\param[in]	dstLayout	La disposition des pixels destination.
+		 *\param[out]	dst			Les pixels destination.
+		 *\param[in]	defaults	Les valeurs R, G, B et A utilisées pour les composantes absentes de la source.
+		 *\param[in]	count		Le nombre de pixels.
+		 */
+		CU_API void convertRowF32ToF16( PxRowLayout const & srcLayout
+			, float const * src
+			, PxRowLayout const & dstLayout
+			, int16_t * dst
+			, Array< int16_t, 4u > const & defaults
+			, size_t count );
+		/**
+		 *\~english
+		 *\brief		Converts a row of pixels with 16 bits float components to 32 bits float components.
+		 *\param[in]	srcLayout	The source pixels layout.
+		 *\param[in]	src			The source pixels.
+		 *\param[in]	dstLayout	The destination pixels layout.
+		 *\param[out]	dst			The destination pixels.
+		 *\param[in]	defaults	The R, G, B and A values used for the components absent from the source.
+		 *\param[in]	count		The pixels count.
+		 *\~french
+		 *\brief		Convertit une ligne de pixels ayant des composantes flottantes 16 bits en composantes flottantes 32 bits.
+		 *\param[in]	srcLayout	La disposition des pixels source.
+		 *\param[in]	src			Les pixels source.
+		 *\param[in]	dstLayout	La disposition des pixels destination.
+		 *\param[out]	dst			Les pixels destination.
+		 *\param[in]	defaults	Les valeurs R, G, B et A utilisées pour les composantes absentes de la source.
+		 *\param[in]	count		Le nombre de pixels.
+		 */
+		CU_API void convertRowF16ToF32( PxRowLayout const & srcLayout
+			, int16_t const * src
+			, PxRowLayout const & dstLayout
+			, float * dst
+			, Array< float, 4u > const & defaults
+			, size_t count );
+		/**
+		 *\~english
+		 *\brief		Splits a buffer conversion in bands of rows, processed in parallel if the options hold a job system.
+		 *\param[in]	options			The convertion options, may be null.
+		 *\param[in]	dimensions		The buffer dimensions.
+		 *\param[in]	count			The buffer pixels count.
+		 *\param[in]	convertRange	Converts the pixels in [begin, end).
+		 *\~french
+		 *\brief		Découpe la conversion d'un buffer en bandes de lignes, traitées en parallèle si les options contiennent un système de tâches.
+		 *\param[in]	options			Les options de conversion, peut être nul.
+		 *\param[in]	dimensions		Les dimensions du buffer.
+		 *\param[in]	count			Le nombre de pixels du buffer.
+		 *\param[in]	convertRange	Convertit les pixels dans [begin, end).
+		 */
+		CU_API void convertRowBands( PxBufferConvertOptions const * options
+			, Size const & dimensions
+			, size_t count
+			, Function< void( size_t, size_t ) > const & convertRange );
+	}
+}
+
+#endif
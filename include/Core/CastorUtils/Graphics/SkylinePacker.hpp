@@ -0,0 +1,107 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_SkylinePacker_HPP___
+#define ___CU_SkylinePacker_HPP___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Graphics/Position.hpp"
+#include "CastorUtils/Graphics/Size.hpp"
+
+namespace castor
+{
+	class SkylinePacker
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	width, height	The packing area dimensions.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	width, height	Les dimensions de la zone de rangement.
+		 */
+		CU_API SkylinePacker( uint32_t width
+			, uint32_t height );
+		/**
+		 *\~english
+		 *\brief		Finds a place for a rectangle, using the bottom-left rule.
+		 *\remarks		The rectangle is put where y + height is the smallest,
+		 *				the narrowest skyline segment being chosen on ties.
+		 *\param[in]	size		The rectangle dimensions.
+		 *\param[out]	position	Receives the rectangle top left position.
+		 *\return		\p false if the rectangle doesn't fit in the area.
+		 *\~french
+		 *\brief		Trouve une place pour un rectangle, en suivant la règle bas-gauche.
+		 *\remarks		Le rectangle est placé là où y + hauteur est le plus petit,
+		 *				le segment de la ligne d'horizon le plus étroit étant choisi en cas d'égalité.
+		 *\param[in]	size		Les dimensions du rectangle.
+		 *\param[out]	position	Reçoit la position du coin haut gauche du rectangle.
+		 *\return		\p false si le rectangle ne rentre pas dans la zone.
+		 */
+		CU_API bool insert( Size const & size
+			, Position & position );
+		/**
+		 *\~english
+		 *\brief		Makes the area higher, the already packed rectangles are kept.
+		 *\param[in]	height	The new height, must not be lower than the current one.
+		 *\~french
+		 *\brief		Rend la zone plus haute, les rectangles déjà rangés sont conservés.
+		 *\param[in]	height	La nouvelle hauteur, ne doit pas être inférieure à l'actuelle.
+		 */
+		CU_API void grow( uint32_t height );
+		/**
+		 *\~english
+		 *\brief		Removes all the packed rectangles.
+		 *\~french
+		 *\brief		Supprime tous les rectangles rangés.
+		 */
+		CU_API void clear();
+		/**
+		 *\~english
+		 *name Getters.
+		 *\~french
+		 *name Accesseurs.
+		**/
+		/**@{*/
+		uint32_t getWidth()const noexcept
+		{
+			return m_width;
+		}
+
+		uint32_t getHeight()const noexcept
+		{
+			return m_height;
+		}
+
+		uint32_t getUsedHeight()const noexcept
+		{
+			return m_usedHeight;
+		}
+		/**@}*/
+
+	private:
+		bool doFit( size_t index
+			, Size const & size
+			, uint32_t & y )const;
+		void doAddLevel( size_t index
+			, Position const & position
+			, Size const & size );
+
+	private:
+		struct Level
+		{
+			uint32_t x{};
+			uint32_t y{};
+			uint32_t width{};
+		};
+
+		Vector< Level > m_skyline;
+		uint32_t m_width{};
+		uint32_t m_height{};
+		uint32_t m_usedHeight{};
+	};
+}
+
+#endif
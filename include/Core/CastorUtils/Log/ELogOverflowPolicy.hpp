@@ -0,0 +1,38 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_LogOverflowPolicy_H___
+#define ___CU_LogOverflowPolicy_H___
+
+namespace castor
+{
+	/**
+	\~english
+	\brief		Defines what happens to a message pushed while the log queue is full.
+	\~french
+	\brief		Définit ce qui arrive à un message ajouté lorsque la file de log est pleine.
+	*/
+	enum class LogOverflowPolicy
+		: uint8_t
+	{
+		//!\~english	The message is dropped.
+		//!\~french		Le message est abandonné.
+		eDrop,
+		//!\~english	The pushing thread waits for room in the queue.
+		//!\~french		Le thread appelant attend de la place dans la file.
+		eBlock,
+		//!\~english	Past half the queue capacity, only one trace, debug or info message out of LogSampleRate is kept.
+		//!				Warnings and errors wait for room in the queue.
+		//!\~french		Au delà de la moitié de la capacité de la file, seul un message trace, debug ou info sur LogSampleRate est gardé.
+		//!				Les avertissements et erreurs attendent de la place dans la file.
+		eSample,
+		//!\~english	Policies count.
+		//!\~french		Compte des politiques.
+		eCount,
+	};
+	//!\~english	The sampling rate used by LogOverflowPolicy::eSample.
+	//!\~french		Le taux d'échantillonnage utilisé par LogOverflowPolicy::eSample.
+	static uint32_t constexpr LogSampleRate = 16u;
+}
+
+#endif
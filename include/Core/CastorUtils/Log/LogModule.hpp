@@ -7,6 +7,7 @@ See LICENSE file in root folder
 
 #include "CastorUtils/CastorUtils.hpp"
 
+#include "ELogOverflowPolicy.hpp"
 #include "ELogType.hpp"
 
 #include <deque>
@@ -23,6 +24,8 @@ namespace castor
 	*/
 	struct Message
 	{
+		Message() = default;
+
 		Message( LogType type
 			, MbString message
 			, bool newLine )
@@ -32,12 +35,23 @@ namespace castor
 		{
 		}
 
+		Message( LogType type
+			, castor::Function< MbString() > formatter
+			, bool newLine )
+			: m_type{ type }
+			, m_formatter{ castor::move( formatter ) }
+			, m_newLine{ newLine }
+		{
+		}
+
 		//! The message type.
-		LogType m_type;
+		LogType m_type{ LogType::eInfo };
 		//! The message text.
-		MbString m_message;
+		MbString m_message{};
+		//! The function building the message text, run by the writer thread, if any.
+		castor::Function< MbString() > m_formatter{};
 		//! Tells if the new line character is printed.
-		bool m_newLine;
+		bool m_newLine{ true };
 	};
 	//! The message queue.
 	using MessageQueue = Deque< Message >;
@@ -83,6 +83,41 @@ namespace castor
 		 *\return		Le niveau de log actuel.
 		 */
 		CU_API static LogType getLevel();
+		/**
+		 *\~english
+		 *\brief		Sets the behaviour when a message is logged while the queue is full.
+		 *\param[in]	policy	The overflow policy.
+		 *\~french
+		 *\brief		Définit le comportement lorsqu'un message est loggé alors que la file est pleine.
+		 *\param[in]	policy	La politique de débordement.
+		 */
+		CU_API static void setOverflowPolicy( LogOverflowPolicy policy );
+		/**
+		 *\~english
+		 *\return		The number of messages dropped because of the overflow policy.
+		 *\~french
+		 *\return		Le nombre de messages abandonnés à cause de la politique de débordement.
+		 */
+		CU_API static uint64_t getDroppedCount();
+		/**
+		 *\~english
+		 *\return		The number of messages waiting to be written.
+		 *\~french
+		 *\return		Le nombre de messages en attente d'écriture.
+		 */
+		CU_API static size_t getQueueDepth();
+		/**
+		 *\~english
+		 *\brief		Logs a message whose text is built by the writer thread, if its type passes the log level.
+		 *\param[in]	type		The message type.
+		 *\param[in]	formatter	The function building the message text.
+		 *\~french
+		 *\brief		Log un message dont le texte est construit par le thread d'écriture, si son type passe le niveau de log.
+		 *\param[in]	type		Le type de message.
+		 *\param[in]	formatter	La fonction construisant le texte du message.
+		 */
+		CU_API static void logDeferred( LogType type
+			, castor::Function< MbString() > formatter );
 		/**
 		 *\~english
 		 *\brief		Logs a trace message.
@@ -144,6 +144,7 @@ namespace castor
 		castor::Mutex m_mutexFiles;
 		LoggerCallbackMap m_mapCallbacks;
 		castor::Mutex m_mutexCallbacks;
+		castor::Mutex m_mutexConsole;
 	};
 }
 
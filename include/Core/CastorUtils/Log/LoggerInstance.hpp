@@ -7,9 +7,11 @@ See LICENSE file in root folder
 #include "CastorUtils/Log/LoggerImpl.hpp"
 
 #include "CastorUtils/Data/DataModule.hpp"
+#include "CastorUtils/Multithreading/MpscRingBuffer.hpp"
 
 #include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 #include "CastorUtils/Config/EndExternHeaderGuard.hpp"
@@ -18,7 +20,14 @@ namespace castor
 {
 	class LoggerInstance
 	{
+	private:
+		using MessageRing = MpscRingBufferT< Message >;
+
 	public:
+		//!\~english	The maximum number of messages waiting for the writer thread.
+		//!\~french		Le nombre maximal de messages attendant le thread d'écriture.
+		static size_t constexpr QueueCapacity = 8192u;
+
 		LoggerInstance( LoggerInstance const & ) = delete;
 		LoggerInstance & operator=( LoggerInstance const & ) = delete;
 		CU_API LoggerInstance( LoggerInstance && rhs )noexcept;
@@ -87,7 +96,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogTrace( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eTrace, toUtf8( msg ), true );
+			doPushMessage( LogType::eTrace, toUtf8( msg ), true );
 		}
 		/**
 		 *\~english
@@ -100,7 +109,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogTraceNoLF( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eTrace, toUtf8( msg ), false );
+			doPushMessage( LogType::eTrace, toUtf8( msg ), false );
 		}
 		/**
 		 *\~english
@@ -171,7 +180,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogDebug( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eDebug, toUtf8( msg ), true );
+			doPushMessage( LogType::eDebug, toUtf8( msg ), true );
 		}
 		/**
 		 *\~english
@@ -184,7 +193,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogDebugNoLF( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eDebug, toUtf8( msg ), false );
+			doPushMessage( LogType::eDebug, toUtf8( msg ), false );
 		}
 		/**
 		 *\~english
@@ -255,7 +264,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogInfo( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eInfo, toUtf8( msg ), true );
+			doPushMessage( LogType::eInfo, toUtf8( msg ), true );
 		}
 		/**
 		 *\~english
@@ -268,7 +277,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogInfoNoLF( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eInfo, toUtf8( msg ), false );
+			doPushMessage( LogType::eInfo, toUtf8( msg ), false );
 		}
 		/**
 		 *\~english
@@ -339,7 +348,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogWarning( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eWarning, toUtf8( msg ), true );
+			doPushMessage( LogType::eWarning, toUtf8( msg ), true );
 		}
 		/**
 		 *\~english
@@ -352,7 +361,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogWarningNoLF( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eWarning, toUtf8( msg ), false );
+			doPushMessage( LogType::eWarning, toUtf8( msg ), false );
 		}
 		/**
 		 *\~english
@@ -423,7 +432,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogError( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eError, toUtf8( msg ), true );
+			doPushMessage( LogType::eError, toUtf8( msg ), true );
 		}
 		/**
 		 *\~english
@@ -436,7 +445,7 @@ namespace castor
 		template< typename CharT >
 		void lockedLogErrorNoLF( std::basic_string< CharT > const & msg )
 		{
-			doLockedPushMessage( LogType::eError, toUtf8( msg ), false );
+			doPushMessage( LogType::eError, toUtf8( msg ), false );
 		}
 		/**
 		 *\~english
@@ -513,31 +522,100 @@ namespace castor
 			, std::basic_string< CharT > const & message
 			, bool addLF = true )
 		{
-			auto lock( makeUniqueLock( m_mutexQueue ) );
-			doLockedPushMessage( type, toUtf8( message ), addLF );
+			doPushMessage( type, toUtf8( message ), addLF );
 		}
-
+		/**
+		 *\~english
+		 *\brief		Pushes a message into the queue, its text being built by the writer thread.
+		 *\remarks		The formatter is not called if the message type is under the log level.
+		 *\param[in]	type		The message type.
+		 *\param[in]	formatter	The function building the message text.
+		 *\param[in]	addLF		Whether or not add a LF at the end.
+		 *\~french
+		 *\brief		Met un message dans la file, son texte étant construit par le thread d'écriture.
+		 *\remarks		Le formateur n'est pas appelé si le type du message est sous le niveau de log.
+		 *\param[in]	type		Le type de message.
+		 *\param[in]	formatter	La fonction construisant le texte du message.
+		 *\param[in]	addLF		Dit si on ajoute un LF à la fin.
+		 */
+		CU_API void pushDeferredMessage( LogType type
+			, castor::Function< MbString() > formatter
+			, bool addLF = true );
+		/**
+		 *\~english
+		 *\brief		Writes the queued messages, waits for a running flush to end.
+		 *\~french
+		 *\brief		Ecrit les messages en file, attend la fin d'une écriture en cours.
+		 */
 		CU_API void flushQueue();
+		/**
+		 *\~english
+		 *\brief		Sets the behaviour when a message is pushed while the queue is full.
+		 *\~french
+		 *\brief		Définit le comportement lorsqu'un message est ajouté alors que la file est pleine.
+		 */
+		void setOverflowPolicy( LogOverflowPolicy policy )noexcept
+		{
+			m_overflowPolicy = policy;
+		}
+
+		LogOverflowPolicy getOverflowPolicy()const noexcept
+		{
+			return m_overflowPolicy;
+		}
+		/**
+		 *\~english
+		 *\return		The number of messages dropped because of the overflow policy.
+		 *\~french
+		 *\return		Le nombre de messages abandonnés à cause de la politique de débordement.
+		 */
+		uint64_t getDroppedCount()const noexcept
+		{
+			return m_dropped;
+		}
+		/**
+		 *\~english
+		 *\return		The number of messages waiting for the writer thread.
+		 *\~french
+		 *\return		Le nombre de messages attendant le thread d'écriture.
+		 */
+		CU_API size_t getQueueDepth()const noexcept;
+		/**
+		 *\~english
+		 *\return		The maximum number of messages waiting for the writer thread.
+		 *\~french
+		 *\return		Le nombre maximal de messages attendant le thread d'écriture.
+		 */
+		CU_API size_t getQueueCapacity()const noexcept;
 
 		MbString getHeader( uint8_t index )const noexcept
 		{
 			return m_headers[index];
 		}
-
+		/**
+		 *\~english
+		 *\brief		Locks the logger for the streambufs, pushing messages doesn't need it.
+		 *\~french
+		 *\brief		Verrouille le logger pour les streambufs, l'ajout de messages n'en a pas besoin.
+		 */
 		void lock()const
 		{
-			m_mutexQueue.lock();
+			m_mutexStreams.lock();
 		}
 
 		void unlock()const noexcept
 		{
-			m_mutexQueue.unlock();
+			m_mutexStreams.unlock();
 		}
 
 	private:
 		void doInitialiseThread();
 		void doCleanupThread();
-		CU_API void doLockedPushMessage( LogType type
+		void doWakeWriter();
+		void doWaitForSpace();
+		bool doDropOnOverflow( LogType type )const;
+		void doEnqueue( Message message );
+		CU_API void doPushMessage( LogType type
 			, MbString const & message
 			, bool addLF = true );
 
@@ -552,8 +630,20 @@ namespace castor
 			"***WARNING*** ",
 			"****ERROR**** ",
 		};
-		MessageQueue m_queue;
-		mutable castor::Mutex m_mutexQueue;
+		RawUniquePtr< MessageRing > m_queue;
+		MessageQueue m_pending;
+		std::atomic< LogOverflowPolicy > m_overflowPolicy{ LogOverflowPolicy::eBlock };
+		std::atomic< uint64_t > m_dropped{};
+		std::atomic< uint32_t > m_sampled{};
+		mutable castor::Mutex m_mutexStreams;
+		castor::Mutex m_mutexFlush;
+		castor::Mutex m_mutexWake;
+		std::condition_variable m_wake;
+		std::atomic_bool m_wakeRequested{ false };
+		//!\~english	Signaled when the writer has popped messages, for the producers waiting for room in the queue.
+		//!\~french		Signalée quand le thread d'écriture a retiré des messages, pour les producteurs attendant de la place dans la file.
+		castor::Mutex m_mutexSpace;
+		std::condition_variable m_space;
 		std::thread m_logThread;
 		std::atomic_bool m_initialised{ false };
 		std::atomic_bool m_stopped{ false };
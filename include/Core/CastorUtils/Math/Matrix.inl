@@ -1,4 +1,5 @@
 #include "CastorUtils/Design/Templates.hpp"
+#include "CastorUtils/Math/Simd.hpp"
 
 #include "CastorUtils/Miscellaneous/Utils.hpp"
 
@@ -527,6 +528,18 @@ namespace castor
 	inline Point< T, Rows > operator*( Matrix< T, Columns, Rows > const & lhs, Point< U, Columns > const & rhs )
 	{
 		Point< T, Rows > result;
+#if CU_UseSimd
+
+		if constexpr ( std::is_same_v< T, float > && std::is_same_v< U, float > && Columns == 4u && Rows == 4u )
+		{
+			auto l = lhs.constPtr();
+			Float4 r{ rhs.constPtr() };
+			( ( Float4{ l + 0u } * r.splat< 0u >() + Float4{ l + 4u } * r.splat< 1u >() )
+				+ ( Float4{ l + 8u } * r.splat< 2u >() + Float4{ l + 12u } * r.splat< 3u >() ) ).toPtr( result.ptr() );
+			return result;
+		}
+
+#endif
 
 		for ( uint32_t i = 0; i < Columns; i++ )
 		{
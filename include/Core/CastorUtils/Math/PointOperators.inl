@@ -699,6 +699,190 @@ namespace castor
 
 	//*********************************************************************************************
 
+#if CU_UseSimd
+
+	template<>
+	struct PtOperators< float, float, 4, 4 >
+	{
+		template< typename PtType1 >
+		static inline Point< float, 4 > add( PtType1 const & lhs, float const & rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } + Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1 >
+		static inline Point< float, 4 > sub( PtType1 const & lhs, float const & rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } - Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1 >
+		static inline Point< float, 4 > mul( PtType1 const & lhs, float const & rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } * Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1 >
+		static inline Point< float, 4 > div( PtType1 const & lhs, float const & rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } / Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1 >
+		static inline Point< float, 4 > add( PtType1 const & lhs, float const * rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } + Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1 >
+		static inline Point< float, 4 > sub( PtType1 const & lhs, float const * rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } - Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1 >
+		static inline Point< float, 4 > mul( PtType1 const & lhs, float const * rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } * Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1 >
+		static inline Point< float, 4 > div( PtType1 const & lhs, float const * rhs )
+		{
+			Point< float, 4 > result;
+			( Float4{ lhs.constPtr() } / Float4{ rhs } ).toPtr( result.ptr() );
+			return result;
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline Point< float, 4 > add( PtType1 const & lhs, PtType2 const & rhs )
+		{
+			return add( lhs, rhs.constPtr() );
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline Point< float, 4 > sub( PtType1 const & lhs, PtType2 const & rhs )
+		{
+			return sub( lhs, rhs.constPtr() );
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline Point< float, 4 > mul( PtType1 const & lhs, PtType2 const & rhs )
+		{
+			return mul( lhs, rhs.constPtr() );
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline Point< float, 4 > div( PtType1 const & lhs, PtType2 const & rhs )
+		{
+			return div( lhs, rhs.constPtr() );
+		}
+	};
+
+	//*********************************************************************************************
+
+	template<>
+	struct PtAssignOperators< float, float, 4, 4 >
+	{
+		template< typename PtType1 >
+		static inline PtType1 & add( PtType1 & lhs, float const & rhs )
+		{
+			( Float4{ lhs.constPtr() } + Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1 >
+		static inline PtType1 & sub( PtType1 & lhs, float const & rhs )
+		{
+			( Float4{ lhs.constPtr() } - Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1 >
+		static inline PtType1 & mul( PtType1 & lhs, float const & rhs )
+		{
+			( Float4{ lhs.constPtr() } * Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1 >
+		static inline PtType1 & div( PtType1 & lhs, float const & rhs )
+		{
+			( Float4{ lhs.constPtr() } / Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1 >
+		static inline PtType1 & add( PtType1 & lhs, float const * rhs )
+		{
+			( Float4{ lhs.constPtr() } + Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1 >
+		static inline PtType1 & sub( PtType1 & lhs, float const * rhs )
+		{
+			( Float4{ lhs.constPtr() } - Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1 >
+		static inline PtType1 & mul( PtType1 & lhs, float const * rhs )
+		{
+			( Float4{ lhs.constPtr() } * Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1 >
+		static inline PtType1 & div( PtType1 & lhs, float const * rhs )
+		{
+			( Float4{ lhs.constPtr() } / Float4{ rhs } ).toPtr( lhs.ptr() );
+			return lhs;
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline PtType1 & add( PtType1 & lhs, PtType2 const & rhs )
+		{
+			return add( lhs, rhs.constPtr() );
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline PtType1 & sub( PtType1 & lhs, PtType2 const & rhs )
+		{
+			return sub( lhs, rhs.constPtr() );
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline PtType1 & mul( PtType1 & lhs, PtType2 const & rhs )
+		{
+			return mul( lhs, rhs.constPtr() );
+		}
+
+		template< typename PtType1, typename PtType2 >
+		static inline PtType1 & div( PtType1 & lhs, PtType2 const & rhs )
+		{
+			return div( lhs, rhs.constPtr() );
+		}
+	};
+
+#endif
+
+	//*********************************************************************************************
+
 	template< typename T1, typename T2 >
 	struct PtAssignOperators< T1, T2, 3, 3 >
 	{
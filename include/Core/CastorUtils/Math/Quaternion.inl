@@ -1,4 +1,5 @@
 #include "CastorUtils/Math/TransformationMatrix.hpp"
+#include "CastorUtils/Math/Simd.hpp"
 
 namespace castor
 {
@@ -11,6 +12,81 @@ namespace castor
 		{
 			return a + ( f * ( b - a ) );
 		}
+
+		template< typename T, typename FactorT >
+		inline std::pair< T, T > getSlerpCoefficients( T cosTheta, FactorT factor )
+		{
+			if ( ( T( 1.0 ) - cosTheta ) > 0.0001 ) // 0.0001 -> some epsillon
+			{
+				//! Standard case (slerp)
+				auto omega = T( acos( cosTheta ) ); // extract theta from dot product's cos theta
+				auto sinom = T( sin( omega ) );
+				return { T( sin( ( 1.0 - factor ) * omega ) / sinom )
+					, T( sin( factor * omega ) / sinom ) };
+			}
+
+			// Very close, do linear interp (because it's faster)
+			return { T( 1.0 - factor ), T( factor ) };
+		}
+
+		template< typename T, typename FactorT >
+		inline QuaternionT< T > slerp( QuaternionT< T > const & source
+			, QuaternionT< T > const & target
+			, FactorT factor )
+		{
+			//!	Slerp = q1((q1^-1)q2)^t;
+			QuaternionT< T > result( target );
+#if CU_UseSimd
+
+			if constexpr ( std::is_same_v< T, float > )
+			{
+				Float4 src{ source.constPtr() };
+				Float4 dst{ target.constPtr() };
+				auto cosTheta = dot( src, dst );
+
+				// do we need to invert rotation?
+				if ( cosTheta < 0 )
+				{
+					cosTheta = -cosTheta;
+					dst = Float4{ 0.0f } - dst;
+				}
+
+				auto [sclp, sclq] = getSlerpCoefficients( cosTheta, factor );
+				( src * Float4{ sclp } + dst * Float4{ sclq } ).toPtr( result.ptr() );
+				return result;
+			}
+
+#endif
+			T cosTheta = point::dot( source, target );
+
+			// do we need to invert rotation?
+			if ( cosTheta < 0 )
+			{
+				cosTheta = -cosTheta;
+				result->x = -result->x;
+				result->y = -result->y;
+				result->z = -result->z;
+				result->w = -result->w;
+			}
+
+			auto [sclp, sclq] = getSlerpCoefficients( cosTheta, factor );
+			result->x = sclp * source->x + sclq * result->x;
+			result->y = sclp * source->y + sclq * result->y;
+			result->z = sclp * source->z + sclq * result->z;
+			result->w = sclp * source->w + sclq * result->w;
+			return result;
+		}
+
+#if CU_UseSimd
+
+		inline Float4 cross( Float4 const & lhs, Float4 const & rhs )
+		{
+			// The w lane ends up as lhs.w * rhs.w - lhs.w * rhs.w, i.e. 0.
+			return Float4::shuffle< 1u, 2u, 0u, 3u >( lhs, lhs ) * Float4::shuffle< 2u, 0u, 1u, 3u >( rhs, rhs )
+				- Float4::shuffle< 2u, 0u, 1u, 3u >( lhs, lhs ) * Float4::shuffle< 1u, 2u, 0u, 3u >( rhs, rhs );
+		}
+
+#endif
 	}
 
 	//*************************************************************************************************
@@ -127,6 +203,33 @@ namespace castor
 	template< typename T >
 	QuaternionT< T > & QuaternionT< T >::operator*=( QuaternionT< T > const & rhs )
 	{
+#if CU_UseSimd
+
+		if constexpr ( std::is_same_v< T, float > )
+		{
+			Float4 l{ BaseType::constPtr() };
+			Float4 r{ rhs.constPtr() };
+			// x' = w * rx + x * rw + y * rz - z * ry
+			// y' = w * ry + y * rw + z * rx - x * rz
+			// z' = w * rz + z * rw + x * ry - y * rx
+			// w' = w * rw - x * rx - y * ry - z * rz
+			Float4 const sign{ 1.0f, 1.0f, 1.0f, -1.0f };
+			auto result = l.splat< 3u >() * r
+				+ ( Float4::shuffle< 0u, 1u, 2u, 0u >( l, l ) * Float4::shuffle< 3u, 3u, 3u, 0u >( r, r )
+					+ Float4::shuffle< 1u, 2u, 0u, 1u >( l, l ) * Float4::shuffle< 2u, 0u, 1u, 1u >( r, r ) ) * sign
+				- Float4::shuffle< 2u, 0u, 1u, 2u >( l, l ) * Float4::shuffle< 1u, 2u, 0u, 2u >( r, r );
+			auto length = std::sqrt( dot( result, result ) );
+
+			if ( length != 0.0f )
+			{
+				result /= Float4{ length };
+			}
+
+			result.toPtr( BaseType::ptr() );
+			return *this;
+		}
+
+#endif
 		double const x = DataHolder::getData().x;
 		double const y = DataHolder::getData().y;
 		double const z = DataHolder::getData().z;
@@ -265,6 +368,22 @@ namespace castor
 	template< Vector3fT PtT >
 	PtT & QuaternionT< T >::transform( PtT const & vector, PtT & result )const
 	{
+#if CU_UseSimd
+
+		if constexpr ( std::is_same_v< T, float > )
+		{
+			auto & point = point::getPoint( vector );
+			Float4 u{ BaseType::constPtr() };
+			Float4 v{ point[0], point[1], point[2], 0.0f };
+			auto uv = details::cross( u, v );
+			auto uuv = details::cross( u, uv );
+			Array< float, 4u > components;
+			( v + uv * Float4{ 2.0f * DataHolder::getData().w } + uuv * Float4{ 2.0f } ).toPtr( components.data() );
+			point::setPoint( result, Point3f{ components[0], components[1], components[2] } );
+			return result;
+		}
+
+#endif
 		Point3d u( DataHolder::getData().x, DataHolder::getData().y, DataHolder::getData().z );
 		Point3d uv( point::cross( u, vector ) );
 		Point3d uuv( point::cross( u, uv ) );
@@ -545,87 +664,13 @@ namespace castor
 	template< typename T >
 	QuaternionT< T > QuaternionT< T >::slerp( QuaternionT< T > const & target, double factor )const
 	{
-		//!	Slerp = q1((q1^-1)q2)^t;
-		T cosTheta = point::dot( *this, target );
-		QuaternionT< T > result( target );
-
-		// do we need to invert rotation?
-		if ( cosTheta < 0 )
-		{
-			cosTheta = -cosTheta;
-			result->x = -result->x;
-			result->y = -result->y;
-			result->z = -result->z;
-			result->w = -result->w;
-		}
-
-		// Calculate coefficients
-		T sclp{};
-		T sclq{};
-
-		if ( ( T( 1.0 ) - cosTheta ) > 0.0001 ) // 0.0001 -> some epsillon
-		{
-			//! Standard case (slerp)
-			auto omega = T( acos( cosTheta ) ); // extract theta from dot product's cos theta
-			auto sinom = T( sin( omega ) );
-			sclp = T( sin( ( 1.0 - factor ) * omega ) / sinom );
-			sclq = T( sin( factor * omega ) / sinom );
-		}
-		else
-		{
-			// Very close, do linear interp (because it's faster)
-			sclp = T( 1.0 - factor );
-			sclq = T( factor );
-		}
-
-		result->x = sclp * DataHolder::getData().x + sclq * result->x;
-		result->y = sclp * DataHolder::getData().y + sclq * result->y;
-		result->z = sclp * DataHolder::getData().z + sclq * result->z;
-		result->w = sclp * DataHolder::getData().w + sclq * result->w;
-		return result;
+		return details::slerp( *this, target, factor );
 	}
 
 	template< typename T >
 	QuaternionT< T > QuaternionT< T >::slerp( QuaternionT< T > const & target, float factor )const
 	{
-		//!	Slerp = q1((q1^-1)q2)^t;
-		T cosTheta = point::dot( *this, target );
-		QuaternionT< T > result( target );
-
-		// do we need to invert rotation?
-		if ( cosTheta < 0 )
-		{
-			cosTheta = -cosTheta;
-			result->x = -result->x;
-			result->y = -result->y;
-			result->z = -result->z;
-			result->w = -result->w;
-		}
-
-		// Calculate coefficients
-		T sclp{};
-		T sclq{};
-
-		if ( ( T( 1.0 ) - cosTheta ) > 0.0001 ) // 0.0001 -> some epsillon
-		{
-			//! Standard case (slerp)
-			auto omega = T( acos( cosTheta ) ); // extract theta from dot product's cos theta
-			auto sinom = T( sin( omega ) );
-			sclp = T( sin( ( 1.0 - factor ) * omega ) / sinom );
-			sclq = T( sin( factor * omega ) / sinom );
-		}
-		else
-		{
-			// Very close, do linear interp (because it's faster)
-			sclp = T( 1.0 - factor );
-			sclq = T( factor );
-		}
-
-		result->x = sclp * DataHolder::getData().x + sclq * result->x;
-		result->y = sclp * DataHolder::getData().y + sclq * result->y;
-		result->z = sclp * DataHolder::getData().z + sclq * result->z;
-		result->w = sclp * DataHolder::getData().w + sclq * result->w;
-		return result;
+		return details::slerp( *this, target, factor );
 	}
 
 	template< typename T >
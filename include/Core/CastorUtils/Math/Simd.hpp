@@ -6,9 +6,22 @@ See LICENSE file in root folder
 
 #include "CastorUtils/Math/MathModule.hpp"
 
-#	if CU_UseSSE2
+#if CU_SimdSSE2 || ( CU_SimdNEON && defined( CU_ArchARM64 ) )
+#	define CU_UseSimd 1
+#else
+#	define CU_UseSimd 0
+#endif
+
+#if CU_UseSimd
 
-#	include <xmmintrin.h>
+#	if CU_SimdSSE2
+#		include <emmintrin.h>
+#		if CU_SimdAVX
+#			include <immintrin.h>
+#		endif
+#	else
+#		include <arm_neon.h>
+#	endif
 
 namespace castor
 {
@@ -17,19 +30,28 @@ namespace castor
 	\date		06/10/2016
 	\~english
 	\brief		SIMD 4 floats abstraction.
+	\remarks	Uses SSE2 on x86, NEON on ARM64.
 	\~french
 	\brief		Abstraction de 4 floats SIMD.
+	\remarks	Utilise SSE2 sur x86, NEON sur ARM64.
 	*/
 	class Float4
 	{
+	public:
+#	if CU_SimdSSE2
+		using NativeT = __m128;
+#	else
+		using NativeT = float32x4_t;
+#	endif
+
 	public:
 		/**
 		 *\~english
 		 *\brief		Constructor from a pointer.
-		 *\param[in]	values	A 16 bits aligned pointer to 4 floats.
+		 *\param[in]	values	A pointer to 4 floats, no alignment required.
 		 *\~french
 		 *\brief		Constructeur depuis un pointeur.
-		 *\param[in]	values	Un pointeur sur 4 flottants alignés sur 16 bits.
+		 *\param[in]	values	Un pointeur sur 4 flottants, sans alignement requis.
 		 */
 		explicit inline Float4( float const * values );
 		/**
@@ -41,15 +63,58 @@ namespace castor
 		 *\param[in]	value	La valeur.
 		 */
 		explicit inline Float4( float value );
+		/**
+		 *\~english
+		 *\brief		Constructor from 4 values.
+		 *\param[in]	x, y, z, w	The values.
+		 *\~french
+		 *\brief		Constructeur depuis 4 valeurs.
+		 *\param[in]	x, y, z, w	Les valeurs.
+		 */
+		inline Float4( float x, float y, float z, float w );
+		/**
+		 *\~english
+		 *\brief		Constructor from a native SIMD register.
+		 *\param[in]	value	The register.
+		 *\~french
+		 *\brief		Constructeur depuis un registre SIMD natif.
+		 *\param[in]	value	Le registre.
+		 */
+		explicit inline Float4( NativeT value );
 		/**
 		 *\~english
 		 *\brief		Puts the values into a pointer.
-		 *\param[out]	values	A 16 bits aligned pointer to 4 floats.
+		 *\param[out]	values	A pointer to 4 floats, no alignment required.
 		 *\~french
 		 *\brief		Met les valeurs dans un pointeur.
-		 *\param[out]	values	Un pointeur sur 4 flottants alignés sur 16 bits.
+		 *\param[out]	values	Un pointeur sur 4 flottants, sans alignement requis.
+		 */
+		inline void toPtr( float * values )const;
+		/**
+		 *\~english
+		 *\return		A Float4 filled with the value of the lane \p LaneT.
+		 *\~french
+		 *\return		Un Float4 rempli avec la valeur de la composante \p LaneT.
 		 */
-		inline void toPtr( float * values );
+		template< uint32_t LaneT >
+		inline Float4 splat()const;
+		/**
+		 *\~english
+		 *\return		The sum of the 4 values.
+		 *\~french
+		 *\return		La somme des 4 valeurs.
+		 */
+		inline float sum()const;
+		/**
+		 *\~english
+		 *\brief		Builds a Float4 from 2 lanes of \p lhs and 2 lanes of \p rhs.
+		 *\return		{ lhs[X], lhs[Y], rhs[Z], rhs[W] }.
+		 *\~french
+		 *\brief		Construit un Float4 à partir de 2 composantes de \p lhs et 2 composantes de \p rhs.
+		 *\return		{ lhs[X], lhs[Y], rhs[Z], rhs[W] }.
+		 */
+		template< uint32_t X, uint32_t Y, uint32_t Z, uint32_t W >
+		static inline Float4 shuffle( Float4 const & lhs, Float4 const & rhs );
 		/**
 		 *\~english
 		 *\brief		addition assignment operator.
@@ -94,9 +159,19 @@ namespace castor
 		 *\return		Une référence sur cet objet.
 		 */
 		inline Float4 & operator/=( Float4 const & rhs );
+		/**
+		 *\~english
+		 *\return		The native SIMD register.
+		 *\~french
+		 *\return		Le registre SIMD natif.
+		 */
+		NativeT native()const noexcept
+		{
+			return m_value;
+		}
 
 	private:
-		__m128 m_value;
+		NativeT m_value;
 	};
 	/**
 	 *\~english
@@ -142,10 +217,23 @@ namespace castor
 	 *\return		Le résultat de la division.
 	 */
 	inline Float4 operator/( Float4 const & lhs, Float4 const & rhs );
+	/**
+	 *\~english
+	 *\return		The dot product of \p lhs and \p rhs.
+	 *\~french
+	 *\return		Le produit scalaire de \p lhs et \p rhs.
+	 */
+	inline float dot( Float4 const & lhs, Float4 const & rhs );
+	/**
+	 *\~english
+	 *\brief		Transposes the 4x4 matrix which columns are given.
+	 *\~french
+	 *\brief		Transpose la matrice 4x4 dont les colonnes sont données.
+	 */
+	inline void transpose( Float4 & col0, Float4 & col1, Float4 & col2, Float4 & col3 );
 }
 
 #include "Simd.inl"
 
-#	endif
 #endif
-
+#endif
@@ -1,9 +1,11 @@
-#if CU_UseSSE2
+#if CU_UseSimd
 
 namespace castor
 {
+#	if CU_SimdSSE2
+
 	inline Float4::Float4( float const * rhs )
-		: m_value( _mm_load_ps( rhs ) )
+		: m_value( _mm_loadu_ps( rhs ) )
 	{
 	}
 
@@ -12,9 +14,40 @@ namespace castor
 	{
 	}
 
-	inline void Float4::toPtr( float * rhs )
+	inline Float4::Float4( float x, float y, float z, float w )
+		: m_value( _mm_set_ps( w, z, y, x ) )
+	{
+	}
+
+	inline Float4::Float4( NativeT rhs )
+		: m_value( rhs )
+	{
+	}
+
+	inline void Float4::toPtr( float * rhs )const
+	{
+		_mm_storeu_ps( rhs, m_value );
+	}
+
+	template< uint32_t LaneT >
+	inline Float4 Float4::splat()const
 	{
-		_mm_store_ps( rhs, m_value );
+		static_assert( LaneT < 4u );
+		return Float4{ _mm_shuffle_ps( m_value, m_value, _MM_SHUFFLE( LaneT, LaneT, LaneT, LaneT ) ) };
+	}
+
+	inline float Float4::sum()const
+	{
+		auto high = _mm_movehl_ps( m_value, m_value );
+		auto pairs = _mm_add_ps( m_value, high );
+		return _mm_cvtss_f32( _mm_add_ss( pairs, _mm_shuffle_ps( pairs, pairs, _MM_SHUFFLE( 1, 1, 1, 1 ) ) ) );
+	}
+
+	template< uint32_t X, uint32_t Y, uint32_t Z, uint32_t W >
+	inline Float4 Float4::shuffle( Float4 const & lhs, Float4 const & rhs )
+	{
+		static_assert( X < 4u && Y < 4u && Z < 4u && W < 4u );
+		return Float4{ _mm_shuffle_ps( lhs.m_value, rhs.m_value, _MM_SHUFFLE( W, Z, Y, X ) ) };
 	}
 
 	inline Float4 & Float4::operator+=( Float4 const & rhs )
@@ -41,6 +74,85 @@ namespace castor
 		return *this;
 	}
 
+#	else
+
+	inline Float4::Float4( float const * rhs )
+		: m_value( vld1q_f32( rhs ) )
+	{
+	}
+
+	inline Float4::Float4( float rhs )
+		: m_value( vdupq_n_f32( rhs ) )
+	{
+	}
+
+	inline Float4::Float4( float x, float y, float z, float w )
+		: m_value{}
+	{
+		float const values[4]{ x, y, z, w };
+		m_value = vld1q_f32( values );
+	}
+
+	inline Float4::Float4( NativeT rhs )
+		: m_value( rhs )
+	{
+	}
+
+	inline void Float4::toPtr( float * rhs )const
+	{
+		vst1q_f32( rhs, m_value );
+	}
+
+	template< uint32_t LaneT >
+	inline Float4 Float4::splat()const
+	{
+		static_assert( LaneT < 4u );
+		return Float4{ vdupq_laneq_f32( m_value, LaneT ) };
+	}
+
+	inline float Float4::sum()const
+	{
+		return vaddvq_f32( m_value );
+	}
+
+	template< uint32_t X, uint32_t Y, uint32_t Z, uint32_t W >
+	inline Float4 Float4::shuffle( Float4 const & lhs, Float4 const & rhs )
+	{
+		static_assert( X < 4u && Y < 4u && Z < 4u && W < 4u );
+		// Constant lanes, the compiler turns these into zip/ext/ins instructions.
+		auto result = vdupq_laneq_f32( lhs.m_value, X );
+		result = vcopyq_laneq_f32( result, 1, lhs.m_value, Y );
+		result = vcopyq_laneq_f32( result, 2, rhs.m_value, Z );
+		result = vcopyq_laneq_f32( result, 3, rhs.m_value, W );
+		return Float4{ result };
+	}
+
+	inline Float4 & Float4::operator+=( Float4 const & rhs )
+	{
+		m_value = vaddq_f32( m_value, rhs.m_value );
+		return *this;
+	}
+
+	inline Float4 & Float4::operator-=( Float4 const & rhs )
+	{
+		m_value = vsubq_f32( m_value, rhs.m_value );
+		return *this;
+	}
+
+	inline Float4 & Float4::operator*=( Float4 const & rhs )
+	{
+		m_value = vmulq_f32( m_value, rhs.m_value );
+		return *this;
+	}
+
+	inline Float4 & Float4::operator/=( Float4 const & rhs )
+	{
+		m_value = vdivq_f32( m_value, rhs.m_value );
+		return *this;
+	}
+
+#	endif
+
 	inline Float4 operator+( Float4 const & lhs, Float4 const & rhs )
 	{
 		Float4 result{ lhs };
@@ -64,6 +176,23 @@ namespace castor
 		Float4 result{ lhs };
 		return result /= rhs;
 	}
+
+	inline float dot( Float4 const & lhs, Float4 const & rhs )
+	{
+		return ( lhs * rhs ).sum();
+	}
+
+	inline void transpose( Float4 & col0, Float4 & col1, Float4 & col2, Float4 & col3 )
+	{
+		auto xy01 = Float4::shuffle< 0u, 1u, 0u, 1u >( col0, col1 );
+		auto zw01 = Float4::shuffle< 2u, 3u, 2u, 3u >( col0, col1 );
+		auto xy23 = Float4::shuffle< 0u, 1u, 0u, 1u >( col2, col3 );
+		auto zw23 = Float4::shuffle< 2u, 3u, 2u, 3u >( col2, col3 );
+		col0 = Float4::shuffle< 0u, 2u, 0u, 2u >( xy01, xy23 );
+		col1 = Float4::shuffle< 1u, 3u, 1u, 3u >( xy01, xy23 );
+		col2 = Float4::shuffle< 0u, 2u, 0u, 2u >( zw01, zw23 );
+		col3 = Float4::shuffle< 1u, 3u, 1u, 3u >( zw01, zw23 );
+	}
 }
 
 #endif
@@ -69,6 +69,72 @@ namespace castor
 			}
 		};
 
+#if CU_UseSimd
+
+		template<>
+		struct SqrMtxInverter< float, 4 >
+		{
+			// Same cofactors as the generic version, computed 4 at a time.
+			template< uint32_t R0, uint32_t R1 >
+			static inline Float4 getFactors( Float4 const & c1
+				, Float4 const & c2
+				, Float4 const & c3 )
+			{
+				auto r1c3c2 = Float4::shuffle< R1, R1, R1, R1 >( c3, c2 );
+				auto r0c3c2 = Float4::shuffle< R0, R0, R0, R0 >( c3, c2 );
+				auto a = Float4::shuffle< R0, R0, R0, R0 >( c2, c1 );
+				auto b = Float4::shuffle< 0u, 0u, 0u, 2u >( r1c3c2, r1c3c2 );
+				auto c = Float4::shuffle< 0u, 0u, 0u, 2u >( r0c3c2, r0c3c2 );
+				auto d = Float4::shuffle< R1, R1, R1, R1 >( c2, c1 );
+				return a * b - c * d;
+			}
+
+			template< uint32_t RowT >
+			static inline Float4 getRow( Float4 const & c0
+				, Float4 const & c1 )
+			{
+				auto tmp = Float4::shuffle< RowT, RowT, RowT, RowT >( c1, c0 );
+				return Float4::shuffle< 0u, 2u, 2u, 2u >( tmp, tmp );
+			}
+
+			static inline void inverse( SquareMatrix< float, 4 > const & input
+				, SquareMatrix< float, 4 > & result )
+			{
+				auto src = input.constPtr();
+				Float4 c0{ src + 0u };
+				Float4 c1{ src + 4u };
+				Float4 c2{ src + 8u };
+				Float4 c3{ src + 12u };
+				auto fac0 = getFactors< 2u, 3u >( c1, c2, c3 );
+				auto fac1 = getFactors< 1u, 3u >( c1, c2, c3 );
+				auto fac2 = getFactors< 1u, 2u >( c1, c2, c3 );
+				auto fac3 = getFactors< 0u, 3u >( c1, c2, c3 );
+				auto fac4 = getFactors< 0u, 2u >( c1, c2, c3 );
+				auto fac5 = getFactors< 0u, 1u >( c1, c2, c3 );
+				auto vec0 = getRow< 0u >( c0, c1 );
+				auto vec1 = getRow< 1u >( c0, c1 );
+				auto vec2 = getRow< 2u >( c0, c1 );
+				auto vec3 = getRow< 3u >( c0, c1 );
+				Float4 const signA{ +1.0f, -1.0f, +1.0f, -1.0f };
+				Float4 const signB{ -1.0f, +1.0f, -1.0f, +1.0f };
+				auto inv0 = ( vec1 * fac0 - vec2 * fac1 + vec3 * fac2 ) * signA;
+				auto inv1 = ( vec0 * fac0 - vec2 * fac3 + vec3 * fac4 ) * signB;
+				auto inv2 = ( vec0 * fac1 - vec1 * fac3 + vec3 * fac5 ) * signA;
+				auto inv3 = ( vec0 * fac2 - vec1 * fac4 + vec2 * fac5 ) * signB;
+				auto row01 = Float4::shuffle< 0u, 0u, 0u, 0u >( inv0, inv1 );
+				auto row23 = Float4::shuffle< 0u, 0u, 0u, 0u >( inv2, inv3 );
+				auto row0 = Float4::shuffle< 0u, 2u, 0u, 2u >( row01, row23 );
+				Float4 const determinant{ dot( c0, row0 ) };
+				auto dst = result.ptr();
+				( inv0 / determinant ).toPtr( dst + 0u );
+				( inv1 / determinant ).toPtr( dst + 4u );
+				( inv2 / determinant ).toPtr( dst + 8u );
+				( inv3 / determinant ).toPtr( dst + 12u );
+			}
+		};
+
+#endif
+
 		template< typename Type >
 		struct SqrMtxInverter< Type, 3 >
 		{
@@ -210,6 +276,60 @@ namespace castor
 			}
 		};
 
+#if CU_UseSimd
+
+		template<>
+		struct SqrMtxOperators< float, 4 >
+		{
+			static const uint32_t Size = sizeof( float ) * 4;
+
+			static inline void mul( SquareMatrix< float, 4 > & lhs, SquareMatrix< float, 4 > const & rhs )
+			{
+				// Each result column is the sum of lhs columns, weighted by the matching rhs column.
+				// lhs columns are loaded first, and rhs column i is read before lhs column i is written,
+				// so rhs can be lhs.
+				auto l = lhs.ptr();
+				auto r = rhs.constPtr();
+#	if CU_SimdAVX
+				// Two result columns per register.
+				auto l0 = _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( l + 0u ) );
+				auto l1 = _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( l + 4u ) );
+				auto l2 = _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( l + 8u ) );
+				auto l3 = _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( l + 12u ) );
+
+				for ( uint32_t col = 0u; col < 4u; col += 2u )
+				{
+					auto rc = _mm256_loadu_ps( r + col * 4u );
+					auto res = _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( l0, _mm256_permute_ps( rc, 0x00 ) )
+							, _mm256_mul_ps( l1, _mm256_permute_ps( rc, 0x55 ) ) )
+						, _mm256_add_ps( _mm256_mul_ps( l2, _mm256_permute_ps( rc, 0xAA ) )
+							, _mm256_mul_ps( l3, _mm256_permute_ps( rc, 0xFF ) ) ) );
+					_mm256_storeu_ps( l + col * 4u, res );
+				}
+#	else
+				Float4 l0{ l + 0u };
+				Float4 l1{ l + 4u };
+				Float4 l2{ l + 8u };
+				Float4 l3{ l + 12u };
+
+				for ( uint32_t col = 0u; col < 4u; ++col )
+				{
+					Float4 rc{ r + col * 4u };
+					( ( l0 * rc.splat< 0u >() + l1 * rc.splat< 1u >() )
+						+ ( l2 * rc.splat< 2u >() + l3 * rc.splat< 3u >() ) ).toPtr( l + col * 4u );
+				}
+#	endif
+			}
+
+			template< typename Type >
+			static inline void mul( SquareMatrix< float, 4 > & lhs, SquareMatrix< Type, 4 > const & rhs )
+			{
+				mul( lhs, SquareMatrix< float, 4 >{ rhs } );
+			}
+		};
+
+#endif
+
 		template< typename Type >
 		struct SqrMtxOperators< Type, 3 >
 		{
@@ -274,6 +394,43 @@ namespace castor
 			}
 		};
 
+		template< typename Type, uint32_t Count >
+		struct SqrMtxTransposer
+		{
+			static inline void transpose( SquareMatrix< Type, Count > & matrix )
+			{
+				for ( uint32_t i = 0; i < Count; i++ )
+				{
+					for ( uint32_t j = 0; j < i; j++ )
+					{
+						castor::swap( matrix[j][i], matrix[i][j] );
+					}
+				}
+			}
+		};
+
+#if CU_UseSimd
+
+		template<>
+		struct SqrMtxTransposer< float, 4 >
+		{
+			static inline void transpose( SquareMatrix< float, 4 > & matrix )
+			{
+				auto data = matrix.ptr();
+				Float4 c0{ data + 0u };
+				Float4 c1{ data + 4u };
+				Float4 c2{ data + 8u };
+				Float4 c3{ data + 12u };
+				castor::transpose( c0, c1, c2, c3 );
+				c0.toPtr( data + 0u );
+				c1.toPtr( data + 4u );
+				c2.toPtr( data + 8u );
+				c3.toPtr( data + 12u );
+			}
+		};
+
+#endif
+
 		template< typename TypeA, typename TypeB, uint32_t Count >
 		struct MtxMultiplicator
 		{
@@ -583,14 +740,7 @@ namespace castor
 	template< typename T, uint32_t Count >
 	inline SquareMatrix< T, Count > & SquareMatrix< T, Count >::transpose()
 	{
-		for ( uint32_t i = 0; i < Count; i++ )
-		{
-			for ( uint32_t j = 0; j < i; j++ )
-			{
-				castor::swap( ( *this )[j][i], ( *this )[i][j] );
-			}
-		}
-
+		sqmtx::SqrMtxTransposer< T, Count >::transpose( *this );
 		return *this;
 	}
 
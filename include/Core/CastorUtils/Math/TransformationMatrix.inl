@@ -1,4 +1,5 @@
 #include "CastorUtils/Math/Quaternion.hpp"
+#include "CastorUtils/Math/Simd.hpp"
 
 namespace castor::matrix
 {
@@ -227,6 +228,20 @@ namespace castor::matrix
 	Point3< U > getTransformed( Matrix4x4< T > const & matrix
 		, Point3< U > const & value )
 	{
+#if CU_UseSimd
+
+		if constexpr ( std::is_same_v< T, float > && std::is_same_v< U, float > )
+		{
+			auto m = matrix.constPtr();
+			auto transformed = ( Float4{ m + 0u } * Float4{ value[0] } + Float4{ m + 4u } * Float4{ value[1] } )
+				+ ( Float4{ m + 8u } * Float4{ value[2] } + Float4{ m + 12u } );
+			transformed /= transformed.splat< 3u >();
+			Array< float, 4u > components;
+			transformed.toPtr( components.data() );
+			return Point3< U >{ components[0], components[1], components[2] };
+		}
+
+#endif
 		Point3< U > result;
 
 		result[0] = value[0] * matrix[0][0] + value[1] * matrix[1][0] + value[2] * matrix[2][0] + matrix[3][0];
@@ -0,0 +1,80 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_VertexPacking_H___
+#define ___CASTOR_VertexPacking_H___
+
+#include "CastorUtils/Math/Point.hpp"
+
+namespace castor::packing
+{
+	/**
+	 *\~english
+	 *\brief		Converts a float in [-1, 1] to a 16 bits signed normalised value.
+	 *\param[in]	value	The value, clamped to [-1, 1].
+	 *\~french
+	 *\brief		Convertit un flottant dans [-1, 1] en une valeur 16 bits signée normalisée.
+	 *\param[in]	value	La valeur, limitée à [-1, 1].
+	 */
+	CU_API int16_t toSnorm16( float value )noexcept;
+	/**
+	 *\~english
+	 *\brief		Converts a 16 bits signed normalised value to a float in [-1, 1].
+	 *\param[in]	value	The value.
+	 *\~french
+	 *\brief		Convertit une valeur 16 bits signée normalisée en un flottant dans [-1, 1].
+	 *\param[in]	value	La valeur.
+	 */
+	CU_API float fromSnorm16( int16_t value )noexcept;
+	/**
+	 *\~english
+	 *\brief		Converts a float in [0, 1] to an 8 bits unsigned normalised value.
+	 *\param[in]	value	The value, clamped to [0, 1].
+	 *\~french
+	 *\brief		Convertit un flottant dans [0, 1] en une valeur 8 bits non signée normalisée.
+	 *\param[in]	value	La valeur, limitée à [0, 1].
+	 */
+	CU_API uint8_t toUnorm8( float value )noexcept;
+	/**
+	 *\~english
+	 *\brief		Converts a float to a 16 bits float, rounded to the nearest even.
+	 *\remarks		The values out of the 16 bits float range give infinity, NaN stays NaN.
+	 *\param[in]	value	The value.
+	 *\~french
+	 *\brief		Convertit un flottant en un flottant 16 bits, arrondi au pair le plus proche.
+	 *\remarks		Les valeurs hors de l'intervalle des flottants 16 bits donnent l'infini, NaN reste NaN.
+	 *\param[in]	value	La valeur.
+	 */
+	CU_API uint16_t toHalf( float value )noexcept;
+	/**
+	 *\~english
+	 *\brief		Converts a 16 bits float to a float.
+	 *\param[in]	value	The value.
+	 *\~french
+	 *\brief		Convertit un flottant 16 bits en un flottant.
+	 *\param[in]	value	La valeur.
+	 */
+	CU_API float fromHalf( uint16_t value )noexcept;
+	/**
+	 *\~english
+	 *\brief		Encodes a direction on the octahedron, in two 16 bits signed normalised values.
+	 *\param[in]	x, y, z	The direction, which doesn't need to be normalised.
+	 *\~french
+	 *\brief		Encode une direction sur l'octaèdre, dans deux valeurs 16 bits signées normalisées.
+	 *\param[in]	x, y, z	La direction, qui n'a pas besoin d'être normalisée.
+	 */
+	CU_API Array< int16_t, 2u > encodeOctahedral( float x, float y, float z )noexcept;
+	/**
+	 *\~english
+	 *\brief		Decodes a direction encoded by encodeOctahedral.
+	 *\param[in]	u, v	The encoded direction.
+	 *\return		The normalised direction.
+	 *\~french
+	 *\brief		Décode une direction encodée par encodeOctahedral.
+	 *\param[in]	u, v	La direction encodée.
+	 *\return		La direction normalisée.
+	 */
+	CU_API Point3f decodeOctahedral( int16_t u, int16_t v )noexcept;
+}
+
+#endif
@@ -25,6 +25,9 @@ namespace castor
 
 			bool m_isIntel{ false };
 			bool m_isAMD{ false };
+			bool m_hasSSE2{ false };
+			bool m_hasAVX2{ false };
+			bool m_hasNEON{ false };
 			uint32_t m_coreCount{ 0u };
 			String m_vendor{};
 			String m_model{};
@@ -68,6 +71,36 @@ namespace castor
 		{
 			return m_internal.m_model;
 		}
+		/**
+		 *\~english
+		 *\return		\p true if the CPU supports SSE2 instructions.
+		 *\~french
+		 *\return		\p true si le CPU supporte les instructions SSE2.
+		 */
+		bool hasSSE2()const
+		{
+			return m_internal.m_hasSSE2;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the CPU and the OS support AVX2 instructions.
+		 *\~french
+		 *\return		\p true si le CPU et l'OS supportent les instructions AVX2.
+		 */
+		bool hasAVX2()const
+		{
+			return m_internal.m_hasAVX2;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the CPU supports NEON instructions.
+		 *\~french
+		 *\return		\p true si le CPU supporte les instructions NEON.
+		 */
+		bool hasNEON()const
+		{
+			return m_internal.m_hasNEON;
+		}
 
 	private:
 		CU_API static CpuInformationsInternal const m_internal;
@@ -67,6 +67,33 @@ namespace castor
 		return hash;
 	}
 
+	// FNV-1a, which result doesn't depend on the standard library, unlike std::hash, and can hence be persisted.
+	static constexpr uint64_t Fnv1a64Basis = 0xcbf29ce484222325ULL;
+
+	inline uint64_t hashFnv1a64( uint64_t & hash
+		, void const * data
+		, size_t size )noexcept
+	{
+		constexpr uint64_t kPrime = 0x100000001b3ULL;
+		auto bytes = static_cast< uint8_t const * >( data );
+
+		for ( size_t i = 0u; i < size; ++i )
+		{
+			hash ^= bytes[i];
+			hash *= kPrime;
+		}
+
+		return hash;
+	}
+
+	template< typename T >
+	inline uint64_t hashFnv1a64( uint64_t & hash
+		, T const & rhs )noexcept
+	{
+		static_assert( std::is_trivially_copyable_v< T > );
+		return hashFnv1a64( hash, &rhs, sizeof( T ) );
+	}
+
 	namespace hashcomb
 	{
 		template< typename HashT, typename EnableT = void >
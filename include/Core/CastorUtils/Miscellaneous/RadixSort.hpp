@@ -0,0 +1,116 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_RadixSort_HPP___
+#define ___CU_RadixSort_HPP___
+
+#include "CastorUtils/Miscellaneous/MiscellaneousModule.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace castor
+{
+	namespace radix
+	{
+		static uint32_t constexpr DigitBits = 8u;
+		static uint32_t constexpr DigitCount = 1u << DigitBits;
+		static uint32_t constexpr DigitMask = DigitCount - 1u;
+	}
+	/**
+	*\~english
+	*\brief		Stable LSD radix sort, on unsigned integer keys, 8 bits per pass.
+	*\remarks	The passes where all the items share the same digit are skipped,
+	*			and nothing is moved when the items are already sorted,
+	*			so that sorting again an array that barely changed is cheap.
+	*\param[in,out]	items	The items to sort.
+	*\param[in,out]	scratch	A scratch array, resized as needed, kept between calls to avoid allocations.
+	*\param[in]		getKey	Retrieves an item's key.
+	*\~french
+	*\brief		Tri par base LSD stable, sur des clés entières non signées, 8 bits par passe.
+	*\remarks	Les passes où tous les éléments ont le même chiffre sont ignorées,
+	*			et rien n'est déplacé si les éléments sont déjà triés,
+	*			afin que trier à nouveau un tableau ayant peu changé soit peu coûteux.
+	*\param[in,out]	items	Les éléments à trier.
+	*\param[in,out]	scratch	Un tableau de travail, redimensionné si besoin, conservé entre les appels pour éviter les allocations.
+	*\param[in]		getKey	Récupère la clé d'un élément.
+	*/
+	template< typename ItemT, typename KeyGetterT >
+	void radixSort( Vector< ItemT > & items
+		, Vector< ItemT > & scratch
+		, KeyGetterT getKey )
+	{
+		using KeyT = std::invoke_result_t< KeyGetterT, ItemT const & >;
+		static_assert( std::is_unsigned_v< KeyT >, "Radix sort keys must be unsigned integers" );
+		static uint32_t constexpr PassCount = uint32_t( sizeof( KeyT ) * 8u ) / radix::DigitBits;
+
+		if ( items.size() < 2u )
+		{
+			return;
+		}
+
+		// One read of the items gives all the passes histograms, and tells if they are already sorted.
+		Array< Array< uint32_t, radix::DigitCount >, PassCount > histograms{};
+		bool sorted = true;
+		auto prevKey = getKey( items.front() );
+
+		for ( auto const & item : items )
+		{
+			auto key = getKey( item );
+			sorted = sorted && prevKey <= key;
+			prevKey = key;
+
+			for ( uint32_t pass = 0u; pass < PassCount; ++pass )
+			{
+				++histograms[pass][( key >> ( pass * radix::DigitBits ) ) & radix::DigitMask];
+			}
+		}
+
+		if ( sorted )
+		{
+			return;
+		}
+
+		scratch.resize( items.size() );
+		auto src = &items;
+		auto dst = &scratch;
+
+		for ( uint32_t pass = 0u; pass < PassCount; ++pass )
+		{
+			auto & histogram = histograms[pass];
+
+			if ( std::any_of( histogram.begin()
+				, histogram.end()
+				, [&items]( uint32_t count )
+				{
+					return count == items.size();
+				} ) )
+			{
+				continue;
+			}
+
+			uint32_t offset{};
+
+			for ( auto & count : histogram )
+			{
+				auto next = offset + count;
+				count = offset;
+				offset = next;
+			}
+
+			for ( auto const & item : *src )
+			{
+				( *dst )[histogram[( getKey( item ) >> ( pass * radix::DigitBits ) ) & radix::DigitMask]++] = item;
+			}
+
+			std::swap( src, dst );
+		}
+
+		if ( src != &items )
+		{
+			std::swap( items, scratch );
+		}
+	}
+}
+
+#endif
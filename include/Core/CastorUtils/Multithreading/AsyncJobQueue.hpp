@@ -5,7 +5,7 @@ See LICENSE file in root folder
 #define ___CU_AsyncJobQueue_H___
 
 #include "CastorUtils/Design/NonCopyable.hpp"
-#include "CastorUtils/Multithreading/ThreadPool.hpp"
+#include "CastorUtils/Multithreading/JobSystem.hpp"
 
 #include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
 #include <atomic>
@@ -17,7 +17,7 @@ namespace castor
 		: public NonMovable
 	{
 	public:
-		using Job = castor::Function< void() >;
+		using Job = JobSystem::Job;
 		using JobArray = Vector< Job >;
 
 	public:
@@ -39,12 +39,12 @@ namespace castor
 		CU_API ~AsyncJobQueue()noexcept;
 		/**
 		 *\~english
-		 *\brief		Feeds a worker thread with the given job.
-		 *\remarks		If no thread is available, waits for one to finish its job.
+		 *\brief		Enqueues the given job.
+		 *\remarks		Never blocks, the job is discarded if the queue is finished.
 		 *\param[in]	job	The job.
 		 *\~french
-		 *\brief		donne à un thread de travail la tâche donnée.
-		 *\remarks		Si aucun thread n'est disponible, attend que l'un d'eux finisse sa tâche.
+		 *\brief		Ajoute la tâche donnée.
+		 *\remarks		Ne bloque jamais, la tâche est jetée si la file est terminée.
 		 *\param[in]	job	La tâche.
 		 */
 		CU_API void pushJob( Job job );
@@ -69,18 +69,20 @@ namespace castor
 		 *\brief		Réinitialise la file à son état initial.
 		 */
 		CU_API void reset();
-
-	private:
-		void doRun();
-		Job doPopJob();
-		bool doCheckEnded();
+		/**
+		 *\~english
+		 *\return		The underlying job system.
+		 *\~french
+		 *\return		Le système de tâches sous-jacent.
+		 */
+		JobSystem & getJobSystem()noexcept
+		{
+			return m_jobs;
+		}
 
 	private:
 		std::atomic_bool m_ended{};
-		JobArray m_pending;
-		ThreadPool m_pool;
-		castor::Mutex m_mutex;
-		std::thread m_worker;
+		JobSystem m_jobs;
 	};
 }
 
@@ -0,0 +1,239 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_JobSystem_H___
+#define ___CU_JobSystem_H___
+
+#include "CastorUtils/Design/NonCopyable.hpp"
+#include "CastorUtils/Multithreading/SpinMutex.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+namespace castor
+{
+	namespace details
+	{
+		struct JobState;
+		using JobStatePtr = SharedPtr< JobState >;
+	}
+
+	class JobHandle
+	{
+		friend class JobSystem;
+
+	public:
+		JobHandle() = default;
+		/**
+		 *\~english
+		 *\return		\p true if the job and its function have been run.
+		 *\remarks		An invalid handle is considered done.
+		 *\~french
+		 *\return		\p true si la tâche a été exécutée.
+		 *\remarks		Un handle invalide est considéré comme terminé.
+		 */
+		CU_API bool isDone()const noexcept;
+		/**
+		 *\~english
+		 *\return		\p true if the handle references a job.
+		 *\~french
+		 *\return		\p true si le handle référence une tâche.
+		 */
+		bool isValid()const noexcept
+		{
+			return m_state != nullptr;
+		}
+
+	private:
+		explicit JobHandle( details::JobStatePtr state )
+			: m_state{ castor::move( state ) }
+		{
+		}
+
+	private:
+		details::JobStatePtr m_state;
+	};
+
+	class JobSystem
+		: public NonMovable
+	{
+	public:
+		using Job = castor::Function< void() >;
+		using RangeJob = castor::Function< void( size_t, size_t ) >;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, initialises the system with given threads count.
+		 *\param[in]	count	The threads count.
+		 *\~french
+		 *\brief		Constructeur, initialise le système au nombre de threads donné.
+		 *\param[in]	count	Le nombre de threads.
+		 */
+		CU_API explicit JobSystem( size_t count );
+		/**
+		 *\~english
+		 *\brief		Destructor, waits for all pending jobs, then stops the threads.
+		 *\~french
+		 *\brief		Destructeur, attend la fin des tâches en cours, puis arrête les threads.
+		 */
+		CU_API ~JobSystem()noexcept;
+		/**
+		 *\~english
+		 *\brief		Enqueues the given job.
+		 *\remarks		Never blocks the caller.
+		 *				Jobs pushed from a worker thread go to this worker's own queue, others go to the shared queue.
+		 *\param[in]	job	The job.
+		 *\return		The handle to the job.
+		 *\~french
+		 *\brief		Ajoute la tâche donnée.
+		 *\remarks		Ne bloque jamais l'appelant.
+		 *				Les tâches ajoutées depuis un thread de travail vont dans la file de ce thread, les autres vont dans la file partagée.
+		 *\param[in]	job	La tâche.
+		 *\return		Le handle de la tâche.
+		 */
+		CU_API JobHandle pushJob( Job job );
+		/**
+		 *\~english
+		 *\brief		Enqueues the given job, to be run once all given dependencies are done.
+		 *\param[in]	dependencies	The jobs to wait for.
+		 *\param[in]	job				The job.
+		 *\return		The handle to the job.
+		 *\~french
+		 *\brief		Ajoute la tâche donnée, qui sera lancée une fois que toutes les dépendances données seront terminées.
+		 *\param[in]	dependencies	Les tâches à attendre.
+		 *\param[in]	job				La tâche.
+		 *\return		Le handle de la tâche.
+		 */
+		CU_API JobHandle pushJob( Vector< JobHandle > const & dependencies
+			, Job job );
+		/**
+		 *\~english
+		 *\brief		Enqueues the given job, to be run once given job is done.
+		 *\param[in]	dependency	The job to wait for.
+		 *\param[in]	job			The continuation.
+		 *\return		The handle to the continuation.
+		 *\~french
+		 *\brief		Ajoute la tâche donnée, qui sera lancée une fois que la tâche donnée sera terminée.
+		 *\param[in]	dependency	La tâche à attendre.
+		 *\param[in]	job			La continuation.
+		 *\return		Le handle de la continuation.
+		 */
+		CU_API JobHandle then( JobHandle const & dependency
+			, Job job );
+		/**
+		 *\~english
+		 *\brief		Runs the given job on ranges of [0, count), in parallel, and waits for all of them.
+		 *\remarks		The calling thread takes part in the processing.
+		 *				When a range throws, the remaining ranges are skipped, and the first exception is rethrown on the calling thread.
+		 *\param[in]	count	The elements count.
+		 *\param[in]	job		The job, receiving [begin, end) ranges.
+		 *\param[in]	grain	The minimal range size, 0 to let the system choose.
+		 *\~french
+		 *\brief		Lance la tâche donnée sur des intervalles de [0, count), en parallèle, et les attend.
+		 *\remarks		Le thread appelant participe au traitement.
+		 *				Quand un intervalle lance une exception, les intervalles restants sont ignorés, et la première exception est relancée sur le thread appelant.
+		 *\param[in]	count	Le nombre d'éléments.
+		 *\param[in]	job		La tâche, recevant des intervalles [begin, end).
+		 *\param[in]	grain	La taille minimale d'un intervalle, 0 pour laisser le système choisir.
+		 */
+		CU_API void parallelFor( size_t count
+			, RangeJob const & job
+			, size_t grain = 0u );
+		/**
+		 *\~english
+		 *\brief		Waits for the given job to be done.
+		 *\remarks		The calling thread runs pending jobs while waiting.
+		 *\param[in]	handle	The job.
+		 *\~french
+		 *\brief		Attend que la tâche donnée soit terminée.
+		 *\remarks		Le thread appelant exécute les tâches en attente pendant ce temps.
+		 *\param[in]	handle	La tâche.
+		 */
+		CU_API void wait( JobHandle const & handle );
+		/**
+		 *\~english
+		 *\brief		Waits for all the jobs to be done, for a given time.
+		 *\remarks		Must not be called from a job.
+		 *\param[in]	timeout	The maximum time to wait.
+		 *\return		\p true if all jobs are done.
+		 *\~french
+		 *\brief		Attend que toutes les tâches soient terminées, pour un temps donné.
+		 *\remarks		Ne doit pas être appelée depuis une tâche.
+		 *\param[in]	timeout	Le temps d'attente maximum.
+		 *\return		\p true si toutes les tâches sont terminées.
+		 */
+		CU_API bool waitAll( Milliseconds const & timeout )const;
+		/**
+		 *\~english
+		 *\brief		Waits for all the jobs to be done.
+		 *\remarks		Must not be called from a job.
+		 *\~french
+		 *\brief		Attend que toutes les tâches soient terminées.
+		 *\remarks		Ne doit pas être appelée depuis une tâche.
+		 */
+		CU_API void waitAll()const;
+		/**
+		 *\~english
+		 *\return		\p true if the calling thread is one of this system's worker threads.
+		 *\~french
+		 *\return		\p true si le thread appelant est l'un des threads de travail de ce système.
+		 */
+		CU_API bool isWorkerThread()const noexcept;
+		/**
+		 *\~english
+		 *\return		The count of jobs that are waiting, queued or running.
+		 *\~french
+		 *\return		Le nombre de tâches en attente, en file, ou en cours.
+		 */
+		size_t getPendingCount()const noexcept
+		{
+			return m_pending.load();
+		}
+		/**
+		 *\~english
+		 *\return		The threads count.
+		 *\~french
+		 *\return		Le nombre de threads.
+		 */
+		size_t getCount()const noexcept
+		{
+			return m_threads.size();
+		}
+
+	private:
+		struct JobQueue
+		{
+			SpinMutex mutex;
+			Deque< details::JobStatePtr > jobs;
+		};
+		using JobQueuePtr = RawUniquePtr< JobQueue >;
+
+		void doRun( size_t index );
+		JobHandle doCreateJob( Job job );
+		void doSchedule( details::JobStatePtr job );
+		details::JobStatePtr doPopJob( size_t index );
+		bool doRunPendingJob();
+		void doExecute( details::JobStatePtr const & job );
+		void doNotifyWaiters();
+
+	private:
+		Vector< std::thread > m_threads;
+		Vector< JobQueuePtr > m_queues;
+		JobQueue m_shared;
+		std::atomic_bool m_terminate{ false };
+		std::atomic_size_t m_queued{};
+		std::atomic_size_t m_pending{};
+		std::atomic_size_t m_sleeping{};
+		mutable std::atomic_size_t m_waiting{};
+		castor::Mutex m_wakeMutex;
+		std::condition_variable m_wakeCondition;
+		mutable castor::Mutex m_doneMutex;
+		mutable std::condition_variable m_doneCondition;
+	};
+}
+
+#endif
@@ -0,0 +1,155 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_MpscRingBuffer_H___
+#define ___CU_MpscRingBuffer_H___
+
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <atomic>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+namespace castor
+{
+	template< typename ValueT >
+	class MpscRingBufferT
+	{
+	private:
+		static constexpr size_t CacheLineSize = 64u;
+
+		struct Slot
+		{
+			std::atomic< size_t > sequence{};
+			ValueT value{};
+		};
+
+		static size_t getCapacity( size_t capacity )noexcept
+		{
+			size_t result = 2u;
+
+			while ( result < capacity )
+			{
+				result <<= 1u;
+			}
+
+			return result;
+		}
+
+	public:
+		MpscRingBufferT( MpscRingBufferT const & ) = delete;
+		MpscRingBufferT & operator=( MpscRingBufferT const & ) = delete;
+		MpscRingBufferT( MpscRingBufferT && )noexcept = delete;
+		MpscRingBufferT & operator=( MpscRingBufferT && )noexcept = delete;
+		/**
+		 *\~english
+		 *\param[in]	capacity	The minimal capacity, rounded up to the next power of two.
+		 *\~french
+		 *\param[in]	capacity	La capacité minimale, arrondie à la puissance de deux supérieure.
+		 */
+		explicit MpscRingBufferT( size_t capacity )
+			: m_slots( getCapacity( capacity ) )
+			, m_mask{ m_slots.size() - 1u }
+		{
+			for ( size_t i = 0u; i < m_slots.size(); ++i )
+			{
+				m_slots[i].sequence.store( i, std::memory_order_relaxed );
+			}
+		}
+		/**
+		 *\~english
+		 *\brief		Pushes a value, can be called concurrently from any thread.
+		 *\param[in]	value	The value, left untouched if the buffer is full.
+		 *\return		\p false if the buffer is full.
+		 *\~french
+		 *\brief		Ajoute une valeur, peut être appelé en concurrence depuis n'importe quel thread.
+		 *\param[in]	value	La valeur, laissée intacte si le tampon est plein.
+		 *\return		\p false si le tampon est plein.
+		 */
+		bool tryPush( ValueT & value )
+		{
+			auto pos = m_tail.load( std::memory_order_relaxed );
+
+			while ( true )
+			{
+				auto & slot = m_slots[pos & m_mask];
+				auto sequence = slot.sequence.load( std::memory_order_acquire );
+				auto diff = intptr_t( sequence ) - intptr_t( pos );
+
+				if ( diff == 0 )
+				{
+					if ( m_tail.compare_exchange_weak( pos, pos + 1u, std::memory_order_relaxed ) )
+					{
+						slot.value = castor::move( value );
+						slot.sequence.store( pos + 1u, std::memory_order_release );
+						return true;
+					}
+				}
+				else if ( diff < 0 )
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_tail.load( std::memory_order_relaxed );
+				}
+			}
+		}
+		/**
+		 *\~english
+		 *\brief		Pops the oldest value, must only be called from one thread at a time.
+		 *\param[out]	value	Receives the value.
+		 *\return		\p false if the buffer is empty.
+		 *\~french
+		 *\brief		Retire la valeur la plus ancienne, ne doit être appelé que par un thread à la fois.
+		 *\param[out]	value	Reçoit la valeur.
+		 *\return		\p false si le tampon est vide.
+		 */
+		bool tryPop( ValueT & value )
+		{
+			auto pos = m_head.load( std::memory_order_relaxed );
+			auto & slot = m_slots[pos & m_mask];
+
+			if ( slot.sequence.load( std::memory_order_acquire ) != pos + 1u )
+			{
+				return false;
+			}
+
+			value = castor::move( slot.value );
+			slot.value = ValueT{};
+			slot.sequence.store( pos + m_slots.size(), std::memory_order_release );
+			m_head.store( pos + 1u, std::memory_order_relaxed );
+			return true;
+		}
+		/**
+		 *\~english
+		 *\return		The number of values in the buffer, approximative while producers are pushing.
+		 *\~french
+		 *\return		Le nombre de valeurs dans le tampon, approximatif pendant que des producteurs ajoutent.
+		 */
+		size_t size()const noexcept
+		{
+			auto head = m_head.load( std::memory_order_relaxed );
+			auto tail = m_tail.load( std::memory_order_relaxed );
+			return tail > head ? tail - head : 0u;
+		}
+
+		bool empty()const noexcept
+		{
+			return size() == 0u;
+		}
+
+		size_t capacity()const noexcept
+		{
+			return m_slots.size();
+		}
+
+	private:
+		Vector< Slot > m_slots;
+		size_t m_mask;
+		alignas( CacheLineSize ) std::atomic< size_t > m_tail{};
+		alignas( CacheLineSize ) std::atomic< size_t > m_head{};
+	};
+}
+
+#endif
@@ -14,6 +14,34 @@ namespace castor
 	/**
 	*\~english
 	*\brief
+	*	Handle to a job pushed in a JobSystem, used to wait for it or to chain continuations.
+	*\~french
+	*\brief
+	*	Handle sur une tâche ajoutée à un JobSystem, utilisé pour l'attendre ou y chaîner des continuations.
+	*/
+	class JobHandle;
+	/**
+	*\~english
+	*\brief
+	*	Work stealing job system, with per thread queues and blocking wake ups.
+	*\~french
+	*\brief
+	*	Système de tâches à vol de travail, avec une file par thread et des réveils bloquants.
+	*/
+	class JobSystem;
+	/**
+	*\~english
+	*\brief
+	*	Bounded lock-free ring buffer, with multiple producers and a single consumer.
+	*\~french
+	*\brief
+	*	Tampon circulaire borné sans verrou, avec plusieurs producteurs et un seul consommateur.
+	*/
+	template< typename ValueT >
+	class MpscRingBufferT;
+	/**
+	*\~english
+	*\brief
 	*	Atomic operators based spin lock implementation.
 	*\remarks
 	*	Uses the same interface as castor::Mutex.
@@ -27,10 +55,10 @@ namespace castor
 	/**
 	*\~english
 	*\brief
-	*	Thread pool implementation, using WorkerThreads.
+	*	Thread pool implementation, using a JobSystem.
 	*\~french
 	*\brief
-	*	Implémentation de pool de thread, utilisant des WorkerThread.
+	*	Implémentation de pool de thread, utilisant un JobSystem.
 	*/
 	class ThreadPool;
 	/**
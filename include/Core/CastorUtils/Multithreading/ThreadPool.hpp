@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___CU_ThreadPool_H___
 
 #include "CastorUtils/Design/NonCopyable.hpp"
+#include "CastorUtils/Multithreading/JobSystem.hpp"
 #include "CastorUtils/Multithreading/WorkerThread.hpp"
 
 namespace castor
@@ -12,9 +13,6 @@ namespace castor
 	class ThreadPool
 		: public NonMovable
 	{
-		using WorkerPtr = castor::RawUniquePtr< WorkerThread >;
-		using WorkerArray = Vector< WorkerPtr >;
-
 	public:
 		/**
 		 *\~english
@@ -59,15 +57,17 @@ namespace castor
 		CU_API bool waitAll( Milliseconds const & timeout )const;
 		/**
 		 *\~english
-		 *\brief		Feeds a worker thread with the given job.
-		 *\remarks		If no thread is available, waits for one to finish its job.
+		 *\brief		Enqueues the given job.
+		 *\remarks		Never blocks, the job is run as soon as a thread is available.
 		 *\param[in]	job	The job.
+		 *\return		The handle to the job.
 		 *\~french
-		 *\brief		donne à un thread de travail la tâche donnée.
-		 *\remarks		Si aucun thread n'est disponible, attend que l'un d'eux finisse sa tâche.
+		 *\brief		Ajoute la tâche donnée.
+		 *\remarks		Ne bloque jamais, la tâche est lancée dès qu'un thread est disponible.
 		 *\param[in]	job	La tâche.
+		 *\return		Le handle de la tâche.
 		 */
-		CU_API void pushJob( WorkerThread::Job job );
+		CU_API JobHandle pushJob( WorkerThread::Job job );
 		/**
 		 *\~english
 		 *\return		The threads count.
@@ -76,19 +76,21 @@ namespace castor
 		 */
 		size_t getCount()const noexcept
 		{
-			return m_count;
+			return m_jobs.getCount();
+		}
+		/**
+		 *\~english
+		 *\return		The underlying job system.
+		 *\~french
+		 *\return		Le système de tâches sous-jacent.
+		 */
+		JobSystem & getJobSystem()noexcept
+		{
+			return m_jobs;
 		}
 
 	private:
-		WorkerThread & doReserveWorker();
-		void doFreeWorker( WorkerThread const & worker );
-
-	private:
-		size_t const m_count;
-		WorkerArray m_available;
-		WorkerArray m_busy;
-		mutable castor::Mutex m_mutex;
-		Vector< WorkerThread::OnEnded::connection > m_endConnections;
+		JobSystem m_jobs;
 	};
 }
 
@@ -11,6 +11,7 @@ See LICENSE file in root folder
 
 #include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 #include "CastorUtils/Config/EndExternHeaderGuard.hpp"
@@ -86,11 +87,13 @@ namespace castor
 		void doRun();
 
 	private:
-		std::thread m_thread;
-		castor::Mutex m_mutex;
+		mutable castor::Mutex m_mutex;
+		std::condition_variable m_startCondition;
+		mutable std::condition_variable m_endCondition;
 		std::atomic_bool m_start{ false };
 		std::atomic_bool m_terminate{ false };
 		Job m_currentJob;
+		std::thread m_thread;
 	};
 }
 
@@ -27,6 +27,20 @@ namespace castor
 	*/
 	template< typename Traits >
 	class BuddyAllocatorT;
+	/**
+	\~english
+	\brief		Two-Level Segregated Fit allocator statistics.
+	\~french
+	\brief		Statistiques d'un allocateur Two-Level Segregated Fit.
+	*/
+	struct TlsfStatistics;
+	/**
+	\~english
+	\brief		Two-Level Segregated Fit offset allocator.
+	\~french
+	\brief		Allocateur de décalages Two-Level Segregated Fit.
+	*/
+	class TlsfAllocator;
 	//@}
 }
 
@@ -0,0 +1,205 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_TlsfAllocator_HPP___
+#define ___CU_TlsfAllocator_HPP___
+
+#include "CastorUtils/Pool/PoolModule.hpp"
+
+namespace castor
+{
+	struct TlsfStatistics
+	{
+		//!\~english	The managed range size.
+		//!\~french		La taille de l'intervalle géré.
+		uint64_t totalSize{};
+		//!\~english	The size currently allocated.
+		//!\~french		La taille actuellement allouée.
+		uint64_t usedSize{};
+		//!\~english	The size currently free.
+		//!\~french		La taille actuellement libre.
+		uint64_t freeSize{};
+		//!\~english	The size of the largest free block.
+		//!\~french		La taille du plus grand bloc libre.
+		uint64_t largestFreeBlock{};
+		//!\~english	The number of live allocations.
+		//!\~french		Le nombre d'allocations vivantes.
+		uint32_t allocationCount{};
+		//!\~english	The number of free blocks.
+		//!\~french		Le nombre de blocs libres.
+		uint32_t freeBlockCount{};
+		/**
+		 *\~english
+		 *\return		The external fragmentation ratio, in [0, 1] (0 when all the free space is contiguous).
+		 *\~french
+		 *\return		Le ratio de fragmentation externe, dans [0, 1] (0 quand tout l'espace libre est contigu).
+		 */
+		float getFragmentation()const noexcept
+		{
+			return freeSize == 0u
+				? 0.0f
+				: 1.0f - float( double( largestFreeBlock ) / double( freeSize ) );
+		}
+	};
+	/**
+	\~english
+	\brief		Two-Level Segregated Fit allocator.
+	\remarks	Manages offsets inside a range, without owning any memory, so it can be used for GPU buffers.
+				<br />Free blocks are sorted in size classes (first level: power of two, second level: linear subdivision),
+				with bitmaps to find a fitting class in constant time.
+				<br />Freed blocks are immediately merged with their free physical neighbours.
+	\~french
+	\brief		Allocateur Two-Level Segregated Fit.
+	\remarks	Gère des décalages dans un intervalle, sans posséder de mémoire, il peut donc être utilisé pour des buffers GPU.
+				<br />Les blocs libres sont rangés par classes de taille (premier niveau : puissance de deux, second niveau : subdivision linéaire),
+				avec des bitmaps pour trouver une classe convenable en temps constant.
+				<br />Les blocs libérés sont immédiatement fusionnés avec leurs voisins physiques libres.
+	*/
+	class TlsfAllocator
+	{
+	public:
+		static uint64_t constexpr InvalidOffset = ~uint64_t{};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	size		The managed range size.
+		 *\param[in]	granularity	The minimal block size, every offset and size are multiples of it.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	size		La taille de l'intervalle géré.
+		 *\param[in]	granularity	La taille minimale d'un bloc, tous les décalages et tailles en sont multiples.
+		 */
+		CU_API explicit TlsfAllocator( uint64_t size
+			, uint64_t granularity = 1u );
+		/**
+		 *\~english
+		 *\brief		Allocates a block.
+		 *\param[in]	size		The requested size.
+		 *\param[in]	alignment	The requested offset alignment, 0 to use the granularity.
+		 *\return		The block offset, InvalidOffset if no free block fits.
+		 *\~french
+		 *\brief		Alloue un bloc.
+		 *\param[in]	size		La taille demandée.
+		 *\param[in]	alignment	L'alignement demandé pour le décalage, 0 pour utiliser la granularité.
+		 *\return		Le décalage du bloc, InvalidOffset si aucun bloc libre ne convient.
+		 */
+		CU_API uint64_t allocate( uint64_t size
+			, uint64_t alignment = 0u );
+		/**
+		 *\~english
+		 *\brief		Releases a block and merges it with its free neighbours.
+		 *\param[in]	offset	The block offset, as returned by allocate.
+		 *\return		\p false if the offset doesn't match any allocated block.
+		 *\~french
+		 *\brief		Libère un bloc et le fusionne avec ses voisins libres.
+		 *\param[in]	offset	Le décalage du bloc, tel que retourné par allocate.
+		 *\return		\p false si le décalage ne correspond à aucun bloc alloué.
+		 */
+		CU_API bool deallocate( uint64_t offset );
+		/**
+		 *\~english
+		 *\brief		Releases all the blocks.
+		 *\~french
+		 *\brief		Libère tous les blocs.
+		 */
+		CU_API void clear();
+		/**
+		 *\~english
+		 *\return		\p true if an allocation of given size and alignment would succeed.
+		 *\~french
+		 *\return		\p true si une allocation de la taille et de l'alignement donnés réussirait.
+		 */
+		CU_API bool hasAvailable( uint64_t size
+			, uint64_t alignment = 0u )const;
+		/**
+		 *\~english
+		 *\return		The allocated size of the block at given offset, 0 if there is none.
+		 *\~french
+		 *\return		La taille allouée du bloc au décalage donné, 0 s'il n'y en a pas.
+		 */
+		CU_API uint64_t getAllocationSize( uint64_t offset )const;
+		/**
+		 *\~english
+		 *\return		The allocator statistics.
+		 *\remarks		Only the largest free block lookup isn't constant time, it walks one size class.
+		 *\~french
+		 *\return		Les statistiques de l'allocateur.
+		 *\remarks		Seule la recherche du plus grand bloc libre n'est pas en temps constant, elle parcourt une classe de taille.
+		 */
+		CU_API TlsfStatistics getStatistics()const;
+		/**
+		 *\~english
+		 *\brief		Checks the internal consistency of the allocator (debug purpose, linear time).
+		 *\~french
+		 *\brief		Vérifie la cohérence interne de l'allocateur (pour le debug, temps linéaire).
+		 */
+		CU_API bool checkConsistency()const;
+
+		uint64_t getTotalSize()const noexcept
+		{
+			return m_totalSize;
+		}
+
+		uint64_t getGranularity()const noexcept
+		{
+			return m_granularity;
+		}
+
+		uint64_t getUsedSize()const noexcept
+		{
+			return m_usedSize;
+		}
+
+	private:
+		static uint32_t constexpr SLLog2 = 4u;
+		static uint32_t constexpr SLCount = 1u << SLLog2;
+		static uint32_t constexpr FLCount = 64u - SLLog2 + 1u;
+		static uint32_t constexpr InvalidIndex = ~uint32_t{};
+
+		struct Block
+		{
+			uint64_t offset{};
+			uint64_t size{};
+			uint32_t prevPhys{ InvalidIndex };
+			uint32_t nextPhys{ InvalidIndex };
+			uint32_t prevFree{ InvalidIndex };
+			uint32_t nextFree{ InvalidIndex };
+			bool free{};
+		};
+
+		struct Mapping
+		{
+			uint32_t fl;
+			uint32_t sl;
+		};
+
+		Mapping doMapInsert( uint64_t units )const noexcept;
+		Mapping doMapSearch( uint64_t units )const noexcept;
+		uint32_t doFindFreeBlock( uint64_t units )const noexcept;
+		uint32_t doCreateBlock( uint64_t offset
+			, uint64_t size );
+		void doReleaseBlock( uint32_t index )noexcept;
+		void doInsertFree( uint32_t index )noexcept;
+		void doRemoveFree( uint32_t index )noexcept;
+		uint32_t doSplit( uint32_t index
+			, uint64_t size );
+		void doMerge( uint32_t into
+			, uint32_t other )noexcept;
+
+	private:
+		uint64_t m_totalSize;
+		uint64_t m_granularity;
+		uint64_t m_usedSize{};
+		uint32_t m_freeBlockCount{};
+		Vector< Block > m_blocks;
+		Vector< uint32_t > m_unusedBlocks;
+		UnorderedMap< uint64_t, uint32_t > m_allocated;
+		uint64_t m_flBitmap{};
+		Array< uint32_t, FLCount > m_slBitmaps{};
+		Array< uint32_t, FLCount * SLCount > m_freeHeads{};
+	};
+}
+
+#endif
@@ -3,6 +3,7 @@
 #define ___CastorMeshConverter_HPP___
 
 #include <Castor3D/Castor3DModule.hpp>
+#include <Castor3D/Binary/BinaryChunk.hpp>
 #include <Castor3D/Scene//SceneModule.hpp>
 
 #if !defined( CU_PlatformWindows )
@@ -24,6 +25,7 @@ namespace castor3d::exporter
 		bool splitPerMaterial{ false };
 		bool recenter{ false };
 		bool ignoreFailures{ false };
+		castor3d::CmshWriteOptions cmsh{};
 	};
 	/**
 	\~english
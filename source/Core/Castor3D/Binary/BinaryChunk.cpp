@@ -3,6 +3,8 @@
 #include "Castor3D/Miscellaneous/Logger.hpp"
 
 #include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/Compression.hpp>
+#include <CastorUtils/Data/MappedFile.hpp>
 
 #include <numeric>
 
@@ -12,6 +14,9 @@ namespace castor3d
 
 	namespace binchunk
 	{
+		// Deflate can't compress data by more than 1032:1.
+		static uint64_t constexpr MaxDeflateRatio = 1032u;
+
 		static bool isValidType( ChunkType v )
 		{
 			switch ( v )
@@ -87,6 +92,15 @@ namespace castor3d
 			case castor3d::ChunkType::eMorphTargetTangentsMikkt:
 			case castor3d::ChunkType::eSubmeshBitangents:
 			case castor3d::ChunkType::eMorphTargetBitangents:
+			case castor3d::ChunkType::eCmshFileV2:
+			case castor3d::ChunkType::eCompressed:
+			case castor3d::ChunkType::eSubmeshEncoded:
+			case castor3d::ChunkType::eLodComponent:
+			case castor3d::ChunkType::eLodPixelError:
+			case castor3d::ChunkType::eLodLevelError:
+			case castor3d::ChunkType::eLodLevelIndexCount:
+			case castor3d::ChunkType::eLodLevelIndices:
+			case castor3d::ChunkType::ePackedVerticesComponent:
 #pragma warning( push )
 #pragma warning( disable: 4996 )
 #pragma GCC diagnostic push
@@ -135,14 +149,16 @@ namespace castor3d
 
 	void BinaryChunk::finalise()
 	{
-		uint32_t size = std::accumulate( m_addedData.begin()
+		uint64_t size = std::accumulate( m_addedData.begin()
 			, m_addedData.end()
-			, uint32_t{}
-			, [&]( uint32_t value, castor::ByteArray const & array )
+			, uint64_t{}
+			, [&]( uint64_t value, castor::ByteArray const & array )
 			{
-				return value + uint32_t( array.size() );
+				return value + uint64_t( array.size() );
 			} );
 		m_data.resize( size );
+		m_view = nullptr;
+		m_viewSize = 0u;
 		size_t index = 0;
 
 		for ( auto const & array : m_addedData )
@@ -157,52 +173,72 @@ namespace castor3d
 		m_addedData.push_back( castor::move( data ) );
 	}
 
-	void BinaryChunk::add( uint8_t * data, uint32_t size )
+	void BinaryChunk::add( uint8_t * data, uint64_t size )
 	{
 		add( castor::ByteArray( data, data + size ) );
 	}
 
-	void BinaryChunk::get( uint8_t * data, uint32_t size )
+	void BinaryChunk::get( uint8_t * data, uint64_t size )
 	{
-		std::memcpy( data, &m_data[m_index], size );
+		std::memcpy( data, doGetBegin() + m_index, size );
 		m_index += size;
 	}
 
-	bool BinaryChunk::checkAvailable( uint32_t size )const
+	bool BinaryChunk::checkAvailable( uint64_t size )const
 	{
-		return size_t( m_index ) + size <= m_data.size();
+		return m_index + size <= doGetSize();
 	}
 
-	uint32_t BinaryChunk::getRemaining()const
+	uint64_t BinaryChunk::getRemaining()const
 	{
-		return uint32_t( m_data.size() - m_index );
+		return doGetSize() - m_index;
 	}
 
 	bool BinaryChunk::getSubChunk( BinaryChunk & chunkDst )
 	{
 		// First we retrieve the chunk type
 		BinaryChunk subchunk{ m_isLittleEndian };
+		subchunk.m_wideSizes = m_wideSizes;
 		bool result = doRead( &subchunk.m_type, 1 );
-		uint32_t size = 0;
+		uint64_t size = 0;
 
 		if ( result )
 		{
 			// Then the chunk data size
-			result = doRead( &size, 1 );
+			if ( m_wideSizes )
+			{
+				result = doRead( &size, 1 );
+			}
+			else
+			{
+				uint32_t size32 = 0;
+				result = doRead( &size32, 1 );
+				size = size32;
+			}
 		}
 
 		if ( result )
 		{
-			result = size_t( m_index ) + size <= m_data.size();
+			result = m_index + size <= doGetSize();
 		}
 
 		if ( result )
 		{
-			// Eventually we retrieve the chunk data
-			subchunk.m_data.insert( subchunk.m_data.end(), m_data.begin() + m_index, m_data.begin() + m_index + size );
+			// Eventually we reference the chunk data, the subchunk is parsed while its parent is alive.
+			subchunk.m_view = doGetBegin() + m_index;
+			subchunk.m_viewSize = size;
 			subchunk.m_index = 0;
 			m_index += size;
-			chunkDst = subchunk;
+
+			if ( subchunk.m_type == ChunkType::eCompressed )
+			{
+				result = doDecompress( subchunk );
+			}
+		}
+
+		if ( result )
+		{
+			chunkDst = castor::move( subchunk );
 		}
 
 		return result;
@@ -210,20 +246,21 @@ namespace castor3d
 
 	bool BinaryChunk::addSubChunk( BinaryChunk const & subchunk )
 	{
-		auto size = uint32_t( subchunk.m_data.size() );
+		auto size = subchunk.doGetSize();
 		castor::ByteArray buffer;
-		buffer.reserve( sizeof( uint32_t ) + sizeof( ChunkType ) + size );
+		buffer.reserve( sizeof( uint64_t ) + sizeof( ChunkType ) + size );
 
 		// Write subchunk type,
 		auto type = castor::systemEndianToLittleEndian( subchunk.m_type );
 		auto data = ByteCPtr( &type );
 		buffer.insert( buffer.end(), data, data + sizeof( ChunkType ) );
 		// Then its size,
-		castor::systemEndianToLittleEndian( size );
-		data = ByteCPtr( &size );
-		buffer.insert( buffer.end(), data, data + sizeof( uint32_t ) );
+		auto leSize = size;
+		castor::systemEndianToLittleEndian( leSize );
+		data = ByteCPtr( &leSize );
+		buffer.insert( buffer.end(), data, data + sizeof( uint64_t ) );
 		// And eventually its data.
-		buffer.insert( buffer.end(), subchunk.m_data.begin(), subchunk.m_data.end() );
+		buffer.insert( buffer.end(), subchunk.doGetBegin(), subchunk.doGetBegin() + size );
 
 		// Now add it to this chunk
 		add( castor::move( buffer ) );
@@ -240,7 +277,7 @@ namespace castor3d
 		{
 			finalise();
 			auto size = castor::systemEndianToLittleEndian( getDataSize() );
-			result = file.write( size ) == sizeof( uint32_t );
+			result = file.write( size ) == sizeof( uint64_t );
 		}
 
 		if ( result )
@@ -253,7 +290,7 @@ namespace castor3d
 
 	bool BinaryChunk::read( castor::BinaryFile & file )
 	{
-		uint32_t size = 0;
+		uint64_t size = 0;
 		bool result = file.read( m_type ) == sizeof( ChunkType );
 
 		if ( result )
@@ -269,12 +306,26 @@ namespace castor3d
 
 		if ( result )
 		{
-			result = file.read( size ) == sizeof( uint32_t );
-			chunkEndianToSystemEndian( *this, size );
+			m_wideSizes = m_type == ChunkType::eCmshFileV2;
+
+			if ( m_wideSizes )
+			{
+				result = file.read( size ) == sizeof( uint64_t );
+				chunkEndianToSystemEndian( *this, size );
+			}
+			else
+			{
+				uint32_t size32 = 0;
+				result = file.read( size32 ) == sizeof( uint32_t );
+				size = chunkEndianToSystemEndian( *this, size32 );
+			}
 		}
 
 		if ( result )
 		{
+			m_view = nullptr;
+			m_viewSize = 0u;
+			m_index = 0u;
 			m_data.resize( size );
 			result = file.readArray( m_data.data(), m_data.size() ) == m_data.size();
 		}
@@ -282,6 +333,151 @@ namespace castor3d
 		return result;
 	}
 
+	bool BinaryChunk::read( uint8_t const * data
+		, uint64_t size )
+	{
+		uint64_t dataSize = 0;
+		bool result = data != nullptr
+			&& size >= sizeof( ChunkType ) + sizeof( uint32_t );
+
+		if ( result )
+		{
+			std::memcpy( &m_type, data, sizeof( ChunkType ) );
+			data += sizeof( ChunkType );
+			size -= sizeof( ChunkType );
+			m_isLittleEndian = binchunk::isValidType( m_type );
+
+			if ( !m_isLittleEndian )
+			{
+				castor::switchEndianness( m_type );
+				result = binchunk::isValidType( m_type );
+			}
+		}
+
+		if ( result )
+		{
+			m_wideSizes = m_type == ChunkType::eCmshFileV2;
+
+			if ( m_wideSizes )
+			{
+				result = size >= sizeof( uint64_t );
+
+				if ( result )
+				{
+					std::memcpy( &dataSize, data, sizeof( uint64_t ) );
+					data += sizeof( uint64_t );
+					size -= sizeof( uint64_t );
+					chunkEndianToSystemEndian( *this, dataSize );
+				}
+			}
+			else
+			{
+				uint32_t size32 = 0;
+				std::memcpy( &size32, data, sizeof( uint32_t ) );
+				data += sizeof( uint32_t );
+				size -= sizeof( uint32_t );
+				dataSize = chunkEndianToSystemEndian( *this, size32 );
+			}
+		}
+
+		if ( result )
+		{
+			result = dataSize <= size;
+		}
+
+		if ( result )
+		{
+			m_data.clear();
+			m_view = data;
+			m_viewSize = dataSize;
+			m_index = 0u;
+		}
+
+		return result;
+	}
+
+	bool BinaryChunk::read( castor::MappedFile const & file )
+	{
+		return file.isMapped()
+			&& read( file.getData(), file.getSize() );
+	}
+
+	void BinaryChunk::compress( CmshWriteOptions const & options )
+	{
+		auto size = doGetSize();
+
+		if ( !options.compress
+			|| size < options.compressionThreshold )
+		{
+			return;
+		}
+
+		castor::ByteArray compressed;
+
+		if ( !castor::compressBuffer( doGetBegin(), size, compressed, options.compressionLevel )
+			|| compressed.size() + sizeof( ChunkType ) + sizeof( uint64_t ) >= size )
+		{
+			return;
+		}
+
+		// The compressed chunk type and data size, then the compressed data.
+		auto type = castor::systemEndianToLittleEndian( m_type );
+		castor::systemEndianToLittleEndian( size );
+		castor::ByteArray buffer;
+		buffer.reserve( sizeof( ChunkType ) + sizeof( uint64_t ) + compressed.size() );
+		auto data = ByteCPtr( &type );
+		buffer.insert( buffer.end(), data, data + sizeof( ChunkType ) );
+		data = ByteCPtr( &size );
+		buffer.insert( buffer.end(), data, data + sizeof( uint64_t ) );
+		buffer.insert( buffer.end(), compressed.begin(), compressed.end() );
+		m_type = ChunkType::eCompressed;
+		m_addedData.clear();
+		m_data = castor::move( buffer );
+	}
+
+	bool BinaryChunk::doDecompress( BinaryChunk & subchunk )
+	{
+		ChunkType type{};
+		uint64_t size{};
+		bool result = subchunk.doRead( &type, 1 )
+			&& subchunk.doRead( &size, 1 );
+
+		// A corrupted header must not trigger a huge allocation.
+		if ( result
+			&& ( type == ChunkType::eCompressed
+				|| !binchunk::isValidType( type )
+				|| size > subchunk.getRemaining() * binchunk::MaxDeflateRatio ) )
+		{
+			binaryError( cuT( "Invalid compressed chunk header" ) );
+			result = false;
+		}
+
+		if ( result )
+		{
+			// The decompressed data is owned by the subchunk, its own subchunks will reference it.
+			castor::ByteArray data( size );
+			result = castor::decompressBuffer( subchunk.getRemainingData()
+				, subchunk.getRemaining()
+				, data.data()
+				, size );
+
+			if ( result )
+			{
+				subchunk.m_type = type;
+				subchunk.m_view = nullptr;
+				subchunk.m_viewSize = 0u;
+				subchunk.m_index = 0u;
+				subchunk.m_data = castor::move( data );
+			}
+			else
+			{
+				binaryError( cuT( "Couldn't decompress chunk data" ) );
+			}
+		}
+
+		return result;
+	}
+
 	void BinaryChunk::binaryError( castor::StringView view )const
 	{
 		log::error << view;
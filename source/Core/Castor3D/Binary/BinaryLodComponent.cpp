@@ -0,0 +1,115 @@
+#include "Castor3D/Binary/BinaryLodComponent.hpp"
+
+#include "Castor3D/Model/Mesh/Submesh/Component/FaceIndices.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp"
+
+namespace castor3d
+{
+	//*************************************************************************************************
+
+	bool BinaryWriter< LodComponent >::doWrite( LodComponent const & obj )
+	{
+		bool result = doWriteChunk( obj.getData().getPixelError(), ChunkType::eLodPixelError, m_chunk );
+
+		for ( auto & lod : obj.getData().getLods() )
+		{
+			auto count = uint32_t( lod.faces.size() );
+
+			if ( result )
+			{
+				result = doWriteChunk( lod.error, ChunkType::eLodLevelError, m_chunk );
+			}
+
+			if ( result )
+			{
+				result = doWriteChunk( count, ChunkType::eLodLevelIndexCount, m_chunk );
+			}
+
+			if ( result )
+			{
+				result = doWriteChunk( reinterpret_cast< FaceIndices const * >( lod.faces.data() )
+					, count
+					, ChunkType::eLodLevelIndices
+					, m_chunk );
+			}
+		}
+
+		return result;
+	}
+
+	//*************************************************************************************************
+
+	template<>
+	castor::String BinaryParserBase< LodComponent >::Name = cuT( "LodComponent" );
+
+	bool BinaryParser< LodComponent >::doParse( LodComponent & obj )
+	{
+		bool result = true;
+		castor::Vector< FaceIndices > faces;
+		float pixelError{};
+		float error{};
+		uint32_t count{ 0u };
+		BinaryChunk chunk{ doIsLittleEndian() };
+
+		while ( result && doGetSubChunk( chunk ) )
+		{
+			switch ( chunk.getChunkType() )
+			{
+			case ChunkType::eLodPixelError:
+				result = doParseChunk( pixelError, chunk );
+				checkError( result, cuT( "Couldn't parse LOD pixel error." ) );
+
+				if ( result )
+				{
+					obj.getData().setPixelError( pixelError );
+				}
+
+				break;
+
+			case ChunkType::eLodLevelError:
+				result = doParseChunk( error, chunk );
+				checkError( result, cuT( "Couldn't parse LOD error." ) );
+				break;
+
+			case ChunkType::eLodLevelIndexCount:
+				result = doParseChunk( count, chunk );
+				checkError( result, cuT( "Couldn't parse LOD index count." ) );
+
+				if ( result )
+				{
+					faces.resize( count );
+				}
+
+				break;
+
+			case ChunkType::eLodLevelIndices:
+				result = doParseChunk( faces, chunk );
+				checkError( result, cuT( "Couldn't parse LOD indices." ) );
+
+				if ( result && !faces.empty() )
+				{
+					SubmeshLod lod{ {}, error };
+					lod.faces.reserve( faces.size() );
+
+					for ( auto & face : faces )
+					{
+						lod.faces.emplace_back( face.m_index[0], face.m_index[1], face.m_index[2] );
+					}
+
+					obj.getData().getLods().push_back( castor::move( lod ) );
+				}
+
+				faces.clear();
+				break;
+
+			default:
+				result = false;
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	//*************************************************************************************************
+}
@@ -1,5 +1,6 @@
 #include "Castor3D/Binary/BinarySubmesh.hpp"
 
+#include "Castor3D/Binary/BinaryLodComponent.hpp"
 #include "Castor3D/Binary/BinaryMorphComponent.hpp"
 #include "Castor3D/Binary/BinarySkinComponent.hpp"
 #include "Castor3D/Buffer/GeometryBuffers.hpp"
@@ -8,10 +9,16 @@
 #include "Castor3D/Model/Mesh/Submesh/Component/BaseDataComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/DefaultRenderComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/LinesMapping.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MorphComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/PackedVerticesComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/SkinComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
 
+#include <CastorUtils/Math/VertexPacking.hpp>
+
+#include <meshoptimizer.h>
+
 namespace castor3d
 {
 	//*************************************************************************************************
@@ -66,6 +73,430 @@ namespace castor3d
 				}
 			}
 		}
+
+		enum class Encoding : uint32_t
+		{
+			eVertexCodec = 1u,
+			eRange16 = 2u,
+			eOctahedral16 = 3u,
+			eTriangles = 4u,
+			eSequence = 5u,
+		};
+
+		enum class Quantisation
+		{
+			eNone,
+			eRange,
+			eOctahedral,
+		};
+
+		template< typename T >
+		static void append( castor::ByteArray & result
+			, T value )
+		{
+			castor::systemEndianToLittleEndian( value );
+			auto begin = reinterpret_cast< uint8_t const * >( &value );
+			result.insert( result.end(), begin, begin + sizeof( T ) );
+		}
+
+		static castor::ByteArray makeHeader( ChunkType type
+			, Encoding encoding
+			, uint32_t components
+			, uint32_t count )
+		{
+			castor::ByteArray result;
+			append( result, uint64_t( type ) );
+			append( result, uint32_t( encoding ) );
+			append( result, components );
+			append( result, count );
+			return result;
+		}
+
+		template< typename VertexT >
+		static void appendVertices( castor::ByteArray & result
+			, castor::Vector< VertexT > const & vertices )
+		{
+			auto offset = result.size();
+			result.resize( offset + meshopt_encodeVertexBufferBound( vertices.size(), sizeof( VertexT ) ) );
+			auto size = meshopt_encodeVertexBuffer( result.data() + offset
+				, result.size() - offset
+				, vertices.data()
+				, vertices.size()
+				, sizeof( VertexT ) );
+			result.resize( offset + size );
+		}
+
+		template< uint32_t CountT >
+		static castor::ByteArray encodeRaw( ChunkType type
+			, castor::Vector< castor::Point< float, CountT > > const & values )
+		{
+			auto result = makeHeader( type, Encoding::eVertexCodec, CountT, uint32_t( values.size() ) );
+			castor::Vector< castor::Point< float, CountT > > vertices{ values };
+
+			for ( auto & vertex : vertices )
+			{
+				for ( uint32_t i = 0u; i < CountT; ++i )
+				{
+					castor::systemEndianToLittleEndian( vertex[i] );
+				}
+			}
+
+			appendVertices( result, vertices );
+			return result;
+		}
+
+		template< uint32_t CountT >
+		static castor::ByteArray encodeRange( ChunkType type
+			, castor::Vector< castor::Point< float, CountT > > const & values )
+		{
+			static_assert( CountT <= 4u );
+			castor::Point< float, CountT > min{ values.front() };
+			castor::Point< float, CountT > max{ values.front() };
+
+			for ( auto & value : values )
+			{
+				for ( uint32_t i = 0u; i < CountT; ++i )
+				{
+					min[i] = std::min( min[i], value[i] );
+					max[i] = std::max( max[i], value[i] );
+				}
+			}
+
+			castor::Point< float, CountT > scale;
+			auto result = makeHeader( type, Encoding::eRange16, CountT, uint32_t( values.size() ) );
+
+			for ( uint32_t i = 0u; i < CountT; ++i )
+			{
+				scale[i] = ( max[i] - min[i] ) / 65535.0f;
+				append( result, min[i] );
+				append( result, scale[i] );
+			}
+
+			// Padded to 4 components, since the vertex codec needs a multiple of 4 bytes.
+			castor::Vector< castor::Array< uint16_t, 4u > > vertices;
+			vertices.reserve( values.size() );
+
+			for ( auto & value : values )
+			{
+				castor::Array< uint16_t, 4u > vertex{};
+
+				for ( uint32_t i = 0u; i < CountT; ++i )
+				{
+					vertex[i] = scale[i] == 0.0f
+						? uint16_t{}
+						: uint16_t( std::round( std::clamp( ( value[i] - min[i] ) / scale[i], 0.0f, 65535.0f ) ) );
+					castor::systemEndianToLittleEndian( vertex[i] );
+				}
+
+				vertices.push_back( vertex );
+			}
+
+			appendVertices( result, vertices );
+			return result;
+		}
+
+		static castor::ByteArray encodeOctahedral( ChunkType type
+			, castor::Point3fArray const & values )
+		{
+			auto result = makeHeader( type, Encoding::eOctahedral16, 3u, uint32_t( values.size() ) );
+			castor::Vector< castor::Array< int16_t, 2u > > vertices;
+			vertices.reserve( values.size() );
+
+			for ( auto & value : values )
+			{
+				auto & vertex = vertices.emplace_back( castor::packing::encodeOctahedral( value->x, value->y, value->z ) );
+				castor::systemEndianToLittleEndian( vertex[0] );
+				castor::systemEndianToLittleEndian( vertex[1] );
+			}
+
+			appendVertices( result, vertices );
+			return result;
+		}
+
+		static castor::ByteArray encodeOctahedral( ChunkType type
+			, castor::Point4fArray const & values )
+		{
+			auto result = makeHeader( type, Encoding::eOctahedral16, 4u, uint32_t( values.size() ) );
+			castor::Vector< castor::Array< int16_t, 4u > > vertices;
+			vertices.reserve( values.size() );
+
+			for ( auto & value : values )
+			{
+				auto oct = castor::packing::encodeOctahedral( value->x, value->y, value->z );
+				castor::Array< int16_t, 4u > vertex{ oct[0], oct[1], castor::packing::toSnorm16( value->w ), 0 };
+
+				for ( auto & component : vertex )
+				{
+					castor::systemEndianToLittleEndian( component );
+				}
+
+				vertices.push_back( vertex );
+			}
+
+			appendVertices( result, vertices );
+			return result;
+		}
+
+		template< uint32_t CountT >
+		static castor::ByteArray encodeVertices( ChunkType type
+			, castor::Vector< castor::Point< float, CountT > > const & values
+			, CmshWriteOptions const & options
+			, Quantisation quantisation )
+		{
+			if ( !options.quantise || quantisation == Quantisation::eNone )
+			{
+				return encodeRaw( type, values );
+			}
+
+			if constexpr ( CountT >= 3u )
+			{
+				if ( quantisation == Quantisation::eOctahedral )
+				{
+					return encodeOctahedral( type, values );
+				}
+			}
+
+			return encodeRange( type, values );
+		}
+
+		static castor::ByteArray encodeIndices( uint32_t const * indices
+			, uint32_t faceCount
+			, uint32_t components
+			, uint32_t vertexCount )
+		{
+			auto indexCount = size_t( faceCount ) * components;
+			auto triangles = components == 3u;
+			auto result = makeHeader( ChunkType::eSubmeshIndices
+				, triangles ? Encoding::eTriangles : Encoding::eSequence
+				, components
+				, faceCount );
+			auto offset = result.size();
+			result.resize( offset + ( triangles
+				? meshopt_encodeIndexBufferBound( indexCount, vertexCount )
+				: meshopt_encodeIndexSequenceBound( indexCount, vertexCount ) ) );
+			auto size = triangles
+				? meshopt_encodeIndexBuffer( result.data() + offset, result.size() - offset, indices, indexCount )
+				: meshopt_encodeIndexSequence( result.data() + offset, result.size() - offset, indices, indexCount );
+			result.resize( offset + size );
+			return result;
+		}
+
+		template< typename T >
+		static bool read( BinaryChunk & chunk
+			, T & value )
+		{
+			return ChunkParser< T >::parse( value, chunk );
+		}
+
+		// The vertex codec stores at least 2 bits per group of 16 bytes, hence a maximum ratio of 64.
+		static uint64_t constexpr MaxVertexCodecRatio = 64u;
+
+		static bool isEncodable( ChunkType type )
+		{
+			switch ( type )
+			{
+			case ChunkType::eSubmeshPositions:
+			case ChunkType::eSubmeshNormals:
+			case ChunkType::eSubmeshTangentsMikkt:
+			case ChunkType::eSubmeshBitangents:
+			case ChunkType::eSubmeshTexcoords0:
+			case ChunkType::eSubmeshTexcoords1:
+			case ChunkType::eSubmeshTexcoords2:
+			case ChunkType::eSubmeshTexcoords3:
+			case ChunkType::eSubmeshColours:
+			case ChunkType::eSubmeshIndices:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		/**
+		 *\~english
+		 *\brief		Checks, before allocating it, that the decoded data size is consistent with the encoded data size.
+		 *\~french
+		 *\brief		Vérifie, avant de l'allouer, que la taille des données décodées est cohérente avec celle des données encodées.
+		 */
+		static bool checkDecodedSize( BinaryChunk const & chunk
+			, uint64_t decodedSize
+			, uint64_t maxRatio )
+		{
+			return decodedSize <= chunk.getRemaining() * maxRatio;
+		}
+
+		template< uint32_t CountT, typename QuantisedT, typename DecodeT >
+		static bool decodeQuantised( BinaryChunk & chunk
+			, uint32_t count
+			, castor::ByteArray & result
+			, DecodeT decode )
+		{
+			if ( !checkDecodedSize( chunk, uint64_t( count ) * sizeof( QuantisedT ), MaxVertexCodecRatio ) )
+			{
+				return false;
+			}
+
+			castor::Vector< QuantisedT > vertices( count );
+
+			if ( meshopt_decodeVertexBuffer( vertices.data()
+				, count
+				, sizeof( QuantisedT )
+				, chunk.getRemainingData()
+				, size_t( chunk.getRemaining() ) ) != 0 )
+			{
+				return false;
+			}
+
+			result.reserve( size_t( count ) * CountT * sizeof( float ) );
+
+			for ( auto & vertex : vertices )
+			{
+				for ( auto & component : vertex )
+				{
+					castor::littleEndianToSystemEndian( component );
+				}
+
+				auto values = decode( vertex );
+
+				for ( uint32_t i = 0u; i < CountT; ++i )
+				{
+					append( result, values[i] );
+				}
+			}
+
+			return true;
+		}
+
+		template< uint32_t CountT >
+		static bool decodeRange( BinaryChunk & chunk
+			, uint32_t count
+			, castor::ByteArray & result )
+		{
+			castor::Array< float, CountT > min{};
+			castor::Array< float, CountT > scale{};
+			bool ok = true;
+
+			for ( uint32_t i = 0u; i < CountT && ok; ++i )
+			{
+				ok = read( chunk, min[i] )
+					&& read( chunk, scale[i] );
+			}
+
+			return ok
+				&& decodeQuantised< CountT, castor::Array< uint16_t, 4u > >( chunk, count, result
+					, [&min, &scale]( castor::Array< uint16_t, 4u > const & vertex )
+					{
+						castor::Array< float, CountT > values{};
+
+						for ( uint32_t i = 0u; i < CountT; ++i )
+						{
+							values[i] = min[i] + float( vertex[i] ) * scale[i];
+						}
+
+						return values;
+					} );
+		}
+
+		/**
+		 *\~english
+		 *\brief		Replaces an encoded chunk by the raw chunk it was made from.
+		 *\~french
+		 *\brief		Remplace un chunk encodé par le chunk brut à partir duquel il a été créé.
+		 */
+		static bool decode( BinaryChunk & chunk )
+		{
+			uint64_t type{};
+			uint32_t encoding{};
+			uint32_t components{};
+			uint32_t count{};
+
+			if ( !read( chunk, type )
+				|| !read( chunk, encoding )
+				|| !read( chunk, components )
+				|| !read( chunk, count )
+				|| !isEncodable( ChunkType( type ) ) )
+			{
+				return false;
+			}
+
+			castor::ByteArray result;
+			bool ok{};
+
+			switch ( Encoding( encoding ) )
+			{
+			case Encoding::eVertexCodec:
+				if ( ( components == 3u || components == 4u )
+					&& checkDecodedSize( chunk, uint64_t( count ) * components * sizeof( float ), MaxVertexCodecRatio ) )
+				{
+					auto size = size_t( components ) * sizeof( float );
+					result.resize( size_t( count ) * size );
+					ok = meshopt_decodeVertexBuffer( result.data()
+						, count
+						, size
+						, chunk.getRemainingData()
+						, size_t( chunk.getRemaining() ) ) == 0;
+				}
+				break;
+			case Encoding::eRange16:
+				if ( components == 3u )
+				{
+					ok = decodeRange< 3u >( chunk, count, result );
+				}
+				else if ( components == 4u )
+				{
+					ok = decodeRange< 4u >( chunk, count, result );
+				}
+				break;
+			case Encoding::eOctahedral16:
+				if ( components == 3u )
+				{
+					ok = decodeQuantised< 3u, castor::Array< int16_t, 2u > >( chunk, count, result
+						, []( castor::Array< int16_t, 2u > const & vertex )
+						{
+							return castor::packing::decodeOctahedral( vertex[0], vertex[1] );
+						} );
+				}
+				else if ( components == 4u )
+				{
+					ok = decodeQuantised< 4u, castor::Array< int16_t, 4u > >( chunk, count, result
+						, []( castor::Array< int16_t, 4u > const & vertex )
+						{
+							auto normal = castor::packing::decodeOctahedral( vertex[0], vertex[1] );
+							return castor::Point4f{ normal->x, normal->y, normal->z, castor::packing::fromSnorm16( vertex[2] ) };
+						} );
+				}
+				break;
+			case Encoding::eTriangles:
+			case Encoding::eSequence:
+				// The index codec needs at least one byte per triangle, the sequence codec one byte per index.
+				if ( Encoding( encoding ) == Encoding::eTriangles
+					? ( components == 3u && checkDecodedSize( chunk, count, 1u ) )
+					: ( components == 2u && checkDecodedSize( chunk, uint64_t( count ) * components, 1u ) ) )
+				{
+					castor::Vector< uint32_t > indices( size_t( count ) * components );
+					ok = ( Encoding( encoding ) == Encoding::eTriangles
+						? meshopt_decodeIndexBuffer( indices.data(), indices.size(), sizeof( uint32_t ), chunk.getRemainingData(), size_t( chunk.getRemaining() ) )
+						: meshopt_decodeIndexSequence( indices.data(), indices.size(), sizeof( uint32_t ), chunk.getRemainingData(), size_t( chunk.getRemaining() ) ) ) == 0;
+					result.reserve( indices.size() * sizeof( uint32_t ) );
+
+					for ( auto index : indices )
+					{
+						append( result, index );
+					}
+				}
+				break;
+			default:
+				break;
+			}
+
+			if ( ok )
+			{
+				BinaryChunk decoded{ ChunkType( type ) };
+				decoded.setData( castor::move( result ) );
+				chunk = castor::move( decoded );
+			}
+
+			return ok;
+		}
 	}
 
 	//*************************************************************************************************
@@ -120,6 +551,21 @@ namespace castor3d
 
 	bool BinaryWriter< Submesh >::doWrite( Submesh const & obj )
 	{
+		auto const & options = m_chunk.getWriteOptions();
+		auto writeValues = [this, &options]( auto const & values
+			, ChunkType chunkType
+			, binsmsh::Quantisation quantisation )
+		{
+			if ( ( !options.encode && !options.quantise )
+				|| values.empty() )
+			{
+				return doWriteChunk( values, chunkType, m_chunk );
+			}
+
+			return doWriteChunk( binsmsh::encodeVertices( chunkType, values, options, quantisation )
+				, ChunkType::eSubmeshEncoded
+				, m_chunk );
+		};
 		auto count = obj.getPointsCount();
 		bool result = doWriteChunk( count, ChunkType::eSubmeshVertexCount, m_chunk );
 
@@ -127,63 +573,63 @@ namespace castor3d
 			&& obj.hasComponent( PositionsComponent::TypeName ) )
 		{
 			auto const & values = obj.getComponent< PositionsComponent >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshPositions, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshPositions, binsmsh::Quantisation::eRange );
 		}
 
 		if ( result
 			&& obj.hasComponent( NormalsComponent::TypeName ) )
 		{
 			auto const & values = obj.getComponent< NormalsComponent >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshNormals, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshNormals, binsmsh::Quantisation::eOctahedral );
 		}
 
 		if ( result
 			&& obj.hasComponent( TangentsComponent::TypeName ) )
 		{
 			auto const & values = obj.getComponent< TangentsComponent >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshTangentsMikkt, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshTangentsMikkt, binsmsh::Quantisation::eOctahedral );
 		}
 
 		if ( result
 			&& obj.hasComponent( BitangentsComponent::TypeName ) )
 		{
 			auto const & values = obj.getComponent< BitangentsComponent >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshBitangents, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshBitangents, binsmsh::Quantisation::eOctahedral );
 		}
 
 		if ( result
 			&& obj.hasComponent( Texcoords0Component::TypeName ) )
 		{
 			auto const & values = obj.getComponent< Texcoords0Component >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshTexcoords0, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshTexcoords0, binsmsh::Quantisation::eRange );
 		}
 
 		if ( result
 			&& obj.hasComponent( Texcoords1Component::TypeName ) )
 		{
 			auto const & values = obj.getComponent< Texcoords1Component >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshTexcoords1, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshTexcoords1, binsmsh::Quantisation::eRange );
 		}
 
 		if ( result
 			&& obj.hasComponent( Texcoords2Component::TypeName ) )
 		{
 			auto const & values = obj.getComponent< Texcoords2Component >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshTexcoords2, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshTexcoords2, binsmsh::Quantisation::eRange );
 		}
 
 		if ( result
 			&& obj.hasComponent( Texcoords3Component::TypeName ) )
 		{
 			auto const & values = obj.getComponent< Texcoords3Component >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshTexcoords3, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshTexcoords3, binsmsh::Quantisation::eRange );
 		}
 
 		if ( result
 			&& obj.hasComponent( ColoursComponent::TypeName ) )
 		{
 			auto const & values = obj.getComponent< ColoursComponent >()->getData().getData();
-			result = doWriteChunk( values, ChunkType::eSubmeshColours, m_chunk );
+			result = writeValues( values, ChunkType::eSubmeshColours, binsmsh::Quantisation::eNone );
 		}
 
 		if ( result )
@@ -202,7 +648,11 @@ namespace castor3d
 				if ( result )
 				{
 					auto const * data = reinterpret_cast< FaceIndices const * >( obj.getComponent< TriFaceMapping >()->getData().getFaces().data() );
-					result = doWriteChunk( data, count, ChunkType::eSubmeshIndices, m_chunk );
+					result = ( options.encode && count > 0u )
+						? doWriteChunk( binsmsh::encodeIndices( data->m_index.data(), count, 3u, obj.getPointsCount() )
+							, ChunkType::eSubmeshEncoded
+							, m_chunk )
+						: doWriteChunk( data, count, ChunkType::eSubmeshIndices, m_chunk );
 				}
 			}
 			else if ( obj.hasComponent( LinesMapping::TypeName ) )
@@ -218,7 +668,11 @@ namespace castor3d
 				if ( result )
 				{
 					auto const * data = reinterpret_cast< LineIndices const * >( obj.getComponent< LinesMapping >()->getData().getFaces().data() );
-					result = doWriteChunk( data, count, ChunkType::eSubmeshIndices, m_chunk );
+					result = ( options.encode && count > 0u )
+						? doWriteChunk( binsmsh::encodeIndices( data->m_index.data(), count, 2u, obj.getPointsCount() )
+							, ChunkType::eSubmeshEncoded
+							, m_chunk )
+						: doWriteChunk( data, count, ChunkType::eSubmeshIndices, m_chunk );
 				}
 			}
 		}
@@ -239,6 +693,22 @@ namespace castor3d
 			}
 		}
 
+		if ( result )
+		{
+			if ( auto component = obj.getComponent< LodComponent >();
+				component && component->getData().hasData() )
+			{
+				BinaryWriter< LodComponent >{}.write( *component, m_chunk );
+			}
+		}
+
+		// Only the packing choice is written, the packed vertices are built from the vertices at upload.
+		if ( result
+			&& obj.hasComponent( PackedVerticesComponent::TypeName ) )
+		{
+			result = doWriteChunk( uint32_t{ 1u }, ChunkType::ePackedVerticesComponent, m_chunk );
+		}
+
 		return result;
 	}
 
@@ -261,6 +731,12 @@ namespace castor3d
 
 		while ( result && doGetSubChunk( chunk ) )
 		{
+			if ( chunk.getChunkType() == ChunkType::eSubmeshEncoded )
+			{
+				result = binsmsh::decode( chunk );
+				checkError( result, cuT( "Couldn't decode submesh data." ) );
+			}
+
 			switch ( chunk.getChunkType() )
 			{
 			case ChunkType::eSubmeshVertexCount:
@@ -418,6 +894,25 @@ namespace castor3d
 					}
 				}
 				break;
+			case ChunkType::eLodComponent:
+				if ( auto component = castor::makeUnique< LodComponent >( obj ) )
+				{
+					result = createBinaryParser< LodComponent >().parse( *component, chunk );
+					checkError( result, cuT( "Couldn't parse LOD component." ) );
+
+					if ( result )
+					{
+						obj.addComponent( castor::ptrRefCast< SubmeshComponent >( component ) );
+					}
+				}
+				break;
+			case ChunkType::ePackedVerticesComponent:
+				if ( !obj.hasComponent( PackedVerticesComponent::TypeName )
+					&& PackedVerticesComponent::canPackVertices( obj ) )
+				{
+					obj.createComponent< PackedVerticesComponent >();
+				}
+				break;
 			case ChunkType::eSubmeshIndexComponentCount:
 				result = doParseChunk( components, chunk );
 				checkError( result, cuT( "Couldn't parse index component size." ) );
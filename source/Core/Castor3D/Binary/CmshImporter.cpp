@@ -14,6 +14,7 @@
 #include "Castor3D/Scene/Animation/SceneNodeAnimation.hpp"
 
 #include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/MappedFile.hpp>
 
 namespace castor3d
 {
@@ -39,6 +40,21 @@ namespace castor3d
 
 			return name;
 		}
+
+		template< typename ParsedT >
+		static bool parseFile( ParsedT & obj
+			, castor::Path const & path )
+		{
+			// The mapping stays alive during the whole parsing, since the chunks only reference it.
+			if ( castor::MappedFile mapped{ path };
+				mapped.isMapped() )
+			{
+				return BinaryParser< ParsedT >{}.parse( obj, mapped );
+			}
+
+			castor::BinaryFile file{ path, castor::File::OpenMode::eRead };
+			return BinaryParser< ParsedT >{}.parse( obj, file );
+		}
 	}
 
 	//*********************************************************************************************
@@ -254,8 +270,7 @@ namespace castor3d
 
 	bool CmshMeshImporter::doImportMesh( Mesh & mesh )
 	{
-		castor::BinaryFile meshFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		return BinaryParser< Mesh >{}.parse( mesh, meshFile );
+		return cmshimp::parseFile( mesh, m_file->getFileName() );
 	}
 
 	//*********************************************************************************************
@@ -274,8 +289,7 @@ namespace castor3d
 
 	bool CmshSkeletonImporter::doImportSkeleton( Skeleton & skeleton )
 	{
-		castor::BinaryFile skelFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		return BinaryParser< Skeleton >{}.parse( skeleton, skelFile );
+		return cmshimp::parseFile( skeleton, m_file->getFileName() );
 	}
 
 	//*********************************************************************************************
@@ -296,8 +310,7 @@ namespace castor3d
 
 	bool CmshAnimationImporter::doImportSkeleton( SkeletonAnimation & animation )
 	{
-		castor::BinaryFile animFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		auto result = BinaryParser< SkeletonAnimation >{}.parse( animation, animFile );
+		auto result = cmshimp::parseFile( animation, m_file->getFileName() );
 
 		if ( result )
 		{
@@ -311,8 +324,7 @@ namespace castor3d
 
 	bool CmshAnimationImporter::doImportMesh( MeshAnimation & animation )
 	{
-		castor::BinaryFile animFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		auto result = BinaryParser< MeshAnimation >{}.parse( animation, animFile );
+		auto result = cmshimp::parseFile( animation, m_file->getFileName() );
 
 		if ( result )
 		{
@@ -326,8 +338,7 @@ namespace castor3d
 
 	bool CmshAnimationImporter::doImportNode( SceneNodeAnimation & animation )
 	{
-		castor::BinaryFile animFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		auto result = BinaryParser< SceneNodeAnimation >{}.parse( animation, animFile );
+		auto result = cmshimp::parseFile( animation, m_file->getFileName() );
 
 		if ( result )
 		{
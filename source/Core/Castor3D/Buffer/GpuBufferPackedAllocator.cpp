@@ -14,176 +14,54 @@ namespace castor3d
 		, size_t alignSize )
 		: m_allocatedSize{ size }
 		, m_alignSize{ alignSize }
+		, m_allocator{ size, alignSize }
 	{
 	}
 
 	VkDeviceSize GpuBufferPackedAllocator::allocate( size_t size )
 	{
 		CU_Require( hasAvailable( size ) );
-		MemChunk chunk{ 0u, size, size };
-		size = size_t( ashes::getAlignedSize( size, m_alignSize ) );
-		chunk.size = size;
+		auto result = m_allocator.allocate( size );
 
-		if ( auto it = std::find_if( m_deallocated.begin()
-			, m_deallocated.end()
-			, [size]( MemChunk const & lookup )
-			{
-				return lookup.size >= size;
-			} );
-			it != m_deallocated.end() )
-		{
-			chunk.offset = it->offset;
-
-			if constexpr ( C3D_DebugGPUPackedAllocator )
-			{
-				if ( 1u < std::count_if( m_deallocated.begin()
-					, m_deallocated.end()
-					, [&chunk]( MemChunk const & lookup )
-					{
-						return lookup.offset == chunk.offset;
-					} ) )
-				{
-					log::error << "Duplicate offset in deallocated chunks" << size << std::endl;
-					CU_Failure( "Duplicate offset in deallocated chunks" );
-				}
-			}
-
-			if ( it->size > size )
-			{
-				it->size -= size;
-				it->askedSize -= size;
-				it->offset += size;
-
-				if constexpr ( C3D_DebugGPUPackedAllocator )
-				{
-					auto offset = it->offset;
-					auto count = std::count_if( m_deallocated.begin()
-						, m_deallocated.end()
-						, [offset]( MemChunk const & lookup )
-						{
-								return lookup.offset == offset;
-						} );
-
-					if ( count > 1u )
-					{
-						log::error << "Duplicate offset in deallocated chunks" << size << std::endl;
-						CU_Failure( "Duplicate offset in deallocated chunks" );
-					}
-
-					count = std::count_if( m_deallocated.begin()
-						, m_deallocated.end()
-						, [&chunk]( MemChunk const & lookup )
-						{
-								return lookup.offset == chunk.offset;
-						} );
-
-					if ( count > 0u )
-					{
-						log::error << "Duplicate offset in deallocated chunks" << size << std::endl;
-						CU_Failure( "Duplicate offset in deallocated chunks" );
-					}
-				}
-			}
-			else
-			{
-				m_deallocated.erase( it );
-			}
-		}
-		else if ( !m_allocated.empty() )
-		{
-			auto rit = m_allocated.rbegin();
-			chunk.offset = rit->offset + rit->size;
-			CU_Require( chunk.offset == ashes::getAlignedSize( chunk.offset, m_alignSize ) );
-		}
-
-		if ( chunk.offset + size > m_allocatedSize )
+		if ( result == castor::TlsfAllocator::InvalidOffset )
 		{
+			auto stats = m_allocator.getStatistics();
 			log::error << "Trying to allocate more than possible (" << m_allocatedSize
-				<< "): offset = " << chunk.offset
-				<< ", size = " << size << std::endl;
+				<< "): size = " << size
+				<< ", used = " << stats.usedSize
+				<< ", largest free chunk = " << stats.largestFreeBlock << std::endl;
 			CU_Failure( "Trying to allocate more than possible" );
 		}
 
 		if constexpr ( C3D_DebugGPUPackedAllocator )
 		{
-			if ( auto it = std::find_if( m_deallocated.begin()
-				, m_deallocated.end()
-				, [&chunk]( MemChunk const & lookup )
-				{
-					return lookup.offset == chunk.offset;
-				} );
-				it != m_deallocated.end() )
-			{
-				log::error << "Trying to allocate at a remaining deallocated offset (" << m_allocatedSize
-					<< "): offset = " << chunk.offset
-					<< ", size = " << size << std::endl;
-				CU_Failure( "Trying to allocate at a remaining deallocated offset" );
-			}
-
-			if ( auto ait = m_allocated.find( chunk );
-				ait != m_allocated.end() )
+			if ( !m_allocator.checkConsistency() )
 			{
-				log::error << "Trying to allocate at an already allocated offset (" << m_allocatedSize
-					<< "): offset = " << chunk.offset
-					<< ", size = " << size << std::endl;
-				CU_Failure( "Trying to allocate at an already allocated offset" );
+				log::error << "Inconsistent packed allocator after allocation at offset " << result << std::endl;
+				CU_Failure( "Inconsistent packed allocator" );
 			}
 		}
 
-		m_currentAllocated += chunk.size;
-		m_allocated.insert( chunk );
-		return chunk.offset;
+		return result;
 	}
 
 	void GpuBufferPackedAllocator::deallocate( VkDeviceSize pointer )
 	{
 		CU_Require( pointer < m_allocatedSize );
 
-		if ( auto it = std::find_if( m_allocated.begin()
-			, m_allocated.end()
-			, [pointer]( MemChunk const & lookup )
-			{
-				return lookup.offset == pointer;
-			} );
-			it != m_allocated.end() )
+		if ( !m_allocator.deallocate( pointer ) )
 		{
-			auto chunk = *it;
-			m_allocated.erase( it );
-			m_currentAllocated -= chunk.size;
+			log::error << "Trying to deallocate a memory chunk that doesn't belong to this buffer" << std::endl;
+			return;
+		}
 
-			if ( m_currentAllocated == 0u )
-			{
-				m_deallocated.clear();
-			}
-			else
+		if constexpr ( C3D_DebugGPUPackedAllocator )
+		{
+			if ( !m_allocator.checkConsistency() )
 			{
-				auto dit = std::find_if( m_deallocated.begin()
-					, m_deallocated.end()
-					, [&chunk]( MemChunk const & lookup )
-					{
-						return lookup.offset == chunk.offset + chunk.size
-							|| chunk.offset == lookup.offset + lookup.size;
-					} );
-
-				if ( dit != m_deallocated.end() )
-				{
-					dit->offset = std::min( dit->offset, chunk.offset );
-					dit->size += chunk.size;
-					dit->askedSize += chunk.size;
-				}
-				else
-				{
-					dit = std::lower_bound( m_deallocated.begin()
-						, m_deallocated.end()
-						, chunk
-						, MemChunkCompare{} );
-					m_deallocated.emplace( dit, chunk );
-				}
+				log::error << "Inconsistent packed allocator after deallocation at offset " << pointer << std::endl;
+				CU_Failure( "Inconsistent packed allocator" );
 			}
 		}
-		else
-		{
-			log::error << "Trying to deallocate a memory chunk that doesn't belong to this buffer" << std::endl;
-		}
 	}
 }
@@ -1,6 +1,7 @@
 #include "Castor3D/Buffer/ObjectBufferPool.hpp"
 
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/Buffer/UploadData.hpp"
 #include "Castor3D/Model/VertexGroup.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/SubmeshComponentRegister.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
@@ -96,6 +97,45 @@ namespace castor3d
 
 			return result;
 		}
+
+		static uint32_t getAllocationCount( ObjectBufferPool::ModelBuffers const & buffers )
+		{
+			uint32_t result{};
+
+			for ( auto & buffer : buffers.buffers )
+			{
+				if ( buffer )
+				{
+					result = std::max( result, buffer->getAllocator().getStatistics().allocationCount );
+				}
+			}
+
+			return result;
+		}
+
+		static VkAccessFlags getAccessFlags( SubmeshData data )
+		{
+			switch ( data )
+			{
+			case SubmeshData::eIndex:
+				return VK_ACCESS_INDEX_READ_BIT;
+			case SubmeshData::eMeshlets:
+				return VK_ACCESS_SHADER_READ_BIT;
+			default:
+				return VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+			}
+		}
+
+		static VkPipelineStageFlags getStageFlags( SubmeshData data )
+		{
+			switch ( data )
+			{
+			case SubmeshData::eMeshlets:
+				return VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT;
+			default:
+				return VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+			}
+		}
 	}
 
 	//*********************************************************************************************
@@ -212,6 +252,10 @@ namespace castor3d
 
 	void ObjectBufferPool::cleanup()
 	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		m_pendingReleases.clear();
+		m_relocatables.clear();
+		m_indexBuffers.clear();
 		m_buffers.clear();
 	}
 
@@ -220,6 +264,7 @@ namespace castor3d
 		, VkDeviceSize meshletCount
 		, SubmeshComponentCombine const & components )
 	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
 		auto result = doGetBuffer( vertexCount, indexCount, meshletCount, components, false );
 
 		if ( indexCount && vertexCount )
@@ -235,6 +280,7 @@ namespace castor3d
 		, ashes::BufferBase const * indexBuffer
 		, SubmeshComponentCombine const & components )
 	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
 		auto result = doGetBuffer( vertexCount, 0u, 0u, components, true );
 
 		if ( indexBuffer )
@@ -248,6 +294,7 @@ namespace castor3d
 
 	ObjectBufferPool::ModelBuffers const & ObjectBufferPool::getBuffers( ashes::BufferBase const & buffer )
 	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
 		ObjectBufferPool::ModelBuffers const * result{};
 
 		if ( auto mit = std::find_if( m_buffers.begin()
@@ -278,6 +325,7 @@ namespace castor3d
 
 	ashes::BufferBase const & ObjectBufferPool::getIndexBuffer( ashes::BufferBase const & buffer )
 	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
 		auto it = m_indexBuffers.find( &buffer );
 
 		if ( it == m_indexBuffers.end() )
@@ -290,33 +338,91 @@ namespace castor3d
 
 	void ObjectBufferPool::putBuffer( ObjectBufferOffset const & bufferOffset )noexcept
 	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		doPutBuffer( bufferOffset );
+	}
+
+	void ObjectBufferPool::registerRelocatable( ObjectBufferOffset & bufferOffset
+		, castor::Function< void() > onMoved )
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
 		auto buffersIt = m_buffers.find( bufferOffset.hash );
-		CU_Require( buffersIt  != m_buffers.end() );
-		auto & buffers = buffersIt->second;
-		auto it = std::find_if( buffers.begin()
-			, buffers.end()
-			, [&bufferOffset]( ModelBuffers const & lookup )
+		CU_Require( buffersIt != m_buffers.end() );
+		auto it = doFindBuffers( bufferOffset, buffersIt->second );
+		CU_Require( it != buffersIt->second.end() );
+
+		if ( m_relocatables.try_emplace( &bufferOffset, Relocatable{ &bufferOffset, castor::move( onMoved ) } ).second )
+		{
+			++it->relocatable;
+		}
+	}
+
+	void ObjectBufferPool::unregisterRelocatable( ObjectBufferOffset const & bufferOffset )noexcept
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		auto relIt = m_relocatables.find( &bufferOffset );
+
+		if ( relIt == m_relocatables.end() )
+		{
+			return;
+		}
+
+		m_relocatables.erase( relIt );
+
+		if ( auto buffersIt = m_buffers.find( bufferOffset.hash );
+			buffersIt != m_buffers.end() )
+		{
+			if ( auto it = doFindBuffers( bufferOffset, buffersIt->second );
+				it != buffersIt->second.end() )
 			{
-				bool result = true;
+				CU_Require( it->relocatable > 0u );
+				--it->relocatable;
+			}
+		}
+	}
 
-				for ( uint32_t i = 0u; i < uint32_t( SubmeshData::eCount ); ++i )
-				{
-					if ( result && lookup.buffers[i] && bufferOffset.buffers[i].buffer )
-					{
-						result = &lookup.buffers[i]->getBuffer() == &bufferOffset.buffers[i].getBuffer();
-					}
-				}
+	void ObjectBufferPool::compact( UploadData & uploader
+		, VkDeviceSize maxMovedSize )
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		m_compactionStats = {};
+		doProcessPendingReleases();
+		doReleaseEmptyBuffers();
 
-				return result;
-			} );
-		CU_Require( it != buffers.end() );
+		if ( !maxMovedSize || !doSelectEvacuated() )
+		{
+			return;
+		}
 
-		for ( uint32_t i = 0u; i < uint32_t( SubmeshData::eCount ); ++i )
+		castor::Vector< castor::Function< void() > const * > moved;
+
+		for ( auto const & [_, relocatable] : m_relocatables )
 		{
-			if ( bufferOffset.buffers[i].buffer )
+			if ( m_compactionStats.movedSize >= maxMovedSize )
 			{
-				CU_Require( it->buffers[i] );
-				it->buffers[i]->deallocate( bufferOffset.buffers[i].chunk );
+				break;
+			}
+
+			auto & bufferOffset = *relocatable.bufferOffset;
+			auto & array = m_buffers.find( bufferOffset.hash )->second;
+
+			if ( auto source = doFindBuffers( bufferOffset, array );
+				source != array.end()
+				&& source->evacuating
+				&& doMove( bufferOffset, array, source, uploader ) )
+			{
+				moved.push_back( &relocatable.onMoved );
+			}
+		}
+
+		if ( !moved.empty() )
+		{
+			// The generation is updated before the callbacks, so that they can retrieve it.
+			++m_generation;
+
+			for ( auto onMoved : moved )
+			{
+				( *onMoved )();
 			}
 		}
 	}
@@ -333,9 +439,11 @@ namespace castor3d
 		hash = castor::hashCombine( hash, isGpuComputed );
 		ObjectBufferOffset result{ hash };
 		auto & buffers = m_buffers.try_emplace( hash ).first->second;
+		auto packed = components.hasPackedVerticesFlag;
 		auto it = doFindBuffer( vertexCount
 			, indexCount
 			, meshletCount
+			, packed
 			, buffers );
 		auto align = uint32_t( m_device.properties.limits.nonCoherentAtomSize );
 
@@ -356,7 +464,7 @@ namespace castor3d
 					{
 						modelBuffers.buffers[index] = details::createBaseBuffer< uint32_t >( m_device
 							, indexCount
-							, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+							, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
 							, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 							, m_debugName + name + getName( data ) + castor::string::toString( buffers.size() )
 							, align );
@@ -368,7 +476,7 @@ namespace castor3d
 					{
 						modelBuffers.buffers[index] = details::createBaseBuffer< Meshlet >( m_device
 							, meshletCount
-							, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+							, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
 							, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 							, m_debugName + name + getName( data ) + castor::string::toString( buffers.size() )
 							, align );
@@ -381,7 +489,7 @@ namespace castor3d
 					case SubmeshData::eSkin:
 						modelBuffers.buffers[index] = details::createBaseBuffer< VertexBoneData >( m_device
 							, vertexCount
-							, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+							, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
 							, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 							, m_debugName + name + getName( data ) + castor::string::toString( buffers.size() )
 							, align );
@@ -389,18 +497,30 @@ namespace castor3d
 					case SubmeshData::ePassMasks:
 						modelBuffers.buffers[index] = details::createBaseBuffer< castor::Point4ui >( m_device
 							, vertexCount
-							, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+							, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
 							, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 							, m_debugName + name + getName( data ) + castor::string::toString( buffers.size() )
 							, align );
 						break;
 					default:
-						modelBuffers.buffers[index] = details::createBaseBuffer< castor::Point4f >( m_device
-							, vertexCount
-							, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
-							, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-							, m_debugName + name + getName( data ) + castor::string::toString( buffers.size() )
-							, align );
+						if ( packed && isPackable( data ) )
+						{
+							modelBuffers.buffers[index] = details::createBaseBuffer< castor::Array< uint8_t, PackedVertexStride > >( m_device
+								, vertexCount
+								, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+								, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+								, m_debugName + name + getName( data ) + castor::string::toString( buffers.size() )
+								, align );
+						}
+						else
+						{
+							modelBuffers.buffers[index] = details::createBaseBuffer< castor::Point4f >( m_device
+								, vertexCount
+								, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+								, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+								, m_debugName + name + getName( data ) + castor::string::toString( buffers.size() )
+								, align );
+						}
 						break;
 					}
 				}
@@ -432,28 +552,30 @@ namespace castor3d
 				if ( it->buffers[i] )
 				{
 					result.buffers[i].buffer = it->buffers[i].get();
-					result.buffers[i].chunk = it->buffers[i]->allocate( getSize( SubmeshData( i ) ) * vertexCount );
+					result.buffers[i].chunk = it->buffers[i]->allocate( getSize( SubmeshData( i ), packed ) * vertexCount );
 				}
 			}
 		}
 
-		result.id = uint16_t( std::distance( buffers.begin(), it ) );
+		result.vertexStride = getSize( SubmeshData::ePositions, packed );
 		return result;
 	}
 
 	ObjectBufferPool::BufferArray::iterator ObjectBufferPool::doFindBuffer( VkDeviceSize vertexCount
 		, VkDeviceSize indexCount
 		, VkDeviceSize meshletCount
+		, bool packed
 		, ObjectBufferPool::BufferArray & array )const
 	{
 		return std::find_if( array.begin()
 			, array.end()
-			, [vertexCount, indexCount, meshletCount]( ModelBuffers const & lookup )
+			, [vertexCount, indexCount, meshletCount, packed]( ModelBuffers const & lookup )
 			{
 				uint32_t index{};
-				return lookup.buffers.end() == std::find_if( lookup.buffers.begin()
+				return !lookup.evacuating
+					&& lookup.buffers.end() == std::find_if( lookup.buffers.begin()
 					, lookup.buffers.end()
-					, [vertexCount, indexCount, meshletCount, &index]( GpuPackedBaseBufferUPtr const & buffer )
+					, [vertexCount, indexCount, meshletCount, packed, &index]( GpuPackedBaseBufferUPtr const & buffer )
 					{
 						if ( index == uint32_t( SubmeshData::eIndex ) )
 						{
@@ -468,10 +590,257 @@ namespace castor3d
 						}
 
 						return buffer
-							&& !buffer->hasAvailable( getSize( SubmeshData( index++ ) ) * vertexCount );
+							&& !buffer->hasAvailable( getSize( SubmeshData( index++ ), packed ) * vertexCount );
 					} );
 			} );
 	}
 
+	ObjectBufferPool::BufferArray::iterator ObjectBufferPool::doFindBuffers( ObjectBufferOffset const & bufferOffset
+		, ObjectBufferPool::BufferArray & array )const
+	{
+		return std::find_if( array.begin()
+			, array.end()
+			, [&bufferOffset]( ModelBuffers const & lookup )
+			{
+				bool result = true;
+
+				for ( uint32_t i = 0u; i < uint32_t( SubmeshData::eCount ); ++i )
+				{
+					if ( result && lookup.buffers[i] && bufferOffset.buffers[i].buffer )
+					{
+						result = &lookup.buffers[i]->getBuffer() == &bufferOffset.buffers[i].getBuffer();
+					}
+				}
+
+				return result;
+			} );
+	}
+
+	void ObjectBufferPool::doPutBuffer( ObjectBufferOffset const & bufferOffset )noexcept
+	{
+		auto buffersIt = m_buffers.find( bufferOffset.hash );
+		CU_Require( buffersIt  != m_buffers.end() );
+		auto & buffers = buffersIt->second;
+		auto it = doFindBuffers( bufferOffset, buffers );
+		CU_Require( it != buffers.end() );
+
+		for ( uint32_t i = 0u; i < uint32_t( SubmeshData::eCount ); ++i )
+		{
+			if ( bufferOffset.buffers[i].buffer )
+			{
+				CU_Require( it->buffers[i] );
+				it->buffers[i]->deallocate( bufferOffset.buffers[i].chunk );
+			}
+		}
+	}
+
+	void ObjectBufferPool::doProcessPendingReleases()
+	{
+		auto it = m_pendingReleases.begin();
+
+		while ( it != m_pendingReleases.end() )
+		{
+			if ( --it->delay == 0u )
+			{
+				for ( auto & chunk : it->bufferOffset.buffers )
+				{
+					if ( chunk.buffer )
+					{
+						m_compactionStats.freedSize += chunk.chunk.size;
+					}
+				}
+
+				doPutBuffer( it->bufferOffset );
+				it = m_pendingReleases.erase( it );
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	void ObjectBufferPool::doReleaseEmptyBuffers()
+	{
+		bool released = false;
+
+		for ( auto & [_, array] : m_buffers )
+		{
+			auto it = array.begin();
+
+			while ( it != array.end() )
+			{
+				if ( objbuf::getAllocationCount( *it ) != 0u )
+				{
+					it->emptyPasses = 0u;
+					++it;
+				}
+				else if ( ++it->emptyPasses < ObjectPoolReleaseDelay )
+				{
+					++it;
+				}
+				else
+				{
+					// Empty for long enough to be sure no frame still uses it.
+					if ( auto & positions = it->buffers[size_t( SubmeshData::ePositions )] )
+					{
+						m_indexBuffers.erase( &positions->getBuffer() );
+					}
+
+					for ( auto & buffer : it->buffers )
+					{
+						if ( buffer )
+						{
+							m_compactionStats.releasedSize += buffer->getAllocator().getTotalSize();
+						}
+					}
+
+					++m_compactionStats.releasedBuffers;
+					it = array.erase( it );
+					released = true;
+				}
+			}
+		}
+
+		if ( released )
+		{
+			++m_generation;
+		}
+	}
+
+	bool ObjectBufferPool::doSelectEvacuated()
+	{
+		bool result = false;
+
+		for ( auto & [_, array] : m_buffers )
+		{
+			if ( array.size() < 2u )
+			{
+				continue;
+			}
+
+			if ( std::any_of( array.begin()
+				, array.end()
+				, []( ModelBuffers const & lookup )
+				{
+					return lookup.evacuating;
+				} ) )
+			{
+				result = true;
+				continue;
+			}
+
+			// Look for the least used buffers, among the ones holding only relocatable ranges.
+			auto candidate = array.end();
+			auto minUsage = ObjectPoolCompactionThreshold;
+			VkDeviceSize freeSize{};
+
+			for ( auto it = array.begin(); it != array.end(); ++it )
+			{
+				auto & positions = it->buffers[size_t( SubmeshData::ePositions )];
+
+				if ( !positions )
+				{
+					continue;
+				}
+
+				auto stats = positions->getAllocator().getStatistics();
+				freeSize += stats.freeSize;
+
+				if ( auto count = objbuf::getAllocationCount( *it );
+					count == 0u || it->relocatable < count )
+				{
+					continue;
+				}
+
+				if ( auto usage = float( double( stats.usedSize ) / double( stats.totalSize ) );
+					usage < minUsage )
+				{
+					minUsage = usage;
+					candidate = it;
+				}
+			}
+
+			if ( candidate != array.end() )
+			{
+				// Only worth starting if the other buffers can receive the candidate's ranges.
+				auto stats = candidate->buffers[size_t( SubmeshData::ePositions )]->getAllocator().getStatistics();
+
+				if ( freeSize - stats.freeSize >= stats.usedSize )
+				{
+					candidate->evacuating = true;
+					result = true;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	bool ObjectBufferPool::doMove( ObjectBufferOffset & bufferOffset
+		, BufferArray & array
+		, BufferArray::iterator source
+		, UploadData & uploader )
+	{
+		auto target = std::find_if( array.begin()
+			, array.end()
+			, [&bufferOffset]( ModelBuffers const & lookup )
+			{
+				if ( lookup.evacuating )
+				{
+					return false;
+				}
+
+				for ( uint32_t i = 0u; i < uint32_t( SubmeshData::eCount ); ++i )
+				{
+					if ( auto & chunk = bufferOffset.buffers[i];
+						chunk.buffer
+						&& ( !lookup.buffers[i]
+							|| !lookup.buffers[i]->hasAvailable( chunk.chunk.askedSize ) ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			} );
+
+		if ( target == array.end() )
+		{
+			// No room left in the other buffers, stop emptying this one.
+			source->evacuating = false;
+			return false;
+		}
+
+		// The previous ranges are kept until the users have updated their references.
+		m_pendingReleases.push_back( { bufferOffset, ObjectPoolReleaseDelay } );
+
+		for ( uint32_t i = 0u; i < uint32_t( SubmeshData::eCount ); ++i )
+		{
+			if ( auto & chunk = bufferOffset.buffers[i];
+				chunk.buffer )
+			{
+				auto & dstBuffer = *target->buffers[i];
+				auto dstChunk = dstBuffer.allocate( chunk.chunk.askedSize );
+				uploader.pushCopy( chunk.getBuffer()
+					, chunk.getOffset()
+					, chunk.chunk.askedSize
+					, dstBuffer.getBuffer()
+					, dstChunk.offset
+					, objbuf::getAccessFlags( SubmeshData( i ) )
+					, objbuf::getStageFlags( SubmeshData( i ) ) );
+				// Counted as the allocated range, as the freed ranges are.
+				m_compactionStats.movedSize += chunk.chunk.size;
+				chunk.buffer = &dstBuffer;
+				chunk.chunk = dstChunk;
+			}
+		}
+
+		--source->relocatable;
+		++target->relocatable;
+		++m_compactionStats.movedCount;
+		return true;
+	}
+
 	//*********************************************************************************************
 }
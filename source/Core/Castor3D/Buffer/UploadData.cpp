@@ -21,6 +21,20 @@ CU_ImplementSmartPtr( castor3d, UploadData )
 
 namespace castor3d
 {
+	namespace updata
+	{
+		template< typename ImageDataRangeT >
+		static bool isBefore( ImageDataRangeT const & lhs
+			, ImageDataRangeT const & rhs )noexcept
+		{
+			return lhs.dstImage < rhs.dstImage
+				|| ( lhs.dstImage == rhs.dstImage
+					&& ( lhs.dstRange.baseArrayLayer < rhs.dstRange.baseArrayLayer
+						|| ( lhs.dstRange.baseArrayLayer == rhs.dstRange.baseArrayLayer
+							&& lhs.dstRange.baseMipLevel < rhs.dstRange.baseMipLevel ) ) );
+		}
+	}
+
 	castor::OutputStream & operator<<( castor::OutputStream & stream, VkImageSubresourceRange const & rhs )
 	{
 		stream << rhs.aspectMask
@@ -84,22 +98,75 @@ namespace castor3d
 		auto it = std::lower_bound( m_pendingImages.begin()
 			, m_pendingImages.end()
 			, upload
-			, []( ImageDataRange const & lhs, ImageDataRange const & rhs )noexcept
-			{
-				return lhs.dstImage < rhs.dstImage
-					|| ( lhs.dstImage == rhs.dstImage
-						&& ( lhs.dstRange.baseArrayLayer < rhs.dstRange.baseArrayLayer
-							|| ( lhs.dstRange.baseArrayLayer == rhs.dstRange.baseArrayLayer
-								&& lhs.dstRange.baseMipLevel < rhs.dstRange.baseMipLevel ) ) );
-			} );
+			, updata::isBefore< ImageDataRange > );
+		m_pendingImages.emplace( it, castor::move( upload ) );
+	}
+
+	void UploadData::pushUpload( void const * srcData
+		, VkDeviceSize srcSize
+		, uint32_t srcRowLength
+		, ashes::Image const & dstImage
+		, castor::ImageLayout dstLayout
+		, VkImageSubresourceRange dstRange
+		, VkOffset3D dstOffset
+		, VkExtent3D dstExtent
+		, VkImageLayout dstImageLayout
+		, VkPipelineStageFlags dstPipelineFlags )
+	{
+		if ( !srcSize || !srcData || !dstExtent.width || !dstExtent.height )
+		{
+			return;
+		}
+
+		dstRange.levelCount = 1u;
+		dstRange.layerCount = 1u;
+		ImageDataRange upload{ srcData
+			, srcSize
+			, &dstImage
+			, castor::move( dstLayout )
+			, dstRange
+			, dstImageLayout
+			, dstPipelineFlags
+			, srcRowLength
+			, dstOffset
+			, dstExtent };
+		// Region uploads go after the whole image uploads to the same subresource, which discard the image content.
+		auto it = std::upper_bound( m_pendingImages.begin()
+			, m_pendingImages.end()
+			, upload
+			, updata::isBefore< ImageDataRange > );
 		m_pendingImages.emplace( it, castor::move( upload ) );
 	}
 
+	void UploadData::pushCopy( ashes::BufferBase const & srcBuffer
+		, VkDeviceSize srcOffset
+		, VkDeviceSize srcSize
+		, ashes::BufferBase const & dstBuffer
+		, VkDeviceSize dstOffset
+		, VkAccessFlags dstAccessFlags
+		, VkPipelineStageFlags dstPipelineFlags )
+	{
+		if ( !srcSize )
+		{
+			return;
+		}
+
+		m_pendingCopies.push_back( { &srcBuffer, srcOffset, srcSize, &dstBuffer, dstOffset, dstAccessFlags, dstPipelineFlags } );
+	}
+
 	void UploadData::process()
 	{
 		castor::Vector< BufferDataRange > * pendingBuffers;
 		castor::Vector< ImageDataRange > * pendingImages;
 		traceUpload( "Start upload" << std::endl );
+
+		// Copies go first, so that uploads targetting the copied ranges aren't overwritten.
+		for ( auto const & copy : m_pendingCopies )
+		{
+			doCopyBuffer( copy );
+		}
+
+		m_pendingCopies.clear();
 		doPreprocess( pendingBuffers, pendingImages );
 #if C3D_DebugUpload
 		VkDeviceSize size{};
@@ -294,6 +361,60 @@ namespace castor3d
 		}
 	}
 
+	void UploadData::doCopyBuffer( BufferCopyRange const & data )const
+	{
+		auto & srcBuffer = *data.srcBuffer;
+		auto & dstBuffer = *data.dstBuffer;
+
+		if ( srcBuffer.getSize() < data.srcOffset + data.srcSize
+			|| dstBuffer.getSize() < data.dstOffset + data.srcSize )
+		{
+			log::error << cuT( "UploadData: Invalid buffer copy from [" ) << castor::makeString( srcBuffer.getName() )
+				<< cuT( "] to [" ) << castor::makeString( dstBuffer.getName() )
+				<< cuT( "]: srcOffset = " ) << data.srcOffset
+				<< cuT( ", dstOffset = " ) << data.dstOffset
+				<< cuT( ", srcSize = " ) << data.srcSize << std::endl;
+			CU_Failure( "Invalid buffer to buffer copy" );
+			return;
+		}
+
+		traceUpload( cuT( "    Registering buffer copy commands: [" ) << castor::makeString( srcBuffer.getName() )
+			<< cuT( "], Offset: " ) << data.srcOffset
+			<< cuT( ", to [" ) << castor::makeString( dstBuffer.getName() )
+			<< cuT( "], Offset: " ) << data.dstOffset
+			<< cuT( ", Copy Size: " ) << data.srcSize
+			<< std::endl );
+
+		if ( auto srcCurFlags = srcBuffer.getCompatibleStageFlags();
+			srcCurFlags != VK_PIPELINE_STAGE_TRANSFER_BIT )
+		{
+			m_commandBuffer->memoryBarrier( srcCurFlags
+				, VK_PIPELINE_STAGE_TRANSFER_BIT
+				, srcBuffer.makeTransferSource() );
+		}
+
+		if ( auto dstCurFlags = dstBuffer.getCompatibleStageFlags();
+			dstCurFlags != VK_PIPELINE_STAGE_TRANSFER_BIT )
+		{
+			m_commandBuffer->memoryBarrier( dstCurFlags
+				, VK_PIPELINE_STAGE_TRANSFER_BIT
+				, dstBuffer.makeTransferDestination() );
+		}
+
+		m_commandBuffer->copyBuffer( srcBuffer
+			, dstBuffer
+			, data.srcSize
+			, data.srcOffset
+			, data.dstOffset );
+		// The source buffer is still in use for its other ranges, so it goes back to the same state as the destination.
+		m_commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TRANSFER_BIT
+			, data.dstPipelineFlags
+			, srcBuffer.makeMemoryTransitionBarrier( data.dstAccessFlags ) );
+		m_commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TRANSFER_BIT
+			, data.dstPipelineFlags
+			, dstBuffer.makeMemoryTransitionBarrier( data.dstAccessFlags ) );
+	}
+
 	void UploadData::doUploadImage( ImageDataRange & data
 		, ashes::BufferBase const & srcBuffer
 		, VkDeviceSize srcOffset )const
@@ -308,47 +429,69 @@ namespace castor3d
 			<< std::endl );
 		bool is3D = data.dstLayout.type == castor::ImageLayout::e3D;
 		auto & dstImage = *data.dstImage;
+		// Whole image uploads discard the previous content, region uploads keep it.
+		bool isRegion = data.dstExtent.width != 0u;
+		VkPipelineStageFlags srcStageFlags = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		VkImageLayout srcImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
 		ashes::VkBufferImageCopyArray copies;
-		VkExtent3D baseDimensions{ dstImage.getDimensions().width
-			, dstImage.getDimensions().height
-			, std::max( dstImage.getLayerCount(), dstImage.getDimensions().depth ) };
 
-		for ( auto layer = data.dstRange.baseArrayLayer;
-			layer < data.dstRange.baseArrayLayer + data.dstRange.layerCount;
-			++layer )
+		if ( isRegion )
 		{
-			VkImageSubresourceLayers subresourceLayers{ data.dstRange.aspectMask
+			copies.push_back( { srcOffset
+				, data.srcRowLength
 				, 0u
-				, ( is3D ? 0u : layer )
-				, 1u };
+				, VkImageSubresourceLayers{ data.dstRange.aspectMask
+					, data.dstRange.baseMipLevel
+					, data.dstRange.baseArrayLayer
+					, 1u }
+				, data.dstOffset
+				, data.dstExtent } );
+			srcStageFlags = data.dstPipelineFlags;
+			srcImageLayout = data.dstImageLayout;
+		}
+		else
+		{
+			VkExtent3D baseDimensions{ dstImage.getDimensions().width
+				, dstImage.getDimensions().height
+				, std::max( dstImage.getLayerCount(), dstImage.getDimensions().depth ) };
 
-			for ( auto level = data.dstRange.baseMipLevel;
-				level < data.dstRange.baseMipLevel + data.dstRange.levelCount;
-				++level )
+			for ( auto layer = data.dstRange.baseArrayLayer;
+				layer < data.dstRange.baseArrayLayer + data.dstRange.layerCount;
+				++layer )
 			{
-				subresourceLayers.mipLevel = level;
-				copies.push_back( { srcOffset + data.dstLayout.layerMipOffset( layer - data.dstRange.baseArrayLayer, level )
-					, 0u
+				VkImageSubresourceLayers subresourceLayers{ data.dstRange.aspectMask
 					, 0u
-					, subresourceLayers
-					, VkOffset3D{ 0
-						, 0
-						, int32_t( is3D ? std::max( 1u, layer >> level ) : 0u ) }
-					, VkExtent3D{ std::max( 1u, baseDimensions.width >> level )
-						, std::max( 1u, baseDimensions.height >> level )
-						, 1u } } );
+					, ( is3D ? 0u : layer )
+					, 1u };
+
+				for ( auto level = data.dstRange.baseMipLevel;
+					level < data.dstRange.baseMipLevel + data.dstRange.levelCount;
+					++level )
+				{
+					subresourceLayers.mipLevel = level;
+					copies.push_back( { srcOffset + data.dstLayout.layerMipOffset( layer - data.dstRange.baseArrayLayer, level )
+						, 0u
+						, 0u
+						, subresourceLayers
+						, VkOffset3D{ 0
+							, 0
+							, int32_t( is3D ? std::max( 1u, layer >> level ) : 0u ) }
+						, VkExtent3D{ std::max( 1u, baseDimensions.width >> level )
+							, std::max( 1u, baseDimensions.height >> level )
+							, 1u } } );
+				}
 			}
-		}
 
-		if ( is3D )
-		{
-			data.dstRange.layerCount = 1u;
+			if ( is3D )
+			{
+				data.dstRange.layerCount = 1u;
+			}
 		}
 
-		m_commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT
+		m_commandBuffer->memoryBarrier( srcStageFlags
 			, VK_PIPELINE_STAGE_TRANSFER_BIT
-			, dstImage.makeTransition( VK_IMAGE_LAYOUT_UNDEFINED
+			, dstImage.makeTransition( srcImageLayout
 				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
 				, data.dstRange ) );
 		m_commandBuffer->copyToImage( copies, srcBuffer, dstImage );
@@ -73,19 +73,15 @@ namespace castor
 			, MaxSkinningDataCount
 			, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT ) }
 	{
-#if C3D_DebugTimers
 		m_timerAnimations = castor::makeUnique< crg::FramePassTimer >( m_device.makeContext(), getScene()->getName() + "/Animations", crg::TimerScope::eUpdate );
 		m_engine.registerTimer( getScene()->getName() + "/Animations", *m_timerAnimations );
-#endif
 		cacheanmgrp::doInitialiseBuffer( m_skinningTransformsData );
 	}
 
 	ResourceCacheT< AnimatedObjectGroup, castor::String, AnimatedObjectGroupCacheTraits >::~ResourceCacheT()noexcept
 	{
-#if C3D_DebugTimers
 		m_engine.unregisterTimer( getScene()->getName() + "/Animations", *m_timerAnimations );
 		m_timerAnimations.reset();
-#endif
 
 		if ( m_skinningTransformsData )
 		{
@@ -131,9 +127,7 @@ namespace castor
 
 	void ResourceCacheT< AnimatedObjectGroup, String, AnimatedObjectGroupCacheTraits >::update( CpuUpdater & updater )
 	{
-#if C3D_DebugTimers
 		auto block( m_timerAnimations->start() );
-#endif
 		auto lock( castor::makeUniqueLock( *this ) );
 
 		for ( auto const & [name, group] : *this )
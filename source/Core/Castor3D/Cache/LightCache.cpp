@@ -89,12 +89,17 @@ namespace castor3d
 	void ObjectCacheT< Light, castor::String, LightCacheTraits >::update( CpuUpdater & updater )
 	{
 		auto lock( castor::makeUniqueLock( *this ) );
-		auto & sceneObjs = updater.dirtyScenes[getScene()];
 		LightsRefArray dirty;
 		castor::swap( m_dirtyLights, dirty );
-		dirty.insert( dirty.end()
-			, sceneObjs.dirtyLights.begin()
-			, sceneObjs.dirtyLights.end() );
+
+		// The updater is shared by the concurrent scene update stages, the dirty objects are hence only looked up.
+		if ( auto it = updater.dirtyScenes.find( getScene() );
+			it != updater.dirtyScenes.end() )
+		{
+			dirty.insert( dirty.end()
+				, it->second.dirtyLights.begin()
+				, it->second.dirtyLights.end() );
+		}
 
 		if ( !dirty.empty() )
 		{
@@ -5,6 +5,8 @@
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Shader/Program.hpp"
 
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
 #include <ShaderWriter/Source.hpp>
 #include <ShaderWriter/GraphicsPipelineWriter.hpp>
 
@@ -19,6 +21,21 @@ namespace castor3d
 
 	void ShaderProgramCache::clear()
 	{
+		castor::Vector< castor::JobHandle > jobs;
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+
+			for ( auto const & autoGenerated : m_autoGenerated )
+			{
+				jobs.push_back( autoGenerated.build->job );
+			}
+		}
+
+		for ( auto const & job : jobs )
+		{
+			getEngine()->getCpuJobs().wait( job );
+		}
+
 		auto lock( castor::makeUniqueLock( m_mutex ) );
 		m_autoGenerated.clear();
 		m_programs.clear();
@@ -36,22 +53,100 @@ namespace castor3d
 
 	ShaderProgramRPtr ShaderProgramCache::getAutomaticProgram( RenderNodesPass const & renderPass
 		, PipelineFlags const & flags )
+	{
+		auto & build = doGetAutomaticProgram( renderPass, flags );
+		getEngine()->getCpuJobs().wait( build.job );
+
+		if ( build.error )
+		{
+			std::rethrow_exception( build.error );
+		}
+
+		CU_Require( build.program );
+		return build.program;
+	}
+
+	ShaderProgramRPtr ShaderProgramCache::tryGetAutomaticProgram( RenderNodesPass const & renderPass
+		, PipelineFlags const & flags )
+	{
+		if ( !getEngine()->isAsyncShaderCompilationEnabled() )
+		{
+			return getAutomaticProgram( renderPass, flags );
+		}
+
+		auto & build = doGetAutomaticProgram( renderPass, flags );
+
+		if ( !build.job.isDone() )
+		{
+			return nullptr;
+		}
+
+		if ( build.error )
+		{
+			std::rethrow_exception( build.error );
+		}
+
+		return build.program;
+	}
+
+	void ShaderProgramCache::waitAutomaticPrograms( RenderNodesPass const & renderPass )
+	{
+		castor::Vector< castor::JobHandle > jobs;
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+
+			for ( auto const & autoGenerated : m_autoGenerated )
+			{
+				if ( autoGenerated.build->renderPass == &renderPass )
+				{
+					jobs.push_back( autoGenerated.build->job );
+				}
+			}
+		}
+
+		for ( auto const & job : jobs )
+		{
+			getEngine()->getCpuJobs().wait( job );
+		}
+	}
+
+	ShaderProgramCache::ProgramBuild & ShaderProgramCache::doGetAutomaticProgram( RenderNodesPass const & renderPass
+		, PipelineFlags const & flags )
 	{
 		auto lock( castor::makeUniqueLock( m_mutex ) );
 
 		if ( auto result = doFindAutomaticProgram( renderPass, flags ) )
 		{
-			return result;
+			return *result;
 		}
 
-		auto result = doCreateAutomaticProgram( renderPass, flags );
-		CU_Require( result );
-		auto ret = result.get();
-		doAddAutomaticProgram( castor::move( result ), renderPass, flags );
-		return ret;
+		auto & autoGenerated = m_autoGenerated.emplace_back( flags
+			, renderPass.getDeferredLightingFilter()
+			, renderPass.getParallaxOcclusionFilter()
+			, castor::make_unique< ProgramBuild >() );
+		auto & result = *autoGenerated.build;
+		result.renderPass = &renderPass;
+		// The shader generation and its compilation to SPIR-V run without the cache lock,
+		// so that the permutations requested by the render passes are built in parallel.
+		// The program is only made visible once it is complete.
+		result.job = getEngine()->getCpuJobs().pushJob( [this, &renderPass, flags, &result]()
+			{
+				try
+				{
+					auto program = doCreateAutomaticProgram( renderPass, flags );
+					auto lock( castor::makeUniqueLock( m_mutex ) );
+					result.program = program.get();
+					doAddProgram( castor::move( program ) );
+				}
+				catch ( ... )
+				{
+					result.error = std::current_exception();
+				}
+			} );
+		return result;
 	}
 
-	ShaderProgramRPtr ShaderProgramCache::doFindAutomaticProgram( RenderNodesPass const & renderPass
+	ShaderProgramCache::ProgramBuild * ShaderProgramCache::doFindAutomaticProgram( RenderNodesPass const & renderPass
 		, PipelineFlags const & flags )
 	{
 		if ( auto it = std::find_if( m_autoGenerated.begin()
@@ -64,7 +159,7 @@ namespace castor3d
 			} );
 			it != m_autoGenerated.end() )
 		{
-			return it->program;
+			return it->build.get();
 		}
 
 		return nullptr;
@@ -86,17 +181,6 @@ namespace castor3d
 		return result;
 	}
 
-	void ShaderProgramCache::doAddAutomaticProgram( ShaderProgramUPtr program
-		, RenderNodesPass const & renderPass
-		, PipelineFlags const & flags )
-	{
-		m_autoGenerated.emplace_back( flags
-			, renderPass.getDeferredLightingFilter()
-			, renderPass.getParallaxOcclusionFilter()
-			, program.get() );
-		doAddProgram( castor::move( program ) );
-	}
-
 	void ShaderProgramCache::doAddProgram( ShaderProgramUPtr program )
 	{
 		m_programs.push_back( castor::move( program ) );
@@ -163,11 +163,79 @@ namespace castor3d
 				, castor::move( buffer ) );
 		}
 
+		static castor::ImageRes loadStagedSource( Engine & engine
+			, TextureSourceInfo const & sourceInfo )
+		{
+			// KTX, DDS and KMG files usually hold compressed pixels, with their mips, which need no adaptation.
+			// Their pixels are hence written straight from the mapped file decoder storage to the texture image buffer,
+			// without the intermediate image from the image cache.
+			auto const & loader = engine.getImageLoader();
+			auto path = sourceInfo.folder() / sourceInfo.relative();
+
+			if ( !loader.exposesStorage( path ) )
+			{
+				return nullptr;
+			}
+
+			castor::PxBufferBaseUPtr buffer;
+			auto staged = loader.loadStaged( path
+				, castor::PixelFormat::eUNDEFINED
+				, [&sourceInfo, &buffer]( castor::ImageLayout const & layout ) -> castor::ByteArrayView
+				{
+					if ( !castor::isCompressed( layout.format )
+						|| ( sourceInfo.layersToTiles() && layout.depthLayers() > 1u ) )
+					{
+						return castor::ByteArrayView{};
+					}
+
+					// Same format normalisation as adaptToTextureImage, a mere relabelling for compressed formats.
+					auto format = ( ( isSRGBFormat( layout.format ) && sourceInfo.allowSRGB() )
+						? layout.format
+						: getNonSRGBFormat( layout.format ) );
+					buffer = castor::PxBufferBase::create( layout.dimensions()
+						, layout.depthLayers()
+						, layout.levels
+						, format
+						, nullptr
+						, format
+						, layout.alignment );
+					return castor::makeArrayView( buffer->getPtr(), buffer->getSize() );
+				}
+				, castor::ImageLoaderConfig{ false, false, false, sourceInfo.allowSRGB() } );
+
+			if ( !buffer )
+			{
+				return nullptr;
+			}
+
+			if ( staged.flipped )
+			{
+				buffer->flip();
+			}
+
+			castor::ImageLayout layout{ ( ( buffer->getLayers() == 1u && staged.layout.type == castor::ImageLayout::e2DArray )
+					? castor::ImageLayout::e2D
+					: staged.layout.type )
+				, *buffer };
+			return engine.createImage( sourceInfo.name()
+				, path
+				, castor::move( layout )
+				, castor::move( buffer ) );
+		}
+
 		static castor::ImageRes loadSource( Engine & engine
 			, std::atomic_bool const & interrupted
 			, TextureSourceInfo const & sourceInfo
 			, bool generateMips )
 		{
+			if ( !sourceInfo.isBufferImage() )
+			{
+				if ( auto result = loadStagedSource( engine, sourceInfo ) )
+				{
+					return result;
+				}
+			}
+
 			return adaptToTextureImage( engine
 				, interrupted
 				, ( sourceInfo.isBufferImage()
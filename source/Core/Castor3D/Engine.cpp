@@ -162,6 +162,7 @@ namespace castor3d
 		, m_importerFileFactory{ castor::makeUnique< ImporterFileFactory >() }
 		, m_particleFactory{ castor::makeUnique< ParticleFactory >() }
 		, m_cpuJobs{ std::max( 8u, std::min( 4u, castor::CpuInformations{}.getCoreCount() / 2u ) ) }
+		, m_frameJobs{ std::max( 2u, castor::CpuInformations{}.getCoreCount() ) - 1u }
 		, m_resources{ m_resourceHandler }
 	{
 		m_passFactory = castor::makeUnique< PassFactory >( *this );
@@ -179,6 +180,8 @@ namespace castor3d
 		castor::ExrImageLoader::registerLoader( m_imageLoader );
 		castor::XpmImageLoader::registerLoader( m_imageLoader );
 		castor::FreeImageLoader::registerLoader( m_imageLoader );
+		m_imageLoader.setJobSystem( &m_cpuJobs.getJobSystem() );
+		m_imageCache.setJobSystem( &m_cpuJobs.getJobSystem() );
 		castor::StbImageWriter::registerWriter( m_imageWriter );
 		castor::GliImageWriter::registerWriter( m_imageWriter );
 
@@ -206,6 +209,17 @@ namespace castor3d
 			castor::File::directoryCreate( getEngineDirectory() );
 		}
 
+		if ( m_config.enableImageDiskCache )
+		{
+			auto imageCacheFolder = getEngineDirectory() / cuT( "Cache" ) / cuT( "Images" );
+
+			if ( castor::File::directoryExists( imageCacheFolder )
+				|| castor::File::directoryCreate( imageCacheFolder ) )
+			{
+				m_imageCache.setDiskCacheFolder( imageCacheFolder );
+			}
+		}
+
 		m_lightingModelFactory = castor::makeUnique< LightingModelFactory >();
 
 		registerBackgroundModel( shader::ImgBackgroundModel::Name
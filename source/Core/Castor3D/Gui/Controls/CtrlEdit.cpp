@@ -1032,12 +1032,7 @@ namespace castor3d
 
 			if ( !newCaption.empty() )
 			{
-				for ( auto c : newCaption )
-				{
-					font->loadGlyph( c );
-				}
-
-				fontTexture->update( true );
+				font->loadGlyphs( newCaption, &getEngine().getCpuJobs() );
 			}
 
 			if ( !m_caption.empty() )
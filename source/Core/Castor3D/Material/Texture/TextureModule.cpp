@@ -17,19 +17,10 @@ namespace castor3d
 		{
 			auto image = engine.tryFindImage( name );
 
-			if ( !image )
+			if ( !image || !image->hasBuffer() )
 			{
-				image = engine.addNewImage( name, createParams );
-			}
-
-			if ( !image )
-			{
-				CU_LoaderError( "Couldn't load image." );
-			}
-
-			if ( !image->hasBuffer() )
-			{
-				**image = *engine.createImage( name, createParams );
+				// Joins the pending background load of this image, if any.
+				image = engine.getImageCache().loadAsync( name, castor::move( createParams ) ).wait();
 
 				if ( image )
 				{
@@ -37,7 +28,7 @@ namespace castor3d
 				}
 			}
 
-			if ( !image->hasBuffer() )
+			if ( !image || !image->hasBuffer() )
 			{
 				CU_LoaderError( "Couldn't load image." );
 			}
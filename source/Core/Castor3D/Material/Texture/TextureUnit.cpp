@@ -118,12 +118,14 @@ namespace castor3d
 					auto & engine = *getEngine( *blockContext );
 					blockContext->image = engine.tryFindImage( relative.getFileName() );
 
-					if ( !blockContext->image )
+					// KTX, DDS and KMG images are decoded straight into the texture image, at its creation, they don't go through the image cache.
+					if ( !blockContext->image
+						&& !engine.getImageLoader().exposesStorage( relative ) )
 					{
-						auto img = engine.createImage( relative.getFileName()
+						// Decoded in the background while parsing goes on, the texture creation waits for it.
+						engine.getImageCache().loadAsync( relative.getFileName()
 							, castor::ImageCreateParams{ folder / relative
 								, { false, false, false } } );
-						blockContext->image = engine.addImage( relative.getFileName(), img );
 					}
 				}
 				else if ( !castor::File::fileExists( relative ) )
@@ -16,41 +16,44 @@ namespace castor3d
 {
 	namespace meshimp
 	{
-		static void transformMesh( castor::Matrix4x4f const & transform
-			, Mesh & mesh )
+		static void transformSubmesh( castor::Matrix4x4f const & transform
+			, Submesh & submesh )
 		{
-			for ( auto & submesh : mesh )
+			for ( auto & vertex : submesh.getPositions() )
 			{
-				for ( auto & vertex : submesh->getPositions() )
-				{
-					vertex = transform * vertex;
-				}
-
-				SubmeshUtils::computeNormals( submesh->getPositions()
-					, submesh->getNormals()
-					, static_cast< TriFaceMapping const & >( *submesh->getIndexMapping() ).getData().getFaces() );
+				vertex = transform * vertex;
+			}
 
-				static castor::Point4fArray tan;
-				static castor::Point3fArray tex;
-				castor::Point4fArray * tangents = &tan;
-				castor::Point3fArray const * texcoords = &tex;
+			auto & faces = static_cast< TriFaceMapping const & >( *submesh.getIndexMapping() ).getData().getFaces();
+			SubmeshUtils::computeNormals( submesh.getPositions()
+				, submesh.getNormals()
+				, faces );
 
-				if ( auto tanComp = submesh->getComponent< TangentsComponent >() )
+			if ( auto tanComp = submesh.getComponent< TangentsComponent >() )
+			{
+				if ( auto texComp = submesh.getComponent< Texcoords0Component >() )
 				{
-					tangents = &tanComp->getData().getData();
+					SubmeshUtils::computeTangentsFromNormals( submesh.getPositions()
+						, texComp->getData().getData()
+						, submesh.getNormals()
+						, tanComp->getData().getData()
+						, faces );
 				}
+			}
+		}
 
-				if ( auto texComp = submesh->getComponent< Texcoords0Component >() )
+		static void transformMesh( castor::Matrix4x4f const & transform
+			, Mesh & mesh )
+		{
+			mesh.getEngine()->getCpuJobs().parallelFor( mesh.getSubmeshCount()
+				, [&transform, &mesh]( size_t begin, size_t end )
 				{
-					texcoords = &texComp->getData().getData();
+					for ( auto i = begin; i < end; ++i )
+					{
+						transformSubmesh( transform, *mesh.getSubmesh( uint32_t( i ) ) );
+					}
 				}
-
-				SubmeshUtils::computeTangentsFromNormals( submesh->getPositions()
-					, *texcoords
-					, submesh->getNormals()
-					, *tangents
-					, static_cast< TriFaceMapping const & >( *submesh->getIndexMapping() ).getData().getFaces() );
-			}
+				, 1u );
 		}
 	}
 
@@ -6,6 +6,8 @@
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/SubmeshUtils.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/BaseDataComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/PackedVerticesComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MeshletComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MorphComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/PassMasksComponent.hpp"
@@ -17,26 +19,59 @@
 #include <meshoptimizer.h>
 #include <CastorUtils/Config/EndExternHeaderGuard.hpp>
 
+#include <atomic>
+
 namespace castor3d
 {
 	namespace meshopt
 	{
 		struct Remapped
 		{
-			FaceArray indices;
-			castor::Map< SubmeshData, castor::Point3fArray > baseBuffers;
-			castor::Point4fArray tangentBuffer;
-			castor::Vector< SubmeshAnimationBuffer > morphTargets;
-			VertexBoneDataArray skin;
-			castor::Vector< PassMasks > passMasks;
+			// The submesh data, remapped in place.
+			FaceArray * indices{};
+			castor::Point3fArray * positions{};
+			castor::Vector< castor::Point3fArray * > baseBuffers;
+			castor::Point4fArray * tangentBuffer{};
+			VertexBoneDataArray * skin{};
+			castor::Vector< PassMasks > * passMasks{};
+			castor::Vector< SubmeshAnimationBuffer > * morphTargets{};
+			castor::Vector< SubmeshLod > * lods{};
+			// Scratch buffers, swapped with the remapped data, so that their memory is reused by the next remap.
+			FaceArray scratchIndices;
+			castor::Point3fArray scratch3f;
+			castor::Point4fArray scratch4f;
+			VertexBoneDataArray scratchSkin;
+			castor::Vector< PassMasks > scratchPassMasks;
 		};
 
+		struct LodParameters
+		{
+			uint32_t count{};
+			float ratio{ 0.5f };
+			float error{ 0.01f };
+			float pixelError{ 1.0f };
+			bool sloppy{};
+		};
+
+		static LodParameters getLodParameters( Parameters const & parameters )
+		{
+			LodParameters result;
+			parameters.get( cuT( "lod_count" ), result.count );
+			parameters.get( cuT( "lod_ratio" ), result.ratio );
+			parameters.get( cuT( "lod_error" ), result.error );
+			parameters.get( cuT( "lod_pixel_error" ), result.pixelError );
+			parameters.get( cuT( "lod_sloppy" ), result.sloppy );
+			result.ratio = std::clamp( result.ratio, 0.05f, 0.95f );
+			result.error = std::max( result.error, 0.0f );
+			return result;
+		}
+
 		static castor::Vector< meshopt_Stream > gather( Submesh & submesh
 			, TriFaceMapping const & triangles
 			, Remapped & remapped )
 		{
 			castor::Vector< meshopt_Stream > result;
-			remapped.indices = triangles.getData().getFaces();
+			remapped.indices = &triangles.getData().getFaces();
 
 			for ( uint32_t i = 1u; i < uint32_t( SubmeshData::eOtherMin ); ++i )
 			{
@@ -46,40 +81,49 @@ namespace castor3d
 				{
 					if ( submeshData == SubmeshData::eTangents )
 					{
-						remapped.tangentBuffer = submesh.getTangents();
+						remapped.tangentBuffer = &submesh.getTangents();
 					}
 					else
 					{
+						auto & data = submesh.getBaseData( submeshData );
+
 						if ( submeshData == SubmeshData::ePositions
 							|| submeshData == SubmeshData::eNormals
 							|| submeshData == SubmeshData::eTexcoords0 )
 						{
-							result.push_back( { submesh.getBaseData( submeshData ).data()
+							result.push_back( { data.data()
 								, sizeof( castor::Point3f )
 								, sizeof( castor::Point3f ) } );
 						}
 
-						remapped.baseBuffers.try_emplace( submeshData, submesh.getBaseData( submeshData ) );
+						if ( submeshData == SubmeshData::ePositions )
+						{
+							remapped.positions = &data;
+						}
+
+						remapped.baseBuffers.push_back( &data );
 					}
 				}
 			}
 
 			if ( auto skin = submesh.getComponent< SkinComponent >() )
 			{
-				remapped.skin = skin->getData().getData();
+				remapped.skin = &skin->getData().getData();
 			}
 
 			if ( auto passMasks = submesh.getComponent< PassMasksComponent >() )
 			{
-				remapped.passMasks = passMasks->getData().getData();
+				remapped.passMasks = &passMasks->getData().getData();
+			}
+
+			if ( auto lods = submesh.getComponent< LodComponent >() )
+			{
+				remapped.lods = &lods->getData().getLods();
 			}
 
 			if ( auto morph = submesh.getComponent< MorphComponent >() )
 			{
-				for ( auto & buffers : morph->getData().getMorphTargetsBuffers() )
-				{
-					remapped.morphTargets.push_back( buffers );
-				}
+				remapped.morphTargets = &morph->getData().getMorphTargetsBuffers();
 			}
 
 			return result;
@@ -129,83 +173,90 @@ namespace castor3d
 		static void applyRemap( size_t originalVertexCount
 			, size_t destinationVertexCount
 			, castor::Vector< uint32_t > const & remap
-			, castor::Vector< DataT > & buffer )
+			, castor::Vector< DataT > & buffer
+			, castor::Vector< DataT > & scratch )
 		{
 			if ( !buffer.empty() )
 			{
-				castor::Vector< DataT > result;
-				result.resize( destinationVertexCount );
-				meshopt_remapVertexBuffer( getPtr( result )
+				scratch.resize( destinationVertexCount );
+				meshopt_remapVertexBuffer( getPtr( scratch )
 					, getConstPtr( buffer )
 					, originalVertexCount
 					, sizeof( DataT )
 					, remap.data() );
-				buffer = castor::move( result );
+				std::swap( buffer, scratch );
 			}
 		}
 
-		static void applyRemap( size_t /*originalVertexCount*/
-			, size_t /*destinationVertexCount*/
-			, castor::Vector< uint32_t > const & remap
+		static void applyRemap( castor::Vector< uint32_t > const & remap
 			, castor::Vector< Face > & buffer )
 		{
 			if ( !buffer.empty() )
 			{
-				castor::Vector< Face > result;
-				result.resize( buffer.size() );
-				meshopt_remapIndexBuffer( result.data()->data()
+				// Each index is replaced by its remapped value, which is safe in place.
+				meshopt_remapIndexBuffer( buffer.data()->data()
 					, buffer.data()->data()
 					, buffer.size() * 3u
 					, remap.data() );
-				buffer = castor::move( result );
 			}
 		}
 
 		static void applyRemap( size_t originalVertexCount
 			, size_t destinationVertexCount
 			, castor::Vector< uint32_t > const & remap
-			, SubmeshAnimationBuffer & buffers )
+			, SubmeshAnimationBuffer & buffers
+			, Remapped & remapped )
 		{
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.positions );
+				, buffers.positions
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.normals );
+				, buffers.normals
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.tangents );
+				, buffers.tangents
+				, remapped.scratch4f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.bitangents );
+				, buffers.bitangents
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.texcoords0 );
+				, buffers.texcoords0
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.texcoords1 );
+				, buffers.texcoords1
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.texcoords2 );
+				, buffers.texcoords2
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.texcoords3 );
+				, buffers.texcoords3
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.colours );
+				, buffers.colours
+				, remapped.scratch3f );
 			applyRemap( originalVertexCount
 				, destinationVertexCount
 				, remap
-				, buffers.passMasks );
+				, buffers.passMasks
+				, remapped.scratchPassMasks );
 		}
 
 		static void applyRemap( size_t originalVertexCount
@@ -213,60 +264,73 @@ namespace castor3d
 			, castor::Vector< uint32_t > const & remap
 			, Remapped & remapped )
 		{
-			applyRemap( originalVertexCount
-				, destinationVertexCount
-				, remap
-				, remapped.indices );
+			applyRemap( remap, *remapped.indices );
 
-			for ( auto & [_, data] : remapped.baseBuffers )
+			for ( auto data : remapped.baseBuffers )
 			{
 				applyRemap( originalVertexCount
 					, destinationVertexCount
 					, remap
-					, data );
+					, *data
+					, remapped.scratch3f );
 			}
 
-			if ( !remapped.tangentBuffer.empty() )
+			if ( remapped.tangentBuffer )
 			{
 				applyRemap( originalVertexCount
 					, destinationVertexCount
 					, remap
-					, remapped.tangentBuffer );
+					, *remapped.tangentBuffer
+					, remapped.scratch4f );
 			}
 
-			if ( !remapped.skin.empty() )
+			if ( remapped.skin )
 			{
 				applyRemap( originalVertexCount
 					, destinationVertexCount
 					, remap
-					, remapped.skin );
+					, *remapped.skin
+					, remapped.scratchSkin );
 			}
 
-			if ( !remapped.passMasks.empty() )
+			if ( remapped.passMasks )
 			{
 				applyRemap( originalVertexCount
 					, destinationVertexCount
 					, remap
-					, remapped.passMasks );
+					, *remapped.passMasks
+					, remapped.scratchPassMasks );
 			}
 
-			for ( auto & remappedMorph : remapped.morphTargets )
+			if ( remapped.morphTargets )
 			{
-				applyRemap( originalVertexCount
-					, destinationVertexCount
-					, remap
-					, remappedMorph );
+				for ( auto & remappedMorph : *remapped.morphTargets )
+				{
+					applyRemap( originalVertexCount
+						, destinationVertexCount
+						, remap
+						, remappedMorph
+						, remapped );
+				}
+			}
+
+			if ( remapped.lods )
+			{
+				for ( auto & lod : *remapped.lods )
+				{
+					applyRemap( remap, lod.faces );
+				}
 			}
 		}
 
 		static size_t remap( castor::Vector< meshopt_Stream > const & streams
 			, Remapped & remapped )
 		{
-			auto indexCount = remapped.indices.size() * 3u;
-			auto vertexCount = remapped.baseBuffers.begin()->second.size();
+			auto indexCount = remapped.indices->size() * 3u;
+			auto vertexCount = remapped.positions->size();
 			castor::Vector< uint32_t > remap( vertexCount );
 			auto newVertexCount = meshopt_generateVertexRemapMulti( remap.data()
-				, remapped.indices.data()->data()
+				, remapped.indices->data()->data()
 				, indexCount
 				, vertexCount
 				, streams.data()
@@ -281,36 +345,38 @@ namespace castor3d
 		static void optimizeCache( Remapped & remapped
 			, size_t vertexCount )
 		{
-			auto indexCount = remapped.indices.size() * 3u;
-			auto previous = remapped.indices;
-			meshopt_optimizeVertexCache( remapped.indices.data()->data()
-				, previous.data()->data()
+			auto indexCount = remapped.indices->size() * 3u;
+			remapped.scratchIndices.resize( remapped.indices->size() );
+			meshopt_optimizeVertexCache( remapped.scratchIndices.data()->data()
+				, remapped.indices->data()->data()
 				, indexCount
 				, vertexCount );
+			std::swap( *remapped.indices, remapped.scratchIndices );
 		}
 
 		static void optimizeOverdraw( Remapped & remapped )
 		{
-			auto it = remapped.baseBuffers.find( SubmeshData::ePositions );
-			auto indexCount = remapped.indices.size() * 3u;
-			auto previous = remapped.indices;
-			meshopt_optimizeOverdraw( remapped.indices.data()->data()
-				, previous.data()->data()
+			auto & positions = *remapped.positions;
+			auto indexCount = remapped.indices->size() * 3u;
+			remapped.scratchIndices.resize( remapped.indices->size() );
+			meshopt_optimizeOverdraw( remapped.scratchIndices.data()->data()
+				, remapped.indices->data()->data()
 				, indexCount
-				, it->second.data()->constPtr()
-				, it->second.size()
+				, positions.data()->constPtr()
+				, positions.size()
 				, sizeof( castor::Point3f )
 				, 1.05f );
+			std::swap( *remapped.indices, remapped.scratchIndices );
 		}
 
 		static void optimizeFetch( Remapped & remapped )
 		{
-			auto indexCount = remapped.indices.size() * 3u;
-			auto vertexCount = remapped.baseBuffers.begin()->second.size();
+			auto indexCount = remapped.indices->size() * 3u;
+			auto vertexCount = remapped.positions->size();
 			castor::Vector< uint32_t > remap;
 			remap.resize( vertexCount );
 			auto newVertexCount = meshopt_optimizeVertexFetchRemap( remap.data()
-				, remapped.indices.data()->data()
+				, remapped.indices->data()->data()
 				, indexCount
 				, vertexCount );
 			applyRemap( vertexCount
@@ -319,23 +385,94 @@ namespace castor3d
 				, remapped );
 		}
 
+		static castor::Vector< SubmeshLod > buildLods( Remapped const & remapped
+			, LodParameters const & params )
+		{
+			castor::Vector< SubmeshLod > result;
+			auto & positions = *remapped.positions;
+			auto indexCount = remapped.indices->size() * 3u;
+			auto previousCount = indexCount;
+			auto target = float( indexCount );
+			float previousError{};
+
+			for ( uint32_t level = 0u; level < params.count; ++level )
+			{
+				target *= params.ratio;
+				auto targetCount = ( size_t( target ) / 3u ) * 3u;
+
+				if ( targetCount < 3u )
+				{
+					break;
+				}
+
+				// Each level is simplified from the full detail triangles, so that the errors don't add up.
+				SubmeshLod lod;
+				lod.faces.resize( remapped.indices->size() );
+				auto count = meshopt_simplify( lod.faces.data()->data()
+					, remapped.indices->data()->data()
+					, indexCount
+					, positions.data()->constPtr()
+					, positions.size()
+					, sizeof( castor::Point3f )
+					, targetCount
+					, params.error
+					, 0u
+					, &lod.error );
+
+				if ( params.sloppy
+					&& count > targetCount + targetCount / 2u )
+				{
+					// The topology (borders, seams) prevents the simplification to reach its target, ignore it.
+					count = meshopt_simplifySloppy( lod.faces.data()->data()
+						, remapped.indices->data()->data()
+						, indexCount
+						, positions.data()->constPtr()
+						, positions.size()
+						, sizeof( castor::Point3f )
+						, targetCount
+						, params.error
+						, &lod.error );
+				}
+
+				if ( count == 0u
+					|| count * 10u > previousCount * 9u )
+				{
+					// The error budget is reached, next levels won't be any coarser.
+					break;
+				}
+
+				lod.faces.resize( count / 3u );
+				meshopt_optimizeVertexCache( lod.faces.data()->data()
+					, lod.faces.data()->data()
+					, count
+					, positions.size() );
+				// Keep the errors sorted, the level selection relies on it.
+				lod.error = std::max( lod.error, previousError );
+				previousError = lod.error;
+				previousCount = count;
+				result.push_back( castor::move( lod ) );
+			}
+
+			return result;
+		}
+
 #if C3D_UseMeshShaders
 
 		static castor::Vector< Meshlet > buildMeshlets( Remapped const & remapped )
 		{
-			auto indexCount = remapped.indices.size() * 3u;
+			auto indexCount = remapped.indices->size() * 3u;
 			auto maxMeshlets = meshopt_buildMeshletsBound( indexCount
 				, MaxMeshletVertexCount
 				, MaxMeshletTriangleCount );
 
-			auto vertexCount = remapped.baseBuffers.begin()->second.size();
+			auto vertexCount = remapped.positions->size();
 			castor::Vector< meshopt_Meshlet > meshlets( maxMeshlets );
 			castor::Vector< uint8_t > triangles( maxMeshlets * MaxMeshletTriangleCount * 3 );
 			castor::Vector< uint32_t > vertices( maxMeshlets * MaxMeshletVertexCount );
 			auto meshletCount = meshopt_buildMeshletsScan( meshlets.data()
 				, vertices.data()
 				, triangles.data()
-				, remapped.indices.data()->data()
+				, remapped.indices->data()->data()
 				, indexCount
 				, vertexCount
 				, MaxMeshletVertexCount
@@ -370,15 +507,15 @@ namespace castor3d
 		{
 			castor::Vector< MeshletCullData > result;
 			result.reserve( meshlets.size() );
-			auto it = remapped.baseBuffers.find( SubmeshData::ePositions );
+			auto & positions = *remapped.positions;
 
 			for ( auto & meshlet : meshlets )
 			{
 				meshopt_Bounds bounds = meshopt_computeMeshletBounds( meshlet.vertices.data()
 					, meshlet.primitives.data()
 					, meshlet.triangleCount
-					, it->second.data()->constPtr()
-					, it->second.size()
+					, positions.data()->constPtr()
+					, positions.size()
 					, sizeof( castor::Point3f ) );
 				result.push_back( { castor::Point4f{ bounds.center[0], bounds.center[1], bounds.center[2], bounds.radius }
 					, castor::Point4f{ bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2], bounds.cone_cutoff } } );
@@ -394,12 +531,21 @@ namespace castor3d
 	bool MeshPreparer::prepare( Mesh & mesh
 		, Parameters const & parameters )
 	{
-		return std::all_of( mesh.begin()
-			, mesh.end()
-			, [&parameters]( SubmeshUPtr const & submesh )
+		// Each submesh only touches its own data, so they are prepared concurrently.
+		std::atomic_bool result{ true };
+		mesh.getEngine()->getCpuJobs().parallelFor( mesh.getSubmeshCount()
+			, [&mesh, &parameters, &result]( size_t begin, size_t end )
 			{
-				return prepare( *submesh, parameters );
-			} );
+				for ( auto i = begin; i < end; ++i )
+				{
+					if ( !prepare( *mesh.getSubmesh( uint32_t( i ) ), parameters ) )
+					{
+						result = false;
+					}
+				}
+			}
+			, 1u );
+		return result;
 	}
 
 	bool MeshPreparer::prepare( Submesh & submesh
@@ -426,6 +572,12 @@ namespace castor3d
 		auto streams = meshopt::gather( submesh
 			, triangles
 			, remapped );
+
+		if ( !remapped.positions || remapped.positions->empty() )
+		{
+			return true;
+		}
+
 		auto newVertexCount = meshopt::remap( streams
 			, remapped );
 		meshopt::optimizeCache( remapped
@@ -450,31 +602,30 @@ namespace castor3d
 		}
 #endif
 
-		triangles.getData().getFaces() = castor::move( remapped.indices );
-
-		for ( auto & [comp, data] : remapped.baseBuffers )
+		// Levels of detail are useless when the submesh is drawn through its meshlets.
+		if ( auto lodParams = meshopt::getLodParameters( parameters );
+			lodParams.count > 0u
+			&& !submesh.hasComponent( MeshletComponent::TypeName ) )
 		{
-			submesh.setBaseData( comp, castor::move( data ) );
-		}
+			auto lods = submesh.getComponent< LodComponent >();
 
-		if ( auto tangents = submesh.getComponent< TangentsComponent >() )
-		{
-			tangents->getData().getData() = castor::move( remapped.tangentBuffer );
-		}
-
-		if ( auto skin = submesh.getComponent< SkinComponent >() )
-		{
-			skin->getData().getData() = castor::move( remapped.skin );
-		}
+			if ( !lods )
+			{
+				lods = submesh.createComponent< LodComponent >();
+			}
 
-		if ( auto passMasks = submesh.getComponent< PassMasksComponent >() )
-		{
-			passMasks->getData().getData() = castor::move( remapped.passMasks );
+			lods->getData().getLods() = meshopt::buildLods( remapped, lodParams );
+			lods->getData().setPixelError( lodParams.pixelError );
 		}
 
-		if ( auto morph = submesh.getComponent< MorphComponent >() )
+		// The positions are quantised in the submesh bounding box, computed once the mesh is prepared.
+		if ( bool packVertices{};
+			parameters.get( cuT( "pack_vertices" ), packVertices )
+			&& packVertices
+			&& !submesh.hasComponent( PackedVerticesComponent::TypeName )
+			&& PackedVerticesComponent::canPackVertices( submesh ) )
 		{
-			morph->getData().getMorphTargetsBuffers() = castor::move( remapped.morphTargets );
+			submesh.createComponent< PackedVerticesComponent >();
 		}
 
 		return true;
@@ -4,36 +4,84 @@
 #include "Castor3D/Buffer/GpuBufferPool.hpp"
 #include "Castor3D/Buffer/UploadData.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/PackedVerticesComponent.hpp"
 #include "Castor3D/Model/Vertex.hpp"
 #include "Castor3D/Miscellaneous/makeVkType.hpp"
 #include "Castor3D/Render/RenderDevice.hpp"
 #include "Castor3D/Render/RenderNodesPass.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 
+#include <CastorUtils/Math/VertexPacking.hpp>
 #include <CastorUtils/Miscellaneous/Hash.hpp>
 
 #include <ashespp/Buffer/VertexBuffer.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace castor3d
 {
 	namespace smshbase
 	{
+		static VkFormat getFormat( SubmeshData submeshData
+			, bool packed )
+		{
+			if ( packed )
+			{
+				switch ( submeshData )
+				{
+				case SubmeshData::ePositions:
+				case SubmeshData::eTangents:
+					return VK_FORMAT_R16G16B16A16_SNORM;
+				case SubmeshData::eNormals:
+				case SubmeshData::eBitangents:
+					return VK_FORMAT_R16G16_SNORM;
+				case SubmeshData::eColours:
+					return VK_FORMAT_R8G8B8A8_UNORM;
+				default:
+					return VK_FORMAT_R16G16B16A16_SFLOAT;
+				}
+			}
+
+			return ( ( submeshData == SubmeshData::ePositions || submeshData == SubmeshData::eTangents )
+				? VK_FORMAT_R32G32B32A32_SFLOAT
+				: VK_FORMAT_R32G32B32_SFLOAT );
+		}
+
 		static ashes::PipelineVertexInputStateCreateInfo createVertexLayout( SubmeshData submeshData
+			, bool packed
 			, uint32_t & currentBinding
 			, uint32_t & currentLocation )
 		{
 			ashes::VkVertexInputBindingDescriptionArray bindings{ { currentBinding
-				, sizeof( castor::Point4f ), VK_VERTEX_INPUT_RATE_VERTEX } };
+				, getSize( submeshData, packed ), VK_VERTEX_INPUT_RATE_VERTEX } };
 			ashes::VkVertexInputAttributeDescriptionArray attributes{ 1u, { currentLocation++
 				, currentBinding
-				, ( ( submeshData == SubmeshData::ePositions || submeshData == SubmeshData::eTangents )
-					? VK_FORMAT_R32G32B32A32_SFLOAT
-					: VK_FORMAT_R32G32B32_SFLOAT )
+				, getFormat( submeshData, packed )
 				, 0u } };
 			++currentBinding;
 			return ashes::PipelineVertexInputStateCreateInfo{ 0u, bindings, attributes };
 		}
 
+		static void upload( SubmeshData submeshData
+			, Submesh const & submesh
+			, void const * data
+			, size_t size
+			, UploadData & uploader )
+		{
+			auto & buffer = submesh.getSourceBufferOffsets().getBufferChunk( submeshData );
+
+			if ( size && buffer.hasData() )
+			{
+				uploader.pushUpload( data
+					, size
+					, buffer.getBuffer()
+					, buffer.getOffset()
+					, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT
+					, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT );
+			}
+		}
+
 		static castor::Point4fArray convert( castor::Point3fArray const & src )
 		{
 			castor::Point4fArray result;
@@ -46,41 +94,105 @@ namespace castor3d
 
 			return result;
 		}
+
+		using PackedVertex = castor::Array< uint8_t, PackedVertexStride >;
+
+		template< typename DataT >
+		static PackedVertex makePacked( castor::Array< DataT, PackedVertexStride / sizeof( DataT ) > const & value )
+		{
+			PackedVertex result;
+			std::memcpy( result.data(), value.data(), result.size() );
+			return result;
+		}
+
+		static PackedVertex pack( SubmeshData submeshData
+			, castor::Point4f const & value
+			, castor::Point4f const & positionsOffset
+			, castor::Point4f const & positionsScale )
+		{
+			switch ( submeshData )
+			{
+			case SubmeshData::ePositions:
+				return makePacked< int16_t >( { castor::packing::toSnorm16( ( value->x - positionsOffset->x ) / positionsScale->x )
+					, castor::packing::toSnorm16( ( value->y - positionsOffset->y ) / positionsScale->y )
+					, castor::packing::toSnorm16( ( value->z - positionsOffset->z ) / positionsScale->z )
+					, castor::packing::toSnorm16( 1.0f ) } );
+			case SubmeshData::eNormals:
+			case SubmeshData::eBitangents:
+				{
+					auto encoded = castor::packing::encodeOctahedral( value->x, value->y, value->z );
+					return makePacked< int16_t >( { encoded[0], encoded[1], int16_t{}, int16_t{} } );
+				}
+			case SubmeshData::eTangents:
+				{
+					auto encoded = castor::packing::encodeOctahedral( value->x, value->y, value->z );
+					return makePacked< int16_t >( { encoded[0], encoded[1], int16_t{}, castor::packing::toSnorm16( value->w >= 0.0f ? 1.0f : -1.0f ) } );
+				}
+			case SubmeshData::eColours:
+				return makePacked< uint8_t >( { castor::packing::toUnorm8( value->x ), castor::packing::toUnorm8( value->y ), castor::packing::toUnorm8( value->z ), castor::packing::toUnorm8( 1.0f )
+					, uint8_t{}, uint8_t{}, uint8_t{}, uint8_t{} } );
+			default:
+				return makePacked< uint16_t >( { castor::packing::toHalf( value->x ), castor::packing::toHalf( value->y ), castor::packing::toHalf( value->z ), uint16_t{} } );
+			}
+		}
+
+		static void pack( SubmeshData submeshData
+			, PackedVerticesComponent const & packing
+			, castor::Point4fArray const & src
+			, castor::ByteArray & dst )
+		{
+			auto positionsOffset = packing.getData().getPositionsOffset();
+			auto positionsScale = packing.getData().getPositionsScale();
+			dst.resize( src.size() * PackedVertexStride );
+			auto it = dst.begin();
+
+			for ( auto & value : src )
+			{
+				auto packed = pack( submeshData, value, positionsOffset, positionsScale );
+				it = std::copy( packed.begin(), packed.end(), it );
+			}
+		}
 	}
 
 	void uploadBaseData( SubmeshData submeshData
 		, Submesh const & submesh
 		, castor::Point4fArray const & data
-		, castor::Point4fArray &
+		, castor::ByteArray & up
 		, UploadData & uploader )
 	{
-		auto count = uint32_t( data.size() );
-		auto & offsets = submesh.getSourceBufferOffsets();
-		auto & buffer = offsets.getBufferChunk( submeshData );
-
-		if ( count && buffer.hasData() )
+		if ( auto packing = submesh.getComponent< PackedVerticesComponent >();
+			packing && isPackable( submeshData ) )
+		{
+			smshbase::pack( submeshData, *packing, data, up );
+			smshbase::upload( submeshData, submesh, up.data(), up.size(), uploader );
+		}
+		else
 		{
-			uploader.pushUpload( data.data()
-				, data.size() * sizeof( castor::Point4f )
-				, buffer.getBuffer()
-				, buffer.getOffset()
-				, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT
-				, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT );
+			smshbase::upload( submeshData, submesh, data.data(), data.size() * sizeof( castor::Point4f ), uploader );
 		}
 	}
 
 	void uploadBaseData( SubmeshData submeshData
 		, Submesh const & submesh
 		, castor::Point3fArray const & data
-		, castor::Point4fArray & up
+		, castor::ByteArray & up
 		, UploadData & uploader )
 	{
-		up = smshbase::convert( data );
-		uploadBaseData( submeshData
-			, submesh
-			, up
-			, up
-			, uploader );
+		auto converted = smshbase::convert( data );
+
+		if ( auto packing = submesh.getComponent< PackedVerticesComponent >();
+			packing && isPackable( submeshData ) )
+		{
+			smshbase::pack( submeshData, *packing, converted, up );
+		}
+		else
+		{
+			// The upload source has to outlive this call.
+			up.resize( converted.size() * sizeof( castor::Point4f ) );
+			std::memcpy( up.data(), converted.data(), up.size() );
+		}
+
+		smshbase::upload( submeshData, submesh, up.data(), up.size(), uploader );
 	}
 
 	void gatherBaseDataBuffer( SubmeshData submeshData
@@ -98,14 +210,17 @@ namespace castor3d
 		if ( bufferChunk.hasData()
 			&& flags.enableVertexInput( submeshData ) )
 		{
+			auto packed = flags.hasPackedVertices() && isPackable( submeshData );
 			auto hash = std::hash< uint32_t >{}( currentBinding );
 			hash = castor::hashCombine( hash, currentLocation );
+			hash = castor::hashCombine( hash, packed );
 			auto layoutIt = cache.find( hash );
 
 			if ( layoutIt == cache.end() )
 			{
 				layoutIt = cache.try_emplace( hash
 					, smshbase::createVertexLayout( submeshData
+						, packed
 						, currentBinding
 						, currentLocation ) ).first;
 			}
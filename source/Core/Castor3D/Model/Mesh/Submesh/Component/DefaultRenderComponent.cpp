@@ -191,7 +191,7 @@ namespace castor3d
 
 		writer.implementMainT< shader::MeshVertexT, shader::FragmentSurfaceT >( sdw::VertexInT< shader::MeshVertexT >{ writer, submeshShaders }
 			, sdw::VertexOutT< shader::FragmentSurfaceT >{ writer, submeshShaders, passShaders, flags }
-			, [&engine, &writer, &materials, &c3d_cameraData, &c3d_modelsData, &c3d_objectIdsData, &drawID, &pipelineID, &flags]( sdw::VertexInT< shader::MeshVertexT > const & in
+			, [&engine, &writer, &utils, &materials, &c3d_cameraData, &c3d_modelsData, &c3d_objectIdsData, &drawID, &pipelineID, &flags]( sdw::VertexInT< shader::MeshVertexT > const & in
 				, sdw::VertexOutT< shader::FragmentSurfaceT > out )
 			{
 				auto nodeId = writer.declLocale( "nodeId"
@@ -200,22 +200,22 @@ namespace castor3d
 						, pipelineID
 						, writer.cast< sdw::UInt >( engine.getRenderDevice()->hasDrawId() ? in.drawID : drawID )
 						, flags ) );
+				auto modelData = writer.declLocale( "modelData"
+					, c3d_modelsData[nodeId - 1u] );
 				auto curPosition = writer.declLocale( "curPosition"
-					, in.position );
+					, modelData.unpackPosition( flags, in.position ) );
 				auto curNormal = writer.declLocale( "curNormal"
-					, in.normal );
+					, in.getNormal( flags, utils ) );
 				auto curTangent = writer.declLocale( "curTangent"
-					, in.tangent );
+					, in.getTangent( flags, utils ) );
 				auto curBitangent = writer.declLocale( "curBitangent"
-					, in.bitangent );
+					, in.getBitangent( flags, utils ) );
 				out.texture0 = in.texture0;
 				out.texture1 = in.texture1;
 				out.texture2 = in.texture2;
 				out.texture3 = in.texture3;
 				out.colour = in.colour;
 				out.nodeId = nodeId;
-				auto modelData = writer.declLocale( "modelData"
-					, c3d_modelsData[nodeId - 1u] );
 				auto material = writer.declLocale( "material"
 					, materials.getMaterial( modelData.getMaterialId() ) );
 				material.getPassMultipliers( flags
@@ -0,0 +1,133 @@
+#include "Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp"
+
+#include "Castor3D/Buffer/GpuBuffer.hpp"
+#include "Castor3D/Buffer/GpuBufferPool.hpp"
+#include "Castor3D/Buffer/UploadData.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+
+CU_ImplementSmartPtr( castor3d, LodComponent )
+
+namespace castor3d
+{
+	//*********************************************************************************************
+
+	void LodComponent::ComponentData::copy( SubmeshComponentDataRPtr data )const
+	{
+		auto result = static_cast< ComponentData * >( data );
+		result->m_lods = m_lods;
+		result->m_pixelError = m_pixelError;
+	}
+
+	uint32_t LodComponent::ComponentData::getIndexCount()const noexcept
+	{
+		uint32_t result{};
+
+		for ( auto & lod : m_lods )
+		{
+			result += lod.getIndexCount();
+		}
+
+		return result;
+	}
+
+	uint32_t LodComponent::ComponentData::getIndexCount( uint32_t level )const noexcept
+	{
+		if ( level == 0u || level > m_lods.size() )
+		{
+			return m_submesh.getIndexCount();
+		}
+
+		return m_lods[level - 1u].getIndexCount();
+	}
+
+	uint32_t LodComponent::ComponentData::getFirstIndex( uint32_t level )const noexcept
+	{
+		if ( level == 0u || level > m_lods.size() )
+		{
+			return 0u;
+		}
+
+		// The levels are stored after the submesh indices, from the finest to the coarsest.
+		auto result = m_submesh.getIndexCount();
+
+		for ( uint32_t i = 1u; i < level; ++i )
+		{
+			result += m_lods[i - 1u].getIndexCount();
+		}
+
+		return result;
+	}
+
+	uint32_t LodComponent::ComponentData::selectLevel( float pixelRadius )const noexcept
+	{
+		// The simplification error is relative to the submesh extent,
+		// hence the projected error is given by the projected diameter.
+		auto pixelDiameter = 2.0f * pixelRadius;
+		uint32_t result{};
+
+		for ( auto & lod : m_lods )
+		{
+			if ( lod.error * pixelDiameter > m_pixelError )
+			{
+				break;
+			}
+
+			++result;
+		}
+
+		return result;
+	}
+
+	bool LodComponent::ComponentData::doInitialise( RenderDevice const & device )
+	{
+		return true;
+	}
+
+	void LodComponent::ComponentData::doCleanup( RenderDevice const & device )
+	{
+		m_lods.clear();
+	}
+
+	void LodComponent::ComponentData::doUpload( UploadData & uploader )
+	{
+		auto & offsets = m_submesh.getSourceBufferOffsets();
+		auto & buffer = offsets.getBufferChunk( SubmeshData::eIndex );
+
+		if ( m_lods.empty() || !buffer.hasData() )
+		{
+			return;
+		}
+
+		CU_Require( buffer.getCount< uint32_t >() >= m_submesh.getIndexCount() + getIndexCount() );
+
+		for ( uint32_t level = 1u; level <= m_lods.size(); ++level )
+		{
+			auto & lod = m_lods[level - 1u];
+			uploader.pushUpload( lod.faces.data()
+				, lod.faces.size() * sizeof( Face )
+				, buffer.getBuffer()
+				, buffer.getOffset() + getFirstIndex( level ) * sizeof( uint32_t )
+				, VK_ACCESS_INDEX_READ_BIT
+				, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT );
+		}
+	}
+
+	//*********************************************************************************************
+
+	castor::String const LodComponent::TypeName = C3D_MakeSubmeshComponentName( "lods" );
+
+	LodComponent::LodComponent( Submesh & submesh )
+		: SubmeshComponent{ submesh, TypeName
+			, castor::make_unique< ComponentData >( submesh ) }
+	{
+	}
+
+	SubmeshComponentUPtr LodComponent::clone( Submesh & submesh )const
+	{
+		auto result = castor::makeUnique< LodComponent >( submesh );
+		result->getData().copy( &getData() );
+		return castor::ptrRefCast< SubmeshComponent >( result );
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,73 @@
+#include "Castor3D/Model/Mesh/Submesh/Component/PackedVerticesComponent.hpp"
+
+#include "Castor3D/Config.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/BaseDataComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/MeshletComponent.hpp"
+
+CU_ImplementSmartPtr( castor3d, PackedVerticesComponent )
+
+namespace castor3d
+{
+	//*********************************************************************************************
+
+	castor::Point4f PackedVerticesComponent::ComponentData::getPositionsOffset()const noexcept
+	{
+		auto & center = m_submesh.getBoundingBox().getCenter();
+		return castor::Point4f{ center->x, center->y, center->z, 0.0f };
+	}
+
+	castor::Point4f PackedVerticesComponent::ComponentData::getPositionsScale()const noexcept
+	{
+		auto & dimensions = m_submesh.getBoundingBox().getDimensions();
+		// A flat axis keeps a unit scale, its quantised values all being 0.
+		auto halfExtent = []( float value )
+		{
+			return value > 0.0f ? value / 2.0f : 1.0f;
+		};
+		return castor::Point4f{ halfExtent( dimensions->x )
+			, halfExtent( dimensions->y )
+			, halfExtent( dimensions->z )
+			, 1.0f };
+	}
+
+	void PackedVerticesComponent::ComponentData::fillModelData( ModelBufferConfiguration & modelData )const noexcept
+	{
+		modelData.positionsOffset = getPositionsOffset();
+		modelData.positionsScale = getPositionsScale();
+	}
+
+	//*********************************************************************************************
+
+	castor::String const PackedVerticesComponent::TypeName = C3D_MakeSubmeshComponentName( "packed_vertices" );
+
+	PackedVerticesComponent::PackedVerticesComponent( Submesh & submesh )
+		: SubmeshComponent{ submesh, TypeName
+			, castor::make_unique< ComponentData >( submesh ) }
+	{
+	}
+
+	SubmeshComponentUPtr PackedVerticesComponent::clone( Submesh & submesh )const
+	{
+		auto result = castor::makeUnique< PackedVerticesComponent >( submesh );
+		result->getData().copy( &getData() );
+		return castor::ptrRefCast< SubmeshComponent >( result );
+	}
+
+	bool PackedVerticesComponent::canPackVertices( Submesh const & submesh )
+	{
+		if constexpr ( C3D_UseVisibilityBuffer != 0 )
+		{
+			// The visibility buffer resolve reads the vertices from storage buffers.
+			return false;
+		}
+		else
+		{
+			return submesh.hasComponent( PositionsComponent::TypeName )
+				&& !submesh.isDynamic()
+				&& !submesh.hasComponent( MeshletComponent::TypeName );
+		}
+	}
+
+	//*********************************************************************************************
+}
@@ -6,8 +6,10 @@
 #include "Castor3D/Model/Mesh/Submesh/Component/DefaultRenderComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/InstantiationComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/LinesMapping.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MeshletComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MorphComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/PackedVerticesComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/PassMasksComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/SkinComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
@@ -52,6 +54,8 @@ namespace castor3d
 		registerComponent< MorphComponent >();
 		registerComponent< InstantiationComponent >();
 		registerComponent< MeshletComponent >();
+		registerComponent< LodComponent >();
+		registerComponent< PackedVerticesComponent >();
 		registerComponent< DefaultRenderComponent >();
 
 		addFlags( m_defaultComponents, m_positionFlag );
@@ -504,6 +508,11 @@ namespace castor3d
 			m_meshletFlag = componentDesc.plugin->getMeshletFlag();
 		}
 
+		if ( componentDesc.plugin->getPackedVerticesFlag() != 0u )
+		{
+			m_packedVerticesFlag = componentDesc.plugin->getPackedVerticesFlag();
+		}
+
 		if ( componentDesc.plugin->getInstantiationFlag() != 0u )
 		{
 			m_instantiationFlag = componentDesc.plugin->getInstantiationFlag();
@@ -598,6 +607,7 @@ namespace castor3d
 		combine.hasMorphFlag = hasAny( combine, m_morphFlag );
 		combine.hasPassMaskFlag = hasAny( combine, m_passMaskFlag );
 		combine.hasVelocityFlag = hasAny( combine, m_velocityFlag );
+		combine.hasPackedVerticesFlag = hasAny( combine, m_packedVerticesFlag );
 		combine.hasRenderFlag = hasAny( combine, m_renderShaderFlags );
 	}
 }
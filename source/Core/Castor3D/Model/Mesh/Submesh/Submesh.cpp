@@ -10,6 +10,7 @@
 #include "Castor3D/Miscellaneous/ConfigurationVisitor.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/BaseDataComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/SkinComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MeshletComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MorphComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/PassMasksComponent.hpp"
@@ -158,7 +159,7 @@ namespace castor3d
 		if ( !m_generated )
 		{
 			if ( !m_sourceBufferOffset
-				|| getPointsCount() != m_sourceBufferOffset.getCount< castor::Point4f >( SubmeshData::ePositions ) )
+				|| getPointsCount() != m_sourceBufferOffset.getVertexCount() )
 			{
 				for ( auto & [_, finalBufferOffset] : m_finalBufferOffsets )
 				{
@@ -171,6 +172,7 @@ namespace castor3d
 
 				if ( m_sourceBufferOffset )
 				{
+					device.geometryPools->unregisterRelocatable( m_sourceBufferOffset );
 					device.geometryPools->putBuffer( m_sourceBufferOffset );
 					m_sourceBufferOffset = {};
 				}
@@ -180,6 +182,12 @@ namespace castor3d
 				if ( m_indexMapping )
 				{
 					indexCount = VkDeviceSize( m_indexMapping->getCount() ) * m_indexMapping->getComponentsCount();
+
+					if ( auto lods = getComponent< LodComponent >() )
+					{
+						// The levels of detail are stored right after the submesh indices.
+						indexCount += lods->getData().getIndexCount();
+					}
 				}
 
 				if ( isDynamic()
@@ -207,6 +215,18 @@ namespace castor3d
 					CU_Exception( "No source data available for submesh" );
 				}
 
+				if ( !isDynamic()
+					&& !hasComponent( MeshletComponent::TypeName ) )
+				{
+					// Only referenced through the source buffers (the meshlets descriptor sets would need to be rewritten),
+					// so the pool compaction can move them.
+					device.geometryPools->registerRelocatable( m_sourceBufferOffset
+						, [this, &device]()
+						{
+							m_relocation = device.geometryPools->getGeneration();
+						} );
+				}
+
 				if ( isDynamic() )
 				{
 					ashes::BufferBase const * indexBuffer{};
@@ -292,6 +312,7 @@ namespace castor3d
 
 		if ( m_sourceBufferOffset )
 		{
+			device.geometryPools->unregisterRelocatable( m_sourceBufferOffset );
 			device.geometryPools->putBuffer( m_sourceBufferOffset );
 		}
 	}
@@ -468,7 +489,7 @@ namespace castor3d
 			, smsh::getComponentCount< Texcoords2Component >( *this )
 			, smsh::getComponentCount< Texcoords3Component >( *this )
 			, smsh::getComponentCount< ColoursComponent >( *this )
-			, uint32_t( m_sourceBufferOffset ? m_sourceBufferOffset.getCount< castor::Point4f >( SubmeshData::ePositions ) : 0u ) } );
+			, uint32_t( m_sourceBufferOffset ? m_sourceBufferOffset.getVertexCount() : 0u ) } );
 	}
 
 	int Submesh::isInMyPoints( castor::Point3f const & vertex
@@ -578,6 +599,13 @@ namespace castor3d
 		, Pass const & pass
 		, PipelineFlags const & flags )const
 	{
+		if ( m_geometryBuffersRelocation != m_relocation )
+		{
+			// The source buffers have been moved by the pool compaction.
+			m_geometryBuffers.clear();
+			m_geometryBuffersRelocation = m_relocation;
+		}
+
 		auto key = smsh::hash( *this, geometry, pass, flags );
 		auto [it, res] = m_geometryBuffers.try_emplace( key );
 		auto & bufferOffsets = getFinalBufferOffsets( geometry, pass );
@@ -1201,7 +1229,7 @@ namespace castor3d
 	VkDeviceSize Submesh::getVertexOffset( Geometry const & geometry
 		, Pass const & pass )const
 	{
-		return getFinalBufferOffsets( geometry, pass ).getFirstVertex< castor::Point4f >();
+		return getFinalBufferOffsets( geometry, pass ).getFirstVertex();
 	}
 
 	VkDeviceSize Submesh::getIndexOffset()const
@@ -6,8 +6,168 @@
 
 #include <mikktspace.h>
 
+#if CU_SimdSSE2
+#	include <emmintrin.h>
+#	define C3D_NormalsSimd 1
+#elif CU_SimdNEON && defined( CU_ArchARM64 )
+#	include <arm_neon.h>
+#	define C3D_NormalsSimd 1
+#else
+#	define C3D_NormalsSimd 0
+#endif
+
 namespace castor3d
 {
+	namespace smshutils
+	{
+#if CU_SimdSSE2
+
+		struct Simd
+		{
+			using Vec = __m128;
+			static uint32_t constexpr Width = 4u;
+
+			static Vec zero()
+			{
+				return _mm_setzero_ps();
+			}
+
+			// Loads 4 consecutive 3 components vectors, deinterleaved.
+			static void load3( float const * data, Vec & x, Vec & y, Vec & z )
+			{
+				auto r0 = _mm_loadu_ps( data + 0u );	// x0 y0 z0 x1
+				auto r1 = _mm_loadu_ps( data + 4u );	// y1 z1 x2 y2
+				auto r2 = _mm_loadu_ps( data + 8u );	// z2 x3 y3 z3
+				x = _mm_shuffle_ps( _mm_shuffle_ps( r0, r0, _MM_SHUFFLE( 3, 0, 3, 0 ) )
+					, _mm_shuffle_ps( r1, r2, _MM_SHUFFLE( 1, 1, 2, 2 ) )
+					, _MM_SHUFFLE( 2, 0, 1, 0 ) );
+				y = _mm_shuffle_ps( _mm_shuffle_ps( r0, r1, _MM_SHUFFLE( 0, 0, 1, 1 ) )
+					, _mm_shuffle_ps( r1, r2, _MM_SHUFFLE( 2, 2, 3, 3 ) )
+					, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+				z = _mm_shuffle_ps( _mm_shuffle_ps( r0, r1, _MM_SHUFFLE( 1, 1, 2, 2 ) )
+					, _mm_shuffle_ps( r2, r2, _MM_SHUFFLE( 3, 0, 3, 0 ) )
+					, _MM_SHUFFLE( 1, 0, 2, 0 ) );
+			}
+
+			// Stores 4 deinterleaved 3 components vectors, interleaved.
+			static void store3( float * data, Vec x, Vec y, Vec z )
+			{
+				_mm_storeu_ps( data + 0u
+					, _mm_shuffle_ps( _mm_shuffle_ps( x, y, _MM_SHUFFLE( 0, 0, 0, 0 ) )
+						, _mm_shuffle_ps( z, x, _MM_SHUFFLE( 1, 1, 0, 0 ) )
+						, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+				_mm_storeu_ps( data + 4u
+					, _mm_shuffle_ps( _mm_shuffle_ps( y, z, _MM_SHUFFLE( 1, 1, 1, 1 ) )
+						, _mm_shuffle_ps( x, y, _MM_SHUFFLE( 2, 2, 2, 2 ) )
+						, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+				_mm_storeu_ps( data + 8u
+					, _mm_shuffle_ps( _mm_shuffle_ps( z, x, _MM_SHUFFLE( 3, 3, 2, 2 ) )
+						, _mm_shuffle_ps( y, z, _MM_SHUFFLE( 3, 3, 3, 3 ) )
+						, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+			}
+
+			static Vec add( Vec lhs, Vec rhs )
+			{
+				return _mm_add_ps( lhs, rhs );
+			}
+
+			static Vec sub( Vec lhs, Vec rhs )
+			{
+				return _mm_sub_ps( lhs, rhs );
+			}
+
+			static Vec mul( Vec lhs, Vec rhs )
+			{
+				return _mm_mul_ps( lhs, rhs );
+			}
+
+			static Vec div( Vec lhs, Vec rhs )
+			{
+				return _mm_div_ps( lhs, rhs );
+			}
+
+			static Vec sqrt( Vec value )
+			{
+				return _mm_sqrt_ps( value );
+			}
+
+			static Vec notEqual( Vec lhs, Vec rhs )
+			{
+				return _mm_cmpneq_ps( lhs, rhs );
+			}
+
+			static Vec select( Vec mask, Vec ifTrue, Vec ifFalse )
+			{
+				return _mm_or_ps( _mm_and_ps( mask, ifTrue ), _mm_andnot_ps( mask, ifFalse ) );
+			}
+		};
+
+#elif CU_SimdNEON && defined( CU_ArchARM64 )
+
+		struct Simd
+		{
+			using Vec = float32x4_t;
+			static uint32_t constexpr Width = 4u;
+
+			static Vec zero()
+			{
+				return vdupq_n_f32( 0.0f );
+			}
+
+			// Loads 4 consecutive 3 components vectors, deinterleaved.
+			static void load3( float const * data, Vec & x, Vec & y, Vec & z )
+			{
+				auto values = vld3q_f32( data );
+				x = values.val[0];
+				y = values.val[1];
+				z = values.val[2];
+			}
+
+			// Stores 4 deinterleaved 3 components vectors, interleaved.
+			static void store3( float * data, Vec x, Vec y, Vec z )
+			{
+				vst3q_f32( data, float32x4x3_t{ { x, y, z } } );
+			}
+
+			static Vec add( Vec lhs, Vec rhs )
+			{
+				return vaddq_f32( lhs, rhs );
+			}
+
+			static Vec sub( Vec lhs, Vec rhs )
+			{
+				return vsubq_f32( lhs, rhs );
+			}
+
+			static Vec mul( Vec lhs, Vec rhs )
+			{
+				return vmulq_f32( lhs, rhs );
+			}
+
+			static Vec div( Vec lhs, Vec rhs )
+			{
+				return vdivq_f32( lhs, rhs );
+			}
+
+			static Vec sqrt( Vec value )
+			{
+				return vsqrtq_f32( value );
+			}
+
+			static Vec notEqual( Vec lhs, Vec rhs )
+			{
+				return vreinterpretq_f32_u32( vmvnq_u32( vceqq_f32( lhs, rhs ) ) );
+			}
+
+			static Vec select( Vec mask, Vec ifTrue, Vec ifFalse )
+			{
+				return vbslq_f32( vreinterpretq_u32_f32( mask ), ifTrue, ifFalse );
+			}
+		};
+
+#endif
+	}
+
 	namespace mikkt
 	{
 		struct SubmeshData
@@ -114,56 +274,79 @@ namespace castor3d
 		, FaceArray const & faces
 		, bool reverted )
 	{
-		static const castor::Point3f pt0{};
+		static_assert( sizeof( castor::Point3f ) == 3u * sizeof( float ) );
 
-		// First we flush normals and tangents
-		for ( auto & pt : normals )
+		if ( normals.empty() )
 		{
-			pt = pt0;
+			return;
 		}
 
-		// Then we compute normals and tangents
-		if ( reverted )
+		// First we flush normals
+		std::fill( normals.begin(), normals.end(), castor::Point3f{} );
+
+		// Then we accumulate the faces normals.
+		// This is a gather and a scatter per face, which SIMD doesn't speed up,
+		// hence a plain loop on the components.
+		auto pos = positions.data()->constPtr();
+		auto nml = normals.data()->ptr();
+		// Reverting the normals is swapping the second and third vertices.
+		auto second = reverted ? 2u : 1u;
+		auto third = reverted ? 1u : 2u;
+
+		for ( auto const & face : faces )
 		{
-			for ( auto const & face : faces )
-			{
-				auto & pos1 = positions[face[0]];
-				auto & pos2 = positions[face[2]];
-				auto & pos3 = positions[face[1]];
-				auto & nml1 = normals[face[0]];
-				auto & nml2 = normals[face[2]];
-				auto & nml3 = normals[face[1]];
-				auto const vec2m1 = pos2 - pos1;
-				auto const vec3m1 = pos3 - pos1;
-				auto const faceNormal = castor::point::cross( vec3m1, vec2m1 );
-				nml1 += faceNormal;
-				nml2 += faceNormal;
-				nml3 += faceNormal;
-			}
+			auto i1 = face[0u] * 3u;
+			auto i2 = face[second] * 3u;
+			auto i3 = face[third] * 3u;
+			auto const vec2m1x = pos[i2 + 0u] - pos[i1 + 0u];
+			auto const vec2m1y = pos[i2 + 1u] - pos[i1 + 1u];
+			auto const vec2m1z = pos[i2 + 2u] - pos[i1 + 2u];
+			auto const vec3m1x = pos[i3 + 0u] - pos[i1 + 0u];
+			auto const vec3m1y = pos[i3 + 1u] - pos[i1 + 1u];
+			auto const vec3m1z = pos[i3 + 2u] - pos[i1 + 2u];
+			// Same operations as castor::point::cross( vec3m1, vec2m1 ).
+			auto const nx = vec3m1y * vec2m1z - vec3m1z * vec2m1y;
+			auto const ny = vec3m1z * vec2m1x - vec3m1x * vec2m1z;
+			auto const nz = vec3m1x * vec2m1y - vec3m1y * vec2m1x;
+
+			nml[i1 + 0u] += nx;
+			nml[i1 + 1u] += ny;
+			nml[i1 + 2u] += nz;
+			nml[i2 + 0u] += nx;
+			nml[i2 + 1u] += ny;
+			nml[i2 + 2u] += nz;
+			nml[i3 + 0u] += nx;
+			nml[i3 + 1u] += ny;
+			nml[i3 + 2u] += nz;
 		}
-		else
+
+		// Eventually we normalise the normals, 4 at a time when possible.
+		auto normalCount = uint32_t( normals.size() );
+		uint32_t index{};
+#if C3D_NormalsSimd
+		using smshutils::Simd;
+		auto const zero = Simd::zero();
+
+		for ( ; index + Simd::Width <= normalCount; index += Simd::Width )
 		{
-			for ( auto const & face : faces )
-			{
-				auto & pos1 = positions[face[0]];
-				auto & pos2 = positions[face[1]];
-				auto & pos3 = positions[face[2]];
-				auto & nml1 = normals[face[0]];
-				auto & nml2 = normals[face[1]];
-				auto & nml3 = normals[face[2]];
-				auto const vec2m1 = pos2 - pos1;
-				auto const vec3m1 = pos3 - pos1;
-				auto const faceNormal = castor::point::cross( vec3m1, vec2m1 );
-				nml1 += faceNormal;
-				nml2 += faceNormal;
-				nml3 += faceNormal;
-			}
+			auto data = nml + index * 3u;
+			Simd::Vec x;
+			Simd::Vec y;
+			Simd::Vec z;
+			Simd::load3( data, x, y, z );
+			auto length = Simd::sqrt( Simd::add( Simd::add( Simd::mul( x, x ), Simd::mul( y, y ) ), Simd::mul( z, z ) ) );
+			// Null normals are left untouched, as castor::point::normalise does.
+			auto valid = Simd::notEqual( length, zero );
+			Simd::store3( data
+				, Simd::select( valid, Simd::div( x, length ), x )
+				, Simd::select( valid, Simd::div( y, length ), y )
+				, Simd::select( valid, Simd::div( z, length ), z ) );
 		}
+#endif
 
-		// Eventually we normalize the normals and tangents
-		for ( auto & nml : normals )
+		for ( ; index < normalCount; ++index )
 		{
-			castor::point::normalise( nml );
+			castor::point::normalise( normals[index] );
 		}
 	}
 
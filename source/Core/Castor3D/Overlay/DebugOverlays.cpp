@@ -1191,6 +1191,12 @@ namespace castor3d
 		m_debugPanel->addTimePanel( cuT( "AverageTime" )
 			, cuT( "Average:" )
 			, m_averageTime );
+		m_debugPanel->addTimePanel( cuT( "CpuStepTime" )
+			, cuT( "CPU Update:" )
+			, m_renderInfo.cpuStepTime );
+		m_debugPanel->addTimePanel( cuT( "QueuesUpdateTime" )
+			, cuT( "Queues:" )
+			, m_renderInfo.queuesUpdateTime );
 		m_debugPanel->addFpsPanel( cuT( "FPS" )
 			, cuT( "Last:" )
 			, m_fps );
@@ -1230,6 +1236,15 @@ namespace castor3d
 		m_debugPanel->addCountPanel( cuT( "StagingBuffersCount" )
 			, cuT( "Upload Buffers:" )
 			, m_renderInfo.stagingBuffersCount );
+		m_debugPanel->addCountPanel( cuT( "CompactionMovedSize" )
+			, cuT( "Compacted Size:" )
+			, m_renderInfo.compactionMovedSize );
+		m_debugPanel->addCountPanel( cuT( "CompactionFreedSize" )
+			, cuT( "Freed Size:" )
+			, m_renderInfo.compactionFreedSize );
+		m_debugPanel->addCountPanel( cuT( "CompactionReleasedSize" )
+			, cuT( "Reclaimed Size:" )
+			, m_renderInfo.compactionReleasedSize );
 		m_debugPanel->setVisible( m_visible );
 	}
 
@@ -2,6 +2,7 @@
 
 #include "Castor3D/Engine.hpp"
 #include "Castor3D/Buffer/GpuBuffer.hpp"
+#include "Castor3D/Buffer/UploadData.hpp"
 #include "Castor3D/Event/Frame/CpuFunctorEvent.hpp"
 #include "Castor3D/Event/Frame/GpuFunctorEvent.hpp"
 #include "Castor3D/Material/Texture/Sampler.hpp"
@@ -11,6 +12,9 @@
 #include <CastorUtils/Design/ResourceCache.hpp>
 #include <CastorUtils/Graphics/Font.hpp>
 #include <CastorUtils/Graphics/Image.hpp>
+#include <CastorUtils/Miscellaneous/BitSize.hpp>
+
+#include <ashespp/Image/Image.hpp>
 
 CU_ImplementSmartPtr( castor3d, FontTexture )
 
@@ -20,6 +24,31 @@ namespace castor3d
 
 	namespace fonttex
 	{
+		// The atlas grows by pages of a quarter of its width, up to twice its width.
+		static uint32_t constexpr PageCountPerWidth = 4u;
+		static uint32_t constexpr MaxPageCount = 8u;
+
+		static castor::PixelFormat getFormat( castor::Font const & font )
+		{
+			return font.isSDF()
+				? castor::PixelFormat::eR32G32B32A32_SFLOAT
+				: castor::PixelFormat::eR8_UNORM;
+		}
+
+		static uint32_t getAtlasWidth( castor::Font const & font )
+		{
+			auto const maxWidth = font.isSDF()
+				? font.getMaxImageWidth()
+				: uint32_t( font.getMaxGlyphWidth() );
+			// At least 16 glyphs per line, with their padding.
+			return castor::getNextPowerOfTwo( std::max( 64u, 16u * ( maxWidth + 1u ) ) );
+		}
+
+		static uint32_t getPageHeight( uint32_t atlasWidth )
+		{
+			return atlasWidth / PageCountPerWidth;
+		}
+
 		static TextureLayoutUPtr createTexture( Engine const & engine
 			, castor::FontResPtr font
 			, castor::String suffix )
@@ -29,21 +58,16 @@ namespace castor3d
 				CU_Exception( "No Font given to FontTexture" );
 			}
 
-			auto const maxWidth = font->isSDF()
-				? font->getMaxImageWidth()
-				: uint32_t( font->getMaxGlyphWidth() );
-			auto const maxHeight = font->isSDF()
-				? font->getMaxImageHeight()
-				: uint32_t( font->getMaxGlyphHeight() );
+			// The real dimensions are given by the atlas, when the texture is updated.
+			auto const width = getAtlasWidth( *font );
 			auto const format = font->isSDF()
 				? VK_FORMAT_R32G32B32A32_SFLOAT
 				: VK_FORMAT_R8_UNORM;
-			uint32_t const count = castor::divRoundUp( uint32_t( std::distance( font->begin(), font->end() ) ), 16u );
 
 			ashes::ImageCreateInfo image{ 0u
 				, VK_IMAGE_TYPE_2D
 				, format
-				, { maxWidth * 16, maxHeight * count, 1u }
+				, { width, getPageHeight( width ), 1u }
 				, 1u
 				, 1u
 				, VK_SAMPLE_COUNT_1_BIT
@@ -80,12 +104,34 @@ namespace castor3d
 			, fonttex::createTexture( engine, font, "_1" ) }
 		, m_font( font )
 		, m_ubo{ castor::makeUnique< FontUbo >( *engine.getRenderDevice() ) }
+		, m_atlas{ [this]( char32_t c )
+				{
+					return m_font->hasGlyphAt( c )
+						? &m_font->getGlyphAt( c )
+						: nullptr;
+				}
+			, fonttex::getFormat( *font )
+			, fonttex::getAtlasWidth( *font )
+			, fonttex::getPageHeight( fonttex::getAtlasWidth( *font ) )
+			, fonttex::getPageHeight( fonttex::getAtlasWidth( *font ) ) * fonttex::MaxPageCount
+			, font->isSDF() }
 	{
 		if ( !m_font )
 		{
 			CU_Exception( "No Font given to FontTexture" );
 		}
 
+		// The already loaded glyphs are put in the atlas, they can be evicted when it is full.
+		castor::U32String loaded;
+
+		for ( auto const & glyph : *m_font )
+		{
+			loaded.push_back( glyph.getCharacter() );
+			m_charIndices.try_emplace( glyph.getCharacter(), uint32_t( m_charIndices.size() ) );
+		}
+
+		m_atlas.addGlyphs( loaded );
+
 		if ( auto sampler = getEngine()->addNewSampler( m_font->getName(), *getEngine() ) )
 		{
 			sampler->setWrapS( VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE );
@@ -102,9 +148,11 @@ namespace castor3d
 	void FontTexture::initialise( RenderDevice const & device
 		, QueueData const & queueData )
 	{
+		doSetSource( doGetFront() );
+		doSetSource( doGetBack() );
+		m_atlas.publish();
 		doInitialise( device, queueData );
-		updateResource( doGetFront() );
-		updateResource( doGetBack() );
+		m_ubo->cpuUpdate( m_atlas.getSize(), m_font->isSDF(), m_font->getPixelRange() );
 		onResourceChanged( *this );
 		log::info << "Initialised FontTexture for Font [" << m_font->getName() << "]" << std::endl;
 	}
@@ -117,12 +165,58 @@ namespace castor3d
 
 	void FontTexture::upload( UploadData & uploader )
 	{
-		if ( auto & resource = doGetFront();
-			resource.needsUpload )
+		auto & resource = doGetFront();
+		auto const & region = m_atlas.getFrontRegion();
+
+		if ( resource.needsUpload )
 		{
+			// The glyphs added since are uploaded next time, after this whole upload.
 			resource.resource->upload( uploader );
 			resource.needsUpload = false;
 		}
+		else if ( !region.empty()
+			&& resource.resource->isInitialised() )
+		{
+			// The front region is only filled while the atlas has the front texture layout and dimensions.
+			auto & texture = *resource.resource;
+			auto pixelSize = uint32_t( getBytesPerPixel( fonttex::getFormat( *m_font ) ) );
+			auto rowSize = m_atlas.getSize().getWidth() * pixelSize;
+			auto width = region.right - region.left;
+			auto height = region.bottom - region.top;
+			uploader.pushUpload( m_atlas.getData().data() + region.top * rowSize + region.left * pixelSize
+				, VkDeviceSize( height - 1u ) * rowSize + VkDeviceSize( width ) * pixelSize
+				, m_atlas.getSize().getWidth()
+				, texture.getTexture()
+				, texture.getImage().getLayout()
+				, { ashes::getAspectMask( texture.getPixelFormat() ), 0u, 1u, 0u, 1u }
+				, VkOffset3D{ int32_t( region.left ), int32_t( region.top ), 0 }
+				, VkExtent3D{ width, height, 1u }
+				, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+				, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT );
+			m_atlas.clearFrontRegion();
+		}
+	}
+
+	void FontTexture::useGlyphs( castor::U32String const & text )
+	{
+		for ( auto c : text )
+		{
+			if ( m_font->hasGlyphAt( c ) )
+			{
+				m_charIndices.try_emplace( c, uint32_t( m_charIndices.size() ) );
+			}
+		}
+
+		if ( m_atlas.useGlyphs( text ) )
+		{
+			// The atlas has grown or has been repacked, the back texture is recreated and will replace the front one.
+			update( true );
+		}
+	}
+
+	void FontTexture::releaseGlyphs( castor::U32String const & text )
+	{
+		m_atlas.releaseGlyphs( text );
 	}
 
 	castor::UInt32Array FontTexture::convert( castor::U32String const & text )const
@@ -154,23 +248,32 @@ namespace castor3d
 
 	castor::Position const & FontTexture::getGlyphPosition( char32_t glyphChar )const
 	{
-		auto it = m_glyphsPositions.find( glyphChar );
+		auto result = m_atlas.getPosition( glyphChar );
 
-		if ( it == m_glyphsPositions.end() )
+		if ( !result )
 		{
-			it = m_glyphsPositions.find( U'?' );
-			CU_Require( it != m_glyphsPositions.end() );
-			return it->second;
+			result = m_atlas.getPosition( U'?' );
+			CU_Require( result );
 		}
 
-		return it->second;
+		return *result;
 	}
 
 	void FontTexture::initialiseResource( Resource & resource
 		, RenderDevice const & device
 		, QueueData const & queueData )
 	{
-		resource.resource->initialise( device );
+		auto & texture = *resource.resource;
+
+		// The atlas may have grown since the texture creation.
+		if ( texture.isInitialised()
+			&& ( texture.getTexture().getDimensions().width != texture.getDimensions().width
+				|| texture.getTexture().getDimensions().height != texture.getDimensions().height ) )
+		{
+			texture.cleanup();
+		}
+
+		texture.initialise( device );
 	}
 
 	void FontTexture::cleanupResource( Resource & resource )
@@ -180,71 +283,34 @@ namespace castor3d
 
 	void FontTexture::updateResource( Resource & resource )
 	{
-		if ( auto font = getFont() )
-		{
-			auto & glyphPositions = m_glyphsPositions;
-			auto const maxWidth = font->isSDF()
-				? font->getMaxImageWidth()
-				: uint32_t( font->getMaxGlyphWidth() );
-			auto const maxHeight = font->isSDF()
-				? font->getMaxImageHeight()
-				: uint32_t( font->getMaxGlyphHeight() );
-			auto const format = font->isSDF()
-				? castor::PixelFormat::eR32G32B32A32_SFLOAT
-				: castor::PixelFormat::eR8_UNORM;
-			uint32_t const count = castor::divRoundUp( uint32_t( std::distance( font->begin(), font->end() ) ), 16u );
-			castor::Size size{ maxWidth * 16, maxHeight * count };
-			m_ubo->cpuUpdate( size, font->isSDF(), font->getPixelRange() );
-			resource.resource->setSource( castor::PxBufferBase::create( castor::Size( maxWidth * 16, maxHeight * count ), format ), true );
-			auto & image = resource.resource->getImage();
-			auto pixelSize = uint32_t( getBytesPerPixel( format ) );
-
-			auto it = font->begin();
-			castor::Size const & sizeImg = size;
-			uint32_t const imgLineSize = sizeImg.getWidth();
-			uint32_t offY = sizeImg.getHeight() - maxHeight;
-			auto buffer = image.getBuffer();
-			uint8_t * dstBuffer = buffer.data();
-
-			for ( uint32_t y = 0; y < count && it != font->end(); ++y )
-			{
-				uint32_t offX = 0;
-
-				for ( uint32_t x = 0; x < 16 && it != font->end(); ++x )
-				{
-					castor::Glyph const & glyph = *it;
-					auto const glyphSize = font->isSDF()
-						? castor::Point2ui{ glyph.getBitmapSize()->x, glyph.getBitmapSize()->y }
-						: castor::Point2ui{ glyph.getSize() };
-					auto srcGlyphBuffer = glyph.getBitmap().data();
-					uint32_t dstGlyphIndex = ( imgLineSize * offY ) + offX;
-					uint8_t * dstGlyphBuffer = &dstBuffer[dstGlyphIndex * pixelSize];
-
-					for ( uint32_t i = 0; i < glyphSize->y; ++i )
-					{
-						CU_Ensure( size_t( dstGlyphIndex ) + glyphSize->x * pixelSize <= buffer.size() );
-						std::memcpy( dstGlyphBuffer, srcGlyphBuffer, glyphSize->x * pixelSize );
-						dstGlyphBuffer += imgLineSize * pixelSize;
-						dstGlyphIndex += imgLineSize * pixelSize;
-						srcGlyphBuffer += glyphSize->x * pixelSize;
-					}
-
-					glyphPositions[glyph.getCharacter()] = castor::Position( int32_t( offX ), int32_t( offY ) );
-					offX += maxWidth;
-					++it;
-
-					m_charIndices.try_emplace( glyph.getCharacter(), uint32_t( m_charIndices.size() ) );
-				}
+		doSetSource( resource );
+		m_atlas.beginRefresh();
+	}
 
-				offY -= maxHeight;
-			}
+	void FontTexture::swapResources()
+	{
+		// The texture dimensions change with the front resource only.
+		m_ubo->cpuUpdate( castor::Size{ getResource().resource->getDimensions().width
+				, getResource().resource->getDimensions().height }
+			, m_font->isSDF()
+			, m_font->getPixelRange() );
 
-			resource.needsUpload = true;
+		if ( m_atlas.endRefresh() )
+		{
+			// The atlas has changed again during the refresh.
+			update( true );
 		}
 	}
 
-	void FontTexture::swapResources()
+	void FontTexture::doSetSource( Resource & resource )
 	{
+		auto const format = fonttex::getFormat( *m_font );
+		resource.resource->setSource( castor::PxBufferBase::create( m_atlas.getSize()
+				, format
+				, m_atlas.getData().data()
+				, format )
+			, true );
+		resource.needsUpload = true;
 	}
 
 	//*********************************************************************************************
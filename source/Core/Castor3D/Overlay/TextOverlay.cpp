@@ -168,6 +168,14 @@ namespace castor3d
 		m_displayable = false;
 	}
 
+	TextOverlay::~TextOverlay()noexcept
+	{
+		if ( m_fontTexture )
+		{
+			m_fontTexture->releaseGlyphs( m_usedCaption );
+		}
+	}
+
 	OverlayCategoryUPtr TextOverlay::create()
 	{
 		return castor::makeUniqueDerived< OverlayCategory, TextOverlay >();
@@ -385,6 +393,13 @@ namespace castor3d
 			}
 
 			m_connection.disconnect();
+
+			if ( m_fontTexture )
+			{
+				m_fontTexture->releaseGlyphs( m_usedCaption );
+				m_usedCaption.clear();
+			}
+
 			m_fontTexture = fontTexture;
 			m_connection = fontTexture->onResourceChanged.connect( [this]( DoubleBufferedTextureLayout const & )
 			{
@@ -436,14 +451,14 @@ namespace castor3d
 
 		if ( !newCaption.empty() )
 		{
-			for ( auto c : newCaption )
-			{
-				font->loadGlyph( c );
-			}
-
-			fontTexture->update( true );
+			font->loadGlyphs( newCaption, &m_overlay->getEngine()->getCpuJobs() );
 		}
 
+		// The new caption's glyphs are referenced before the previous ones are released, so that the common ones stay in the atlas.
+		fontTexture->useGlyphs( m_currentCaption );
+		fontTexture->releaseGlyphs( m_usedCaption );
+		m_usedCaption = m_currentCaption;
+
 		if ( !m_currentCaption.empty() )
 		{
 			m_previousCaption = m_currentCaption;
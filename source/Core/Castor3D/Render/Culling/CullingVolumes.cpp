@@ -0,0 +1,374 @@
+#include "Castor3D/Render/Culling/CullingVolumes.hpp"
+
+#include <CastorUtils/Miscellaneous/CpuInformations.hpp>
+
+#if CU_SimdSSE2
+#	include <emmintrin.h>
+#	include <immintrin.h>
+#endif
+
+#if CU_SimdNEON
+#	include <arm_neon.h>
+#endif
+
+#if CU_SimdSSE2 && ( defined( CU_CompilerMSVC ) || defined( CU_CompilerGNUC ) )
+#	define C3D_CullingAVX2 1
+#	if defined( CU_CompilerGNUC )
+#		define C3D_TargetAVX2 __attribute__( ( target( "avx2" ) ) )
+#	else
+#		define C3D_TargetAVX2
+#	endif
+#else
+#	define C3D_CullingAVX2 0
+#endif
+
+namespace castor3d
+{
+	//*********************************************************************************************
+
+	namespace cullvol
+	{
+		struct PlaneData
+		{
+			float nx;
+			float ny;
+			float nz;
+			float d;
+			// The box's positive vertex components, relative to the plane normal.
+			float const * px;
+			float const * py;
+			float const * pz;
+		};
+
+		using PlanesData = castor::Array< PlaneData, size_t( FrustumPlane::eCount ) >;
+
+		static PlanesData makePlanesData( Frustum::Planes const & planes
+			, CullingVolumes const & volumes )
+		{
+			PlanesData result{};
+			auto it = result.begin();
+
+			for ( auto & plane : planes )
+			{
+				auto & normal = plane.getNormal();
+				*it = { normal->x, normal->y, normal->z, plane.getDistance()
+					, ( normal->x >= 0.0f ? volumes.maxX.data() : volumes.minX.data() )
+					, ( normal->y >= 0.0f ? volumes.maxY.data() : volumes.minY.data() )
+					, ( normal->z >= 0.0f ? volumes.maxZ.data() : volumes.minZ.data() ) };
+				++it;
+			}
+
+			return result;
+		}
+
+		// The operations order matches PlaneEquation::distance, to get the same results in all kernels.
+
+		static void cullScalar( PlanesData const & planes
+			, CullingVolumes const & volumes
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			for ( auto i = begin; i < end; ++i )
+			{
+				auto radius = -volumes.radius[i];
+				bool result = true;
+
+				for ( auto & plane : planes )
+				{
+					auto sphereDist = plane.nx * volumes.centerX[i] + plane.ny * volumes.centerY[i] + plane.nz * volumes.centerZ[i] + plane.d;
+					auto boxDist = plane.nx * plane.px[i] + plane.ny * plane.py[i] + plane.nz * plane.pz[i] + plane.d;
+					result = result
+						&& sphereDist >= radius
+						&& boxDist >= 0.0f;
+				}
+
+				visible[i - begin] = result ? 1u : 0u;
+			}
+		}
+
+#if CU_SimdSSE2
+
+		static void cullSSE2( PlanesData const & planes
+			, CullingVolumes const & volumes
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			auto const zero = _mm_setzero_ps();
+			auto const sign = _mm_set1_ps( -0.0f );
+			auto i = begin;
+
+			for ( ; i + 4u <= end; i += 4u )
+			{
+				auto cx = _mm_loadu_ps( volumes.centerX.data() + i );
+				auto cy = _mm_loadu_ps( volumes.centerY.data() + i );
+				auto cz = _mm_loadu_ps( volumes.centerZ.data() + i );
+				auto radius = _mm_xor_ps( _mm_loadu_ps( volumes.radius.data() + i ), sign );
+				auto mask = _mm_cmpeq_ps( zero, zero );
+
+				for ( auto & plane : planes )
+				{
+					auto nx = _mm_set1_ps( plane.nx );
+					auto ny = _mm_set1_ps( plane.ny );
+					auto nz = _mm_set1_ps( plane.nz );
+					auto d = _mm_set1_ps( plane.d );
+					auto sphereDist = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( nx, cx )
+						, _mm_mul_ps( ny, cy ) )
+						, _mm_mul_ps( nz, cz ) )
+						, d );
+					auto boxDist = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( nx, _mm_loadu_ps( plane.px + i ) )
+						, _mm_mul_ps( ny, _mm_loadu_ps( plane.py + i ) ) )
+						, _mm_mul_ps( nz, _mm_loadu_ps( plane.pz + i ) ) )
+						, d );
+					mask = _mm_and_ps( mask
+						, _mm_and_ps( _mm_cmpge_ps( sphereDist, radius )
+							, _mm_cmpge_ps( boxDist, zero ) ) );
+				}
+
+				auto bits = uint32_t( _mm_movemask_ps( mask ) );
+
+				for ( uint32_t lane = 0u; lane < 4u; ++lane )
+				{
+					visible[i - begin + lane] = uint8_t( ( bits >> lane ) & 0x01u );
+				}
+			}
+
+			cullScalar( planes, volumes, i, end, visible + ( i - begin ) );
+		}
+
+#endif
+#if C3D_CullingAVX2
+
+		C3D_TargetAVX2 static void cullAVX2( PlanesData const & planes
+			, CullingVolumes const & volumes
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			auto const zero = _mm256_setzero_ps();
+			auto const sign = _mm256_set1_ps( -0.0f );
+			auto i = begin;
+
+			for ( ; i + 8u <= end; i += 8u )
+			{
+				auto cx = _mm256_loadu_ps( volumes.centerX.data() + i );
+				auto cy = _mm256_loadu_ps( volumes.centerY.data() + i );
+				auto cz = _mm256_loadu_ps( volumes.centerZ.data() + i );
+				auto radius = _mm256_xor_ps( _mm256_loadu_ps( volumes.radius.data() + i ), sign );
+				auto mask = _mm256_cmp_ps( zero, zero, _CMP_EQ_OQ );
+
+				for ( auto & plane : planes )
+				{
+					auto nx = _mm256_set1_ps( plane.nx );
+					auto ny = _mm256_set1_ps( plane.ny );
+					auto nz = _mm256_set1_ps( plane.nz );
+					auto d = _mm256_set1_ps( plane.d );
+					auto sphereDist = _mm256_add_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( nx, cx )
+						, _mm256_mul_ps( ny, cy ) )
+						, _mm256_mul_ps( nz, cz ) )
+						, d );
+					auto boxDist = _mm256_add_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( nx, _mm256_loadu_ps( plane.px + i ) )
+						, _mm256_mul_ps( ny, _mm256_loadu_ps( plane.py + i ) ) )
+						, _mm256_mul_ps( nz, _mm256_loadu_ps( plane.pz + i ) ) )
+						, d );
+					mask = _mm256_and_ps( mask
+						, _mm256_and_ps( _mm256_cmp_ps( sphereDist, radius, _CMP_GE_OQ )
+							, _mm256_cmp_ps( boxDist, zero, _CMP_GE_OQ ) ) );
+				}
+
+				auto bits = uint32_t( _mm256_movemask_ps( mask ) );
+
+				for ( uint32_t lane = 0u; lane < 8u; ++lane )
+				{
+					visible[i - begin + lane] = uint8_t( ( bits >> lane ) & 0x01u );
+				}
+			}
+
+			cullScalar( planes, volumes, i, end, visible + ( i - begin ) );
+		}
+
+#endif
+#if CU_SimdNEON
+
+		static void cullNEON( PlanesData const & planes
+			, CullingVolumes const & volumes
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			auto const zero = vdupq_n_f32( 0.0f );
+			auto i = begin;
+
+			for ( ; i + 4u <= end; i += 4u )
+			{
+				auto cx = vld1q_f32( volumes.centerX.data() + i );
+				auto cy = vld1q_f32( volumes.centerY.data() + i );
+				auto cz = vld1q_f32( volumes.centerZ.data() + i );
+				auto radius = vnegq_f32( vld1q_f32( volumes.radius.data() + i ) );
+				auto mask = vdupq_n_u32( ~0u );
+
+				for ( auto & plane : planes )
+				{
+					auto nx = vdupq_n_f32( plane.nx );
+					auto ny = vdupq_n_f32( plane.ny );
+					auto nz = vdupq_n_f32( plane.nz );
+					auto d = vdupq_n_f32( plane.d );
+					// No multiply-accumulate, to keep the scalar rounding.
+					auto sphereDist = vaddq_f32( vaddq_f32( vaddq_f32( vmulq_f32( nx, cx )
+						, vmulq_f32( ny, cy ) )
+						, vmulq_f32( nz, cz ) )
+						, d );
+					auto boxDist = vaddq_f32( vaddq_f32( vaddq_f32( vmulq_f32( nx, vld1q_f32( plane.px + i ) )
+						, vmulq_f32( ny, vld1q_f32( plane.py + i ) ) )
+						, vmulq_f32( nz, vld1q_f32( plane.pz + i ) ) )
+						, d );
+					mask = vandq_u32( mask
+						, vandq_u32( vcgeq_f32( sphereDist, radius )
+							, vcgeq_f32( boxDist, zero ) ) );
+				}
+
+				visible[i - begin + 0u] = uint8_t( vgetq_lane_u32( mask, 0 ) & 0x01u );
+				visible[i - begin + 1u] = uint8_t( vgetq_lane_u32( mask, 1 ) & 0x01u );
+				visible[i - begin + 2u] = uint8_t( vgetq_lane_u32( mask, 2 ) & 0x01u );
+				visible[i - begin + 3u] = uint8_t( vgetq_lane_u32( mask, 3 ) & 0x01u );
+			}
+
+			cullScalar( planes, volumes, i, end, visible + ( i - begin ) );
+		}
+
+#endif
+	}
+
+	//*********************************************************************************************
+
+	void CullingVolumes::resize( size_t count )
+	{
+		centerX.resize( count );
+		centerY.resize( count );
+		centerZ.resize( count );
+		radius.resize( count );
+		minX.resize( count );
+		minY.resize( count );
+		minZ.resize( count );
+		maxX.resize( count );
+		maxY.resize( count );
+		maxZ.resize( count );
+	}
+
+	void CullingVolumes::set( size_t index
+		, castor::BoundingSphere const & sphere
+		, castor::BoundingBox const & box
+		, castor::Matrix4x4f const & transformations
+		, castor::Point3f const & scale )
+	{
+		auto maxScale = std::max( scale[0], std::max( scale[1], scale[2] ) );
+		castor::Point3f center = transformations * sphere.getCenter();
+		centerX[index] = center->x;
+		centerY[index] = center->y;
+		centerZ[index] = center->z;
+		radius[index] = sphere.getRadius() * maxScale;
+
+		auto aabb = box.getAxisAligned( transformations );
+		auto min = aabb.getMin();
+		auto max = aabb.getMax();
+		minX[index] = min->x;
+		minY[index] = min->y;
+		minZ[index] = min->z;
+		maxX[index] = max->x;
+		maxY[index] = max->y;
+		maxZ[index] = max->z;
+	}
+
+	//*********************************************************************************************
+
+	castor::String getName( CullingKernel value )
+	{
+		switch ( value )
+		{
+		case CullingKernel::eScalar:
+			return cuT( "scalar" );
+		case CullingKernel::eSSE2:
+			return cuT( "sse2" );
+		case CullingKernel::eAVX2:
+			return cuT( "avx2" );
+		case CullingKernel::eNEON:
+			return cuT( "neon" );
+		default:
+			CU_Failure( "Unsupported CullingKernel" );
+			return castor::cuEmptyString;
+		}
+	}
+
+	bool isSupported( CullingKernel kernel )
+	{
+		castor::CpuInformations cpu;
+
+		switch ( kernel )
+		{
+		case CullingKernel::eScalar:
+			return true;
+		case CullingKernel::eSSE2:
+			return CU_SimdSSE2 && cpu.hasSSE2();
+		case CullingKernel::eAVX2:
+			return C3D_CullingAVX2 && cpu.hasAVX2();
+		case CullingKernel::eNEON:
+			return CU_SimdNEON && cpu.hasNEON();
+		default:
+			return false;
+		}
+	}
+
+	CullingKernel getBestCullingKernel()
+	{
+		static CullingKernel const result = []()
+		{
+			for ( auto kernel : { CullingKernel::eAVX2, CullingKernel::eSSE2, CullingKernel::eNEON } )
+			{
+				if ( isSupported( kernel ) )
+				{
+					return kernel;
+				}
+			}
+
+			return CullingKernel::eScalar;
+		}();
+		return result;
+	}
+
+	void cullVolumes( Frustum::Planes const & planes
+		, CullingVolumes const & volumes
+		, size_t begin
+		, size_t end
+		, uint8_t * visible
+		, CullingKernel kernel )
+	{
+		CU_Require( isSupported( kernel ) );
+		CU_Require( end <= volumes.size() );
+		auto planesData = cullvol::makePlanesData( planes, volumes );
+
+		switch ( kernel )
+		{
+#if CU_SimdSSE2
+		case CullingKernel::eSSE2:
+			cullvol::cullSSE2( planesData, volumes, begin, end, visible );
+			break;
+#endif
+#if C3D_CullingAVX2
+		case CullingKernel::eAVX2:
+			cullvol::cullAVX2( planesData, volumes, begin, end, visible );
+			break;
+#endif
+#if CU_SimdNEON
+		case CullingKernel::eNEON:
+			cullvol::cullNEON( planesData, volumes, begin, end, visible );
+			break;
+#endif
+		default:
+			cullvol::cullScalar( planesData, volumes, begin, end, visible );
+			break;
+		}
+	}
+
+	//*********************************************************************************************
+}
@@ -1,8 +1,10 @@
 #include "Castor3D/Render/Culling/FrustumCuller.hpp"
 
+#include "Castor3D/Engine.hpp"
 #include "Castor3D/Material/Material.hpp"
 #include "Castor3D/Material/Pass/Pass.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Render/Frustum.hpp"
 #include "Castor3D/Render/Node/BillboardRenderNode.hpp"
 #include "Castor3D/Render/Node/SceneRenderNodes.hpp"
 #include "Castor3D/Render/Node/SubmeshRenderNode.hpp"
@@ -14,6 +16,52 @@
 
 namespace castor3d
 {
+	namespace frcull
+	{
+		// Below this count, the batch path is not worth the gathering.
+		static size_t constexpr MinBatchCount = 256u;
+		static size_t constexpr BatchGrain = 1024u;
+
+		enum NodeState : uint8_t
+		{
+			eHidden,
+			eVisible,
+			eTested,
+		};
+
+		// Same checks as isSubmeshVisible, the bounding volumes test is deferred to the batch.
+		static NodeState gatherVolumes( SubmeshRenderNode const & node
+			, size_t index
+			, CullingVolumes & volumes )
+		{
+			if ( !node.instance.isCullable() )
+			{
+				return eVisible;
+			}
+
+			auto sceneNode = node.instance.getParent();
+
+			if ( !sceneNode
+				|| !sceneNode->isDisplayable()
+				|| !sceneNode->isVisible() )
+			{
+				return eHidden;
+			}
+
+			if ( node.data.getInstantiation().isInstanced( *node.pass ) )
+			{
+				return eVisible;
+			}
+
+			volumes.set( index
+				, node.instance.getBoundingSphere( node.data )
+				, node.instance.getBoundingBox( node.data )
+				, node.instance.getGlobalTransform()
+				, sceneNode->getDerivedScale() );
+			return eTested;
+		}
+	}
+
 	FrustumCuller::FrustumCuller( Scene & scene
 		, Camera & camera
 		, std::optional< bool > isStatic )
@@ -52,4 +100,40 @@ namespace castor3d
 		return !node.instance.isCullable()
 			|| isVisible( hasCamera() ? getCamera().getFrustum() : *m_frustum, node );
 	}
+
+	void FrustumCuller::areSubmeshesVisible( NodeArrayT< SubmeshRenderNode, CulledNodePtrT > const & nodes
+		, castor::Vector< uint8_t > & result )const
+	{
+		// When frustum culling is disabled, the per node checks must decide alone, as the batch would test the volumes.
+		if ( C3D_DisableFrustumCulling
+			|| nodes.size() < frcull::MinBatchCount )
+		{
+			SceneCuller::areSubmeshesVisible( nodes, result );
+			return;
+		}
+
+		auto & planes = ( hasCamera() ? getCamera().getFrustum() : *m_frustum ).getPlanes();
+		result.resize( nodes.size() );
+		m_states.resize( nodes.size() );
+		m_volumes.resize( nodes.size() );
+		getScene().getEngine()->getFrameJobs().parallelFor( nodes.size()
+			, [this, &nodes, &planes, &result]( size_t begin, size_t end )
+			{
+				for ( auto i = begin; i < end; ++i )
+				{
+					m_states[i] = frcull::gatherVolumes( *nodes[i]->node, i, m_volumes );
+				}
+
+				cullVolumes( planes, m_volumes, begin, end, result.data() + begin, m_kernel );
+
+				for ( auto i = begin; i < end; ++i )
+				{
+					if ( m_states[i] != frcull::eTested )
+					{
+						result[i] = m_states[i] == frcull::eVisible ? 1u : 0u;
+					}
+				}
+			}
+			, frcull::BatchGrain );
+	}
 }
@@ -57,6 +57,69 @@ namespace castor3d
 			return frustum.isVisible( instance.getBoundingBox( data )
 				, instance.getGlobalTransform() );
 		}
+
+		static bool updateCounts( Camera const * camera
+			, CulledNodeT< SubmeshRenderNode > & culled )
+		{
+			auto & node = *culled.node;
+			auto lod = node.selectLod( camera );
+			auto indexCount = node.getLodIndexCount( lod );
+			auto firstIndex = node.getLodFirstIndex( lod );
+
+			if ( culled.lod == lod
+				&& culled.indexCount == indexCount
+				&& culled.firstIndex == firstIndex
+				&& culled.vertexCount == node.modelData.vertexCount )
+			{
+				return false;
+			}
+
+			culled.lod = lod;
+			culled.indexCount = indexCount;
+			culled.firstIndex = firstIndex;
+			culled.vertexCount = node.modelData.vertexCount;
+			return true;
+		}
+
+		template< typename NodeT >
+		static CulledNodeT< NodeT > * findCulled( NodeArrayT< NodeT, CulledNodePtrT > const & culled
+			, castor::UnorderedMap< NodeT const *, size_t > const & indices
+			, NodeT const * node )
+		{
+			auto it = indices.find( node );
+			return it == indices.end()
+				? nullptr
+				: culled[it->second].get();
+		}
+
+		template< typename NodeT >
+		static CulledNodeT< NodeT > & addCulled( NodeArrayT< NodeT, CulledNodePtrT > & culled
+			, castor::UnorderedMap< NodeT const *, size_t > & indices
+			, CulledNodePtrT< NodeT > node )
+		{
+			indices.emplace( node->node, culled.size() );
+			culled.emplace_back( castor::move( node ) );
+			return *culled.back();
+		}
+
+		template< typename NodeT >
+		static void removeCulled( NodeArrayT< NodeT, CulledNodePtrT > & culled
+			, castor::UnorderedMap< NodeT const *, size_t > & indices
+			, NodeT const * node )
+		{
+			auto it = indices.find( node );
+			auto index = it->second;
+			indices.erase( it );
+
+			// Swap and pop, the moved node's slot is updated.
+			if ( index != culled.size() - 1u )
+			{
+				culled[index] = castor::move( culled.back() );
+				indices[culled[index]->node] = index;
+			}
+
+			culled.pop_back();
+		}
 	}
 
 	//*********************************************************************************************
@@ -192,33 +255,19 @@ namespace castor3d
 
 	void SceneCuller::removeCulled( SubmeshRenderNode const & node )
 	{
-		auto it = std::find_if( m_culledSubmeshes.begin()
-			, m_culledSubmeshes.end()
-			, [&node]( CulledNodePtrT< SubmeshRenderNode > const & lookup )
-			{
-				return &node == lookup->node;
-			} );
-
-		if ( m_culledSubmeshes.end() != it )
+		if ( auto culled = cull::findCulled( m_culledSubmeshes, m_submeshIndices, &node ) )
 		{
-			onSubmeshRemoved( *this, **it, false );
-			m_culledSubmeshes.erase( it );
+			onSubmeshRemoved( *this, *culled, false );
+			cull::removeCulled( m_culledSubmeshes, m_submeshIndices, &node );
 		}
 	}
 
 	void SceneCuller::removeCulled( BillboardRenderNode const & node )
 	{
-		auto it = std::find_if( m_culledBillboards.begin()
-			, m_culledBillboards.end()
-			, [&node]( CulledNodePtrT< BillboardRenderNode > const & lookup )
-			{
-				return &node == lookup->node;
-			} );
-
-		if ( m_culledBillboards.end() != it )
+		if ( auto culled = cull::findCulled( m_culledBillboards, m_billboardIndices, &node ) )
 		{
-			onBillboardRemoved( *this, **it, false );
-			m_culledBillboards.erase( it );
+			onBillboardRemoved( *this, *culled, false );
+			cull::removeCulled( m_culledBillboards, m_billboardIndices, &node );
 		}
 	}
 
@@ -232,6 +281,8 @@ namespace castor3d
 			m_culledChanged = true;
 			m_culledSubmeshes.clear();
 			m_culledBillboards.clear();
+			m_submeshIndices.clear();
+			m_billboardIndices.clear();
 		}
 	}
 
@@ -248,9 +299,12 @@ namespace castor3d
 			if ( m_isStatic == std::nullopt
 				|| node->instance.getParent()->isStatic() == m_isStatic )
 			{
-				m_culledSubmeshes.emplace_back( castor::make_unique< CulledNodeT< SubmeshRenderNode > >( node.get()
-					, node->getInstanceCount()
-					, isSubmeshVisible( *node ) ) );
+				cull::updateCounts( m_camera
+					, cull::addCulled( m_culledSubmeshes
+						, m_submeshIndices
+						, castor::make_unique< CulledNodeT< SubmeshRenderNode > >( node.get()
+							, node->getInstanceCount()
+							, isSubmeshVisible( *node ) ) ) );
 			}
 
 			++m_total.objectCount;
@@ -263,9 +317,11 @@ namespace castor3d
 			if ( m_isStatic == std::nullopt
 				|| node->instance.getNode()->isStatic() == m_isStatic )
 			{
-				m_culledBillboards.emplace_back( castor::make_unique< CulledNodeT< BillboardRenderNode > >( node.get()
-					, node->getInstanceCount()
-					, isBillboardVisible( *node ) ) );
+				cull::addCulled( m_culledBillboards
+					, m_billboardIndices
+					, castor::make_unique< CulledNodeT< BillboardRenderNode > >( node.get()
+						, node->getInstanceCount()
+						, isBillboardVisible( *node ) ) );
 			}
 
 			++m_total.billboardCount;
@@ -287,21 +343,23 @@ namespace castor3d
 #if C3D_DebugTimers
 			auto blockCompute( m_timerCompute->start() );
 #endif
+			areSubmeshesVisible( m_culledSubmeshes, m_submeshesVisibility );
+			auto visibleIt = m_submeshesVisibility.begin();
+
 			for ( auto const & culled : m_culledSubmeshes )
 			{
-				auto visible = isSubmeshVisible( *culled->node );
+				auto visible = *visibleIt != 0u;
 				auto count = culled->node->getInstanceCount();
+				++visibleIt;
 
-				if ( culled->visible != visible
+				if ( auto countsChanged = cull::updateCounts( m_camera, *culled );
+					culled->visible != visible
 					|| culled->instanceCount != count
-					|| culled->vertexCount != culled->node->modelData.vertexCount
-					|| culled->indexCount != culled->node->modelData.indexCount )
+					|| countsChanged )
 				{
 					m_culledChanged = true;
 					culled->visible = visible;
 					culled->instanceCount = count;
-					culled->indexCount = culled->node->modelData.indexCount;
-					culled->vertexCount = culled->node->modelData.vertexCount;
 					onSubmeshChanged( *this, *culled, visible );
 				}
 			}
@@ -363,37 +421,31 @@ namespace castor3d
 	{
 		for ( auto dirty : dirtySubmeshes )
 		{
-			auto it = std::find_if( m_culledSubmeshes.begin()
-				, m_culledSubmeshes.end()
-				, [dirty]( CulledNodePtrT< SubmeshRenderNode > const & lookup )
-				{
-					return lookup->node == dirty;
-				} );
+			auto culled = cull::findCulled( m_culledSubmeshes, m_submeshIndices, dirty );
 			auto visible = isSubmeshVisible( *dirty );
 			auto count = dirty->getInstanceCount();
 
-			if ( it != m_culledSubmeshes.end() )
+			if ( culled )
 			{
-				auto const & culled = *it;
-
-				if ( culled->visible != visible
+				if ( auto countsChanged = cull::updateCounts( m_camera, *culled );
+					culled->visible != visible
 					|| culled->instanceCount != count
-					|| culled->vertexCount != culled->node->modelData.vertexCount
-					|| culled->indexCount != culled->node->modelData.indexCount )
+					|| countsChanged )
 				{
 					m_culledChanged = true;
 					culled->visible = visible;
 					culled->instanceCount = count;
-					culled->indexCount = culled->node->modelData.indexCount;
-					culled->vertexCount = culled->node->modelData.vertexCount;
 					onSubmeshChanged( *this, *culled, visible );
 				}
 			}
 			else
 			{
 				m_culledChanged = true;
-				m_culledSubmeshes.emplace_back( castor::make_unique< CulledNodeT< SubmeshRenderNode > >( dirty, 1u, visible ) );
-				onSubmeshChanged( *this, *m_culledSubmeshes.back(), visible );
+				auto & added = cull::addCulled( m_culledSubmeshes
+					, m_submeshIndices
+					, castor::make_unique< CulledNodeT< SubmeshRenderNode > >( dirty, 1u, visible ) );
+				cull::updateCounts( m_camera, added );
+				onSubmeshChanged( *this, added, visible );
 			}
 		}
 	}
@@ -402,19 +454,12 @@ namespace castor3d
 	{
 		for ( auto dirty : dirtyBillboards )
 		{
-			auto it = std::find_if( m_culledBillboards.begin()
-				, m_culledBillboards.end()
-				, [dirty]( CulledNodePtrT< BillboardRenderNode > const & lookup )
-				{
-					return lookup->node == dirty;
-				} );
+			auto culled = cull::findCulled( m_culledBillboards, m_billboardIndices, dirty );
 			auto visible = isBillboardVisible( *dirty );
 			auto count = dirty->getInstanceCount();
 
-			if ( it != m_culledBillboards.end() )
+			if ( culled )
 			{
-				auto const & culled = *it;
-
 				if ( culled->visible != visible
 					|| culled->instanceCount != count )
 				{
@@ -427,12 +472,28 @@ namespace castor3d
 			else
 			{
 				m_culledChanged = true;
-				m_culledBillboards.emplace_back( castor::make_unique< CulledNodeT< BillboardRenderNode > >( dirty, count, visible ) );
-				onBillboardChanged( *this, *m_culledBillboards.back(), visible );
+				onBillboardChanged( *this
+					, cull::addCulled( m_culledBillboards
+						, m_billboardIndices
+						, castor::make_unique< CulledNodeT< BillboardRenderNode > >( dirty, count, visible ) )
+					, visible );
 			}
 		}
 	}
 
+	void SceneCuller::areSubmeshesVisible( NodeArrayT< SubmeshRenderNode, CulledNodePtrT > const & nodes
+		, castor::Vector< uint8_t > & result )const
+	{
+		result.resize( nodes.size() );
+		auto it = result.begin();
+
+		for ( auto const & culled : nodes )
+		{
+			*it = isSubmeshVisible( *culled->node ) ? 1u : 0u;
+			++it;
+		}
+	}
+
 	void SceneCuller::doMakeDirty( Geometry const & object
 		, castor::Vector< SubmeshRenderNode const * > & dirtySubmeshes )const
 	{
@@ -12,8 +12,6 @@ namespace castor3d
 {
 	namespace rendfrust
 	{
-		static bool constexpr C3D_DisableFrustumCulling = false;
-
 		static void updatePoints( castor::Matrix4x4f const & viewProj
 			, castor::Array< InterleavedVertex, 8u > & points )
 		{
@@ -55,7 +53,7 @@ namespace castor3d
 	void Frustum::update( castor::Matrix4x4f const & projection
 		, castor::Matrix4x4f const & view )
 	{
-		if constexpr ( !rendfrust::C3D_DisableFrustumCulling )
+		if constexpr ( !C3D_DisableFrustumCulling )
 		{
 			auto const vp = projection * view;
 			castor::Array< castor::Point4f, size_t( FrustumPlane::eCount ) > points;
@@ -117,7 +115,7 @@ namespace castor3d
 	bool Frustum::isVisible( castor::BoundingBox const & box
 		, castor::Matrix4x4f const & transformations )const
 	{
-		if constexpr ( rendfrust::C3D_DisableFrustumCulling )
+		if constexpr ( C3D_DisableFrustumCulling )
 		{
 			return true;
 		}
@@ -138,7 +136,7 @@ namespace castor3d
 		, castor::Matrix4x4f const & transformations
 		, castor::Point3f const & scale)const
 	{
-		if constexpr ( rendfrust::C3D_DisableFrustumCulling )
+		if constexpr ( C3D_DisableFrustumCulling )
 		{
 			return true;
 		}
@@ -159,7 +157,7 @@ namespace castor3d
 
 	bool Frustum::isVisible( castor::Point3f const & point )const
 	{
-		if constexpr ( rendfrust::C3D_DisableFrustumCulling )
+		if constexpr ( C3D_DisableFrustumCulling )
 		{
 			return true;
 		}
@@ -351,12 +351,12 @@ namespace castor3d
 							, pipelineID
 							, writer.cast< sdw::UInt >( getEngine()->getRenderDevice()->hasDrawId() ? in.drawID : drawID )
 							, flags ) );
-					auto curPosition = writer.declLocale( "curPosition"
-						, in.position );
-					auto curNormal = writer.declLocale( "curNormal"
-						, in.normal );
 					auto modelData = writer.declLocale( "modelData"
 						, c3d_modelsData[nodeId - 1u] );
+					auto curPosition = writer.declLocale( "curPosition"
+						, modelData.unpackPosition( flags, in.position ) );
+					auto curNormal = writer.declLocale( "curNormal"
+						, in.getNormal( flags, utils ) );
 					auto material = writer.declLocale( "material"
 						, materials.getMaterial( modelData.getMaterialId() ) );
 					out.nodeId = nodeId;
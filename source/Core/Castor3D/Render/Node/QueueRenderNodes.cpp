@@ -25,14 +25,17 @@
 #include "Castor3D/Render/Node/SceneRenderNodes.hpp"
 #include "Castor3D/Render/Node/SubmeshRenderNode.hpp"
 #include "Castor3D/Scene/BillboardList.hpp"
+#include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
 #include "Castor3D/Scene/Scene.hpp"
+#include "Castor3D/Scene/SceneNode.hpp"
 #include "Castor3D/Scene/Animation/AnimatedMesh.hpp"
 #include "Castor3D/Scene/Animation/AnimatedObjectGroup.hpp"
 #include "Castor3D/Scene/Animation/AnimatedSkeleton.hpp"
 
 #include <CastorUtils/Miscellaneous/BlockTimer.hpp>
 #include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Multithreading/JobSystem.hpp>
 
 #include <RenderGraph/RecordContext.hpp>
 #include <RenderGraph/RunnablePass.hpp>
@@ -62,14 +65,14 @@ namespace castor3d
 		}
 
 		static VkDrawIndexedIndirectCommand getCommand( ObjectBufferOffset const & bufferOffsets
-			, ObjectBufferOffset::GpuBufferChunk const & bufferChunk
+			, ObjectBufferOffset::GpuBufferChunk const &
 			, CulledNodeT< SubmeshRenderNode > const & culled )
 		{
 			auto & indexOffset = bufferOffsets.getBufferChunk( SubmeshData::eIndex );
 			return VkDrawIndexedIndirectCommand{ .indexCount = indexOffset.hasData() ? culled.indexCount : culled.vertexCount
 				, .instanceCount = culled.instanceCount
-				, .firstIndex = indexOffset.hasData() ? indexOffset.getFirst< uint32_t >() : 0u
-				, .vertexOffset = int32_t( bufferChunk.getFirst< castor::Point4f >() )
+				, .firstIndex = indexOffset.hasData() ? indexOffset.getFirst< uint32_t >() + culled.firstIndex : 0u
+				, .vertexOffset = int32_t( culled.node->getFinalBufferOffsets().getFirstVertex() )
 				, .firstInstance = 0u };
 		}
 
@@ -125,6 +128,49 @@ namespace castor3d
 			return it != nodes.end() ? &( *it ) : nullptr;
 		}
 
+		static castor::Point3f getNodePosition( SubmeshRenderNode const & node )
+		{
+			return node.instance.getParent()->getDerivedPosition();
+		}
+
+		static castor::Point3f getNodePosition( BillboardRenderNode const & node )
+		{
+			return node.instance.getNode()->getDerivedPosition();
+		}
+
+		template< typename NodeT >
+		static void sortRenderedNodes( RenderNodesPass const & renderPass
+			, SceneCuller const & culler
+			, PipelinesNodesT< NodeT > const & nodes
+			, bool nodesChanged
+			, SortedNodesT< NodeT > & sorted )
+		{
+			if ( !culler.hasCamera() )
+			{
+				// No view to sort against, the nodes are only sorted by pipeline, buffer and pass.
+				sorted.update( nodes
+					, nodesChanged
+					, []( RenderedNodeT< NodeT > const & )
+					{
+						return 0u;
+					} );
+				return;
+			}
+
+			auto rendersBlended = !checkFlag( renderPass.getRenderFilters(), RenderFilter::eAlphaBlend );
+			auto position = culler.getCamera().getParent()->getDerivedPosition();
+			// Opaque nodes are drawn front to back, to benefit from early depth test,
+			// blended ones back to front.
+			sorted.update( nodes
+				, nodesChanged
+				, [rendersBlended, &position]( RenderedNodeT< NodeT > const & node )
+				{
+					auto & renderNode = *node.node;
+					return SortedNodesT< NodeT >::quantiseDepth( float( castor::point::distanceSquared( position, getNodePosition( renderNode ) ) )
+						, rendersBlended && renderNode.pass->getPassFlags().hasAlphaBlendingFlag );
+				} );
+		}
+
 		static bool hasVisibleInstance( castor::UnorderedSet< Geometry const * > const & instances )
 		{
 			return std::any_of( instances.begin()
@@ -143,7 +189,9 @@ namespace castor3d
 			, ashes::Optional< VkRect2D > const & scissor
 			, bool hasDrawId )
 		{
-			commandBuffer.bindPipeline( pipeline.getPipeline() );
+			pipeline.getRenderSystem().getRenderDevice()->vkCmdBindPipeline( commandBuffer
+				, VK_PIPELINE_BIND_POINT_GRAPHICS
+				, pipeline.getPipeline() );
 
 			if ( viewport )
 			{
@@ -257,7 +305,7 @@ namespace castor3d
 				commandBuffer.drawIndexed( node.command.indexCount
 					, instanceCount
 					, geometryBuffers.indexOffset.getFirst< uint32_t >()
-					, node.node->getFinalBufferOffsets().getBufferChunk( SubmeshData::ePositions ).getFirst< castor::Point4f >()
+					, node.node->getFinalBufferOffsets().getFirstVertex()
 					, 0u );
 				++idxIndex;
 			}
@@ -265,7 +313,7 @@ namespace castor3d
 			{
 				commandBuffer.draw( node.command.indexCount
 					, instanceCount
-					, node.node->getFinalBufferOffsets().getBufferChunk( SubmeshData::ePositions ).getFirst< castor::Point4f >()
+					, node.node->getFinalBufferOffsets().getFirstVertex()
 					, 0u );
 				++nidxIndex;
 			}
@@ -549,6 +597,140 @@ namespace castor3d
 
 #endif
 
+		//*****************************************************************************************
+
+		static void addCounts( RenderCounts & lhs
+			, RenderCounts const & rhs )
+		{
+			lhs.objectCount += rhs.objectCount;
+			lhs.faceCount += rhs.faceCount;
+			lhs.vertexCount += rhs.vertexCount;
+			lhs.billboardCount += rhs.billboardCount;
+		}
+
+		static void countNodeCommands( RenderedNodeT< SubmeshRenderNode > const & node
+			, bool meshlets
+			, IndirectCommandsBatch & batch )
+		{
+			auto instanceCount = node.node->getInstanceCount();
+
+			if ( meshlets && node.node->data.getMeshletsCount() )
+			{
+				batch.mshOffset += node.node->data.isDynamic() ? 1u : instanceCount;
+			}
+			else if ( node.node->getSourceBufferOffsets().hasData( SubmeshData::eIndex ) )
+			{
+				++batch.idxOffset;
+			}
+			else
+			{
+				++batch.nidxOffset;
+			}
+
+			batch.visible.objectCount += instanceCount;
+			batch.visible.faceCount += node.node->data.getFaceCount() * instanceCount;
+			batch.visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
+		}
+
+		static void countNodeCommands( RenderedNodeT< BillboardRenderNode > const & node
+			, bool
+			, IndirectCommandsBatch & batch )
+		{
+			++batch.nidxOffset;
+			batch.visible.billboardCount += node.node->data.getCount();
+		}
+
+		// Returns the batch covering all the nodes, its offsets being the commands counts.
+		template< typename NodeT, typename FillerT >
+		static IndirectCommandsBatch fillIndirectCommands( castor::JobSystem & jobs
+			, castor::Vector< typename SortedNodesT< NodeT >::NodesRange > const & ranges
+			, PipelineBufferArray const & nodesIds
+			, PipelineNodes * nodesIdsBuffer
+			, VkDeviceSize maxNodesCount
+			, bool meshShading
+			, castor::Vector< IndirectCommandsBatch > & batches
+			, FillerT fill )
+		{
+			batches.clear();
+
+			for ( uint32_t rangeIndex = 0u; rangeIndex < ranges.size(); ++rangeIndex )
+			{
+				auto const & range = ranges[rangeIndex];
+				auto count = uint32_t( range.nodes.size() );
+				auto & pipelineNodes = getPipelineNodes( range.pipeline->pipeline.pipeline->getFlagsHash()
+					, *range.buffer
+					, nodesIds
+					, nodesIdsBuffer
+					, maxNodesCount );
+				CU_Require( count <= pipelineNodes.size() );
+				addIndirectCommandsBatches( rangeIndex, count, pipelineNodes.data(), batches );
+			}
+
+			return fillIndirectCommandsBatches( jobs
+				, batches
+				, [&ranges, meshShading]( IndirectCommandsBatch & batch )
+				{
+					auto const & range = ranges[batch.range];
+					auto meshlets = meshShading
+						&& range.pipeline->pipeline.pipeline->hasMeshletDescriptorSetLayout();
+
+					for ( auto index = batch.first; index < batch.first + batch.count; ++index )
+					{
+						countNodeCommands( *range.nodes[index].node, meshlets, batch );
+					}
+				}
+				, [&ranges, &fill]( IndirectCommandsBatch const & batch )
+				{
+					fill( ranges[batch.range], batch );
+				} );
+		}
+
+#if VK_EXT_mesh_shader || VK_NV_mesh_shader
+
+		// The batch filler for the mesh shading paths, the meshlets nodes of meshlets pipelines go to the mesh tasks commands.
+		template< typename MeshCommandT >
+		static auto makeMeshBatchFiller( MeshCommandT * indirectMshBuffer
+			, VkDrawIndexedIndirectCommand * indirectIdxBuffer
+			, VkDrawIndirectCommand * indirectNIdxBuffer )
+		{
+			return [indirectMshBuffer, indirectIdxBuffer, indirectNIdxBuffer]( SortedNodesT< SubmeshRenderNode >::NodesRange const & range
+				, IndirectCommandsBatch const & batch )
+			{
+				auto batchMshBuffer = indirectMshBuffer + batch.mshOffset;
+				auto batchIdxBuffer = indirectIdxBuffer + batch.idxOffset;
+				auto batchNIdxBuffer = indirectNIdxBuffer + batch.nidxOffset;
+				auto pipelinesBuffer = batch.pipelinesBuffer;
+				auto meshlets = range.pipeline->pipeline.pipeline->hasMeshletDescriptorSetLayout();
+
+				for ( auto index = batch.first; index < batch.first + batch.count; ++index )
+				{
+					auto const & node = *range.nodes[index].node;
+
+					if ( meshlets )
+					{
+						fillNodeIndirectCommands( node
+							, batchMshBuffer
+							, batchIdxBuffer
+							, batchNIdxBuffer
+							, node.node->getInstanceCount()
+							, pipelinesBuffer );
+					}
+					else
+					{
+						fillNodeIndirectCommands( node
+							, batchIdxBuffer
+							, batchNIdxBuffer
+							, node.node->getInstanceCount()
+							, pipelinesBuffer );
+					}
+				}
+			};
+		}
+
+#endif
+
+		//*****************************************************************************************
+
 		static size_t makeHash( SubmeshRenderNode const & node
 			, bool frontCulled )
 		{
@@ -783,6 +965,59 @@ namespace castor3d
 
 	//*************************************************************************************************
 
+	void addIndirectCommandsBatches( uint32_t range
+		, uint32_t count
+		, uint32_t * pipelinesBuffer
+		, castor::Vector< IndirectCommandsBatch > & batches )
+	{
+		for ( uint32_t first = 0u; first < count; first += IndirectCommandsBatchSize )
+		{
+			batches.push_back( { range
+				, first
+				, std::min( IndirectCommandsBatchSize, count - first )
+				, pipelinesBuffer + first } );
+		}
+	}
+
+	IndirectCommandsBatch fillIndirectCommandsBatches( castor::JobSystem & jobs
+		, castor::Vector< IndirectCommandsBatch > & batches
+		, castor::Function< void( IndirectCommandsBatch & ) > const & count
+		, castor::Function< void( IndirectCommandsBatch const & ) > const & fill )
+	{
+		jobs.parallelFor( batches.size()
+			, [&batches, &count]( size_t begin, size_t end )
+			{
+				for ( auto i = begin; i < end; ++i )
+				{
+					count( batches[i] );
+				}
+			}
+			, 1u );
+
+		IndirectCommandsBatch result{};
+
+		for ( auto & batch : batches )
+		{
+			batch.idxOffset = std::exchange( result.idxOffset, result.idxOffset + batch.idxOffset );
+			batch.nidxOffset = std::exchange( result.nidxOffset, result.nidxOffset + batch.nidxOffset );
+			batch.mshOffset = std::exchange( result.mshOffset, result.mshOffset + batch.mshOffset );
+			queuerndnd::addCounts( result.visible, batch.visible );
+		}
+
+		jobs.parallelFor( batches.size()
+			, [&batches, &fill]( size_t begin, size_t end )
+			{
+				for ( auto i = begin; i < end; ++i )
+				{
+					fill( batches[i] );
+				}
+			}
+			, 1u );
+		return result;
+	}
+
+	//*************************************************************************************************
+
 	QueueRenderNodes::QueueRenderNodes( RenderQueue const & queue
 		, RenderDevice const & device
 		, castor::String const & typeName
@@ -988,6 +1223,9 @@ namespace castor3d
 		m_submeshNodes.clear();
 		m_instancedSubmeshNodes.clear();
 		m_billboardNodes.clear();
+		m_sortedSubmeshNodes.clear();
+		m_sortedBillboardNodes.clear();
+		m_sortedNodesChanged = true;
 	}
 
 	void QueueRenderNodes::checkEmpty()
@@ -1035,6 +1273,7 @@ namespace castor3d
 			m_billboardNodes.clear();
 			m_pendingSubmeshes.clear();
 			m_pendingBillboards.clear();
+			m_sortedNodesChanged = true;
 
 			auto count = culler.getSubmeshes().size();
 			m_nodesIds.reserve( count );
@@ -1076,6 +1315,9 @@ namespace castor3d
 			C3D_DebugTime( renderPass.getTypeName() );
 			auto pendingSubmeshes = castor::move( m_pendingSubmeshes );
 			auto pendingBillboards = castor::move( m_pendingBillboards );
+			m_sortedNodesChanged = m_sortedNodesChanged
+				|| !pendingSubmeshes.empty()
+				|| !pendingBillboards.empty();
 
 			for ( auto culled : pendingSubmeshes )
 			{
@@ -1130,6 +1372,7 @@ namespace castor3d
 				C3D_DebugTime( renderPass.getTypeName() + " - Overall" );
 				auto maxNodesCount = m_pipelinesNodes->getCount();
 				auto nodesIdsBuffer = m_pipelinesNodes->lock( 0u, ashes::WholeSize, 0u );
+				doSortRenderedNodes();
 
 				if ( !m_submeshNodes.empty()
 					|| !m_instancedSubmeshNodes.empty() )
@@ -1281,6 +1524,12 @@ namespace castor3d
 				: renderPass.prepareBackPipeline( pipelineFlags
 					, node.getGeometryBuffers( pipelineFlags ).layouts
 					, node.getMeshletDescriptorLayout() );
+
+			if ( !result.pipeline )
+			{
+				return result;
+			}
+
 			it = m_pipelines.try_emplace( hash, result ).first;
 			renderPass.initialiseAdditionalDescriptor( *result.pipeline
 				, shadowMaps
@@ -1305,6 +1554,12 @@ namespace castor3d
 			auto result = renderPass.prepareBackPipeline( pipelineFlags
 				, node.getGeometryBuffers( pipelineFlags ).layouts
 				, nullptr );
+
+			if ( !result.pipeline )
+			{
+				return result;
+			}
+
 			it = m_pipelines.try_emplace( hash, result ).first;
 			renderPass.initialiseAdditionalDescriptor( *result.pipeline
 				, shadowMaps
@@ -1328,6 +1583,17 @@ namespace castor3d
 				|| node.pass->isTwoSided()
 				|| passFlags.hasAlphaBlendingFlag );
 
+		// Both culling variants are added together, once their programs are ready,
+		// so that a retried node is never added twice.
+		if ( !doGetPipeline( shadowMaps, shadowBuffer, node, false ).pipeline
+			|| ( needsFront
+				&& !doGetPipeline( shadowMaps, shadowBuffer, node, true ).pipeline ) )
+		{
+			m_hasNodes = true;
+			m_pendingSubmeshes.insert( &counted );
+			return;
+		}
+
 		if ( node.isInstanced() )
 		{
 			if ( node.instance.getParent()->isVisible() )
@@ -1373,11 +1639,12 @@ namespace castor3d
 			, node );
 		m_hasNodes = true;
 
-		if ( !queuerndnd::addRenderNode( pipelineId
-			, counted
-			, false
-			, m_billboardNodes
-			, m_nodesIds ) )
+		if ( !pipelineId.pipeline
+			|| !queuerndnd::addRenderNode( pipelineId
+				, counted
+				, false
+				, m_billboardNodes
+				, m_nodesIds ) )
 		{
 			m_pendingBillboards.insert( &counted );
 		}
@@ -1395,11 +1662,12 @@ namespace castor3d
 			, frontCulled );
 		m_hasNodes = true;
 
-		if ( !queuerndnd::addRenderNode( pipelineId
-			, counted
-			, frontCulled
-			, m_submeshNodes
-			, m_nodesIds ) )
+		if ( !pipelineId.pipeline
+			|| !queuerndnd::addRenderNode( pipelineId
+				, counted
+				, frontCulled
+				, m_submeshNodes
+				, m_nodesIds ) )
 		{
 			m_pendingSubmeshes.insert( &counted );
 		}
@@ -1417,11 +1685,12 @@ namespace castor3d
 			, frontCulled );
 		m_hasNodes = true;
 
-		if ( !queuerndnd::addRenderNode( pipelineId
-			, counted
-			, frontCulled
-			, m_instancedSubmeshNodes
-			, m_nodesIds ) )
+		if ( !pipelineId.pipeline
+			|| !queuerndnd::addRenderNode( pipelineId
+				, counted
+				, frontCulled
+				, m_instancedSubmeshNodes
+				, m_nodesIds ) )
 		{
 			m_pendingSubmeshes.insert( &counted );
 		}
@@ -1473,6 +1742,24 @@ namespace castor3d
 		}
 	}
 
+	void QueueRenderNodes::doSortRenderedNodes()
+	{
+		auto const & renderPass = *getOwner()->getOwner();
+		C3D_DebugTime( renderPass.getTypeName() + " - Sort" );
+		auto const & culler = getOwner()->getCuller();
+		queuerndnd::sortRenderedNodes( renderPass
+			, culler
+			, m_submeshNodes
+			, m_sortedNodesChanged
+			, m_sortedSubmeshNodes );
+		queuerndnd::sortRenderedNodes( renderPass
+			, culler
+			, m_billboardNodes
+			, m_sortedNodesChanged
+			, m_sortedBillboardNodes );
+		m_sortedNodesChanged = false;
+	}
+
 	uint32_t QueueRenderNodes::doPrepareMeshTraditionalNoDrawIDCommandBuffers( ashes::CommandBuffer const & commandBuffer
 		, ashes::Optional< VkViewport > const & viewport
 		, ashes::Optional< VkRect2D > const & scissors
@@ -1484,54 +1771,46 @@ namespace castor3d
 		uint32_t nidxIndex{};
 		{
 			C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Single" );
-			for ( auto const & [_, pipelinesNodes] : m_submeshNodes )
+			for ( auto const & [pipelinesNodes, buffer, nodes] : m_sortedSubmeshNodes.getRanges() )
 			{
-				auto const & pipeline = pipelinesNodes.pipeline;
+				auto const & pipeline = pipelinesNodes->pipeline;
+
+				auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
+					, *buffer
+					, m_nodesIds
+					, nodesIdsBuffer
+					, maxNodesCount );
+				auto pipelinesBuffer = pipelineNodes.data();
+				auto pipelineId = queuerndnd::bindPipeline( commandBuffer
+					, *this
+					, *pipeline.pipeline
+					, *buffer
+					, viewport
+					, scissors
+					, false );
+				uint32_t visibleNodesCount{};
 
-				for ( auto const & [buffer, nodes] : pipelinesNodes.nodes )
+				for ( auto const & sorted : nodes )
 				{
-					if ( queuerndnd::hasVisibleNode( nodes ) )
-					{
-						auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
-							, *buffer
-							, m_nodesIds
-							, nodesIdsBuffer
-							, maxNodesCount );
-						auto pipelinesBuffer = pipelineNodes.data();
-						auto pipelineId = queuerndnd::bindPipeline( commandBuffer
-							, *this
-							, *pipeline.pipeline
-							, *buffer
-							, viewport
-							, scissors
-							, false );
-						uint32_t visibleNodesCount{};
-
-						for ( auto const & node : nodes )
-						{
-							if ( node.visible )
-							{
-								auto instanceCount = node.node->getInstanceCount();
-								queuerndnd::registerNodeCommands( *pipeline.pipeline
-									, node
-									, commandBuffer
-									, instanceCount
-									, pipelineId
-									, visibleNodesCount
-									, pipelinesBuffer
-									, idxIndex
-									, nidxIndex );
-								CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-								m_visible.objectCount += instanceCount;
-								m_visible.faceCount += node.node->data.getFaceCount() * instanceCount;
-								m_visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
-								++visibleNodesCount;
-							}
-						}
-
-						++result;
-					}
+					auto const & node = *sorted.node;
+					auto instanceCount = node.node->getInstanceCount();
+					queuerndnd::registerNodeCommands( *pipeline.pipeline
+						, node
+						, commandBuffer
+						, instanceCount
+						, pipelineId
+						, visibleNodesCount
+						, pipelinesBuffer
+						, idxIndex
+						, nidxIndex );
+					CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
+					m_visible.objectCount += instanceCount;
+					m_visible.faceCount += node.node->data.getFaceCount() * instanceCount;
+					m_visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
+					++visibleNodesCount;
 				}
+
+				++result;
 			}
 		}
 		{
@@ -1596,61 +1875,59 @@ namespace castor3d
 		auto indirectNIdxBuffer = origIndirectNIdxBuffer;
 		{
 			C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Single" );
-			for ( auto const & [_, pipelinesNodes] : m_submeshNodes )
+			auto & ranges = m_sortedSubmeshNodes.getRanges();
 			{
-				auto const & pipeline = pipelinesNodes.pipeline;
-
-				for ( auto const & [buffer, nodes] : pipelinesNodes.nodes )
-				{
-					if ( auto firstVisibleNode = queuerndnd::hasVisibleNode( nodes ) )
+				C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Indirect" );
+				auto total = queuerndnd::fillIndirectCommands< SubmeshRenderNode >( getOwner()->getOwner()->getEngine()->getFrameJobs()
+					, ranges
+					, m_nodesIds
+					, nodesIdsBuffer
+					, maxNodesCount
+					, false
+					, m_indirectBatches
+					, [origIndirectIdxBuffer, origIndirectNIdxBuffer]( auto const & range
+						, IndirectCommandsBatch const & batch )
 					{
-						auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
-							, *buffer
-							, m_nodesIds
-							, nodesIdsBuffer
-							, maxNodesCount );
-						auto pipelinesBuffer = pipelineNodes.data();
-
-						queuerndnd::bindPipeline( commandBuffer
-							, *this
-							, *pipeline.pipeline
-							, *buffer
-							, viewport
-							, scissors
-							, true );
-						uint32_t visibleNodesCount{};
-
-						for ( auto const & node : nodes )
+						auto batchIdxBuffer = origIndirectIdxBuffer + batch.idxOffset;
+						auto batchNIdxBuffer = origIndirectNIdxBuffer + batch.nidxOffset;
+						auto pipelinesBuffer = batch.pipelinesBuffer;
+
+						for ( auto index = batch.first; index < batch.first + batch.count; ++index )
 						{
-							if ( node.visible )
-							{
-								auto instanceCount = node.node->getInstanceCount();
-								queuerndnd::fillNodeIndirectCommands( node
-									, indirectIdxBuffer
-									, indirectNIdxBuffer
-									, instanceCount
-									, pipelinesBuffer );
-								m_visible.objectCount += instanceCount;
-								m_visible.faceCount += node.node->data.getFaceCount() * instanceCount;
-								m_visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
-								CU_Require( size_t( std::distance( origIndirectIdxBuffer, indirectIdxBuffer ) ) <= submeshIdxCommands.getCount() );
-								CU_Require( size_t( std::distance( origIndirectNIdxBuffer, indirectNIdxBuffer ) ) <= submeshNIdxCommands.getCount() );
-								CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-								++visibleNodesCount;
-							}
+							auto const & node = *range.nodes[index].node;
+							queuerndnd::fillNodeIndirectCommands( node
+								, batchIdxBuffer
+								, batchNIdxBuffer
+								, node.node->getInstanceCount()
+								, pipelinesBuffer );
 						}
+					} );
+				CU_Require( total.idxOffset <= submeshIdxCommands.getCount() );
+				CU_Require( total.nidxOffset <= submeshNIdxCommands.getCount() );
+				indirectIdxBuffer += total.idxOffset;
+				indirectNIdxBuffer += total.nidxOffset;
+				queuerndnd::addCounts( m_visible, total.visible );
+			}
 
-						queuerndnd::registerNodeCommands( *pipeline.pipeline
-							, *firstVisibleNode
-							, commandBuffer
-							, &submeshIdxCommands
-							, submeshNIdxCommands
-							, visibleNodesCount
-							, idxIndex
-							, nidxIndex );
-						++result;
-					}
-				}
+			for ( auto const & [pipelinesNodes, buffer, nodes] : ranges )
+			{
+				auto const & pipeline = pipelinesNodes->pipeline;
+				queuerndnd::bindPipeline( commandBuffer
+					, *this
+					, *pipeline.pipeline
+					, *buffer
+					, viewport
+					, scissors
+					, true );
+				queuerndnd::registerNodeCommands( *pipeline.pipeline
+					, *nodes.front().node
+					, commandBuffer
+					, &submeshIdxCommands
+					, submeshNIdxCommands
+					, uint32_t( nodes.size() )
+					, idxIndex
+					, nidxIndex );
+				++result;
 			}
 		}
 		{
@@ -1729,101 +2006,69 @@ namespace castor3d
 		auto indirectMshBuffer = origIndirectMshBuffer;
 		{
 			C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Single" );
-			for ( auto const & [_, pipelinesNodes] : m_submeshNodes )
+			auto & ranges = m_sortedSubmeshNodes.getRanges();
 			{
-				auto const & pipeline = pipelinesNodes.pipeline;
-
-				for ( auto const & [buffer, nodes] : pipelinesNodes.nodes )
-				{
-					if ( auto firstVisibleNode = queuerndnd::hasVisibleNode( nodes ) )
-					{
-						auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
-							, *buffer
-							, m_nodesIds
-							, nodesIdsBuffer
-							, maxNodesCount );
-						auto pipelinesBuffer = pipelineNodes.data();
-
-						auto pipelineId = queuerndnd::bindPipeline( commandBuffer
-							, *this
-							, *pipeline.pipeline
-							, *buffer
-							, viewport
-							, scissors
-							, true );
-
-						if ( pipeline.pipeline->hasMeshletDescriptorSetLayout() )
-						{
-							uint32_t drawOffset{};
+				C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Indirect" );
+				auto total = queuerndnd::fillIndirectCommands< SubmeshRenderNode >( getOwner()->getOwner()->getEngine()->getFrameJobs()
+					, ranges
+					, m_nodesIds
+					, nodesIdsBuffer
+					, maxNodesCount
+					, true
+					, m_indirectBatches
+					, queuerndnd::makeMeshBatchFiller( origIndirectMshBuffer, origIndirectIdxBuffer, origIndirectNIdxBuffer ) );
+				CU_Require( total.mshOffset <= submeshMshCommands.getCount() );
+				CU_Require( total.idxOffset <= submeshIdxCommands.getCount() );
+				CU_Require( total.nidxOffset <= submeshNIdxCommands.getCount() );
+				indirectMshBuffer += total.mshOffset;
+				indirectIdxBuffer += total.idxOffset;
+				indirectNIdxBuffer += total.nidxOffset;
+				queuerndnd::addCounts( m_visible, total.visible );
+			}
 
-							for ( auto const & node : nodes )
-							{
-								if ( node.visible )
-								{
-									auto instanceCount = node.node->getInstanceCount();
-									queuerndnd::fillNodeIndirectCommands( node
-										, indirectMshBuffer
-										, indirectIdxBuffer
-										, indirectNIdxBuffer
-										, instanceCount
-										, pipelinesBuffer );
-									m_visible.objectCount += instanceCount;
-									m_visible.faceCount += node.node->data.getFaceCount() * instanceCount;
-									m_visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
-									CU_Require( size_t( std::distance( origIndirectMshBuffer, indirectMshBuffer ) ) <= submeshMshCommands.getCount() );
-									CU_Require( size_t( std::distance( origIndirectIdxBuffer, indirectIdxBuffer ) ) <= submeshIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( origIndirectNIdxBuffer, indirectNIdxBuffer ) ) <= submeshNIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-
-									queuerndnd::registerNodeCommands( *pipeline.pipeline
-										, *node.node
-										, commandBuffer
-										, submeshMshCommands
-										, pipelineId
-										, drawOffset
-										, instanceCount
-										, mshIndex );
-									drawOffset += instanceCount;
-									++result;
-								}
-							}
-						}
-						else
-						{
-							uint32_t visibleNodesCount{};
+			for ( auto const & [pipelinesNodes, buffer, nodes] : ranges )
+			{
+				auto const & pipeline = pipelinesNodes->pipeline;
+				auto pipelineId = queuerndnd::bindPipeline( commandBuffer
+					, *this
+					, *pipeline.pipeline
+					, *buffer
+					, viewport
+					, scissors
+					, true );
 
-							for ( auto const & node : nodes )
-							{
-								if ( node.visible )
-								{
-									auto instanceCount = node.node->getInstanceCount();
-									queuerndnd::fillNodeIndirectCommands( node
-										, indirectIdxBuffer
-										, indirectNIdxBuffer
-										, instanceCount
-										, pipelinesBuffer );
-									m_visible.objectCount += instanceCount;
-									m_visible.faceCount += node.node->data.getFaceCount() * instanceCount;
-									m_visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
-									CU_Require( size_t( std::distance( origIndirectIdxBuffer, indirectIdxBuffer ) ) <= submeshIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( origIndirectNIdxBuffer, indirectNIdxBuffer ) ) <= submeshNIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-									++visibleNodesCount;
-								}
-							}
+				if ( pipeline.pipeline->hasMeshletDescriptorSetLayout() )
+				{
+					uint32_t drawOffset{};
 
-							queuerndnd::registerNodeCommands( *pipeline.pipeline
-								, *firstVisibleNode
-								, commandBuffer
-								, &submeshIdxCommands
-								, submeshNIdxCommands
-								, visibleNodesCount
-								, idxIndex
-								, nidxIndex );
-							++result;
-						}
+					for ( auto const & sorted : nodes )
+					{
+						auto const & node = *sorted.node;
+						auto instanceCount = node.node->getInstanceCount();
+						queuerndnd::registerNodeCommands( *pipeline.pipeline
+							, *node.node
+							, commandBuffer
+							, submeshMshCommands
+							, pipelineId
+							, drawOffset
+							, instanceCount
+							, mshIndex );
+						drawOffset += instanceCount;
+						++result;
 					}
 				}
+				else
+				{
+					queuerndnd::registerNodeCommands( *pipeline.pipeline
+						, *nodes.front().node
+						, commandBuffer
+						, &submeshIdxCommands
+						, submeshNIdxCommands
+						, uint32_t( nodes.size() )
+						, idxIndex
+						, nidxIndex );
+					++result;
+				}
 			}
 		}
 		{
@@ -1939,101 +2184,69 @@ namespace castor3d
 		auto indirectMshBuffer = origIndirectMshBuffer;
 		{
 			C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Single" );
-			for ( auto const & [_, pipelinesNodes] : m_submeshNodes )
+			auto & ranges = m_sortedSubmeshNodes.getRanges();
 			{
-				auto const & pipeline = pipelinesNodes.pipeline;
-
-				for ( auto const & [buffer, nodes] : pipelinesNodes.nodes )
-				{
-					if ( auto firstVisibleNode = queuerndnd::hasVisibleNode( nodes ) )
-					{
-						auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
-							, *buffer
-							, m_nodesIds
-							, nodesIdsBuffer
-							, maxNodesCount );
-						auto pipelinesBuffer = pipelineNodes.data();
-
-						auto pipelineId = queuerndnd::bindPipeline( commandBuffer
-							, *this
-							, *pipeline.pipeline
-							, *buffer
-							, viewport
-							, scissors
-							, true );
-
-						if ( pipeline.pipeline->hasMeshletDescriptorSetLayout() )
-						{
-							uint32_t drawOffset{};
+				C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Indirect" );
+				auto total = queuerndnd::fillIndirectCommands< SubmeshRenderNode >( getOwner()->getOwner()->getEngine()->getFrameJobs()
+					, ranges
+					, m_nodesIds
+					, nodesIdsBuffer
+					, maxNodesCount
+					, true
+					, m_indirectBatches
+					, queuerndnd::makeMeshBatchFiller( origIndirectMshBuffer, origIndirectIdxBuffer, origIndirectNIdxBuffer ) );
+				CU_Require( total.mshOffset <= submeshMshCommands.getCount() );
+				CU_Require( total.idxOffset <= submeshIdxCommands.getCount() );
+				CU_Require( total.nidxOffset <= submeshNIdxCommands.getCount() );
+				indirectMshBuffer += total.mshOffset;
+				indirectIdxBuffer += total.idxOffset;
+				indirectNIdxBuffer += total.nidxOffset;
+				queuerndnd::addCounts( m_visible, total.visible );
+			}
 
-							for ( auto const & node : nodes )
-							{
-								if ( node.visible )
-								{
-									auto instanceCount = node.node->getInstanceCount();
-									queuerndnd::fillNodeIndirectCommands( node
-										, indirectMshBuffer
-										, indirectIdxBuffer
-										, indirectNIdxBuffer
-										, instanceCount
-										, pipelinesBuffer );
-									m_visible.objectCount += instanceCount;
-									m_visible.faceCount += node.node->data.getFaceCount() * instanceCount;
-									m_visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
-									CU_Require( size_t( std::distance( origIndirectMshBuffer, indirectMshBuffer ) ) <= submeshMshCommands.getCount() );
-									CU_Require( size_t( std::distance( origIndirectIdxBuffer, indirectIdxBuffer ) ) <= submeshIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( origIndirectNIdxBuffer, indirectNIdxBuffer ) ) <= submeshNIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-
-									queuerndnd::registerNodeCommands( *pipeline.pipeline
-										, *node.node
-										, commandBuffer
-										, submeshMshCommands
-										, pipelineId
-										, drawOffset
-										, instanceCount
-										, mshIndex );
-									drawOffset += instanceCount;
-									++result;
-								}
-							}
-						}
-						else
-						{
-							uint32_t visibleNodesCount{};
+			for ( auto const & [pipelinesNodes, buffer, nodes] : ranges )
+			{
+				auto const & pipeline = pipelinesNodes->pipeline;
+				auto pipelineId = queuerndnd::bindPipeline( commandBuffer
+					, *this
+					, *pipeline.pipeline
+					, *buffer
+					, viewport
+					, scissors
+					, true );
 
-							for ( auto const & node : nodes )
-							{
-								if ( node.visible )
-								{
-									auto instanceCount = node.node->getInstanceCount();
-									queuerndnd::fillNodeIndirectCommands( node
-										, indirectIdxBuffer
-										, indirectNIdxBuffer
-										, instanceCount
-										, pipelinesBuffer );
-									m_visible.objectCount += instanceCount;
-									m_visible.faceCount += node.node->data.getFaceCount() * instanceCount;
-									m_visible.vertexCount += node.node->data.getPointsCount() * instanceCount;
-									CU_Require( size_t( std::distance( origIndirectIdxBuffer, indirectIdxBuffer ) ) <= submeshIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( origIndirectNIdxBuffer, indirectNIdxBuffer ) ) <= submeshNIdxCommands.getCount() );
-									CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-									++visibleNodesCount;
-								}
-							}
+				if ( pipeline.pipeline->hasMeshletDescriptorSetLayout() )
+				{
+					uint32_t drawOffset{};
 
-							queuerndnd::registerNodeCommands( *pipeline.pipeline
-								, *firstVisibleNode
-								, commandBuffer
-								, &submeshIdxCommands
-								, submeshNIdxCommands
-								, visibleNodesCount
-								, idxIndex
-								, nidxIndex );
-							++result;
-						}
+					for ( auto const & sorted : nodes )
+					{
+						auto const & node = *sorted.node;
+						auto instanceCount = node.node->getInstanceCount();
+						queuerndnd::registerNodeCommands( *pipeline.pipeline
+							, *node.node
+							, commandBuffer
+							, submeshMshCommands
+							, pipelineId
+							, drawOffset
+							, instanceCount
+							, mshIndex );
+						drawOffset += instanceCount;
+						++result;
 					}
 				}
+				else
+				{
+					queuerndnd::registerNodeCommands( *pipeline.pipeline
+						, *nodes.front().node
+						, commandBuffer
+						, &submeshIdxCommands
+						, submeshNIdxCommands
+						, uint32_t( nodes.size() )
+						, idxIndex
+						, nidxIndex );
+					++result;
+				}
 			}
 		}
 		{
@@ -2136,51 +2349,43 @@ namespace castor3d
 		uint32_t result{};
 		uint32_t nidxIndex{};
 
-		for ( auto const & [_, pipelinesNodes] : m_billboardNodes )
+		for ( auto const & [pipelinesNodes, buffer, nodes] : m_sortedBillboardNodes.getRanges() )
 		{
-			auto const & pipeline = pipelinesNodes.pipeline;
-
-			for ( auto const & [buffer, nodes] : pipelinesNodes.nodes )
+			auto const & pipeline = pipelinesNodes->pipeline;
+
+			auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
+				, *buffer
+				, m_nodesIds
+				, nodesIdsBuffer
+				, maxNodesCount );
+			auto pipelinesBuffer = pipelineNodes.data();
+			auto pipelineId = queuerndnd::bindPipeline( commandBuffer
+				, *this
+				, *pipeline.pipeline
+				, *buffer
+				, viewport
+				, scissors
+				, true );
+			uint32_t visibleNodesCount{};
+
+			for ( auto const & sorted : nodes )
 			{
-				if ( queuerndnd::hasVisibleNode( nodes ) )
-				{
-					auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
-						, *buffer
-						, m_nodesIds
-						, nodesIdsBuffer
-						, maxNodesCount );
-					auto pipelinesBuffer = pipelineNodes.data();
-					auto pipelineId = queuerndnd::bindPipeline( commandBuffer
-						, *this
-						, *pipeline.pipeline
-						, *buffer
-						, viewport
-						, scissors
-						, true );
-					uint32_t visibleNodesCount{};
-
-					for ( auto const & node : nodes )
-					{
-						if ( node.visible )
-						{
-							auto instanceCount = node.node->getInstanceCount();
-							queuerndnd::registerNodeCommands( *pipeline.pipeline
-								, node
-								, commandBuffer
-								, instanceCount
-								, pipelineId
-								, visibleNodesCount
-								, pipelinesBuffer
-								, nidxIndex );
-							CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-							m_visible.billboardCount += node.node->data.getCount();
-							++visibleNodesCount;
-						}
-					}
-
-					++result;
-				}
+				auto const & node = *sorted.node;
+				auto instanceCount = node.node->getInstanceCount();
+				queuerndnd::registerNodeCommands( *pipeline.pipeline
+					, node
+					, commandBuffer
+					, instanceCount
+					, pipelineId
+					, visibleNodesCount
+					, pipelinesBuffer
+					, nidxIndex );
+				CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
+				m_visible.billboardCount += node.node->data.getCount();
+				++visibleNodesCount;
 			}
+
+			++result;
 		}
 
 		return result;
@@ -2199,59 +2404,54 @@ namespace castor3d
 
 		auto const & billboardCommands = *m_billboardIndirectCommands;
 		auto origIndirectBuffer = billboardCommands.lock( 0u, ashes::WholeSize, 0u );
-		auto indirectBuffer = origIndirectBuffer;
-
-		for ( auto const & [_, pipelinesNodes] : m_billboardNodes )
+		auto & ranges = m_sortedBillboardNodes.getRanges();
 		{
-			auto const & pipeline = pipelinesNodes.pipeline;
-
-			for ( auto const & [buffer, nodes] : pipelinesNodes.nodes )
-			{
-				if ( auto firstVisibleNode = queuerndnd::hasVisibleNode( nodes ) )
+			C3D_DebugTime( getOwner()->getOwner()->getTypeName() + " - Indirect" );
+			auto total = queuerndnd::fillIndirectCommands< BillboardRenderNode >( getOwner()->getOwner()->getEngine()->getFrameJobs()
+				, ranges
+				, m_nodesIds
+				, nodesIdsBuffer
+				, maxNodesCount
+				, false
+				, m_indirectBatches
+				, [origIndirectBuffer]( auto const & range
+					, IndirectCommandsBatch const & batch )
 				{
-					auto & pipelineNodes = getPipelineNodes( pipeline.pipeline->getFlagsHash()
-						, *buffer
-						, m_nodesIds
-						, nodesIdsBuffer
-						, maxNodesCount );
-					auto pipelinesBuffer = pipelineNodes.data();
-
-					queuerndnd::bindPipeline( commandBuffer
-						, *this
-						, *pipeline.pipeline
-						, *buffer
-						, viewport
-						, scissors
-						, true );
-					uint32_t visibleNodesCount{};
+					auto batchBuffer = origIndirectBuffer + batch.nidxOffset;
+					auto pipelinesBuffer = batch.pipelinesBuffer;
 
-					for ( auto const & node : nodes )
+					for ( auto index = batch.first; index < batch.first + batch.count; ++index )
 					{
-						if ( node.visible )
-						{
-							auto instanceCount = node.node->getInstanceCount();
-							queuerndnd::fillNodeIndirectCommand( node
-								, indirectBuffer
-								, instanceCount
-								, pipelinesBuffer );
-							m_visible.billboardCount += node.node->data.getCount();
-							CU_Require( size_t( std::distance( origIndirectBuffer, indirectBuffer ) ) <= billboardCommands.getCount() );
-							CU_Require( size_t( std::distance( pipelineNodes.data(), pipelinesBuffer ) ) <= pipelineNodes.size() );
-							++visibleNodesCount;
-						}
+						auto const & node = *range.nodes[index].node;
+						queuerndnd::fillNodeIndirectCommand( node
+							, batchBuffer
+							, node.node->getInstanceCount()
+							, pipelinesBuffer );
 					}
+				} );
+			CU_Require( total.nidxOffset <= billboardCommands.getCount() );
+			queuerndnd::addCounts( m_visible, total.visible );
+		}
 
-					queuerndnd::registerNodeCommands( *pipeline.pipeline
-						, *firstVisibleNode
-						, commandBuffer
-						, nullptr
-						, billboardCommands
-						, visibleNodesCount
-						, idxIndex
-						, nidxIndex );
-					++result;
-				}
-			}
+		for ( auto const & [pipelinesNodes, buffer, nodes] : ranges )
+		{
+			auto const & pipeline = pipelinesNodes->pipeline;
+			queuerndnd::bindPipeline( commandBuffer
+				, *this
+				, *pipeline.pipeline
+				, *buffer
+				, viewport
+				, scissors
+				, true );
+			queuerndnd::registerNodeCommands( *pipeline.pipeline
+				, *nodes.front().node
+				, commandBuffer
+				, nullptr
+				, billboardCommands
+				, uint32_t( nodes.size() )
+				, idxIndex
+				, nidxIndex );
+			++result;
 		}
 
 		billboardCommands.flush( 0u, ashes::WholeSize );
@@ -12,6 +12,7 @@
 #include "Castor3D/Material/Texture/TextureUnit.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MorphComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/PackedVerticesComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/SkinComponent.hpp"
 #include "Castor3D/Render/RenderNodesPass.hpp"
 #include "Castor3D/Render/RenderPipeline.hpp"
@@ -133,18 +134,14 @@ namespace castor3d
 			, m_billboardsData->getCount() ) }
 		, m_vertexTransform{ castor::makeUnique< VertexTransforming >( scene, m_device ) }
 	{
-#if C3D_DebugTimers
 		m_timerRenderNodes = castor::makeUnique< crg::FramePassTimer >( m_device.makeContext(), getOwner()->getName() + "/RenderNodes", crg::TimerScope::eUpdate );
 		getOwner()->getEngine()->registerTimer( getOwner()->getName() + "/RenderNodes", *m_timerRenderNodes );
-#endif
 	}
 
 	SceneRenderNodes::~SceneRenderNodes()noexcept
 	{
-#if C3D_DebugTimers
 		getOwner()->getEngine()->unregisterTimer( getOwner()->getName() + "/RenderNodes", *m_timerRenderNodes );
 		m_timerRenderNodes.reset();
-#endif
 	}
 
 	void SceneRenderNodes::registerCuller( SceneCuller & culler )
@@ -217,6 +214,12 @@ namespace castor3d
 				, data.getIndexCount()
 				, data.getPointsCount()
 				, node.modelData );
+
+			if ( auto packing = data.getComponent< PackedVerticesComponent >() )
+			{
+				packing->getData().fillModelData( node.modelData );
+			}
+
 			scnrendnd::add( pass.getLightingModelId(), m_lightingModels );
 			auto [pit, pres] = m_onPassChanged.try_emplace( &pass );
 
@@ -524,14 +527,16 @@ namespace castor3d
 
 	void SceneRenderNodes::update( CpuUpdater & updater )
 	{
-		if ( !m_dirty && updater.dirtyScenes[getOwner()].dirtyNodes.empty() )
+		// The updater is shared by the concurrent scene update stages, the dirty objects are hence only looked up.
+		auto it = updater.dirtyScenes.find( getOwner() );
+
+		if ( !m_dirty
+			&& ( it == updater.dirtyScenes.end() || it->second.dirtyNodes.empty() ) )
 		{
 			return;
 		}
 
-#if C3D_DebugTimers
 		auto block( m_timerRenderNodes->start() );
-#endif
 		castor::Map< Submesh const *, castor::Map< uint32_t, uint32_t > > indices;
 		
 		for ( auto const & [_, node] : m_submeshNodes )
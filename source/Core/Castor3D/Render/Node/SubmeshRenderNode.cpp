@@ -1,12 +1,17 @@
 #include "Castor3D/Render/Node/SubmeshRenderNode.hpp"
 
+#include "Castor3D/Config.hpp"
 #include "Castor3D/Buffer/UniformBufferPool.hpp"
 #include "Castor3D/Material/Pass/Pass.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/InstantiationComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MeshletComponent.hpp"
 #include "Castor3D/Render/RenderDevice.hpp"
+#include "Castor3D/Render/Viewport.hpp"
+#include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
+#include "Castor3D/Scene/SceneNode.hpp"
 
 CU_ImplementSmartPtr( castor3d, SubmeshRenderNode )
 
@@ -133,4 +138,67 @@ namespace castor3d
 	{
 		return data.getInstantiation().isInstanced( *pass );
 	}
+
+	uint32_t SubmeshRenderNode::selectLod( Camera const * camera )const
+	{
+		if constexpr ( C3D_UseVisibilityBuffer != 0 )
+		{
+			// The visibility buffer resolves the primitives from the full detail indices.
+			return 0u;
+		}
+		else
+		{
+			auto lods = data.getComponent< LodComponent >();
+			auto sceneNode = instance.getParent();
+
+			// Instances share the same draw command, and meshlets don't use the index buffer.
+			if ( !camera
+				|| !camera->getParent()
+				|| !sceneNode
+				|| !lods
+				|| !lods->getData().hasData()
+				|| isInstanced()
+				|| data.getMeshletsCount() > 0u
+				|| ( camera->getViewportType() != ViewportType::ePerspective
+					&& camera->getViewportType() != ViewportType::eInfinitePerspective ) )
+			{
+				return 0u;
+			}
+
+			auto const & sphere = instance.getBoundingSphere( data );
+			auto scale = sceneNode->getDerivedScale();
+			castor::Point3f center = instance.getGlobalTransform() * sphere.getCenter();
+			auto radius = sphere.getRadius() * std::max( scale[0], std::max( scale[1], scale[2] ) );
+			auto distance = float( castor::point::distance( center, camera->getParent()->getDerivedPosition() ) );
+
+			if ( distance <= radius )
+			{
+				return 0u;
+			}
+
+			return lods->getData().selectLevel( radius * camera->getViewport().getProjectionScale() / distance );
+		}
+	}
+
+	uint32_t SubmeshRenderNode::getLodFirstIndex( uint32_t lod )const
+	{
+		if ( auto lods = data.getComponent< LodComponent >();
+			lods && lod > 0u )
+		{
+			return lods->getData().getFirstIndex( lod );
+		}
+
+		return 0u;
+	}
+
+	uint32_t SubmeshRenderNode::getLodIndexCount( uint32_t lod )const
+	{
+		if ( auto lods = data.getComponent< LodComponent >();
+			lods && lod > 0u )
+		{
+			return lods->getData().getIndexCount( lod );
+		}
+
+		return modelData.indexCount;
+	}
 }
@@ -2225,6 +2225,19 @@ namespace castor3d
 	{
 		m_maxPipelineId = m_nodesPass.getMaxPipelineId();
 
+		if ( auto generation = m_device.geometryPools->getGeneration();
+			generation != m_geometryGeneration )
+		{
+			// The descriptor sets are keyed by buffer address, which may have been released by the pool compaction.
+			m_geometryGeneration = generation;
+			m_commandsChanged = true;
+
+			for ( auto const & pipeline : m_pipelines )
+			{
+				pipeline->vtxDescriptorSets.clear();
+			}
+		}
+
 		if ( m_commandsChanged || m_maxPipelineId.isDirty() )
 		{
 			m_maxPipelineId.reset();
@@ -0,0 +1,194 @@
+#include "Castor3D/Render/PipelineCache.hpp"
+
+#include "Castor3D/Miscellaneous/Logger.hpp"
+#include "Castor3D/Miscellaneous/makeVkType.hpp"
+
+#include <CastorUtils/Data/File.hpp>
+#include <CastorUtils/Data/MappedFile.hpp>
+
+#include <ashespp/Core/Device.hpp>
+
+#include <cstring>
+
+CU_ImplementSmartPtr( castor3d, PipelineCache )
+
+namespace castor3d
+{
+	//*********************************************************************************************
+
+	namespace pplch
+	{
+		static constexpr uint32_t CacheMagic = 0x43503343u; // "C3PC"
+		static constexpr uint32_t CacheVersion = 1u;
+
+		struct CacheHeader
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint32_t vendorID;
+			uint32_t deviceID;
+			uint32_t driverVersion;
+			uint32_t padding;
+			uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+			uint64_t size;
+		};
+
+		static CacheHeader makeHeader( VkPhysicalDeviceProperties const & properties
+			, uint64_t size )
+		{
+			CacheHeader result{ CacheMagic
+				, CacheVersion
+				, properties.vendorID
+				, properties.deviceID
+				, properties.driverVersion
+				, 0u
+				, {}
+				, size };
+			std::memcpy( result.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE );
+			return result;
+		}
+
+		static bool isValid( VkPhysicalDeviceProperties const & properties
+			, CacheHeader const & header
+			, uint8_t const * data
+			, uint64_t size )
+		{
+			if ( header.magic != CacheMagic
+				|| header.version != CacheVersion
+				|| header.vendorID != properties.vendorID
+				|| header.deviceID != properties.deviceID
+				|| header.driverVersion != properties.driverVersion
+				|| std::memcmp( header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE ) != 0
+				|| header.size != size
+				|| size < sizeof( VkPipelineCacheHeaderVersionOne ) )
+			{
+				return false;
+			}
+
+			// Some drivers don't check the data they are given, so the Vulkan header is checked too.
+			VkPipelineCacheHeaderVersionOne vkHeader;
+			std::memcpy( &vkHeader, data, sizeof( VkPipelineCacheHeaderVersionOne ) );
+			return vkHeader.headerSize >= sizeof( VkPipelineCacheHeaderVersionOne )
+				&& vkHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+				&& vkHeader.vendorID == properties.vendorID
+				&& vkHeader.deviceID == properties.deviceID
+				&& std::memcmp( vkHeader.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE ) == 0;
+		}
+	}
+
+	//*********************************************************************************************
+
+	PipelineCache::PipelineCache( ashes::Device const & device
+		, castor::Path file )
+		: m_device{ device }
+		, m_file{ castor::move( file ) }
+	{
+		auto const & properties = m_device.getProperties();
+		castor::RawUniquePtr< castor::MappedFile > mapped;
+		uint8_t const * initialData{};
+		size_t initialSize{};
+
+		if ( castor::File::fileExists( m_file ) )
+		{
+			mapped = castor::make_unique< castor::MappedFile >( m_file );
+
+			if ( mapped->isMapped()
+				&& mapped->getSize() >= sizeof( pplch::CacheHeader ) )
+			{
+				pplch::CacheHeader header;
+				std::memcpy( &header, mapped->getData(), sizeof( pplch::CacheHeader ) );
+				auto data = mapped->getData() + sizeof( pplch::CacheHeader );
+				auto size = mapped->getSize() - sizeof( pplch::CacheHeader );
+
+				if ( pplch::isValid( properties, header, data, size ) )
+				{
+					initialData = data;
+					initialSize = size_t( size );
+				}
+				else
+				{
+					log::info << cuT( "Pipeline cache file [" ) << m_file << cuT( "] doesn't match the current device, ignoring it." ) << std::endl;
+				}
+			}
+		}
+
+		auto createInfo = makeVkStruct< VkPipelineCacheCreateInfo >( VkPipelineCacheCreateFlags{}
+			, initialSize
+			, initialData );
+		auto res = m_device.vkCreatePipelineCache( m_device
+			, &createInfo
+			, m_device.getAllocationCallbacks()
+			, &m_cache );
+
+		if ( res != VK_SUCCESS
+			&& initialData )
+		{
+			// The driver refused the content, start from an empty cache.
+			createInfo.initialDataSize = 0u;
+			createInfo.pInitialData = nullptr;
+			res = m_device.vkCreatePipelineCache( m_device
+				, &createInfo
+				, m_device.getAllocationCallbacks()
+				, &m_cache );
+		}
+
+		if ( res != VK_SUCCESS )
+		{
+			log::warn << cuT( "Couldn't create the pipeline cache." ) << std::endl;
+			m_cache = VkPipelineCache{};
+		}
+		else if ( initialData )
+		{
+			log::debug << cuT( "Loaded pipeline cache from [" ) << m_file << cuT( "]" ) << std::endl;
+		}
+	}
+
+	PipelineCache::~PipelineCache()noexcept
+	{
+		if ( m_cache )
+		{
+			try
+			{
+				save();
+			}
+			catch ( ... )
+			{
+				// Nothing to do, the cache will be rebuilt next time.
+			}
+
+			m_device.vkDestroyPipelineCache( m_device
+				, m_cache
+				, m_device.getAllocationCallbacks() );
+		}
+	}
+
+	void PipelineCache::save()const
+	{
+		if ( !m_cache )
+		{
+			return;
+		}
+
+		size_t size{};
+
+		if ( m_device.vkGetPipelineCacheData( m_device, m_cache, &size, nullptr ) != VK_SUCCESS
+			|| size == 0u )
+		{
+			return;
+		}
+
+		castor::ByteArray data( size );
+
+		if ( m_device.vkGetPipelineCacheData( m_device, m_cache, &size, data.data() ) != VK_SUCCESS )
+		{
+			return;
+		}
+
+		auto header = pplch::makeHeader( m_device.getProperties(), uint64_t( size ) );
+		castor::File::writeAtomic( m_file
+			, { castor::makeArrayView( reinterpret_cast< uint8_t const * >( &header ), sizeof( pplch::CacheHeader ) )
+				, castor::makeArrayView( static_cast< uint8_t const * >( data.data() ), size ) } );
+	}
+
+	//*********************************************************************************************
+}
@@ -1,12 +1,15 @@
 #include "Castor3D/Render/RenderDevice.hpp"
 
+#include "Castor3D/Engine.hpp"
 #include "Castor3D/Limits.hpp"
 #include "Castor3D/Buffer/GpuBufferPool.hpp"
 #include "Castor3D/Buffer/ObjectBufferPool.hpp"
 #include "Castor3D/Buffer/UniformBufferPool.hpp"
+#include "Castor3D/Render/PipelineCache.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Miscellaneous/Logger.hpp"
 
+#include <CastorUtils/Data/File.hpp>
 #include <CastorUtils/Miscellaneous/Debug.hpp>
 
 #include <ashespp/Core/Instance.hpp>
@@ -571,6 +574,20 @@ namespace castor3d
 		vertexPools = castor::makeUnique< VertexBufferPool >( *this, cuT( "VertexBuffersPool" ) );
 		indexPools = castor::makeUnique< IndexBufferPool >( *this, cuT( "IndexBuffersPool" ) );
 		uboPool = castor::makeUnique< UniformBufferPool >( *this, cuT( "UniformBufferPool" ) );
+
+		if ( renderSystem.getEngine()->isPipelineDiskCacheEnabled() )
+		{
+			auto cacheFolder = Engine::getEngineDirectory() / cuT( "Cache" );
+
+			if ( castor::File::directoryExists( cacheFolder )
+				|| castor::File::directoryCreate( cacheFolder ) )
+			{
+				// One file per GPU, so that switching between GPUs doesn't discard the cache each time.
+				auto stream = castor::makeStringStream();
+				stream << cuT( "Pipelines_" ) << std::hex << properties.vendorID << cuT( "_" ) << properties.deviceID << cuT( ".bin" );
+				pipelineCache = castor::makeUnique< PipelineCache >( *device, cacheFolder / stream.str() );
+			}
+		}
 	}
 
 	RenderDevice::~RenderDevice()noexcept
@@ -579,6 +596,7 @@ namespace castor3d
 			auto lock = castor::makeUniqueLock( m_mutex );
 			m_contexts.clear();
 		}
+		pipelineCache.reset();
 		uboPool.reset();
 		uboPool.reset();
 		indexPools.reset();
@@ -729,7 +747,9 @@ namespace castor3d
 		if ( res )
 		{
 			it->second = castor::make_unique< crg::GraphContext >( *device
-				, VkPipelineCache{}
+				, ( pipelineCache
+					? pipelineCache->getHandle()
+					: VkPipelineCache{} )
 				, device->getAllocationCallbacks()
 				, device->getMemoryProperties()
 				, device->getProperties()
@@ -23,6 +23,7 @@
 
 #include <CastorUtils/Design/BlockGuard.hpp>
 #include <CastorUtils/Design/ResourceCache.hpp>
+#include <CastorUtils/Miscellaneous/PreciseTimer.hpp>
 
 CU_ImplementSmartPtr( castor3d, RenderLoop )
 
@@ -192,7 +193,7 @@ namespace castor3d
 			doProcessEvents( CpuEventType::ePreGpuStep );
 			doGpuStep( info );
 			doProcessEvents( CpuEventType::ePreCpuStep );
-			doCpuStep( tslf );
+			doCpuStep( info, tslf );
 			doProcessEvents( CpuEventType::ePostCpuStep );
 			m_lastFrameTime = m_debugOverlays->endFrame( first );
 
@@ -277,6 +278,8 @@ namespace castor3d
 		getEngine()->update( updater );
 
 		uploadData.begin();
+		// Compaction copies must be registered before this frame's uploads, which use the moved offsets.
+		device.geometryPools->compact( uploadData, MaxObjectPoolCompactionSize );
 		device.bufferPool->upload( uploadData );
 		device.uboPool->upload( uploadData );
 		getEngine()->upload( uploadData );
@@ -315,6 +318,10 @@ namespace castor3d
 		*used.used = toWait.empty();
 		info.uploadSize = uint32_t( used.uploadSize );
 		info.stagingBuffersCount = uint32_t( used.buffersCount );
+		auto & compactionStats = device.geometryPools->getCompactionStats();
+		info.compactionMovedSize = uint32_t( compactionStats.movedSize );
+		info.compactionFreedSize = uint32_t( compactionStats.freedSize );
+		info.compactionReleasedSize = uint32_t( compactionStats.releasedSize );
 
 		// Usually GPU cleanup
 		doProcessEvents( GpuEventType::ePostRender, device, *data );
@@ -327,12 +334,16 @@ namespace castor3d
 		}
 	}
 
-	void RenderLoop::doCpuStep( castor::Milliseconds tslf )
+	void RenderLoop::doCpuStep( RenderInfo & info
+		, castor::Milliseconds tslf )
 	{
+		castor::PreciseTimer stepTimer;
 		CpuUpdater updater;
 		updater.tslf = tslf;
 		getEngine()->update( updater );
 
+		castor::PreciseTimer queuesTimer;
+
 		for ( auto const & techniqueQueues : updater.techniquesQueues )
 		{
 			for ( auto const & queue : techniqueQueues.queues )
@@ -341,6 +352,8 @@ namespace castor3d
 			}
 		}
 
+		info.queuesUpdateTime = queuesTimer.getElapsed();
+		info.cpuStepTime = stepTimer.getElapsed();
 		m_debugOverlays->endCpuTask();
 	}
 }
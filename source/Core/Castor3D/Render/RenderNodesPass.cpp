@@ -203,6 +203,7 @@ namespace castor3d
 
 	RenderNodesPass::~RenderNodesPass()noexcept
 	{
+		getEngine()->getShaderProgramCache().waitAutomaticPrograms( *this );
 		getRenderQueue().cleanup();
 		m_backPipelines.clear();
 		m_frontPipelines.clear();
@@ -1421,13 +1422,21 @@ namespace castor3d
 
 			if ( it == pipelines.end() )
 			{
+				auto program = getEngine()->getShaderProgramCache().tryGetAutomaticProgram( *this, flags );
+
+				if ( !program )
+				{
+					// The program is still being compiled, the nodes using it will be added later.
+					return { nullptr, 0u };
+				}
+
 				auto pipeline = castor::makeUnique< RenderPipeline >( *this
 					, renderSystem
 					, doCreateDepthStencilState( flags )
 					, doCreateRasterizationState( flags, cullMode )
 					, doCreateBlendState( flags )
 					, doCreateMultisampleState( flags )
-					, doGetProgram( flags )
+					, program
 					, flags );
 				pipeline->setViewport( makeViewport( m_size ) );
 
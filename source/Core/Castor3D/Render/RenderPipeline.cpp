@@ -3,7 +3,10 @@
 #include "Castor3D/Engine.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Miscellaneous/DebugName.hpp"
+#include "Castor3D/Miscellaneous/makeVkType.hpp"
+#include "Castor3D/Render/PipelineCache.hpp"
 #include "Castor3D/Render/PipelineFlags.hpp"
+#include "Castor3D/Render/RenderDevice.hpp"
 #include "Castor3D/Render/RenderNodesPass.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Scene/BillboardList.hpp"
@@ -11,8 +14,8 @@
 #include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Shader/Program.hpp"
 
+#include <ashespp/Core/Device.hpp>
 #include <ashespp/Descriptor/DescriptorSetLayout.hpp>
-#include <ashespp/Pipeline/GraphicsPipeline.hpp>
 #include <ashespp/Pipeline/GraphicsPipelineCreateInfo.hpp>
 #include <ashespp/Pipeline/PipelineInputAssemblyStateCreateInfo.hpp>
 #include <ashespp/Pipeline/PipelineLayout.hpp>
@@ -52,6 +55,11 @@ namespace castor3d
 	{
 	}
 
+	RenderPipeline::~RenderPipeline()noexcept
+	{
+		cleanup();
+	}
+
 	void RenderPipeline::initialise( RenderDevice const & device
 		, VkRenderPass renderPass )
 	{
@@ -143,13 +151,39 @@ namespace castor3d
 			*m_pipelineLayout,
 			renderPass
 		);
-		m_pipeline = device->createPipeline( mbName
-			, castor::move( createInfo ) );
+		// Created directly, to go through the device's pipeline cache.
+		auto res = device->vkCreateGraphicsPipelines( *device
+			, ( device.pipelineCache
+				? device.pipelineCache->getHandle()
+				: VkPipelineCache{} )
+			, 1u
+			, &static_cast< VkGraphicsPipelineCreateInfo const & >( createInfo )
+			, device->getAllocationCallbacks()
+			, &m_pipeline );
+		ashes::checkError( res, "Graphics pipeline creation" );
+		// Not created through ashes, so the debug name must be given here.
+#if VK_EXT_debug_utils
+		device->setDebugUtilsObjectName( makeVkStruct< VkDebugUtilsObjectNameInfoEXT >( VK_OBJECT_TYPE_PIPELINE
+			, uint64_t( m_pipeline )
+			, mbName.c_str() ) );
+#elif VK_EXT_debug_marker
+		device->debugMarkerSetObjectName( makeVkStruct< VkDebugMarkerObjectNameInfoEXT >( VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT
+			, uint64_t( m_pipeline )
+			, mbName.c_str() ) );
+#endif
+		m_device = &device;
 	}
 
 	void RenderPipeline::cleanup()
 	{
-		m_pipeline.reset();
+		if ( m_pipeline )
+		{
+			( *m_device )->vkDestroyPipeline( **m_device
+				, m_pipeline
+				, ( *m_device )->getAllocationCallbacks() );
+			m_pipeline = VkPipeline{};
+		}
+
 		m_pipelineLayout.reset();
 	}
 
@@ -5,6 +5,7 @@
 #include "Castor3D/Render/RenderQueue.hpp"
 
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/Buffer/ObjectBufferPool.hpp"
 #include "Castor3D/Event/Frame/GpuFunctorEvent.hpp"
 #include "Castor3D/Miscellaneous/makeVkType.hpp"
 #include "Castor3D/Render/RenderDevice.hpp"
@@ -93,6 +94,15 @@ namespace castor3d
 	void RenderQueue::update( ShadowMapLightTypeArray const & shadowMaps
 		, ShadowBuffer const * shadowBuffer )
 	{
+		if ( auto generation = getOwner()->getEngine()->getRenderDevice()->geometryPools->getGeneration();
+			generation != m_geometryGeneration )
+		{
+			// Geometry buffers have been moved or released by the pool compaction, nodes need to be regrouped.
+			m_geometryGeneration = generation;
+			m_culledChanged = true;
+			m_fullSort = true;
+		}
+
 		if ( hasCommandBuffer() )
 		{
 			m_toDelete.reset();
@@ -2,13 +2,16 @@
 
 #include "Castor3D/Config.hpp"
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/RequiredVersion.hpp"
 #include "Castor3D/Buffer/GpuBuffer.hpp"
 #include "Castor3D/Render/RenderDevice.hpp"
 #include "Castor3D/Shader/GlslToSpv.hpp"
 #include "Castor3D/Shader/Program.hpp"
+#include "Castor3D/Shader/SpirVCache.hpp"
 
 #include <CastorUtils/Data/BinaryFile.hpp>
 #include <CastorUtils/Math/Angle.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
 #include <CastorUtils/Math/SquareMatrix.hpp>
 #include <CastorUtils/Align/Aligned.hpp>
 
@@ -18,12 +21,14 @@
 #include <ashespp/Core/Surface.hpp>
 #include <ashespp/Image/Image.hpp>
 
+#include <ShaderAST/Visitors/DebugDisplayStatements.hpp>
 #include <ShaderWriter/Source.hpp>
 #include <CompilerSpirV/compileSpirV.hpp>
 #if C3D_HasGLSL
 #	include <CompilerGlsl/compileGlsl.hpp>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <random>
 
@@ -536,6 +541,53 @@ namespace castor3d
 			return result;
 		}
 
+		static void hashString( uint64_t & hash
+			, std::string_view value )
+		{
+			castor::hashFnv1a64( hash, uint64_t( value.size() ) );
+			castor::hashFnv1a64( hash, value.data(), value.size() );
+		}
+
+		static uint64_t getSpirVCacheKey( Engine const & engine
+			, ast::stmt::Container * statements
+			, ast::EntryPointConfig const & entryPoint
+			, spirv::SpirVConfig const & config )
+		{
+			// The key is persisted, so it only uses FNV-1a, which result is the same from one run, or build, to another.
+			// The statements are hashed through their text dump, the ShaderWriter version accounts for changes in the SPIR-V generator.
+			uint64_t result = castor::Fnv1a64Basis;
+			hashString( result, ast::debug::displayStatements( statements ) );
+			hashString( result, C3D_ShaderWriterVersion );
+			castor::hashFnv1a64( result, engine.getVersion().getVkVersion() );
+			castor::hashFnv1a64( result, uint32_t( entryPoint.stage ) );
+			hashString( result, entryPoint.name );
+			castor::hashFnv1a64( result, uint32_t( config.specVersion ) );
+			castor::hashFnv1a64( result, uint32_t( config.debugLevel ) );
+
+			// Sorted by name, so that the key doesn't depend on the set's ordering.
+			castor::Vector< spirv::SpirVExtension const * > extensions;
+
+			for ( auto & extension : *config.availableExtensions )
+			{
+				extensions.push_back( &extension );
+			}
+
+			std::sort( extensions.begin()
+				, extensions.end()
+				, []( spirv::SpirVExtension const * lhs, spirv::SpirVExtension const * rhs )
+				{
+					return lhs->name < rhs->name;
+				} );
+
+			for ( auto extension : extensions )
+			{
+				hashString( result, extension->name );
+				castor::hashFnv1a64( result, uint32_t( extension->specVersion ) );
+			}
+
+			return result;
+		}
+
 		static std::default_random_engine createRandomEngine( bool disableRandomSeed )
 		{
 			if ( disableRandomSeed )
@@ -606,6 +658,17 @@ namespace castor3d
 			, castor::move( pdeviceExtensions ) );
 		doCreateRandomStorage( *m_device );
 
+		if ( getEngine()->isSpirVDiskCacheEnabled() )
+		{
+			auto spirvCacheFolder = Engine::getEngineDirectory() / cuT( "Cache" ) / cuT( "SpirV" );
+
+			if ( castor::File::directoryExists( spirvCacheFolder )
+				|| castor::File::directoryCreate( spirvCacheFolder ) )
+			{
+				m_spirvCache = castor::makeUnique< SpirVCache >( spirvCacheFolder );
+			}
+		}
+
 		static castor::Map< uint32_t, castor::String > vendors
 		{
 			{ 0x1002, cuT( "AMD" ) },
@@ -913,8 +976,31 @@ namespace castor3d
 		ast::stmt::StmtCache compileStmtCache{ *allocator };
 		ast::expr::ExprCache compileExprCache{ *allocator };
 		auto statements = ast::selectEntryPoint( compileStmtCache, compileExprCache, entryPoint, *shader.getStatements() );
+		// The text outputs need the compiled module, so the cache is only used when they aren't requested.
+		auto useCache = m_spirvCache
+			&& !getEngine()->areTextShadersKept()
+			&& !getEngine()->isShaderValidationEnabled();
+		uint64_t cacheKey{};
+
+		if ( useCache )
+		{
+			cacheKey = rendsys::getSpirVCacheKey( *getEngine(), statements.get(), entryPoint, spirvConfig );
+
+			if ( m_spirvCache->tryLoad( cacheKey, result.spirv ) )
+			{
+				log::debug << " Cached." << std::endl;
+				return result;
+			}
+		}
+
 		auto shaderModule = spirv::compileSpirV( *allocator, shader, statements.get(), entryPoint.stage, spirvConfig );
 		result.spirv = spirv::serialiseModule( *shaderModule );
+
+		if ( useCache )
+		{
+			m_spirvCache->store( cacheKey, result.spirv );
+		}
+
 		castor::MbString glsl;
 
 #if C3D_HasGLSL
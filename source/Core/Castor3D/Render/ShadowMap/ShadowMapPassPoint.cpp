@@ -177,21 +177,21 @@ namespace castor3d
 						, pipelineID
 						, writer.cast< sdw::UInt >( getEngine()->getRenderDevice()->hasDrawId() ? in.drawID : drawID )
 						, flags ) );
+				auto modelData = writer.declLocale( "modelData"
+					, c3d_modelsData[nodeId - 1u] );
 				auto curPosition = writer.declLocale( "curPosition"
-					, in.position );
+					, modelData.unpackPosition( flags, in.position ) );
 				auto curNormal = writer.declLocale( "curNormal"
-					, in.normal );
+					, in.getNormal( flags, utils ) );
 				auto curTangent = writer.declLocale( "curTangent"
-					, in.tangent );
+					, in.getTangent( flags, utils ) );
 				auto curBitangent = writer.declLocale( "curBitangent"
-					, in.bitangent );
+					, in.getBitangent( flags, utils ) );
 				out.texture0 = in.texture0;
 				out.texture1 = in.texture1;
 				out.texture2 = in.texture2;
 				out.texture3 = in.texture3;
 				out.colour = in.colour;
-				auto modelData = writer.declLocale( "modelData"
-					, c3d_modelsData[nodeId - 1u] );
 				auto material = writer.declLocale( "material"
 					, materials.getMaterial( modelData.getMaterialId() ) );
 				material.getPassMultipliers( flags
@@ -2,6 +2,7 @@
 
 #include "Castor3D/DebugDefines.hpp"
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/Buffer/ObjectBufferPool.hpp"
 #include "Castor3D/Limits.hpp"
 #include "Castor3D/Cache/OverlayCache.hpp"
 #include "Castor3D/Event/Frame/CpuFunctorEvent.hpp"
@@ -14,6 +15,7 @@
 #include "Castor3D/Miscellaneous/makeVkType.hpp"
 #include "Castor3D/Model/Mesh/Mesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/PackedVerticesComponent.hpp"
 #include "Castor3D/Model/Skeleton/Skeleton.hpp"
 #include "Castor3D/Overlay/Overlay.hpp"
 #include "Castor3D/Render/RenderInfo.hpp"
@@ -70,6 +72,144 @@ namespace castor3d
 
 	//*************************************************************************************************
 
+	namespace scn
+	{
+		static size_t constexpr ObjectsGrain = 64u;
+
+		static bool updateGeometry( Geometry & geometry )
+		{
+			bool dirty = false;
+
+			for ( auto const & [pass, submeshes] : geometry.getIds() )
+			{
+				for ( auto & [_, rendered] : submeshes )
+				{
+					auto const & submesh = rendered.second->data;
+
+					if ( submesh.isInitialised() )
+					{
+						geometry.fillEntry( rendered.first
+							, *pass
+							, *geometry.getParent()
+							, submesh.getMeshletsCount()
+							, submesh.getIndexCount()
+							, submesh.getPointsCount()
+							, rendered.second->modelData );
+
+						if ( auto packing = submesh.getComponent< PackedVerticesComponent >() )
+						{
+							packing->getData().fillModelData( rendered.second->modelData );
+						}
+
+						geometry.fillEntryOffsets( rendered.first
+							, submesh.getVertexOffset( geometry, *pass )
+							, submesh.getIndexOffset()
+							, submesh.getMeshletOffset() );
+					}
+					else
+					{
+						dirty = true;
+					}
+				}
+
+				dirty = dirty || pass->getId() == 0;
+			}
+
+			return dirty;
+		}
+
+		static bool updateBillboard( BillboardBase & object )
+		{
+			bool dirty = false;
+
+			for ( auto & [pass, billboard] : object.getIds() )
+			{
+				object.fillEntry( billboard.first
+					, *pass
+					, *object.getNode()
+					, 0u
+					, 0u
+					, 0u
+					, billboard.second->modelData );
+				object.fillEntryOffsets( billboard.first
+					, 0u
+					, 0u
+					, 0u );
+				object.fillData( billboard.second->billboardData );
+				dirty = dirty || pass->getId() == 0;
+			}
+
+			return dirty;
+		}
+
+		// The particles write their times in the updater, they hence get their own one to run alongside the other stages.
+		static CpuUpdater makeParticlesUpdater( CpuUpdater const & updater )
+		{
+			CpuUpdater result;
+			result.scene = updater.scene;
+			result.camera = updater.camera;
+			result.tslf = updater.tslf;
+			return result;
+		}
+
+		// Runs the update stages as jobs, each one starting once the stages it depends on are done.
+		// The job system only logs the jobs errors, the first one is hence kept, to be rethrown on the calling thread.
+		class UpdateGraph
+		{
+		public:
+			explicit UpdateGraph( castor::JobSystem & jobs )
+				: m_jobs{ jobs }
+			{
+			}
+
+			castor::JobHandle add( castor::Vector< castor::JobHandle > const & dependencies
+				, castor::JobSystem::Job job )
+			{
+				auto result = m_jobs.pushJob( dependencies
+					, [this, job = castor::move( job )]()
+					{
+						try
+						{
+							job();
+						}
+						catch ( ... )
+						{
+							auto lock( castor::makeUniqueLock( m_errorMutex ) );
+
+							if ( !m_error )
+							{
+								m_error = std::current_exception();
+							}
+						}
+					} );
+				m_stages.push_back( result );
+				return result;
+			}
+
+			void wait()
+			{
+				// The stages reference the scene and the updater, they must all end before rethrowing.
+				for ( auto const & stage : m_stages )
+				{
+					m_jobs.wait( stage );
+				}
+
+				if ( m_error )
+				{
+					std::rethrow_exception( m_error );
+				}
+			}
+
+		private:
+			castor::JobSystem & m_jobs;
+			castor::Vector< castor::JobHandle > m_stages;
+			castor::Mutex m_errorMutex;
+			std::exception_ptr m_error;
+		};
+	}
+
+	//*************************************************************************************************
+
 	template<>
 	inline void CacheViewT< OverlayCache, EventType( CpuEventType::ePreGpuStep ) >::clear()
 	{
@@ -279,7 +419,6 @@ namespace castor3d
 		auto mbName = castor::toUtf8( getName() );
 		m_timerParticlesGpu = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/ParticlesGPU", crg::TimerScope::eUpdate );
 		engine.registerTimer( getName() + cuT( "/ParticlesGPU" ), *m_timerParticlesGpu );
-#if C3D_DebugTimers
 		m_timerSceneNodes = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/SceneNodes", crg::TimerScope::eUpdate );
 		engine.registerTimer( getName() + cuT( "/SceneNodes" ), *m_timerSceneNodes );
 		m_timerBoundingBox = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/BoundingBoxes", crg::TimerScope::eUpdate );
@@ -290,10 +429,13 @@ namespace castor3d
 		engine.registerTimer( getName() + cuT( "/Lights" ), *m_timerLights );
 		m_timerParticlesCpu = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/ParticlesCPU", crg::TimerScope::eUpdate );
 		engine.registerTimer( getName() + cuT( "/ParticlesCPU" ), *m_timerParticlesCpu );
-		m_timerGpuUpdate = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/GPUUpdate", crg::TimerScope::eUpdate );
-		engine.registerTimer( getName() + cuT( "/GPUUpdate" ), *m_timerGpuUpdate );
 		m_timerMovables = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/Movables", crg::TimerScope::eUpdate );
 		engine.registerTimer( getName() + cuT( "/Movables" ), *m_timerMovables );
+		m_timerCpuUpdate = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/CPUUpdate", crg::TimerScope::eUpdate );
+		engine.registerTimer( getName() + cuT( "/CPUUpdate" ), *m_timerCpuUpdate );
+#if C3D_DebugTimers
+		m_timerGpuUpdate = castor::makeUnique< crg::FramePassTimer >( device.makeContext(), mbName + "/GPUUpdate", crg::TimerScope::eUpdate );
+		engine.registerTimer( getName() + cuT( "/GPUUpdate" ), *m_timerGpuUpdate );
 #endif
 
 		m_animatedObjectGroupCache->initialise( device );
@@ -308,9 +450,7 @@ namespace castor3d
 
 	void Scene::updateBoundingBox()
 	{
-#if C3D_DebugTimers
 		auto block( m_timerBoundingBox ? castor::make_unique< crg::FramePassTimerBlock >( m_timerBoundingBox->start() ) : nullptr );
-#endif
 		auto & cache = *m_geometryCache;
 		auto lock( castor::makeUniqueLock( cache ) );
 
@@ -350,6 +490,7 @@ namespace castor3d
 	{
 		m_initialised = false;
 		m_dirtyNodes.clear();
+		m_queuedNodes.clear();
 		m_dirtyBillboards.clear();
 		m_dirtyObjects.clear();
 
@@ -387,7 +528,6 @@ namespace castor3d
 			} ) );
 
 		auto & engine = *getEngine();
-#if C3D_DebugTimers
 		engine.unregisterTimer( getName() + cuT( "/SceneNodes" ), *m_timerSceneNodes );
 		m_timerSceneNodes.reset();
 		engine.unregisterTimer( getName() + cuT( "/BoundingBoxes" ), *m_timerBoundingBox );
@@ -398,10 +538,13 @@ namespace castor3d
 		m_timerLights.reset();
 		engine.unregisterTimer( getName() + cuT( "/ParticlesCPU" ), *m_timerParticlesCpu );
 		m_timerParticlesCpu.reset();
-		engine.unregisterTimer( getName() + cuT( "/GPUUpdate" ), *m_timerGpuUpdate );
-		m_timerGpuUpdate.reset();
 		engine.unregisterTimer( getName() + cuT( "/Movables" ), *m_timerMovables );
 		m_timerMovables.reset();
+		engine.unregisterTimer( getName() + cuT( "/CPUUpdate" ), *m_timerCpuUpdate );
+		m_timerCpuUpdate.reset();
+#if C3D_DebugTimers
+		engine.unregisterTimer( getName() + cuT( "/GPUUpdate" ), *m_timerGpuUpdate );
+		m_timerGpuUpdate.reset();
 #endif
 		engine.unregisterTimer( getName() + cuT( "/ParticlesGPU" ), *m_timerParticlesGpu );
 		m_timerParticlesGpu.reset();
@@ -430,24 +573,63 @@ namespace castor3d
 	{
 		if ( m_initialised )
 		{
+			auto block( m_timerCpuUpdate->start() );
 			onUpdate( *this );
 			updater.scene = this;
 			auto & sceneObjs = updater.dirtyScenes.try_emplace( this ).first->second;
 			doGatherDirty( sceneObjs );
-			doUpdateSceneNodes( sceneObjs );
-			m_animatedObjectGroupCache->update( updater );
-			doUpdateMovables( updater, sceneObjs );
-
-			if ( !sceneObjs.dirtyGeometries.empty()
-				|| !sceneObjs.dirtyNodes.empty() )
-			{
-				updateBoundingBox();
-			}
-
-			doUpdateMaterials();
-			doUpdateLights( updater, sceneObjs );
-			m_renderNodes->update( updater );
-			doUpdateParticles( updater );
+			// The materials and particles don't depend on the other stages.
+			// The animations move the nodes, hence run once their transforms are updated.
+			// The movables and lights read the nodes transforms, the animations being done.
+			// The movables run after the animations, both marking objects dirty, which keeps the dirty lists order.
+			// The render nodes and the bounding box read the movables data.
+			auto particlesUpdater = scn::makeParticlesUpdater( updater );
+			scn::UpdateGraph graph{ getEngine()->getFrameJobs() };
+			graph.add( {}
+				, [this]()
+				{
+					doUpdateMaterials();
+				} );
+			graph.add( {}
+				, [this, &particlesUpdater]()
+				{
+					doUpdateParticles( particlesUpdater );
+				} );
+			auto nodes = graph.add( {}
+				, [this, &sceneObjs]()
+				{
+					doUpdateSceneNodes( sceneObjs );
+				} );
+			auto animations = graph.add( { nodes }
+				, [this, &updater]()
+				{
+					m_animatedObjectGroupCache->update( updater );
+				} );
+			auto movables = graph.add( { animations }
+				, [this, &updater, &sceneObjs]()
+				{
+					doUpdateMovables( updater, sceneObjs );
+				} );
+			graph.add( { animations }
+				, [this, &updater, &sceneObjs]()
+				{
+					doUpdateLights( updater, sceneObjs );
+				} );
+			graph.add( { movables }
+				, [this, &updater]()
+				{
+					m_renderNodes->update( updater );
+				} );
+			graph.add( { movables }
+				, [this, &sceneObjs]()
+				{
+					if ( !sceneObjs.dirtyGeometries.empty()
+						|| !sceneObjs.dirtyNodes.empty() )
+					{
+						updateBoundingBox();
+					}
+				} );
+			graph.wait();
 			doUpdateLightsDependent();
 			m_changed = false;
 		}
@@ -684,44 +866,15 @@ namespace castor3d
 		{
 			auto & curNode = *work.back();
 			work.pop_back();
-			auto it = std::find( m_dirtyNodes.begin()
-				, m_dirtyNodes.end()
-				, &curNode );
-
-			if ( it != m_dirtyNodes.end() )
-			{
-				m_dirtyNodes.erase( it );
-			}
-
-			auto parent = curNode.getParent();
 
-			if ( !parent )
-			{
-				it = m_dirtyNodes.begin();
-			}
-			else
+			// A queued node has its descendants queued too.
+			// The order doesn't matter, the nodes transforms being updated level by level.
+			if ( !m_queuedNodes.insert( &curNode ).second )
 			{
-				do
-				{
-					it = std::find( m_dirtyNodes.begin()
-						, m_dirtyNodes.end()
-						, parent );
-					parent = parent->getParent();
-
-				}
-				while ( parent && it == m_dirtyNodes.end() );
-
-				if ( it == m_dirtyNodes.end() )
-				{
-					it = m_dirtyNodes.begin();
-				}
-				else
-				{
-					it = std::next( it );
-				}
+				continue;
 			}
 
-			m_dirtyNodes.insert( it, &curNode );
+			m_dirtyNodes.push_back( &curNode );
 
 			for ( auto & object : curNode.getObjects() )
 			{
@@ -891,6 +1044,31 @@ namespace castor3d
 
 	void Scene::doGatherDirty( CpuUpdater::DirtyObjects & sceneObjs )
 	{
+		if ( auto device = getEngine()->getRenderDevice();
+			device && device->geometryPools
+			&& device->geometryPools->getGeneration() != m_geometryGeneration )
+		{
+			// Geometries with submeshes moved by the pool compaction need their offsets to be updated.
+			using LockType = castor::UniqueLock< GeometryCache >;
+			LockType lock{ castor::makeUniqueLock( *m_geometryCache ) };
+
+			for ( auto const & [_, geometry] : *m_geometryCache )
+			{
+				if ( auto mesh = geometry->getMesh();
+					mesh && std::any_of( mesh->begin()
+						, mesh->end()
+						, [this]( SubmeshUPtr const & submesh )
+						{
+							return submesh->getRelocation() > m_geometryGeneration;
+						} ) )
+				{
+					markDirty( *geometry );
+				}
+			}
+
+			m_geometryGeneration = device->geometryPools->getGeneration();
+		}
+
 		sceneObjs.dirtyNodes.insert( sceneObjs.dirtyNodes.end()
 			, m_dirtyNodes.begin()
 			, m_dirtyNodes.end() );
@@ -939,96 +1117,66 @@ namespace castor3d
 		m_dirtyBillboards.clear();
 		m_dirtyObjects.clear();
 		m_dirtyNodes.clear();
+		m_queuedNodes.clear();
 	}
 
-	void Scene::doUpdateSceneNodes( CpuUpdater::DirtyObjects const & sceneObjs )const
+	void Scene::doUpdateSceneNodes( CpuUpdater::DirtyObjects const & sceneObjs )
 	{
-#if C3D_DebugTimers
 		auto block( m_timerSceneNodes->start() );
-#endif
-
-		for ( auto & node : sceneObjs.dirtyNodes )
-		{
-			node->update();
-		}
+		m_sceneNodeCache->getTransforms().update( getEngine()->getFrameJobs()
+			, *m_rootNode
+			, sceneObjs.dirtyNodes
+			, m_nodesHierarchyChanged.exchange( false ) );
 	}
 
 	void Scene::doUpdateMovables( CpuUpdater & updater
 		, CpuUpdater::DirtyObjects & sceneObjs )
 	{
-#if C3D_DebugTimers
 		auto block( m_timerMovables->start() );
-#endif
 
 		for ( auto camera : sceneObjs.dirtyCameras )
 		{
 			camera->update();
 		}
 
-		for ( auto object : sceneObjs.dirtyGeometries )
-		{
-			bool dirty = false;
-			auto & geometry = *object;
-
-			for ( auto const & [pass, submeshes] : geometry.getIds() )
+		// Each object only writes its own entries, the objects to mark dirty are gathered
+		// and processed afterwards, in their original order, to keep the result deterministic.
+		auto & jobs = getEngine()->getFrameJobs();
+		castor::Vector< uint8_t > dirtyGeometries( sceneObjs.dirtyGeometries.size(), 0u );
+		jobs.parallelFor( sceneObjs.dirtyGeometries.size()
+			, [&sceneObjs, &dirtyGeometries]( size_t begin, size_t end )
 			{
-				for ( auto & [_, rendered] : submeshes )
+				for ( auto i = begin; i < end; ++i )
 				{
-					auto const & submesh = rendered.second->data;
-
-					if ( submesh.isInitialised() )
-					{
-						geometry.fillEntry( rendered.first
-							, *pass
-							, *geometry.getParent()
-							, submesh.getMeshletsCount()
-							, submesh.getIndexCount()
-							, submesh.getPointsCount()
-							, rendered.second->modelData );
-						geometry.fillEntryOffsets( rendered.first
-							, submesh.getVertexOffset( geometry, *pass )
-							, submesh.getIndexOffset()
-							, submesh.getMeshletOffset() );
-					}
-					else
-					{
-						markDirty( geometry );
-					}
+					dirtyGeometries[i] = scn::updateGeometry( *sceneObjs.dirtyGeometries[i] ) ? 1u : 0u;
 				}
-
-				dirty = dirty || pass->getId() == 0;
 			}
+			, scn::ObjectsGrain );
 
-			if ( dirty )
+		castor::Vector< uint8_t > dirtyBillboards( sceneObjs.dirtyBillboards.size(), 0u );
+		jobs.parallelFor( sceneObjs.dirtyBillboards.size()
+			, [&sceneObjs, &dirtyBillboards]( size_t begin, size_t end )
 			{
-				markDirty( geometry );
+				for ( auto i = begin; i < end; ++i )
+				{
+					dirtyBillboards[i] = scn::updateBillboard( *sceneObjs.dirtyBillboards[i] ) ? 1u : 0u;
+				}
 			}
-		}
+			, scn::ObjectsGrain );
 
-		for ( auto object : sceneObjs.dirtyBillboards )
+		for ( size_t i = 0u; i < dirtyGeometries.size(); ++i )
 		{
-			bool dirty = false;
-
-			for ( auto & [pass, billboard] : object->getIds() )
+			if ( dirtyGeometries[i] )
 			{
-				object->fillEntry( billboard.first
-					, *pass
-					, *object->getNode()
-					, 0u
-					, 0u
-					, 0u
-					, billboard.second->modelData );
-				object->fillEntryOffsets( billboard.first
-					, 0u
-					, 0u
-					, 0u );
-				object->fillData( billboard.second->billboardData );
-				dirty = dirty || pass->getId() == 0;
+				markDirty( *sceneObjs.dirtyGeometries[i] );
 			}
+		}
 
-			if ( dirty )
+		for ( size_t i = 0u; i < dirtyBillboards.size(); ++i )
+		{
+			if ( dirtyBillboards[i] )
 			{
-				markDirty( *object );
+				markDirty( *sceneObjs.dirtyBillboards[i] );
 			}
 		}
 	}
@@ -1036,9 +1184,7 @@ namespace castor3d
 	void Scene::doUpdateLights( CpuUpdater & updater
 		, CpuUpdater::DirtyObjects const & sceneObjs )
 	{
-#if C3D_DebugTimers
 		auto block( m_timerLights->start() );
-#endif
 
 		for ( auto const & light : sceneObjs.dirtyLights )
 		{
@@ -1052,9 +1198,7 @@ namespace castor3d
 
 	void Scene::doUpdateParticles( CpuUpdater & updater )
 	{
-#if C3D_DebugTimers
 		auto block( m_timerParticlesCpu->start() );
-#endif
 		auto & cache = getParticleSystemCache();
 		auto lock( castor::makeUniqueLock( cache ) );
 		updater.index = 0u;
@@ -1087,17 +1231,15 @@ namespace castor3d
 
 	void Scene::doUpdateMaterials()
 	{
-#if C3D_DebugTimers
 		auto block( m_timerMaterials->start() );
-#endif
 
-		if ( m_dirtyMaterials )
+		if ( m_dirtyMaterials.exchange( false ) )
 		{
 			auto const & cache = getEngine()->getMaterialCache();
+			bool needsSubsurfaceScattering{};
+			bool hasTransparentObjects{};
+			bool hasOpaqueObjects{};
 			cache.lock();
-			m_needsSubsurfaceScattering = false;
-			m_hasTransparentObjects = false;
-			m_hasOpaqueObjects = false;
 
 			for ( auto & matName : *m_materialCacheView )
 			{
@@ -1105,19 +1247,21 @@ namespace castor3d
 				{
 					if ( auto material = cache.findNoLock( matName ) )
 					{
-						m_needsSubsurfaceScattering |= material->hasSubsurfaceScattering();
+						needsSubsurfaceScattering |= material->hasSubsurfaceScattering();
 
 						for ( auto const & pass : *material )
 						{
-							m_hasTransparentObjects |= pass->hasAlphaBlending();
-							m_hasOpaqueObjects |= !pass->hasOnlyAlphaBlending();
+							hasTransparentObjects |= pass->hasAlphaBlending();
+							hasOpaqueObjects |= !pass->hasOnlyAlphaBlending();
 						}
 					}
 				}
 			}
 
 			cache.unlock();
-			m_dirtyMaterials = false;
+			m_needsSubsurfaceScattering = needsSubsurfaceScattering;
+			m_hasTransparentObjects = hasTransparentObjects;
+			m_hasOpaqueObjects = hasOpaqueObjects;
 		}
 	}
 
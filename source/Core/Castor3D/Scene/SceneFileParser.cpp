@@ -46,6 +46,7 @@ namespace castor3d
 		getData().overlays->root = &getData();
 		getData().gui->root = &getData();
 		getData().progress = progress;
+		setJobSystem( &engine.getCpuJobs() );
 
 		for ( auto const & [name, parsers] : getEngine()->getAdditionalParsers() )
 		{
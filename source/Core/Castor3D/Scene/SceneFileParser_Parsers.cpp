@@ -213,6 +213,70 @@ namespace castor3d
 				{
 					parameters.add( cuT( "invert_normals" ), true );
 				}
+				else if ( param.find( cuT( "lod_count" ) ) == 0 )
+				{
+					if ( auto eqIndex = param.find( cuT( '=' ) );
+						eqIndex != castor::String::npos )
+					{
+						uint32_t value;
+						castor::string::parse< uint32_t >( param.substr( eqIndex + 1 ), value );
+						parameters.add( cuT( "lod_count" ), value );
+					}
+					else
+					{
+						CU_ParsingError( cuT( "Malformed parameter -lod_count=<uint>." ) );
+					}
+				}
+				else if ( param.find( cuT( "lod_ratio" ) ) == 0 )
+				{
+					if ( auto eqIndex = param.find( cuT( '=' ) );
+						eqIndex != castor::String::npos )
+					{
+						float value;
+						castor::string::parse< float >( param.substr( eqIndex + 1 ), value );
+						parameters.add( cuT( "lod_ratio" ), value );
+					}
+					else
+					{
+						CU_ParsingError( cuT( "Malformed parameter -lod_ratio=<float>." ) );
+					}
+				}
+				else if ( param.find( cuT( "lod_error" ) ) == 0 )
+				{
+					if ( auto eqIndex = param.find( cuT( '=' ) );
+						eqIndex != castor::String::npos )
+					{
+						float value;
+						castor::string::parse< float >( param.substr( eqIndex + 1 ), value );
+						parameters.add( cuT( "lod_error" ), value );
+					}
+					else
+					{
+						CU_ParsingError( cuT( "Malformed parameter -lod_error=<float>." ) );
+					}
+				}
+				else if ( param.find( cuT( "lod_pixel_error" ) ) == 0 )
+				{
+					if ( auto eqIndex = param.find( cuT( '=' ) );
+						eqIndex != castor::String::npos )
+					{
+						float value;
+						castor::string::parse< float >( param.substr( eqIndex + 1 ), value );
+						parameters.add( cuT( "lod_pixel_error" ), value );
+					}
+					else
+					{
+						CU_ParsingError( cuT( "Malformed parameter -lod_pixel_error=<float>." ) );
+					}
+				}
+				else if ( param.find( cuT( "lod_sloppy" ) ) == 0 )
+				{
+					parameters.add( cuT( "lod_sloppy" ), true );
+				}
+				else if ( param.find( cuT( "pack_vertices" ) ) == 0 )
+				{
+					parameters.add( cuT( "pack_vertices" ), true );
+				}
 				else if ( param.find( cuT( "preferred_importer" ) ) == 0 )
 				{
 					if ( auto eqIndex = param.find( cuT( '=' ) );
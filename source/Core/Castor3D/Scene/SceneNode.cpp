@@ -316,6 +316,11 @@ namespace castor3d
 
 	castor::Point3f SceneNode::getDerivedPosition()const
 	{
+		if ( !isModified() )
+		{
+			return castor::Point3f{ m_derivedTransform[3][0], m_derivedTransform[3][1], m_derivedTransform[3][2] };
+		}
+
 		castor::Point3f result( m_position );
 
 		if ( auto parent = getParent() )
@@ -328,6 +333,11 @@ namespace castor3d
 
 	castor::Quaternion SceneNode::getDerivedOrientation()const
 	{
+		if ( !isModified() )
+		{
+			return m_derivedOrientation;
+		}
+
 		castor::Quaternion result( m_orientation );
 
 		if ( auto parent = getParent() )
@@ -340,6 +350,11 @@ namespace castor3d
 
 	castor::Point3f SceneNode::getDerivedScale()const
 	{
+		if ( !isModified() )
+		{
+			return m_derivedScale;
+		}
+
 		castor::Point3f result( m_scale );
 
 		if ( auto parent = getParent() )
@@ -412,10 +427,15 @@ namespace castor3d
 			{
 				parent->doComputeMatrix();
 				m_derivedTransform = parent->getDerivedTransformationMatrix() * m_transform;
+				m_derivedOrientation = m_orientation * parent->m_derivedOrientation;
+				m_derivedScale = m_scale;
+				m_derivedScale *= parent->m_derivedScale;
 			}
 			else
 			{
 				m_derivedTransform = m_transform;
+				m_derivedOrientation = m_orientation;
+				m_derivedScale = m_scale;
 			}
 
 			m_derivedMtxChanged = false;
@@ -453,7 +473,10 @@ namespace castor3d
 				m_displayable = m_parent->m_displayable;
 				m_parent->addChild( *this );
 				m_mtxChanged = true;
+				doUpdateChildsDerivedTransform();
 			}
+
+			m_scene.markNodesHierarchyChanged();
 		}
 	}
 
@@ -467,6 +490,8 @@ namespace castor3d
 			m_parent = nullptr;
 			parent->detachChild( *this );
 			m_mtxChanged = true;
+			doUpdateChildsDerivedTransform();
+			m_scene.markNodesHierarchyChanged();
 			markDirty();
 		}
 	}
@@ -0,0 +1,219 @@
+#include "Castor3D/Scene/SceneNodeTransforms.hpp"
+
+#include "Castor3D/Scene/SceneNode.hpp"
+
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
+namespace castor3d
+{
+	//*********************************************************************************************
+
+	namespace scntfm
+	{
+		static size_t constexpr NodesGrain = 256u;
+		static size_t constexpr GatherGrain = 1024u;
+	}
+
+	//*********************************************************************************************
+
+	void SceneNodeTransforms::update( castor::JobSystem & jobs
+		, SceneNode & rootNode
+		, castor::Vector< SceneNode * > const & dirtyNodes
+		, bool hierarchyChanged )
+	{
+		if ( hierarchyChanged || m_nodes.empty() )
+		{
+			// All the nodes are gathered again.
+			doSort( rootNode );
+			jobs.parallelFor( m_nodes.size()
+				, [this]( size_t begin, size_t end )
+				{
+					for ( auto i = begin; i < end; ++i )
+					{
+						doGather( uint32_t( i ) );
+					}
+				}
+				, scntfm::GatherGrain );
+		}
+		else if ( dirtyNodes.empty() )
+		{
+			return;
+		}
+		else
+		{
+			jobs.parallelFor( dirtyNodes.size()
+				, [this, &dirtyNodes]( size_t begin, size_t end )
+				{
+					for ( auto i = begin; i < end; ++i )
+					{
+						if ( auto index = getIndex( *dirtyNodes[i] );
+							index != InvalidIndex )
+						{
+							doGather( index );
+						}
+					}
+				}
+				, scntfm::GatherGrain );
+		}
+
+		// The nodes out of the hierarchy are updated on their own.
+		for ( auto node : dirtyNodes )
+		{
+			if ( getIndex( *node ) == InvalidIndex )
+			{
+				node->update();
+			}
+		}
+
+		for ( auto const & level : m_levels )
+		{
+			jobs.parallelFor( level.end - level.begin
+				, [this, &level]( size_t begin, size_t end )
+				{
+					doUpdateLevel( uint32_t( level.begin + begin )
+						, uint32_t( level.begin + end ) );
+				}
+				, scntfm::NodesGrain );
+		}
+
+		std::fill( m_changed.begin(), m_changed.end(), uint8_t{} );
+	}
+
+	uint32_t SceneNodeTransforms::getIndex( SceneNode const & node )const noexcept
+	{
+		auto index = node.m_transformIndex;
+		return ( index < m_nodes.size() && m_nodes[index] == &node )
+			? index
+			: InvalidIndex;
+	}
+
+	void SceneNodeTransforms::multiply( castor::Matrix4x4f const & lhs
+		, castor::Matrix4x4f const & rhs
+		, castor::Matrix4x4f & result )
+	{
+		// Uses the SIMD float 4x4 matrices product, the result can be one of the operands.
+		result = lhs * rhs;
+	}
+
+	void SceneNodeTransforms::doSort( SceneNode & rootNode )
+	{
+		// Breadth first traversal, giving the nodes sorted by depth.
+		m_nodes.clear();
+		m_parents.clear();
+		m_levels.clear();
+		m_nodes.push_back( &rootNode );
+		m_parents.push_back( InvalidIndex );
+		uint32_t begin{};
+
+		while ( begin < m_nodes.size() )
+		{
+			auto end = uint32_t( m_nodes.size() );
+			m_levels.push_back( { begin, end } );
+
+			for ( auto index = begin; index < end; ++index )
+			{
+				for ( auto const & [_, child] : m_nodes[index]->getChildren() )
+				{
+					if ( child )
+					{
+						m_nodes.push_back( child );
+						m_parents.push_back( index );
+					}
+				}
+			}
+
+			begin = end;
+		}
+
+		auto count = m_nodes.size();
+		m_positions.resize( count );
+		m_orientations.resize( count );
+		m_scales.resize( count );
+		m_matrixSet.resize( count );
+		m_locals.resize( count );
+		m_worlds.resize( count );
+		m_derivedOrientations.resize( count );
+		m_derivedScales.resize( count );
+		m_dirty.assign( count, 0u );
+		m_changed.assign( count, 0u );
+
+		for ( uint32_t index = 0u; index < count; ++index )
+		{
+			m_nodes[index]->m_transformIndex = index;
+		}
+	}
+
+	void SceneNodeTransforms::doGather( uint32_t index )
+	{
+		auto & node = *m_nodes[index];
+		m_positions[index] = node.m_position;
+		m_orientations[index] = node.m_orientation;
+		m_scales[index] = node.m_scale;
+		m_matrixSet[index] = node.m_mtxSet ? 1u : 0u;
+
+		if ( node.m_mtxSet )
+		{
+			m_locals[index] = node.m_transform;
+		}
+
+		m_dirty[index] = 1u;
+	}
+
+	void SceneNodeTransforms::doUpdateLevel( uint32_t begin
+		, uint32_t end )
+	{
+		for ( auto index = begin; index < end; ++index )
+		{
+			auto parent = m_parents[index];
+			auto dirty = m_dirty[index] != 0u;
+
+			if ( !dirty
+				&& ( parent == InvalidIndex || m_changed[parent] == 0u ) )
+			{
+				continue;
+			}
+
+			if ( dirty && !m_matrixSet[index] )
+			{
+				castor::matrix::setTransform( m_locals[index]
+					, m_positions[index]
+					, m_scales[index]
+					, m_orientations[index] );
+			}
+
+			if ( parent == InvalidIndex )
+			{
+				m_worlds[index] = m_locals[index];
+				m_derivedOrientations[index] = m_orientations[index];
+				m_derivedScales[index] = m_scales[index];
+			}
+			else
+			{
+				multiply( m_worlds[parent], m_locals[index], m_worlds[index] );
+				m_derivedOrientations[index] = m_orientations[index] * m_derivedOrientations[parent];
+				m_derivedScales[index] = m_scales[index];
+				m_derivedScales[index] *= m_derivedScales[parent];
+			}
+
+			m_changed[index] = 1u;
+			m_dirty[index] = 0u;
+
+			// Each node is written by one job only.
+			auto & node = *m_nodes[index];
+
+			if ( dirty )
+			{
+				node.m_transform = m_locals[index];
+				node.m_mtxChanged = false;
+			}
+
+			node.m_derivedTransform = m_worlds[index];
+			node.m_derivedOrientation = m_derivedOrientations[index];
+			node.m_derivedScale = m_derivedScales[index];
+			node.m_derivedMtxChanged = false;
+		}
+	}
+
+	//*********************************************************************************************
+}
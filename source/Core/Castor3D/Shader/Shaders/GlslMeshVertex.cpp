@@ -2,6 +2,7 @@
 
 #include "Castor3D/Shader/Shaders/GlslSubmeshShaders.hpp"
 #include "Castor3D/Shader/Shaders/GlslMeshlet.hpp"
+#include "Castor3D/Shader/Shaders/GlslUtils.hpp"
 
 #include <ShaderWriter/Writer.hpp>
 #include <ShaderWriter/Intrinsics/Intrinsics.hpp>
@@ -32,6 +33,41 @@ namespace castor3d::shader
 	{
 	}
 
+	sdw::Vec3 MeshVertexBase::getNormal( PipelineFlags const & flags
+		, Utils & utils )const
+	{
+		if ( !flags.hasPackedVertices() )
+		{
+			return normal;
+		}
+
+		return utils.decodeOctahedral( normal.xy() );
+	}
+
+	sdw::Vec4 MeshVertexBase::getTangent( PipelineFlags const & flags
+		, Utils & utils )const
+	{
+		if ( !flags.hasPackedVertices() )
+		{
+			return tangent;
+		}
+
+		// The handedness is stored in the last component.
+		return vec4( utils.decodeOctahedral( tangent.xy() )
+			, sign( tangent.w() ) );
+	}
+
+	sdw::Vec3 MeshVertexBase::getBitangent( PipelineFlags const & flags
+		, Utils & utils )const
+	{
+		if ( !flags.hasPackedVertices() )
+		{
+			return bitangent;
+		}
+
+		return utils.decodeOctahedral( bitangent.xy() );
+	}
+
 	ast::type::IOStructPtr MeshVertexBase::makeIOType( ast::type::TypesCache & cache
 		, sdw::EntryPoint entryPoint
 		, SubmeshShaders const & submeshShaders
@@ -842,6 +842,27 @@ namespace castor3d::shader
 		return m_decodeNormal( pnormalMask );
 	}
 
+	sdw::RetVec3 Utils::decodeOctahedral( sdw::Vec2 const & pencoded )
+	{
+		if ( !m_decodeOctahedral )
+		{
+			m_decodeOctahedral = m_writer.implementFunction< sdw::Vec3 >( "c3d_decodeOctahedral"
+				, [this]( sdw::Vec2 const & encoded )
+				{
+					auto normal = m_writer.declLocale( "normal"
+						, vec3( encoded, 1.0_f - abs( encoded.x() ) - abs( encoded.y() ) ) );
+					auto t = m_writer.declLocale( "t"
+						, max( -normal.z(), 0.0_f ) );
+					normal.x() += m_writer.ternary( normal.x() >= 0.0_f, -t, t );
+					normal.y() += m_writer.ternary( normal.y() >= 0.0_f, -t, t );
+					m_writer.returnStmt( normalize( normal ) );
+				}
+				, sdw::InVec2{ m_writer, "encoded" } );
+		}
+
+		return m_decodeOctahedral( pencoded );
+	}
+
 	sdw::RetVec4 Utils::encodeFloatRGBA( sdw::Float const & pv )
 	{
 		if ( !m_encodeFloatRGBA )
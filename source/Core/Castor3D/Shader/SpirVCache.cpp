@@ -0,0 +1,102 @@
+#include "Castor3D/Shader/SpirVCache.hpp"
+
+#include "Castor3D/Miscellaneous/Logger.hpp"
+
+#include <CastorUtils/Data/File.hpp>
+#include <CastorUtils/Data/MappedFile.hpp>
+
+#include <cstring>
+#include <iomanip>
+
+CU_ImplementSmartPtr( castor3d, SpirVCache )
+
+namespace castor3d
+{
+	//*********************************************************************************************
+
+	namespace spvch
+	{
+		static constexpr uint32_t CacheMagic = 0x56533343u; // "C3SV"
+		static constexpr uint32_t CacheVersion = 1u;
+
+		struct CacheHeader
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint64_t key;
+			uint64_t wordCount;
+		};
+	}
+
+	//*********************************************************************************************
+
+	SpirVCache::SpirVCache( castor::Path folder )
+		: m_folder{ castor::move( folder ) }
+	{
+	}
+
+	bool SpirVCache::tryLoad( uint64_t key
+		, castor::UInt32Array & spirv )const
+	{
+		auto file = getFile( key );
+
+		if ( !castor::File::fileExists( file ) )
+		{
+			return false;
+		}
+
+		castor::MappedFile mapped{ file };
+
+		if ( !mapped.isMapped()
+			|| mapped.getSize() < sizeof( spvch::CacheHeader ) )
+		{
+			return false;
+		}
+
+		spvch::CacheHeader header;
+		std::memcpy( &header, mapped.getData(), sizeof( spvch::CacheHeader ) );
+
+		if ( header.magic != spvch::CacheMagic
+			|| header.version != spvch::CacheVersion
+			|| header.key != key
+			|| header.wordCount == 0u
+			|| mapped.getSize() != sizeof( spvch::CacheHeader ) + header.wordCount * sizeof( uint32_t ) )
+		{
+			log::warn << cuT( "Ignoring invalid SPIR-V cache file [" ) << file << cuT( "]" ) << std::endl;
+			return false;
+		}
+
+		spirv.resize( size_t( header.wordCount ) );
+		std::memcpy( spirv.data()
+			, mapped.getData() + sizeof( spvch::CacheHeader )
+			, spirv.size() * sizeof( uint32_t ) );
+		return true;
+	}
+
+	void SpirVCache::store( uint64_t key
+		, castor::UInt32Array const & spirv )
+	{
+		if ( spirv.empty() )
+		{
+			return;
+		}
+
+		auto file = getFile( key );
+		spvch::CacheHeader header{ spvch::CacheMagic
+			, spvch::CacheVersion
+			, key
+			, uint64_t( spirv.size() ) };
+		castor::File::writeAtomic( file
+			, { castor::makeArrayView( reinterpret_cast< uint8_t const * >( &header ), sizeof( spvch::CacheHeader ) )
+				, castor::makeArrayView( reinterpret_cast< uint8_t const * >( spirv.data() ), spirv.size() * sizeof( uint32_t ) ) } );
+	}
+
+	castor::Path SpirVCache::getFile( uint64_t key )const
+	{
+		auto stream = castor::makeStringStream();
+		stream << std::hex << std::setw( 16 ) << std::setfill( cuT( '0' ) ) << key << cuT( ".spv" );
+		return m_folder / stream.str();
+	}
+
+	//*********************************************************************************************
+}
@@ -67,6 +67,19 @@ namespace castor3d::shader
 		return prvMtxModel() * pos;
 	}
 
+	sdw::Vec4 ModelData::unpackPosition( PipelineFlags const & flags
+		, sdw::Vec4 const & pos )const
+	{
+		if ( !flags.hasPackedVertices() )
+		{
+			return pos;
+		}
+
+		// Packed positions are quantised in the submesh bounding box.
+		return vec4( pos.xyz() * getMember< "positionsScale" >().xyz() + getMember< "positionsOffset" >().xyz()
+			, 1.0_f );
+	}
+
 	sdw::Mat4 ModelData::getCurModelMtx( PipelineFlags const & flags
 		, sdw::Mat4 const & transform )const
 	{
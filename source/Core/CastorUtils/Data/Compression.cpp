@@ -0,0 +1,112 @@
+#include "CastorUtils/Data/Compression.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+
+namespace castor
+{
+	namespace compression
+	{
+		// zlib counts in uInt, so big buffers are given to the stream in slices.
+		static uint64_t constexpr MaxSlice = 1ULL << 30u;
+
+		static uInt getSlice( uint64_t remaining )
+		{
+			return uInt( std::min( remaining, MaxSlice ) );
+		}
+	}
+
+	bool compressBuffer( uint8_t const * data
+		, uint64_t size
+		, ByteArray & result
+		, int32_t level )
+	{
+		z_stream stream{};
+
+		if ( deflateInit( &stream, std::clamp( level, 1, 9 ) ) != Z_OK )
+		{
+			return false;
+		}
+
+		result.resize( size_t( deflateBound( &stream, uLong( std::min( size, compression::MaxSlice ) ) ) ) );
+		uint64_t consumed{};
+		uint64_t produced{};
+		int ret{ Z_OK };
+
+		while ( ret == Z_OK )
+		{
+			if ( produced == result.size() )
+			{
+				result.resize( result.size() + std::max( result.size() / 2u, size_t( 1024u ) ) );
+			}
+
+			stream.next_in = const_cast< Bytef * >( data + consumed );
+			stream.avail_in = compression::getSlice( size - consumed );
+			stream.next_out = result.data() + produced;
+			stream.avail_out = compression::getSlice( result.size() - produced );
+			auto availIn = stream.avail_in;
+			auto availOut = stream.avail_out;
+			ret = deflate( &stream
+				, ( consumed + availIn == size ) ? Z_FINISH : Z_NO_FLUSH );
+			consumed += availIn - stream.avail_in;
+			produced += availOut - stream.avail_out;
+
+			if ( ret == Z_BUF_ERROR
+				&& stream.avail_out == 0u )
+			{
+				// The output is full, it will be grown.
+				ret = Z_OK;
+			}
+		}
+
+		deflateEnd( &stream );
+		result.resize( size_t( produced ) );
+		return ret == Z_STREAM_END;
+	}
+
+	bool decompressBuffer( uint8_t const * data
+		, uint64_t size
+		, uint8_t * result
+		, uint64_t resultSize )
+	{
+		z_stream stream{};
+
+		if ( inflateInit( &stream ) != Z_OK )
+		{
+			return false;
+		}
+
+		// zlib rejects a null output, even when nothing is expected.
+		uint8_t dummy{};
+		result = result ? result : &dummy;
+		uint64_t consumed{};
+		uint64_t produced{};
+		int ret{ Z_OK };
+
+		while ( ret == Z_OK )
+		{
+			stream.next_in = const_cast< Bytef * >( data + consumed );
+			stream.avail_in = compression::getSlice( size - consumed );
+			stream.next_out = result + produced;
+			stream.avail_out = compression::getSlice( resultSize - produced );
+			auto availIn = stream.avail_in;
+			auto availOut = stream.avail_out;
+			ret = inflate( &stream, Z_NO_FLUSH );
+			consumed += availIn - stream.avail_in;
+			produced += availOut - stream.avail_out;
+
+			if ( ret == Z_OK
+				&& availIn == stream.avail_in
+				&& availOut == stream.avail_out )
+			{
+				// No progress: the input is truncated or the output is full.
+				ret = Z_BUF_ERROR;
+			}
+		}
+
+		inflateEnd( &stream );
+		return ret == Z_STREAM_END
+			&& produced == resultSize;
+	}
+}
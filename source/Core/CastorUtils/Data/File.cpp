@@ -1,10 +1,12 @@
 #include "CastorUtils/Data/File.hpp"
 
+#include "CastorUtils/Data/BinaryFile.hpp"
 #include "CastorUtils/Miscellaneous/Utils.hpp"
 
 #include "CastorUtils/Log/Logger.hpp"
 
 #include <filesystem>
+#include <thread>
 
 namespace castor
 {
@@ -273,6 +275,45 @@ namespace castor
 			, allowReplace );
 	}
 
+	bool File::writeAtomic( Path const & filePath
+		, Vector< ConstByteArrayView > const & data )
+	{
+		// The temporary file name is unique per thread, for concurrent writers of the same file.
+		auto tmpFile = filePath;
+		tmpFile += cuT( "." ) + string::toString( std::hash< std::thread::id >{}( std::this_thread::get_id() ) ) + cuT( ".tmp" );
+		bool written = true;
+
+		try
+		{
+			BinaryFile file{ tmpFile, OpenMode::eWrite | OpenMode::eBinary };
+
+			for ( auto it = data.begin(); written && it != data.end(); ++it )
+			{
+				written = file.writeArray( it->data(), it->size() ) == it->size();
+			}
+		}
+		catch ( std::exception & exc )
+		{
+			Logger::logWarning( cuT( "Couldn't write file [" ) + filePath + cuT( "]: " ) + makeString( exc.what() ) );
+			written = false;
+		}
+
+		std::error_code error;
+
+		if ( written )
+		{
+			std::filesystem::rename( makePath( tmpFile ), makePath( filePath ), error );
+		}
+
+		if ( !written || error )
+		{
+			std::filesystem::remove( makePath( tmpFile ), error );
+			return false;
+		}
+
+		return true;
+	}
+
 	bool File::copyFileName( Path const & srcFileName
 		, Path const & dstFileName
 		, bool allowReplace )
@@ -0,0 +1,15 @@
+#include "CastorUtils/Data/MappedFile.hpp"
+
+namespace castor
+{
+	MappedFile::MappedFile( Path path )noexcept
+		: m_path{ castor::move( path ) }
+	{
+		doMap();
+	}
+
+	MappedFile::~MappedFile()noexcept
+	{
+		doUnmap();
+	}
+}
@@ -1,7 +1,10 @@
 #include "CastorUtils/FileParser/FileParser.hpp"
 
 #include "CastorUtils/FileParser/ParserParameter.hpp"
+#include "CastorUtils/Data/MappedFile.hpp"
 #include "CastorUtils/Data/ZipArchive.hpp"
+#include "CastorUtils/Miscellaneous/Hash.hpp"
+#include "CastorUtils/Multithreading/JobSystem.hpp"
 
 namespace castor
 {
@@ -87,55 +90,40 @@ namespace castor
 		}
 
 		static StringView getLine( LoggerInstance & logger
-			, String const & content
-			, uint64_t & lineIndex
+			, StringView content
+			, uint64_t lineIndex
 			, size_t & offset )
 		{
-			if ( offset == content.size() )
+			auto end = content.find_first_of( cuT( "\r\n" ), offset );
+
+			if ( end == StringView::npos )
 			{
-				return StringView{};
+				end = content.size();
 			}
 
-			auto current = std::next( content.begin(), ptrdiff_t( offset ) );
-			auto it = std::find_if( current
-				, content.end()
-				, []( xchar const & c )
-				{
-					return c == '\n' || c == '\r';
-				} );
-			offset = size_t( std::distance( content.begin(), it ) );
-			StringView result{ &*current, size_t( std::distance( current, it ) ) };
+			auto result = content.substr( offset, end - offset );
+			offset = end;
 
-			if ( it != content.end() && *it == '\r' )
+			if ( offset < content.size() && content[offset] == '\r' )
 			{
 				++offset;
-				++it;
 			}
 
-			if ( it != content.end() && *it == '\n' )
+			if ( offset < content.size() && content[offset] == '\n' )
 			{
 				++offset;
-				++it;
 			}
 
 			if constexpr ( DisplayLines )
 			{
 				auto idx = makeStringStream();
-				idx << std::setw( 8 ) << std::left << std::setfill( ' ' ) << ( lineIndex + 1u );
+				idx << std::setw( 8 ) << std::left << std::setfill( ' ' ) << lineIndex;
 				logger.logDebug( idx.str() + String{ result } );
 			}
 
 			trimLine( result );
 			// Trim RHS of inline comment start
-			result = result.substr( 0, result.find( cuT( "//" ) ) );
-
-			if ( result.empty() && it != content.end() )
-			{
-				++lineIndex;
-				result = getLine( logger, content, lineIndex, offset );
-			}
-
-			return result;
+			return result.substr( 0, result.find( cuT( "//" ) ) );
 		}
 
 		static void splitLineCommentBlock( StringView text
@@ -224,10 +212,98 @@ namespace castor
 			}
 			while ( pos != String::npos );
 		}
+
+		struct Token
+		{
+			StringView text;
+			uint64_t line;
+		};
+
+		static void tokenize( LoggerInstance & logger
+			, StringView content
+			, Vector< Token > & tokens )
+		{
+			Vector< StringView > work;
+			uint64_t lineIndex = 0ULL;
+			size_t offset = 0u;
+
+			while ( offset < content.size() )
+			{
+				auto line = getLine( logger, content, ++lineIndex, offset );
+
+				if ( !line.empty() )
+				{
+					work.clear();
+					splitLine( line, work );
+
+					for ( auto text : work )
+					{
+						tokens.push_back( { text, lineIndex } );
+					}
+				}
+			}
+		}
+
+		static Pair< StringView, StringView > splitDirective( StringView line )
+		{
+			auto index = line.find_first_of( cuT( " \t" ) );
+
+			if ( index == StringView::npos )
+			{
+				return { line, StringView{} };
+			}
+
+			auto params = line.substr( index );
+			trimLine( params, cuT( " \t" ) );
+			return { line.substr( 0, index ), params };
+		}
+
+		static uint64_t hashParser( SectionId section
+			, StringView name )
+		{
+			uint64_t result = section;
+			return hashCombine64( result, name );
+		}
 	}
 
 	//*********************************************************************************************
 
+	struct FileParser::TokenizedFile
+	{
+		struct Include
+		{
+			String param;
+			Path path;
+			JobHandle job;
+			TokenizedFilePtr file;
+			bool consumed{};
+		};
+
+		explicit TokenizedFile( JobSystem * jobs )
+			: jobs{ jobs }
+		{
+		}
+
+		TokenizedFile( TokenizedFile const & ) = delete;
+		TokenizedFile & operator=( TokenizedFile const & ) = delete;
+
+		~TokenizedFile()noexcept
+		{
+			// The pre-parse jobs reference the includes list.
+			for ( auto const & include : includes )
+			{
+				jobs->wait( include.job );
+			}
+		}
+
+		JobSystem * jobs;
+		castor::RawUniquePtr< MappedFile > mapped;
+		String content;
+		bool opened{};
+		Vector< fileprs::Token > tokens;
+		Vector< Include > includes;
+	};
+
 	void addParser( AttributeParsers & parsers
 		, uint32_t oldSection
 		, uint32_t newSection
@@ -409,7 +485,9 @@ namespace castor
 		string::trim( params );
 		String missingParam;
 
-		for ( auto param : expected )
+		received.reserve( expected.size() + 1u );
+
+		for ( auto const & param : expected )
 		{
 			if ( result )
 			{
@@ -553,24 +631,8 @@ namespace castor
 			}
 		}
 
-		String content;
-
-		if ( TextFile file{ path, File::OpenMode::eRead };
-			file.isOk() )
-		{
-			file.copyToString( content );
-		}
-		else
-		{
-			m_logger.logError( cuT( "FileParser : Couldn't open file [" ) + path.getFileName( true ) + cuT( "]." ) );
-		}
-
-		if ( !content.empty() )
-		{
-			m_logger.logInfo( cuT( "FileParser : Preprocessing file [" ) + path.getFileName( true ) + cuT( "]." ) );
-			processFile( path, content, preprocessed );
-			m_logger.logInfo( cuT( "FileParser : Finished preprocessing file [" ) + path.getFileName( true ) + cuT( "]." ) );
-		}
+		auto file = doLoadFile( m_logger, m_jobs, path );
+		doProcessFile( path, *file, preprocessed );
 	}
 
 	void FileParser::processFile( Path const & path
@@ -583,41 +645,15 @@ namespace castor
 		, String const & content
 		, PreprocessedFile & preprocessed )
 	{
-		if ( m_sections.empty() )
-		{
-			m_sections.push_back( m_rootSectionId );
-		}
-
-		m_path = path.getPath();
-		m_fileName = path.getFileName( true );
-		bool isNextOpenBrace = false;
-		SectionId pendingSection{};
-		bool commented = false;
-		uint64_t lineIndex = 0ULL;
-
-		Vector< StringView > work;
-		Vector< StringView > nextWork;
-		size_t offset = 0u;
-		auto nxtLine = fileprs::getLine( m_logger, content, lineIndex, offset );
-		fileprs::splitLine( nxtLine, nextWork );
+		TokenizedFile file{ m_jobs };
+		fileprs::tokenize( m_logger, content, file.tokens );
 
-		while ( !nxtLine.empty() )
+		if ( m_jobs )
 		{
-			if ( work.empty() )
-			{
-				++lineIndex;
-				castor::swap( work, nextWork );
-				nxtLine = fileprs::getLine( m_logger, content, lineIndex, offset );
-				fileprs::splitLine( nxtLine, nextWork );
-			}
-
-			while ( !work.empty() )
-			{
-				auto curLine = work.front();
-				work.erase( work.begin() );
-				doProcessLine( curLine, preprocessed, work, nextWork, lineIndex, pendingSection, commented, isNextOpenBrace );
-			}
+			doPrefetchIncludes( m_logger, m_jobs, path.getPath(), file );
 		}
+
+		doProcessTokens( path, file, preprocessed );
 	}
 
 	PreprocessedFile FileParser::processFile( String const & appName
@@ -690,6 +726,7 @@ namespace castor
 	{
 		auto & parsers = m_parsers.try_emplace( name ).first->second;
 		auto [it, res] = parsers.try_emplace( oldSection, function, newSection, params );
+		m_dispatchDirty = m_dispatchDirty || res;
 
 		if ( !res )
 		{
@@ -719,10 +756,237 @@ namespace castor
 		return false;
 	}
 
+	FileParser::TokenizedFilePtr FileParser::doLoadFile( LoggerInstance & logger
+		, JobSystem * jobs
+		, Path const & path )
+	{
+		auto result = castor::make_shared< TokenizedFile >( jobs );
+		StringView content;
+
+		if constexpr ( std::is_same_v< xchar, char > )
+		{
+			// The tokens directly reference the mapped file content.
+			if ( File::fileExists( path ) )
+			{
+				result->mapped = castor::make_unique< MappedFile >( path );
+
+				if ( result->mapped->isMapped() )
+				{
+					content = StringView{ reinterpret_cast< xchar const * >( result->mapped->getData() )
+						, size_t( result->mapped->getSize() ) };
+					result->opened = true;
+				}
+			}
+		}
+
+		if ( !result->opened )
+		{
+			if ( TextFile file{ path, File::OpenMode::eRead };
+				file.isOk() )
+			{
+				file.copyToString( result->content );
+				content = result->content;
+				result->opened = true;
+			}
+		}
+
+		if ( result->opened )
+		{
+			fileprs::tokenize( logger, content, result->tokens );
+
+			if ( jobs )
+			{
+				doPrefetchIncludes( logger, jobs, path.getPath(), *result );
+			}
+		}
+
+		return result;
+	}
+
+	void FileParser::doPrefetchIncludes( LoggerInstance & logger
+		, JobSystem * jobs
+		, Path const & folder
+		, TokenizedFile & file )
+	{
+		for ( auto const & token : file.tokens )
+		{
+			auto [name, param] = fileprs::splitDirective( token.text );
+
+			if ( name == cuT( "include" ) && !param.empty() )
+			{
+				String params{ param };
+				Path path;
+
+				if ( ValueParser< ParameterType::ePath >::parse( logger, params, path ) )
+				{
+					// Missing and zipped files are left to the sequential path, which reports the errors.
+					auto fullPath = folder / path;
+
+					if ( fullPath.getExtension() != cuT( "zip" )
+						&& File::fileExists( fullPath ) )
+					{
+						file.includes.push_back( { String{ param }, castor::move( fullPath ), {}, {}, false } );
+					}
+				}
+			}
+		}
+
+		// The list is complete before any job is pushed, the references stay valid.
+		for ( auto & include : file.includes )
+		{
+			include.job = jobs->pushJob( [&logger, jobs, &include]()
+				{
+					include.file = doLoadFile( logger, jobs, include.path );
+				} );
+		}
+	}
+
+	void FileParser::doProcessFile( Path const & path
+		, TokenizedFile & file
+		, PreprocessedFile & preprocessed )
+	{
+		if ( !file.opened )
+		{
+			m_logger.logError( cuT( "FileParser : Couldn't open file [" ) + path.getFileName( true ) + cuT( "]." ) );
+		}
+		else if ( !file.tokens.empty() )
+		{
+			m_logger.logInfo( cuT( "FileParser : Preprocessing file [" ) + path.getFileName( true ) + cuT( "]." ) );
+			doProcessTokens( path, file, preprocessed );
+			m_logger.logInfo( cuT( "FileParser : Finished preprocessing file [" ) + path.getFileName( true ) + cuT( "]." ) );
+		}
+	}
+
+	void FileParser::doProcessTokens( Path const & path
+		, TokenizedFile & file
+		, PreprocessedFile & preprocessed )
+	{
+		if ( m_sections.empty() )
+		{
+			m_sections.push_back( m_rootSectionId );
+		}
+
+		m_path = path.getPath();
+		m_fileName = path.getFileName( true );
+		m_filePath = m_path / m_fileName;
+		m_file = &file;
+		bool isNextOpenBrace = false;
+		SectionId pendingSection{};
+		bool commented = false;
+		auto const & tokens = file.tokens;
+
+		for ( size_t index = 0u; index < tokens.size(); ++index )
+		{
+			auto const & token = tokens[index];
+			doProcessLine( token.text
+				, preprocessed
+				, ( index + 1u < tokens.size() ? tokens[index + 1u].text : StringView{} )
+				, token.line
+				, pendingSection
+				, commented
+				, isNextOpenBrace );
+		}
+
+		m_file = nullptr;
+	}
+
+	FileParser::TokenizedFilePtr FileParser::doTakePrefetchedInclude( StringView param )
+	{
+		if ( !m_file )
+		{
+			return nullptr;
+		}
+
+		auto it = std::find_if( m_file->includes.begin()
+			, m_file->includes.end()
+			, [param]( TokenizedFile::Include const & lookup )
+			{
+				return !lookup.consumed
+					&& lookup.param == param;
+			} );
+
+		if ( it == m_file->includes.end() )
+		{
+			return nullptr;
+		}
+
+		m_file->jobs->wait( it->job );
+		it->consumed = true;
+		auto result = castor::move( it->file );
+		return ( result && result->opened )
+			? result
+			: nullptr;
+	}
+
+	void FileParser::doBuildDispatchTable()
+	{
+		size_t count = 0u;
+
+		for ( auto const & [name, parsers] : m_parsers )
+		{
+			count += parsers.size();
+		}
+
+		// Keep the load factor under 0.5, for short probe sequences.
+		size_t capacity = 16u;
+
+		while ( capacity < count * 2u )
+		{
+			capacity <<= 1u;
+		}
+
+		m_dispatch.assign( capacity, ParserEntry{} );
+		m_dispatchMask = capacity - 1u;
+
+		for ( auto const & [name, parsers] : m_parsers )
+		{
+			for ( auto const & [section, parser] : parsers )
+			{
+				auto hash = fileprs::hashParser( section, name );
+				auto index = hash & m_dispatchMask;
+
+				while ( m_dispatch[index].parser )
+				{
+					index = ( index + 1u ) & m_dispatchMask;
+				}
+
+				m_dispatch[index] = { hash, section, name, &parser };
+			}
+		}
+
+		m_dispatchDirty = false;
+	}
+
+	ParserFunctionAndParams const * FileParser::doFindParser( SectionId section
+		, StringView name )
+	{
+		if ( m_dispatchDirty )
+		{
+			doBuildDispatchTable();
+		}
+
+		auto hash = fileprs::hashParser( section, name );
+		auto index = hash & m_dispatchMask;
+
+		while ( m_dispatch[index].parser )
+		{
+			if ( auto const & entry = m_dispatch[index];
+				entry.hash == hash
+				&& entry.section == section
+				&& entry.name == name )
+			{
+				return entry.parser;
+			}
+
+			index = ( index + 1u ) & m_dispatchMask;
+		}
+
+		return nullptr;
+	}
+
 	void FileParser::doProcessNoBlockLine( StringView curLine
 		, PreprocessedFile & preprocessed
-		, Vector< StringView > const & work
-		, Vector< StringView > const & nextWork
+		, StringView nextToken
 		, uint64_t lineIndex
 		, SectionId & pendingSection
 		, bool & isNextOpenBrace )
@@ -744,9 +1008,7 @@ namespace castor
 		{
 			auto [nextOpenBrace, newSection] = doInvokeParser( preprocessed
 				, curLine
-				, ( work.empty()
-					? nextWork.empty() ? cuT( "" ) : nextWork.front()
-					: work.front() )
+				, nextToken
 				, lineIndex );
 			isNextOpenBrace = nextOpenBrace;
 
@@ -759,8 +1021,7 @@ namespace castor
 
 	void FileParser::doProcessLine( StringView curLine
 		, PreprocessedFile & preprocessed
-		, Vector< StringView > const & work
-		, Vector< StringView > const & nextWork
+		, StringView nextToken
 		, uint64_t lineIndex
 		, SectionId & pendingSection
 		, bool & commented
@@ -784,7 +1045,7 @@ namespace castor
 				}
 				else
 				{
-					doProcessNoBlockLine( curLine, preprocessed, work, nextWork, lineIndex, pendingSection, isNextOpenBrace );
+					doProcessNoBlockLine( curLine, preprocessed, nextToken, lineIndex, pendingSection, isNextOpenBrace );
 				}
 			}
 		}
@@ -808,7 +1069,7 @@ namespace castor
 			return false;
 		};
 		auto section = m_sections.back();
-		preprocessed.addParserAction( m_path / m_fileName
+		preprocessed.addParserAction( m_filePath
 			, lineIndex
 			, cuT( "{" )
 			, section
@@ -823,26 +1084,20 @@ namespace castor
 		, bool implicit )
 	{
 		bool result = false;
-		auto it = m_parsers.find( cuT( "}" ) );
 		auto curSection = m_sections.back();
 		m_sections.pop_back();
 		auto nxtSection = m_sections.back();
 
-		if ( it != m_parsers.end() )
+		if ( auto parser = doFindParser( curSection, cuT( "}" ) ) )
 		{
-			auto itFunc = it->second.find( curSection );
-
-			if ( itFunc != it->second.end() )
-			{
-				preprocessed.addParserAction( m_path / m_fileName
-					, lineIndex
-					, cuT( "}" )
-					, curSection
-					, { itFunc->second.function, nxtSection, itFunc->second.params }
-					, {}
-					, implicit );
-				result = true;
-			}
+			preprocessed.addParserAction( m_filePath
+				, lineIndex
+				, cuT( "}" )
+				, curSection
+				, { parser->function, nxtSection, parser->params }
+				, {}
+				, implicit );
+			result = true;
 		}
 
 		if ( !result )
@@ -855,7 +1110,7 @@ namespace castor
 				context.blocks.pop_back();
 				return false;
 			};
-			preprocessed.addParserAction( m_path / m_fileName
+			preprocessed.addParserAction( m_filePath
 				, lineIndex
 				, cuT( "}" )
 				, curSection
@@ -878,60 +1133,50 @@ namespace castor
 		if ( !doIsInIgnoredBlock() )
 		{
 			m_ignored = false;
-			auto splitCmd = string::split( line, cuT( " \t" ), 1, false );
-			String functionName{ splitCmd[0] };
-			auto iter = m_parsers.find( functionName );
-			bool found = false;
+			auto [functionName, params] = fileprs::splitDirective( line );
 
-			if ( iter != m_parsers.end() )
+			if ( auto parser = doFindParser( section, functionName ) )
 			{
-				auto itFunc = iter->second.find( section );
+				String parameters{ params };
 
-				if ( itFunc != iter->second.end() )
+				if ( !parameters.empty() )
 				{
-					String parameters;
-
-					if ( splitCmd.size() > 1u )
-					{
-						parameters = string::trim( splitCmd[1] );
-						doCheckDefines( parameters );
-					}
+					doCheckDefines( parameters );
+				}
 
-					result = nextToken == cuT( "{" )
-						|| ( itFunc->second.resultSection != section
-							&& functionName != cuT( "}" ) );
-					auto nextSection = itFunc->second.resultSection;
+				result = nextToken == cuT( "{" )
+					|| ( parser->resultSection != section
+						&& functionName != cuT( "}" ) );
+				auto nextSection = parser->resultSection;
 
-					if ( result && nextToken != cuT( "{" ) )
-					{
-						nextSection = section;
-					}
-
-					preprocessed.addParserAction( m_path / m_fileName
-						, lineIndex
-						, functionName
-						, section
-						, { itFunc->second.function, nextSection, itFunc->second.params }
-						, parameters
-						, false );
-					section = itFunc->second.resultSection;
-					found = true;
-				}
-				else
+				if ( result && nextToken != cuT( "{" ) )
 				{
-					parseError( functionName, lineIndex, cuT( "Directive [" ) + functionName + cuT( "] not found for section " ) + getSectionName( section ) );
+					nextSection = section;
 				}
-			}
 
-			if ( !found )
+				preprocessed.addParserAction( m_filePath
+					, lineIndex
+					, String{ functionName }
+					, section
+					, { parser->function, nextSection, parser->params }
+					, castor::move( parameters )
+					, false );
+				section = parser->resultSection;
+			}
+			else
 			{
-				if ( functionName == cuT( "define" ) && splitCmd.size() > 1 )
+				if ( m_parsers.find( functionName ) != m_parsers.end() )
+				{
+					parseError( String{ functionName }, lineIndex, cuT( "Directive [" ) + String{ functionName } + cuT( "] not found for section " ) + getSectionName( section ) );
+				}
+
+				if ( functionName == cuT( "define" ) && !params.empty() )
 				{
-					doAddDefine( lineIndex, splitCmd[1] );
+					doAddDefine( lineIndex, params );
 				}
-				else if ( functionName == cuT( "include" ) && splitCmd.size() > 1 )
+				else if ( functionName == cuT( "include" ) && !params.empty() )
 				{
-					doIncludeFile( preprocessed, lineIndex, splitCmd[1] );
+					doIncludeFile( preprocessed, lineIndex, params );
 				}
 				else if ( !doDiscardParser( preprocessed, line ) )
 				{
@@ -994,9 +1239,18 @@ namespace castor
 		if ( ValueParser< ParameterType::ePath >::parse( m_logger, params, path ) )
 		{
 			auto subparser = doCreateParser();
+			subparser->m_jobs = m_jobs;
 			subparser->doInitialiseParser( m_path / path );
 			subparser->m_sections = m_sections;
-			subparser->processFile( m_path / path, preprocessed );
+
+			if ( auto prefetched = doTakePrefetchedInclude( param ) )
+			{
+				subparser->doProcessFile( m_path / path, *prefetched, preprocessed );
+			}
+			else
+			{
+				subparser->processFile( m_path / path, preprocessed );
+			}
 		}
 	}
 
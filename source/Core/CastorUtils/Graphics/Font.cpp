@@ -1,5 +1,7 @@
 #include "CastorUtils/Graphics/Font.hpp"
 
+#include "CastorUtils/Multithreading/JobSystem.hpp"
+
 #include <msdfgen/msdfgen.h>
 #include <msdfgen/msdfgen-ext.h>
 #include <ft2build.h>
@@ -222,6 +224,17 @@ namespace castor
 
 	namespace msdf
 	{
+		struct GlyphShape
+		{
+			char32_t c{};
+			bool loaded{};
+			msdfgen::Shape shape{};
+			double advance{};
+			double width{};
+			double height{};
+			msdfgen::Vector2 translate{};
+		};
+
 		struct GlyphLoader
 			: public Font::GlyphLoader
 		{
@@ -270,61 +283,145 @@ namespace castor
 
 			Glyph loadGlyph( char32_t c32 )override
 			{
-				msdfgen::Shape shape{};
-				auto pixelSize = 4u * sizeof( float );
-				ByteArray buffer( ( m_sdfInfo.emSize + 2u ) * ( m_sdfInfo.emSize + 2u ) * pixelSize );
-				double advance{};
-				double width{};
-				double height{};
-				msdfgen::Vector2 translate{};
+				auto shape = loadShape( c32 );
+				return makeGlyph( shape, generateBitmap( shape ) );
+			}
+
+			Font::GlyphArray loadGlyphs( Vector< char32_t > const & chars
+				, JobSystem * jobs )override
+			{
+				if ( !jobs || chars.size() < 2u )
+				{
+					return Font::GlyphLoader::loadGlyphs( chars, jobs );
+				}
+
+				// The shapes are read from the FreeType face, which can't be shared between threads,
+				// the distance fields generation is what costs, and it only needs the shape.
+				Vector< GlyphShape > shapes;
+				shapes.reserve( chars.size() );
+
+				for ( auto c : chars )
+				{
+					shapes.push_back( loadShape( c ) );
+				}
+
+				Vector< ByteArray > bitmaps( shapes.size() );
+				jobs->parallelFor( shapes.size()
+					, [this, &shapes, &bitmaps]( size_t begin, size_t end )
+					{
+						for ( auto i = begin; i < end; ++i )
+						{
+							bitmaps[i] = generateBitmap( shapes[i] );
+						}
+					}
+					, 1u );
+				Font::GlyphArray result;
+				result.reserve( shapes.size() );
+
+				for ( size_t i = 0u; i < shapes.size(); ++i )
+				{
+					result.push_back( makeGlyph( shapes[i], bitmaps[i] ) );
+				}
+
+				return result;
+			}
+
+			void fillKerningTable( char32_t c32
+				, Font::GlyphArray const & glyphs
+				, Font::GlyphKerningMap & table )override
+			{
+				// First complete the existing kerning tables agains this glyph.
+				for ( auto & [l32, tab] : table )
+				{
+					double result{};
+					msdfgen::getKerning( result, m_font, l32, c32 );
+					tab.try_emplace( c32, float( result ) );
+				}
 
-				if ( msdfgen::loadGlyph( shape, m_font, c32, &advance ) )
+				// Then create kerning table for this glyph against all currently loaded ones.
+				Font::GlyphKerning lhsKerning;
+
+				for ( auto & glyph : glyphs )
 				{
-					shape.normalize();
-					auto bounds = shape.getBounds();
+					double result{};
+					auto r32 = glyph.getCharacter();
+					msdfgen::getKerning( result, m_font, c32, r32 );
+					lhsKerning.try_emplace( glyph.getCharacter(), float( result ) );
+				}
+
+				table.emplace( c32, lhsKerning );
+			}
+
+			Font::SdfInfo const & getSdfInfo()const noexcept
+			{
+				return m_sdfInfo;
+			}
+
+		private:
+			GlyphShape loadShape( char32_t c32 )
+			{
+				GlyphShape result{ .c = c32 };
+				result.loaded = msdfgen::loadGlyph( result.shape, m_font, c32, &result.advance );
+
+				if ( result.loaded )
+				{
+					result.shape.normalize();
+					auto bounds = result.shape.getBounds();
 					double l = bounds.l;
 					double b = bounds.b;
 					double r = bounds.r;
 					double t = bounds.t;
-					width = r - l;
-					height = t - b;
+					result.width = r - l;
+					result.height = t - b;
 
 					if ( c32 == ' ' || c32 == '\t' )
 					{
-						height = 0;
+						result.height = 0;
 						double space = {};
 						double tab = {};
 						msdfgen::getFontWhitespaceWidth( space, tab, m_font );
 
 						if ( c32 == ' ' )
 						{
-							width = float( space );
+							result.width = float( space );
 						}
 						else
 						{
-							width = float( tab );
+							result.width = float( tab );
 						}
 					}
 					else
 					{
-						if ( std::isinf( width ) )
+						if ( std::isinf( result.width ) )
 						{
-							width = float( m_sdfInfo.emSize );
+							result.width = float( m_sdfInfo.emSize );
 						}
 
-						if ( std::isinf( height ) )
+						if ( std::isinf( result.height ) )
 						{
-							height = float( m_sdfInfo.emSize );
+							result.height = float( m_sdfInfo.emSize );
 						}
 					}
 
-					translate.x = -l + 0.5 * ( m_sdfInfo.emSize - width );
-					translate.y = -b + 0.5 * ( m_sdfInfo.emSize - height );
-					msdfgen::edgeColoringSimple( shape, 3.0f );
+					result.translate.x = -l + 0.5 * ( m_sdfInfo.emSize - result.width );
+					result.translate.y = -b + 0.5 * ( m_sdfInfo.emSize - result.height );
+					msdfgen::edgeColoringSimple( result.shape, 3.0f );
+				}
+
+				return result;
+			}
+
+			ByteArray generateBitmap( GlyphShape const & glyph )const
+			{
+				auto pixelSize = 4u * sizeof( float );
+				ByteArray buffer( ( m_sdfInfo.emSize + 2u ) * ( m_sdfInfo.emSize + 2u ) * pixelSize );
+
+				if ( glyph.loaded )
+				{
 					msdfgen::Bitmap< float, 4u > msdf{ int( m_sdfInfo.emSize ), int( m_sdfInfo.emSize ) };
 					msdfgen::generateMTSDF( msdf
-						, shape
-						, msdfgen::Projection{ msdfgen::Vector2{ 1.0, 1.0 }, translate }
+						, glyph.shape
+						, msdfgen::Projection{ msdfgen::Vector2{ 1.0, 1.0 }, glyph.translate }
 						, m_sdfInfo.pixelRange );
 					auto * dst = buffer.data();
 					auto const * src = msdf( 0, 0 );
@@ -351,43 +448,18 @@ namespace castor
 					std::memset( dst, 0u, dstLineSize );
 				}
 
-				return Glyph{ c32
-					, { width, height }
-					, { -translate.x, -translate.y }
-					, float( advance )
-					, Size{ m_sdfInfo.emSize + 2u, m_sdfInfo.emSize + 2u }
-					, buffer };
+				return buffer;
 			}
 
-			void fillKerningTable( char32_t c32
-				, Font::GlyphArray const & glyphs
-				, Font::GlyphKerningMap & table )override
+			Glyph makeGlyph( GlyphShape const & glyph
+				, ByteArray const & bitmap )const
 			{
-				// First complete the existing kerning tables agains this glyph.
-				for ( auto & [l32, tab] : table )
-				{
-					double result{};
-					msdfgen::getKerning( result, m_font, l32, c32 );
-					tab.try_emplace( c32, float( result ) );
-				}
-
-				// Then create kerning table for this glyph against all currently loaded ones.
-				Font::GlyphKerning lhsKerning;
-
-				for ( auto & glyph : glyphs )
-				{
-					double result{};
-					auto r32 = glyph.getCharacter();
-					msdfgen::getKerning( result, m_font, c32, r32 );
-					lhsKerning.try_emplace( glyph.getCharacter(), float( result ) );
-				}
-
-				table.emplace( c32, lhsKerning );
-			}
-
-			Font::SdfInfo const & getSdfInfo()const noexcept
-			{
-				return m_sdfInfo;
+				return Glyph{ glyph.c
+					, { glyph.width, glyph.height }
+					, { -glyph.translate.x, -glyph.translate.y }
+					, float( glyph.advance )
+					, Size{ m_sdfInfo.emSize + 2u, m_sdfInfo.emSize + 2u }
+					, bitmap };
 			}
 
 		private:
@@ -466,6 +538,22 @@ namespace castor
 
 	//*********************************************************************************************
 
+	Font::GlyphArray Font::GlyphLoader::loadGlyphs( Vector< char32_t > const & chars
+		, JobSystem * )
+	{
+		GlyphArray result;
+		result.reserve( chars.size() );
+
+		for ( auto c : chars )
+		{
+			result.push_back( loadGlyph( c ) );
+		}
+
+		return result;
+	}
+
+	//*********************************************************************************************
+
 	Font::Font( String const & name, uint32_t height )
 		: Named{ name }
 		, m_height{ height }
@@ -507,6 +595,35 @@ namespace castor
 		m_glyphLoader->cleanup();
 	}
 
+	void Font::loadGlyphs( Vector< char32_t > const & chars
+		, JobSystem * jobs )
+	{
+		Vector< char32_t > missing;
+
+		for ( auto c : chars )
+		{
+			if ( !hasGlyphAt( c )
+				&& missing.end() == std::find( missing.begin(), missing.end(), c ) )
+			{
+				missing.push_back( c );
+			}
+		}
+
+		if ( missing.empty() )
+		{
+			return;
+		}
+
+		m_glyphLoader->initialise();
+
+		for ( auto & glyph : m_glyphLoader->loadGlyphs( missing, jobs ) )
+		{
+			doAddGlyph( castor::move( glyph ) );
+		}
+
+		m_glyphLoader->cleanup();
+	}
+
 	float Font::getKerning( char32_t lhs, char32_t rhs, uint32_t height )const
 	{
 		auto tit = m_kerningTable.find( lhs );
@@ -725,18 +842,25 @@ namespace castor
 
 		if ( it == m_loadedGlyphs.end() )
 		{
-			m_loadedGlyphs.push_back( m_glyphLoader->loadGlyph( c ) );
-			it = std::next( m_loadedGlyphs.begin()
-				, ptrdiff_t( m_loadedGlyphs.size() - 1u ) );
-			m_maxSize->x = std::max( m_maxSize->x, it->getSize()->x );
-			m_maxSize->y = std::max( m_maxSize->y, it->getSize()->y );
-			m_maxImageSize->x = std::max( m_maxImageSize->x, int32_t( it->getBitmapSize()->x ) );
-			m_maxImageSize->y = std::max( m_maxImageSize->y, int32_t( it->getBitmapSize()->y ) );
-			m_maxBearing->x = std::min( m_maxBearing->x, it->getBearing()->x );
-			m_maxBearing->y = std::max( m_maxBearing->y, it->getBearing()->y );
-			m_glyphLoader->fillKerningTable( c, m_loadedGlyphs, m_kerningTable );
+			return doAddGlyph( m_glyphLoader->loadGlyph( c ) );
 		}
 
 		return *it;
 	}
+
+	Glyph const & Font::doAddGlyph( Glyph glyph )
+	{
+		auto c = glyph.getCharacter();
+		m_loadedGlyphs.push_back( castor::move( glyph ) );
+		auto it = std::next( m_loadedGlyphs.begin()
+			, ptrdiff_t( m_loadedGlyphs.size() - 1u ) );
+		m_maxSize->x = std::max( m_maxSize->x, it->getSize()->x );
+		m_maxSize->y = std::max( m_maxSize->y, it->getSize()->y );
+		m_maxImageSize->x = std::max( m_maxImageSize->x, int32_t( it->getBitmapSize()->x ) );
+		m_maxImageSize->y = std::max( m_maxImageSize->y, int32_t( it->getBitmapSize()->y ) );
+		m_maxBearing->x = std::min( m_maxBearing->x, it->getBearing()->x );
+		m_maxBearing->y = std::max( m_maxBearing->y, it->getBearing()->y );
+		m_glyphLoader->fillKerningTable( c, m_loadedGlyphs, m_kerningTable );
+		return *it;
+	}
 }
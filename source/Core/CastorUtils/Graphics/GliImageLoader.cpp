@@ -64,6 +64,48 @@ namespace castor
 			}
 		}
 
+		static gli::texture loadTexture( String const & imageFormat
+			, uint8_t const * data
+			, uint32_t size
+			, bool & flipped )
+		{
+			using CharCPtr = char const *;
+			gli::texture result;
+
+			if ( imageFormat.find( cuT( "dds" ) ) != String::npos )
+			{
+				result = gli::load_dds( CharCPtr( data ), size );
+				flipped = true;
+			}
+			else if ( imageFormat.find( cuT( "kmg" ) ) != String::npos )
+			{
+				result = gli::load_kmg( CharCPtr( data ), size );
+			}
+			else if ( imageFormat.find( cuT( "ktx" ) ) != String::npos )
+			{
+				result = gli::load_ktx( CharCPtr( data ), size );
+			}
+
+			if ( result.empty() )
+			{
+				CU_LoaderError( "Can't load image: Failed to read data" );
+			}
+
+			return result;
+		}
+
+		static ImageLayout getLayout( gli::texture const & texture )
+		{
+			ImageLayout result;
+			result.type = convert( texture.target() );
+			result.format = convert( texture.format() );
+			result.extent = { texture.extent().x, texture.extent().y, texture.extent().z };
+			result.layers = uint32_t( texture.layers() );
+			result.levels = uint32_t( texture.levels() );
+			result.alignment = uint32_t( getBytesPerPixel( result.format ) );
+			return result;
+		}
+
 		static StringArray const GliExtensions
 		{
 			cuT( "dds" ),
@@ -95,36 +137,9 @@ namespace castor
 		, uint32_t size
 		, PxBufferBaseUPtr & buffer )const
 	{
-		using CharCPtr = char const *;
-		gli::texture texture;
 		bool flipped = false;
-
-		if ( imageFormat.find( cuT( "dds" ) ) != String::npos )
-		{
-			texture = gli::load_dds( CharCPtr( data ), size );
-			flipped = true;
-		}
-		else if ( imageFormat.find( cuT( "kmg" ) ) != String::npos )
-		{
-			texture = gli::load_kmg( CharCPtr( data ), size );
-		}
-		else if ( imageFormat.find( cuT( "ktx" ) ) != String::npos )
-		{
-			texture = gli::load_ktx( CharCPtr( data ), size );
-		}
-
-		if ( texture.empty() )
-		{
-			CU_LoaderError( "Can't load image: Failed to read data" );
-		}
-
-		ImageLayout result;
-		result.type = glil::convert( texture.target() );
-		result.format = glil::convert( texture.format() );
-		result.extent = { texture.extent().x, texture.extent().y, texture.extent().z };
-		result.layers = uint32_t( texture.layers() );
-		result.levels = uint32_t( texture.levels() );
-		result.alignment = uint32_t( getBytesPerPixel( result.format ) );
+		auto texture = glil::loadTexture( imageFormat, data, size, flipped );
+		auto result = glil::getLayout( texture );
 		buffer = PxBufferBase::create( result.dimensions()
 			, result.layers
 			, result.levels
@@ -140,4 +155,17 @@ namespace castor
 
 		return result;
 	}
+
+	void GliImageLoader::decode( String const & imageFormat
+		, uint8_t const * data
+		, uint32_t size
+		, ImagePixelsConsumer const & consumer )const
+	{
+		// The levels are tightly packed in gli storage, in the same order as in PxBufferBase, so it is given as is.
+		bool flipped = false;
+		auto texture = glil::loadTexture( imageFormat, data, size, flipped );
+		consumer( glil::getLayout( texture )
+			, makeArrayView( static_cast< uint8_t const * >( texture.data() ), texture.size() )
+			, flipped );
+	}
 }
@@ -0,0 +1,300 @@
+#include "CastorUtils/Graphics/GlyphAtlas.hpp"
+
+#include "CastorUtils/Graphics/Glyph.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+
+namespace castor
+{
+	namespace glyphatl
+	{
+		// One texel between the glyphs, so that linear filtering doesn't bleed from the neighbours.
+		static uint32_t constexpr GlyphPadding = 1u;
+
+		static void addRect( GlyphAtlas::Region & region
+			, Position const & position
+			, Size const & size )
+		{
+			auto x = uint32_t( position.x() );
+			auto y = uint32_t( position.y() );
+
+			if ( region.empty() )
+			{
+				region = { x, y, x + size.getWidth(), y + size.getHeight() };
+			}
+			else
+			{
+				region.left = std::min( region.left, x );
+				region.top = std::min( region.top, y );
+				region.right = std::max( region.right, x + size.getWidth() );
+				region.bottom = std::max( region.bottom, y + size.getHeight() );
+			}
+		}
+	}
+
+	GlyphAtlas::GlyphAtlas( GlyphGetter getGlyph
+		, PixelFormat format
+		, uint32_t width
+		, uint32_t pageHeight
+		, uint32_t maxHeight
+		, bool bitmapOnly )
+		: m_getGlyph{ castor::move( getGlyph ) }
+		, m_pixelSize{ uint32_t( getBytesPerPixel( format ) ) }
+		, m_pageHeight{ pageHeight }
+		, m_maxHeight{ maxHeight }
+		, m_bitmapOnly{ bitmapOnly }
+		, m_packer{ width, 0u }
+		, m_size{ width, 0u }
+	{
+	}
+
+	bool GlyphAtlas::addGlyphs( U32String const & text )
+	{
+		for ( auto c : text )
+		{
+			if ( isResident( c ) )
+			{
+				continue;
+			}
+
+			if ( auto glyph = m_getGlyph( c ) )
+			{
+				m_evicted.erase( c );
+
+				if ( !doInsert( *glyph ) )
+				{
+					Logger::logWarning( cuT( "GlyphAtlas: Glyph [" ) + string::toString( uint32_t( c ) ) + cuT( "] doesn't fit in the atlas" ) );
+				}
+			}
+		}
+
+		return m_layoutChanged && !m_refreshing;
+	}
+
+	bool GlyphAtlas::useGlyphs( U32String const & text )
+	{
+		for ( auto c : text )
+		{
+			++m_references[c];
+		}
+
+		return addGlyphs( text );
+	}
+
+	void GlyphAtlas::releaseGlyphs( U32String const & text )
+	{
+		for ( auto c : text )
+		{
+			if ( auto it = m_references.find( c );
+				it != m_references.end() && --it->second == 0u )
+			{
+				m_references.erase( it );
+			}
+		}
+	}
+
+	void GlyphAtlas::publish()
+	{
+		m_front = { m_positions, {}, {} };
+		m_back = {};
+		m_published = true;
+		m_refreshing = false;
+		m_layoutChanged = false;
+	}
+
+	void GlyphAtlas::beginRefresh()
+	{
+		if ( !m_published )
+		{
+			// No texture has been displayed yet.
+			publish();
+			return;
+		}
+
+		m_back = { m_positions, {}, {} };
+		m_refreshing = true;
+		m_layoutChanged = false;
+	}
+
+	bool GlyphAtlas::endRefresh()
+	{
+		if ( !m_refreshing )
+		{
+			return false;
+		}
+
+		m_front = castor::move( m_back );
+		m_back = {};
+		m_refreshing = false;
+		return m_layoutChanged;
+	}
+
+	void GlyphAtlas::clearFrontRegion()noexcept
+	{
+		m_front.region = {};
+		m_front.pending.clear();
+	}
+
+	Position const * GlyphAtlas::getPosition( char32_t c )const
+	{
+		auto it = m_front.positions.find( c );
+		return it == m_front.positions.end()
+			? nullptr
+			: &it->second;
+	}
+
+	bool GlyphAtlas::doIsReferenced( char32_t c )const
+	{
+		// The default glyph is always kept.
+		return c == U'?'
+			|| m_references.end() != m_references.find( c );
+	}
+
+	Size GlyphAtlas::doGetPaddedSize( Glyph const & glyph )const
+	{
+		auto size = glyph.getBitmapSize();
+
+		if ( !m_bitmapOnly )
+		{
+			size = Size{ std::max( size.getWidth(), uint32_t( std::ceil( glyph.getSize()->x ) ) )
+				, std::max( size.getHeight(), uint32_t( std::ceil( glyph.getSize()->y ) ) ) };
+		}
+
+		return Size{ size.getWidth() + glyphatl::GlyphPadding
+			, size.getHeight() + glyphatl::GlyphPadding };
+	}
+
+	bool GlyphAtlas::doInsert( Glyph const & glyph )
+	{
+		auto size = doGetPaddedSize( glyph );
+		Position position;
+
+		while ( !m_packer.insert( size, position ) )
+		{
+			if ( m_size.getHeight() < m_maxHeight )
+			{
+				doGrow();
+			}
+			else if ( !doEvict() )
+			{
+				return false;
+			}
+		}
+
+		doWrite( glyph, position );
+		return true;
+	}
+
+	void GlyphAtlas::doWrite( Glyph const & glyph
+		, Position const & position )
+	{
+		auto const & glyphSize = glyph.getBitmapSize();
+		auto const dstRowSize = size_t( m_size.getWidth() ) * m_pixelSize;
+		auto const srcRowSize = size_t( glyphSize.getWidth() ) * m_pixelSize;
+		CU_Require( glyph.getBitmap().size() >= srcRowSize * glyphSize.getHeight() );
+		auto src = glyph.getBitmap().data();
+		auto dst = m_data.data() + uint32_t( position.y() ) * dstRowSize + uint32_t( position.x() ) * m_pixelSize;
+
+		for ( uint32_t y = 0u; y < glyphSize.getHeight(); ++y )
+		{
+			std::memcpy( dst, src, srcRowSize );
+			dst += dstRowSize;
+			src += srcRowSize;
+		}
+
+		m_positions[glyph.getCharacter()] = position;
+
+		// While the layout is the one of the texture being displayed (or being refreshed),
+		// the glyph goes in it through a region upload, otherwise it waits for the next refresh.
+		if ( !m_layoutChanged )
+		{
+			auto & view = m_refreshing ? m_back : m_front;
+			view.positions[glyph.getCharacter()] = position;
+			view.pending.push_back( glyph.getCharacter() );
+			glyphatl::addRect( view.region, position, glyphSize );
+		}
+	}
+
+	void GlyphAtlas::doChangeLayout()noexcept
+	{
+		m_layoutChanged = true;
+	}
+
+	void GlyphAtlas::doGrow()
+	{
+		doChangeLayout();
+		auto const height = std::min( m_maxHeight, m_size.getHeight() + m_pageHeight );
+		m_size = Size{ m_size.getWidth(), height };
+		m_packer.grow( height );
+		// The width being fixed, the existing lines keep their place.
+		m_data.resize( size_t( m_size.getWidth() ) * height * m_pixelSize );
+	}
+
+	bool GlyphAtlas::doEvict()
+	{
+		Vector< Glyph const * > kept;
+		Vector< char32_t > evicted;
+
+		for ( auto const & [c, position] : m_positions )
+		{
+			auto glyph = m_getGlyph( c );
+
+			if ( glyph && doIsReferenced( c ) )
+			{
+				kept.push_back( glyph );
+			}
+			else
+			{
+				evicted.push_back( c );
+			}
+		}
+
+		if ( evicted.empty() )
+		{
+			// Every glyph is in use, none can be evicted.
+			return false;
+		}
+
+		doChangeLayout();
+
+		// The pending regions refer to the previous layout, their glyphs are not in the textures.
+		for ( auto view : { &m_front, &m_back } )
+		{
+			for ( auto c : view->pending )
+			{
+				view->positions.erase( c );
+			}
+
+			view->region = {};
+			view->pending.clear();
+		}
+
+		// The glyphs in use are packed again, from the highest, for a denser packing.
+		std::stable_sort( kept.begin()
+			, kept.end()
+			, [this]( Glyph const * lhs, Glyph const * rhs )
+			{
+				return doGetPaddedSize( *lhs ).getHeight() > doGetPaddedSize( *rhs ).getHeight();
+			} );
+		m_positions.clear();
+		std::fill( m_data.begin(), m_data.end(), uint8_t{} );
+		m_packer = SkylinePacker{ m_size.getWidth(), m_size.getHeight() };
+
+		for ( auto glyph : kept )
+		{
+			Position position;
+
+			if ( m_packer.insert( doGetPaddedSize( *glyph ), position ) )
+			{
+				doWrite( *glyph, position );
+			}
+			else
+			{
+				evicted.push_back( glyph->getCharacter() );
+			}
+		}
+
+		m_evicted.insert( evicted.begin(), evicted.end() );
+		Logger::logDebug( cuT( "GlyphAtlas: The atlas is full, " ) + string::toString( evicted.size() ) + cuT( " glyphs are evicted" ) );
+		return true;
+	}
+}
@@ -1,12 +1,253 @@
 #include "CastorUtils/Graphics/ImageCache.hpp"
 
+#include "CastorUtils/Data/File.hpp"
+#include "CastorUtils/Data/MappedFile.hpp"
 #include "CastorUtils/Graphics/Image.hpp"
 #include "CastorUtils/Graphics/ImageLoader.hpp"
+#include "CastorUtils/Miscellaneous/Hash.hpp"
+#include "CastorUtils/Multithreading/JobSystem.hpp"
+
+#include <cmath>
+#include <exception>
+#include <iomanip>
 
 namespace castor
 {
 	//*********************************************************************************************
 
+	namespace details
+	{
+		struct ImageLoadState
+		{
+			JobSystem * jobs{};
+			JobHandle job;
+			ImageCacheTraits::ElementObsT image{};
+			std::exception_ptr error;
+		};
+	}
+
+	//*********************************************************************************************
+
+	namespace imgch
+	{
+		static constexpr uint32_t CacheMagic = 0x474d4943u; // "CIMG"
+		static constexpr uint32_t CacheVersion = 2u;
+
+		struct CacheHeader
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint32_t type;
+			uint32_t format;
+			uint32_t width;
+			uint32_t height;
+			uint32_t depth;
+			uint32_t layers;
+			uint32_t levels;
+			uint32_t alignment;
+			uint32_t flipped;
+			uint32_t padding;
+			uint64_t size;
+		};
+
+		static Path getCacheFile( Path const & folder
+			, ImageLoader const & loader
+			, String const & type
+			, uint8_t const * data
+			, uint32_t size
+			, ImageLoaderConfig const & config )
+		{
+			auto & support = loader.getOptions().support;
+			// The key is stored on disk, hence computed with a hash that doesn't depend on the standard library.
+			uint64_t key = Fnv1a64Basis;
+			auto lowerType = string::lowerCase( type );
+			hashFnv1a64( key, data, size );
+			hashFnv1a64( key, CacheVersion );
+			hashFnv1a64( key, lowerType.data(), lowerType.size() * sizeof( xchar ) );
+			hashFnv1a64( key, config.allowCompression );
+			hashFnv1a64( key, config.generateMips );
+			hashFnv1a64( key, config.layersToTiles );
+			hashFnv1a64( key, config.allowSRGB );
+			hashFnv1a64( key, support.supportBC1 );
+			hashFnv1a64( key, support.supportBC3 );
+			hashFnv1a64( key, support.supportBC5 );
+			hashFnv1a64( key, support.supportBC6 );
+			hashFnv1a64( key, support.supportBC7 );
+			auto stream = makeStringStream();
+			stream << std::hex << std::setw( 16 ) << std::setfill( cuT( '0' ) ) << key << cuT( ".cimg" );
+			return folder / stream.str();
+		}
+
+		static bool isValid( CacheHeader const & header )
+		{
+			if ( header.type > uint32_t( ImageLayout::Type_MAX )
+				|| header.format <= uint32_t( PixelFormat::eUNDEFINED )
+				|| header.format > uint32_t( PixelFormat::eMax )
+				|| header.width == 0u
+				|| header.height == 0u
+				|| header.depth == 0u
+				|| header.layers == 0u
+				|| header.alignment == 0u )
+			{
+				return false;
+			}
+
+			auto maxLevels = 1u + uint32_t( std::log2( std::max( header.width, header.height ) ) );
+			return header.levels > 0u
+				&& header.levels <= maxLevels;
+		}
+
+		static ImageCacheTraits::ElementPtrT readCache( String const & name
+			, Path const & path
+			, Path const & cacheFile )
+		{
+			if ( !File::fileExists( cacheFile ) )
+			{
+				return nullptr;
+			}
+
+			MappedFile mapped{ cacheFile };
+
+			if ( !mapped.isMapped()
+				|| mapped.getSize() < sizeof( CacheHeader ) )
+			{
+				return nullptr;
+			}
+
+			CacheHeader header;
+			std::memcpy( &header, mapped.getData(), sizeof( CacheHeader ) );
+
+			if ( header.magic != CacheMagic
+				|| header.version != CacheVersion
+				|| !isValid( header )
+				|| mapped.getSize() < sizeof( CacheHeader ) + header.size )
+			{
+				return nullptr;
+			}
+
+			ImageLayout layout{ ImageLayout::Type( header.type )
+				, PixelFormat( header.format )
+				, { header.width, header.height, header.depth }
+				, 0u
+				, header.layers
+				, 0u
+				, header.levels
+				, header.alignment };
+
+			// The pixel buffer reads the whole layout from the file data.
+			if ( header.size < layout.size() )
+			{
+				return nullptr;
+			}
+
+			auto buffer = PxBufferBase::create( layout.dimensions()
+				, header.layers
+				, header.levels
+				, layout.format
+				, mapped.getData() + sizeof( CacheHeader )
+				, layout.format
+				, header.alignment );
+
+			if ( header.flipped )
+			{
+				buffer->flip();
+			}
+
+			return makeResource< Image, String >( name
+				, path
+				, castor::move( layout )
+				, castor::move( buffer ) );
+		}
+
+		static void writeCache( Image const & image
+			, Path const & cacheFile )
+		{
+			if ( !image.hasBuffer() )
+			{
+				return;
+			}
+
+			auto & layout = image.getLayout();
+			auto & buffer = image.getPxBuffer();
+			CacheHeader header{ CacheMagic
+				, CacheVersion
+				, uint32_t( layout.type )
+				, uint32_t( layout.format )
+				, layout.extent->x
+				, layout.extent->y
+				, layout.extent->z
+				, layout.layers
+				, layout.levels
+				, layout.alignment
+				, buffer.isFlipped() ? 1u : 0u
+				, 0u
+				, buffer.getSize() };
+			File::writeAtomic( cacheFile
+				, { makeArrayView( reinterpret_cast< uint8_t const * >( &header ), sizeof( CacheHeader ) )
+					, makeArrayView( buffer.getConstPtr(), buffer.getSize() ) } );
+		}
+
+		static ImageCacheTraits::ElementPtrT loadData( ImageLoader const & loader
+			, Path const & cacheFolder
+			, String const & name
+			, Path const & path
+			, String const & type
+			, uint8_t const * data
+			, uint32_t size
+			, ImageLoaderConfig const & config )
+		{
+			if ( cacheFolder.empty() )
+			{
+				return makeResource< Image, String >( path.empty()
+					? loader.load( name, type, data, size, config )
+					: loader.load( name, path, data, size, config ) );
+			}
+
+			auto cacheFile = getCacheFile( cacheFolder, loader, type, data, size, config );
+
+			if ( auto result = readCache( name, path, cacheFile ) )
+			{
+				return result;
+			}
+
+			auto result = makeResource< Image, String >( path.empty()
+				? loader.load( name, type, data, size, config )
+				: loader.load( name, path, data, size, config ) );
+			writeCache( *result, cacheFile );
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	bool ImageLoadHandle::isDone()const noexcept
+	{
+		return !m_state
+			|| m_state->job.isDone();
+	}
+
+	ImageCacheTraits::ElementObsT ImageLoadHandle::wait()const
+	{
+		if ( !m_state )
+		{
+			return nullptr;
+		}
+
+		if ( m_state->jobs )
+		{
+			m_state->jobs->wait( m_state->job );
+		}
+
+		if ( m_state->error )
+		{
+			std::rethrow_exception( m_state->error );
+		}
+
+		return m_state->image;
+	}
+
+	//*********************************************************************************************
+
 	const String ResourceCacheTraitsT< Image, String >::Name = cuT( "Image" );
 
 	ResourceCacheTraitsT< Image, String >::ElementPtrT ResourceCacheTraitsT< Image, String >::makeElement( ResourceCacheBaseT< Image, String, ResourceCacheTraitsT< Image, String > > const & cache
@@ -25,11 +266,31 @@ namespace castor
 
 		if ( params.mode == ImageCreateParams::eBuffer )
 		{
-			return makeResource< Image, String >( realCache.getLoader().load( name
+			return imgch::loadData( realCache.getLoader()
+				, realCache.getDiskCacheFolder()
+				, name
+				, Path{}
 				, params.type
 				, params.data.data()
 				, uint32_t( params.data.size() )
-				, params.loadConfig ) );
+				, params.loadConfig );
+		}
+
+		if ( !realCache.getDiskCacheFolder().empty() )
+		{
+			// The file content is needed to compute the disk cache key.
+			if ( MappedFile mapped{ params.path };
+				mapped.isMapped() && mapped.getSize() <= std::numeric_limits< uint32_t >::max() )
+			{
+				return imgch::loadData( realCache.getLoader()
+					, realCache.getDiskCacheFolder()
+					, name
+					, params.path
+					, string::lowerCase( params.path.getExtension() )
+					, mapped.getData()
+					, uint32_t( mapped.getSize() )
+					, params.loadConfig );
+			}
 		}
 
 		return makeResource< Image, String >( realCache.getLoader().load( name
@@ -68,5 +329,78 @@ namespace castor
 		return PixelFormat::eUNDEFINED;
 	}
 
+	ImageLoadHandle ResourceCacheT< Image, String, ImageCacheTraits >::loadAsync( String const & name
+		, ImageCreateParams params )
+	{
+		auto state = castor::make_shared< details::ImageLoadState >();
+
+		if ( !m_jobs )
+		{
+			try
+			{
+				state->image = doLoad( name, params );
+			}
+			catch ( ... )
+			{
+				state->error = std::current_exception();
+			}
+
+			return ImageLoadHandle{ castor::move( state ) };
+		}
+
+		auto lock( makeUniqueLock( m_pendingMutex ) );
+
+		if ( auto it = m_pending.find( name );
+			it != m_pending.end() )
+		{
+			return ImageLoadHandle{ it->second };
+		}
+
+		if ( auto image = tryFind( name );
+			image && image->hasBuffer() )
+		{
+			state->image = image;
+			return ImageLoadHandle{ castor::move( state ) };
+		}
+
+		state->jobs = m_jobs;
+		m_pending.emplace( name, state );
+		// The job is pushed while the pending list is locked, so that concurrent requests get a valid job handle.
+		state->job = m_jobs->pushJob( [this, name, params = castor::move( params ), state]()
+			{
+				try
+				{
+					state->image = doLoad( name, params );
+				}
+				catch ( ... )
+				{
+					state->error = std::current_exception();
+				}
+
+				auto jobLock( makeUniqueLock( m_pendingMutex ) );
+				m_pending.erase( name );
+			} );
+		return ImageLoadHandle{ castor::move( state ) };
+	}
+
+	ResourceCacheT< Image, String, ImageCacheTraits >::ElementObsT ResourceCacheT< Image, String, ImageCacheTraits >::doLoad( String const & name
+		, ImageCreateParams const & params )
+	{
+		auto created = create( name, params );
+		auto lock( makeUniqueLock( *this ) );
+
+		if ( auto image = tryFindNoLock( name ) )
+		{
+			if ( !image->hasBuffer() )
+			{
+				*image = castor::move( *created );
+			}
+
+			return image;
+		}
+
+		return addNoLock( name, created, true );
+	}
+
 	//*********************************************************************************************
 }
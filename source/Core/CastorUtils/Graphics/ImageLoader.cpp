@@ -2,6 +2,7 @@
 
 #include "CastorUtils/Data/BinaryFile.hpp"
 #include "CastorUtils/Data/LoaderException.hpp"
+#include "CastorUtils/Data/MappedFile.hpp"
 #include "CastorUtils/Data/Path.hpp"
 #include "CastorUtils/Graphics/ImageLayout.hpp"
 
@@ -59,6 +60,154 @@ namespace castor
 				, newLayout
 				, castor::move( buffer ) };
 		}
+
+		template< typename FuncT >
+		static auto processFile( Path const & path
+			, FuncT const & process )
+		{
+			if ( path.empty() )
+			{
+				CU_LoaderError( "Can't load image: Path is empty" );
+			}
+
+			if ( MappedFile mapped{ path };
+				mapped.isMapped() )
+			{
+				if ( mapped.getSize() > std::numeric_limits< uint32_t >::max() )
+				{
+					CU_LoaderError( "Can't load image: File is too large" );
+				}
+
+				return process( mapped.getData(), uint32_t( mapped.getSize() ) );
+			}
+
+			// The file couldn't be mapped, read it in memory.
+			ByteArray data;
+
+			if ( BinaryFile file{ path, File::OpenMode::eRead };
+				file.isOk() )
+			{
+				auto size = file.getLength();
+
+				if ( !size )
+				{
+					CU_LoaderError( "Can't load image: Empty file" );
+				}
+
+				data.resize( size_t( size ) );
+
+				if ( file.readArray( data.data(), data.size() ) < data.size() )
+				{
+					CU_LoaderError( "Can't load image: Couldn't read image file" );
+				}
+			}
+
+			return process( data.data(), uint32_t( data.size() ) );
+		}
+
+		static StagedImage writeStaging( PxBufferConvertOptions const & options
+			, ImageLoaderConfig const & config
+			, PixelFormat targetFormat
+			, ImageLayout layout
+			, ConstByteArrayView pixels
+			, bool flipped
+			, ImageStagingAllocator const & allocate )
+		{
+			auto dstFormat = ( targetFormat == PixelFormat::eUNDEFINED
+				? layout.format
+				: targetFormat );
+
+			if ( config.allowCompression )
+			{
+				dstFormat = options.getCompressed( dstFormat );
+			}
+
+			// Block compression may resize the image and generate its mips, and mips generation needs the whole chain:
+			// both go through an intermediate buffer, the other cases are written straight to the staging memory.
+			PxBufferBaseUPtr buffer;
+
+			if ( dstFormat != layout.format
+				&& isCompressed( dstFormat ) )
+			{
+				buffer = PxBufferBase::create( &options
+					, layout.dimensions()
+					, layout.depthLayers()
+					, layout.levels
+					, dstFormat
+					, pixels.data()
+					, layout.format
+					, layout.alignment );
+			}
+			else if ( config.generateMips
+				&& layout.levels <= 1u
+				&& !isCompressed( layout.format ) )
+			{
+				buffer = PxBufferBase::create( layout.dimensions()
+					, layout.depthLayers()
+					, 1u
+					, layout.format
+					, pixels.data()
+					, layout.format
+					, layout.alignment );
+				buffer->generateMips();
+			}
+
+			if ( buffer )
+			{
+				layout = ImageLayout{ layout.type, *buffer };
+				pixels = makeArrayView( buffer->getConstPtr(), buffer->getSize() );
+			}
+
+			StagedImage result{ layout, {}, flipped };
+
+			if ( dstFormat != layout.format )
+			{
+				result.layout.format = dstFormat;
+				result.layout.alignment = uint32_t( getBytesPerPixel( dstFormat ) );
+			}
+
+			result.data = allocate( result.layout );
+
+			if ( result.data.empty() )
+			{
+				return result;
+			}
+
+			if ( result.data.size() < result.layout.size() )
+			{
+				CU_LoaderError( "Can't load image: Staging memory is too small" );
+			}
+
+			if ( dstFormat == layout.format )
+			{
+				std::memcpy( result.data.data()
+					, pixels.data()
+					, size_t( std::min( ImageLayout::DeviceSize( pixels.size() ), result.layout.size() ) ) );
+				return result;
+			}
+
+			for ( uint32_t layer = 0u; layer < layout.depthLayers(); ++layer )
+			{
+				for ( uint32_t level = 0u; level < layout.levels; ++level )
+				{
+					auto srcRange = layout.sliceMip( layer, level );
+					auto dstRange = result.layout.sliceMip( layer, level );
+					Size dimensions{ std::max( 1u, layout.extent->x >> level )
+						, std::max( 1u, layout.extent->y >> level ) };
+					convertBuffer( &options
+						, dimensions
+						, dimensions
+						, layout.format
+						, pixels.data() + srcRange.getMin()
+						, uint32_t( srcRange.getMax() - srcRange.getMin() )
+						, dstFormat
+						, result.data.data() + dstRange.getMin()
+						, uint32_t( dstRange.getMax() - dstRange.getMin() ) );
+				}
+			}
+
+			return result;
+		}
 	}
 
 	//*********************************************************************************************
@@ -74,6 +223,18 @@ namespace castor
 		return Image{ name, imagePath, layout, castor::move( buffer ) };
 	}
 
+	void ImageLoaderImpl::decode( String const & imageFormat
+		, uint8_t const * data
+		, uint32_t size
+		, ImagePixelsConsumer const & consumer )const
+	{
+		PxBufferBaseUPtr buffer;
+		auto layout = load( imageFormat, data, size, buffer );
+		consumer( layout
+			, makeArrayView( buffer->getConstPtr(), buffer->getSize() )
+			, buffer->isFlipped() );
+	}
+
 	Image ImageLoaderImpl::load( String const & name
 		, String const & imageFormat
 		, uint8_t const * data
@@ -144,44 +305,68 @@ namespace castor
 		, Path const & path
 		, ImageLoaderConfig const & config )const
 	{
-		if ( path.empty() )
-		{
-			CU_LoaderError( "Can't load image: Path is empty" );
-		}
-
-		ByteArray data;
-
-		if ( BinaryFile file{ path, File::OpenMode::eRead };
-			file.isOk() )
-		{
-			auto size = file.getLength();
+		return imgl::processFile( path
+			, [this, &name, &path, &config]( uint8_t const * data
+				, uint32_t size )
+			{
+				try
+				{
+					return load( name
+						, path
+						, data
+						, size
+						, config );
+				}
+				catch ( std::exception & exc )
+				{
+					std::cerr << exc.what() << "\n" << toUtf8( path ) << std::endl;
+					throw;
+				}
+			} );
+	}
 
-			if ( !size )
+	void ImageLoader::decode( Path const & path
+		, ImagePixelsConsumer const & consumer )const
+	{
+		imgl::processFile( path
+			, [this, &path, &consumer]( uint8_t const * data
+				, uint32_t size )
 			{
-				CU_LoaderError( "Can't load image: Empty file" );
-			}
+				checkData( data, size );
+				findLoader( path )->decode( string::lowerCase( path.getExtension() )
+					, data
+					, size
+					, consumer );
+			} );
+	}
 
-			data.resize( size_t( size ) );
+	bool ImageLoader::exposesStorage( Path const & path )const
+	{
+		auto it = m_extLoaders.find( string::lowerCase( path.getExtension() ) );
+		return it != m_extLoaders.end()
+			&& it->second->exposesStorage();
+	}
 
-			if ( file.readArray( data.data(), data.size() ) < data.size() )
+	StagedImage ImageLoader::loadStaged( Path const & path
+		, PixelFormat targetFormat
+		, ImageStagingAllocator const & allocate
+		, ImageLoaderConfig const & config )const
+	{
+		StagedImage result;
+		decode( path
+			, [this, &result, &config, targetFormat, &allocate]( ImageLayout const & layout
+				, ConstByteArrayView pixels
+				, bool flipped )
 			{
-				CU_LoaderError( "Can't load image: Couldn't read image file" );
-			}
-		}
-
-		try
-		{
-			return load( name
-				, path
-				, data.data()
-				, uint32_t( data.size() )
-				, config );
-		}
-		catch ( std::exception & exc )
-		{
-			std::cerr << exc.what() << "\n" << toUtf8( path ) << std::endl;
-			throw;
-		}
+				result = imgl::writeStaging( m_options
+					, config
+					, targetFormat
+					, layout
+					, pixels
+					, flipped
+					, allocate );
+			} );
+		return result;
 	}
 
 	Image ImageLoader::load( String const & name
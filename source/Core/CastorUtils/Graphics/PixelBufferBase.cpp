@@ -191,7 +191,8 @@ namespace castor
 			return result;
 		}
 
-		static uint32_t copyBuffer( Size const & dimensions
+		static uint32_t copyBuffer( PxBufferConvertOptions const * options
+			, Size const & dimensions
 			, uint8_t const * srcBuffer
 			, PixelFormat srcFormat
 			, uint32_t srcAlign
@@ -242,7 +243,8 @@ namespace castor
 						, VkFormat( dstFormat ) );
 
 					CU_Require( ( written + dstLevelSize ) <= dstBufferSize );
-					convertBuffer( { srcLevelExtent.width, srcLevelExtent.height }
+					convertBuffer( options
+						, { srcLevelExtent.width, srcLevelExtent.height }
 						, { dstLevelExtent.width, dstLevelExtent.height }
 						, srcFormat
 						, srcLevel
@@ -607,7 +609,8 @@ namespace castor
 			}
 			else
 			{
-				pxbb::copyBuffer( m_size
+				pxbb::copyBuffer( options
+					, m_size
 					, buffer
 					, bufferFormat
 					, bufferAlign
@@ -630,11 +630,32 @@ namespace castor
 		, PixelFormat dstFormat
 		, uint8_t * dstBuffer
 		, uint32_t dstSize )
+	{
+		convertBuffer( nullptr
+			, srcDimensions
+			, dstDimensions
+			, srcFormat
+			, srcBuffer
+			, srcSize
+			, dstFormat
+			, dstBuffer
+			, dstSize );
+	}
+
+	void convertBuffer( PxBufferConvertOptions const * options
+		, Size const & srcDimensions
+		, Size const & dstDimensions
+		, PixelFormat srcFormat
+		, uint8_t const * srcBuffer
+		, uint32_t srcSize
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize )
 	{
 		switch ( srcFormat )
 		{
 #define CUPF_ENUM_VALUE( name, value, components, alpha, colour, depth, stencil, compressed ) case PixelFormat::e##name:\
-			PixelDefinitionsT< PixelFormat::e##name >::convert( nullptr, srcDimensions, dstDimensions, srcBuffer, srcSize, dstFormat, dstBuffer, dstSize );\
+			PixelDefinitionsT< PixelFormat::e##name >::convert( options, srcDimensions, dstDimensions, srcBuffer, srcSize, dstFormat, dstBuffer, dstSize );\
 			break;
 #include "CastorUtils/Graphics/PixelFormat.enum"
 		default:
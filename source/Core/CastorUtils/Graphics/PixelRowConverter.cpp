@@ -0,0 +1,558 @@
+#include "CastorUtils/Graphics/PixelRowConverter.hpp"
+
+#include "CastorUtils/Graphics/PixelBufferBase.hpp"
+#include "CastorUtils/Graphics/PixelComponents.hpp"
+#include "CastorUtils/Multithreading/JobSystem.hpp"
+
+#include <cstring>
+
+#if CU_SimdSSE2
+#	include <emmintrin.h>
+#endif
+
+#if CU_SimdNEON
+#	include <arm_neon.h>
+#endif
+
+namespace castor
+{
+	namespace details
+	{
+		//*****************************************************************************************
+
+		namespace pxrow
+		{
+			// Images smaller than this are converted on the calling thread.
+			static size_t constexpr MinParallelPixels = 256u * 1024u;
+			// Approximate pixels count of a band of rows.
+			static uint32_t constexpr BandPixels = 64u * 1024u;
+
+			static bool isRGBA( PxRowLayout const & layout )
+			{
+				return layout.count == 4u
+					&& layout.indices == Array< int8_t, 4u >{ 0, 1, 2, 3 };
+			}
+
+			static bool isR( PxRowLayout const & layout )
+			{
+				return layout.count == 1u
+					&& layout.indices[0] == 0;
+			}
+
+			template< typename SrcT, typename DstT, typename CastT >
+			static void convertScalar( PxRowLayout const & srcLayout
+				, SrcT const * src
+				, PxRowLayout const & dstLayout
+				, DstT * dst
+				, Array< DstT, 4u > const & defaults
+				, size_t count
+				, CastT cast )
+			{
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						if ( auto dstIndex = dstLayout.indices[c];
+							dstIndex >= 0 )
+						{
+							auto srcIndex = srcLayout.indices[c];
+							dst[dstIndex] = srcIndex >= 0
+								? cast( src[srcIndex] )
+								: defaults[c];
+						}
+					}
+
+					src += srcLayout.count;
+					dst += dstLayout.count;
+				}
+			}
+
+			static uint8_t castU8( uint8_t value )
+			{
+				return value;
+			}
+
+			static int16_t castF16( float value )
+			{
+				return componentCast< int16_t >( value );
+			}
+
+			static float castF32( int16_t value )
+			{
+				return componentCast< float >( value );
+			}
+
+#if CU_SimdSSE2
+
+			static int32_t loadU32( uint8_t const * src )
+			{
+				int32_t result;
+				std::memcpy( &result, src, sizeof( result ) );
+				return result;
+			}
+
+			// Loads 4 pixels, one per 32 bits lane.
+			// For 2 or 3 bytes pixels, reads past the 4th pixel, so the caller must ensure there is one more.
+			static __m128i loadU8x4( uint8_t const * src
+				, uint32_t pixelSize )
+			{
+				switch ( pixelSize )
+				{
+				case 1u:
+					{
+						auto zero = _mm_setzero_si128();
+						auto bytes = _mm_cvtsi32_si128( loadU32( src ) );
+						return _mm_unpacklo_epi16( _mm_unpacklo_epi8( bytes, zero ), zero );
+					}
+				case 4u:
+					return _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+				default:
+					return _mm_setr_epi32( loadU32( src )
+						, loadU32( src + pixelSize )
+						, loadU32( src + 2u * pixelSize )
+						, loadU32( src + 3u * pixelSize ) );
+				}
+			}
+
+			// Stores 4 pixels, one per 32 bits lane.
+			// For 2 or 3 bytes pixels, writes past the 4th pixel, so the caller must ensure there is one more.
+			static void storeU8x4( __m128i pixels
+				, uint8_t * dst
+				, uint32_t pixelSize )
+			{
+				switch ( pixelSize )
+				{
+				case 1u:
+					{
+						pixels = _mm_packs_epi32( pixels, pixels );
+						pixels = _mm_packus_epi16( pixels, pixels );
+						auto value = _mm_cvtsi128_si32( pixels );
+						std::memcpy( dst, &value, sizeof( value ) );
+					}
+					break;
+				case 4u:
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), pixels );
+					break;
+				default:
+					{
+						alignas( 16 ) Array< int32_t, 4u > lanes;
+						_mm_store_si128( reinterpret_cast< __m128i * >( lanes.data() ), pixels );
+
+						// Each write overwrites the unused byte(s) of the previous one.
+						for ( uint32_t i = 0u; i < 4u; ++i )
+						{
+							std::memcpy( dst + i * pixelSize, &lanes[i], sizeof( int32_t ) );
+						}
+					}
+					break;
+				}
+			}
+
+			static size_t convertU8SSE2( PxRowLayout const & srcLayout
+				, uint8_t const * src
+				, PxRowLayout const & dstLayout
+				, uint8_t * dst
+				, Array< uint8_t, 4u > const & defaults
+				, size_t count )
+			{
+				// Each component is moved with a shift right (to the first byte), a mask, then a shift left.
+				Array< __m128i, 4u > srcShifts{};
+				Array< __m128i, 4u > dstShifts{};
+				uint32_t moves{};
+				uint32_t constant{};
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					auto srcIndex = srcLayout.indices[c];
+					auto dstIndex = dstLayout.indices[c];
+
+					if ( dstIndex < 0 )
+					{
+						continue;
+					}
+
+					if ( srcIndex < 0 )
+					{
+						constant |= uint32_t( defaults[c] ) << ( 8u * uint32_t( dstIndex ) );
+					}
+					else
+					{
+						srcShifts[moves] = _mm_cvtsi32_si128( 8 * srcIndex );
+						dstShifts[moves] = _mm_cvtsi32_si128( 8 * dstIndex );
+						++moves;
+					}
+				}
+
+				auto mask = _mm_set1_epi32( 0xFF );
+				auto fill = _mm_set1_epi32( int32_t( constant ) );
+				size_t i = 0u;
+
+				for ( ; i + 5u <= count; i += 4u )
+				{
+					auto pixels = loadU8x4( src, srcLayout.count );
+					auto result = fill;
+
+					for ( uint32_t m = 0u; m < moves; ++m )
+					{
+						auto component = _mm_and_si128( _mm_srl_epi32( pixels, srcShifts[m] ), mask );
+						result = _mm_or_si128( result, _mm_sll_epi32( component, dstShifts[m] ) );
+					}
+
+					storeU8x4( result, dst, dstLayout.count );
+					src += 4u * srcLayout.count;
+					dst += 4u * dstLayout.count;
+				}
+
+				return i;
+			}
+
+			static size_t convertF32ToF16SSE2( PxRowLayout const & srcLayout
+				, float const * src
+				, PxRowLayout const & dstLayout
+				, int16_t * dst
+				, Array< int16_t, 4u > const & defaults
+				, size_t count )
+			{
+				auto scale = _mm_set1_ps( 32768.0f );
+				// Keeps the 16 low bits, sign extended, as the scalar cast does.
+				auto convert = [&scale]( float const * values )
+				{
+					auto result = _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( values ), scale ) );
+					return _mm_srai_epi32( _mm_slli_epi32( result, 16 ), 16 );
+				};
+				size_t i = 0u;
+
+				if ( isRGBA( srcLayout ) && isRGBA( dstLayout ) )
+				{
+					for ( ; i + 2u <= count; i += 2u )
+					{
+						auto pixels = _mm_packs_epi32( convert( src ), convert( src + 4u ) );
+						_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), pixels );
+						src += 8u;
+						dst += 8u;
+					}
+				}
+				else if ( isR( srcLayout ) && isRGBA( dstLayout ) )
+				{
+					auto gFill = _mm_set1_epi32( int32_t( uint32_t( uint16_t( defaults[1] ) ) << 16u ) );
+					auto baFill = _mm_set1_epi32( int32_t( uint32_t( uint16_t( defaults[2] ) )
+						| ( uint32_t( uint16_t( defaults[3] ) ) << 16u ) ) );
+					auto mask = _mm_set1_epi32( 0xFFFF );
+
+					for ( ; i + 4u <= count; i += 4u )
+					{
+						auto rg = _mm_or_si128( _mm_and_si128( convert( src ), mask ), gFill );
+						_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), _mm_unpacklo_epi32( rg, baFill ) );
+						_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + 8u ), _mm_unpackhi_epi32( rg, baFill ) );
+						src += 4u;
+						dst += 16u;
+					}
+				}
+
+				return i;
+			}
+
+			static size_t convertF16ToF32SSE2( PxRowLayout const & srcLayout
+				, int16_t const * src
+				, PxRowLayout const & dstLayout
+				, float * dst
+				, size_t count )
+			{
+				size_t i = 0u;
+
+				if ( isRGBA( srcLayout ) && isRGBA( dstLayout ) )
+				{
+					for ( ; i + 2u <= count; i += 2u )
+					{
+						auto pixels = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+						auto lo = _mm_srai_epi32( _mm_unpacklo_epi16( pixels, pixels ), 16 );
+						auto hi = _mm_srai_epi32( _mm_unpackhi_epi16( pixels, pixels ), 16 );
+						_mm_storeu_ps( dst, _mm_cvtepi32_ps( lo ) );
+						_mm_storeu_ps( dst + 4u, _mm_cvtepi32_ps( hi ) );
+						src += 8u;
+						dst += 8u;
+					}
+				}
+				else if ( isRGBA( srcLayout ) && isR( dstLayout ) )
+				{
+					// Extracts the sign extended R component of 2 pixels.
+					auto extract = []( int16_t const * values )
+					{
+						auto pixels = _mm_loadu_si128( reinterpret_cast< __m128i const * >( values ) );
+						pixels = _mm_srai_epi32( _mm_slli_epi32( pixels, 16 ), 16 );
+						return _mm_shuffle_epi32( pixels, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+					};
+
+					for ( ; i + 4u <= count; i += 4u )
+					{
+						auto r = _mm_unpacklo_epi64( extract( src ), extract( src + 8u ) );
+						_mm_storeu_ps( dst, _mm_cvtepi32_ps( r ) );
+						src += 16u;
+						dst += 4u;
+					}
+				}
+
+				return i;
+			}
+
+#endif
+#if CU_SimdNEON
+
+			static uint8x16x4_t loadU8x16( uint8_t const * src
+				, uint32_t pixelSize )
+			{
+				uint8x16x4_t result{};
+
+				switch ( pixelSize )
+				{
+				case 1u:
+					result.val[0] = vld1q_u8( src );
+					break;
+				case 2u:
+					{
+						auto planes = vld2q_u8( src );
+						result.val[0] = planes.val[0];
+						result.val[1] = planes.val[1];
+					}
+					break;
+				case 3u:
+					{
+						auto planes = vld3q_u8( src );
+						result.val[0] = planes.val[0];
+						result.val[1] = planes.val[1];
+						result.val[2] = planes.val[2];
+					}
+					break;
+				default:
+					result = vld4q_u8( src );
+					break;
+				}
+
+				return result;
+			}
+
+			static void storeU8x16( uint8x16x4_t const & planes
+				, uint8_t * dst
+				, uint32_t pixelSize )
+			{
+				switch ( pixelSize )
+				{
+				case 1u:
+					vst1q_u8( dst, planes.val[0] );
+					break;
+				case 2u:
+					vst2q_u8( dst, uint8x16x2_t{ { planes.val[0], planes.val[1] } } );
+					break;
+				case 3u:
+					vst3q_u8( dst, uint8x16x3_t{ { planes.val[0], planes.val[1], planes.val[2] } } );
+					break;
+				default:
+					vst4q_u8( dst, planes );
+					break;
+				}
+			}
+
+			static size_t convertU8NEON( PxRowLayout const & srcLayout
+				, uint8_t const * src
+				, PxRowLayout const & dstLayout
+				, uint8_t * dst
+				, Array< uint8_t, 4u > const & defaults
+				, size_t count )
+			{
+				size_t i = 0u;
+
+				for ( ; i + 16u <= count; i += 16u )
+				{
+					auto srcPlanes = loadU8x16( src, srcLayout.count );
+					uint8x16x4_t dstPlanes{};
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						if ( auto dstIndex = dstLayout.indices[c];
+							dstIndex >= 0 )
+						{
+							auto srcIndex = srcLayout.indices[c];
+							dstPlanes.val[dstIndex] = srcIndex >= 0
+								? srcPlanes.val[srcIndex]
+								: vdupq_n_u8( defaults[c] );
+						}
+					}
+
+					storeU8x16( dstPlanes, dst, dstLayout.count );
+					src += 16u * srcLayout.count;
+					dst += 16u * dstLayout.count;
+				}
+
+				return i;
+			}
+
+			static size_t convertF32ToF16NEON( PxRowLayout const & srcLayout
+				, float const * src
+				, PxRowLayout const & dstLayout
+				, int16_t * dst
+				, Array< int16_t, 4u > const & defaults
+				, size_t count )
+			{
+				auto scale = vdupq_n_f32( 32768.0f );
+				// Keeps the 16 low bits, as the scalar cast does.
+				auto convert = [&scale]( float const * values )
+				{
+					return vmovn_s32( vcvtq_s32_f32( vmulq_f32( vld1q_f32( values ), scale ) ) );
+				};
+				size_t i = 0u;
+
+				if ( isRGBA( srcLayout ) && isRGBA( dstLayout ) )
+				{
+					for ( ; i + 2u <= count; i += 2u )
+					{
+						vst1q_s16( dst, vcombine_s16( convert( src ), convert( src + 4u ) ) );
+						src += 8u;
+						dst += 8u;
+					}
+				}
+				else if ( isR( srcLayout ) && isRGBA( dstLayout ) )
+				{
+					int16x4x4_t pixels{ { vdup_n_s16( 0 )
+						, vdup_n_s16( defaults[1] )
+						, vdup_n_s16( defaults[2] )
+						, vdup_n_s16( defaults[3] ) } };
+
+					for ( ; i + 4u <= count; i += 4u )
+					{
+						pixels.val[0] = convert( src );
+						vst4_s16( dst, pixels );
+						src += 4u;
+						dst += 16u;
+					}
+				}
+
+				return i;
+			}
+
+			static size_t convertF16ToF32NEON( PxRowLayout const & srcLayout
+				, int16_t const * src
+				, PxRowLayout const & dstLayout
+				, float * dst
+				, size_t count )
+			{
+				size_t i = 0u;
+
+				if ( isRGBA( srcLayout ) && isRGBA( dstLayout ) )
+				{
+					for ( ; i + 2u <= count; i += 2u )
+					{
+						auto pixels = vld1q_s16( src );
+						vst1q_f32( dst, vcvtq_f32_s32( vmovl_s16( vget_low_s16( pixels ) ) ) );
+						vst1q_f32( dst + 4u, vcvtq_f32_s32( vmovl_s16( vget_high_s16( pixels ) ) ) );
+						src += 8u;
+						dst += 8u;
+					}
+				}
+				else if ( isRGBA( srcLayout ) && isR( dstLayout ) )
+				{
+					for ( ; i + 4u <= count; i += 4u )
+					{
+						auto pixels = vld4_s16( src );
+						vst1q_f32( dst, vcvtq_f32_s32( vmovl_s16( pixels.val[0] ) ) );
+						src += 16u;
+						dst += 4u;
+					}
+				}
+
+				return i;
+			}
+
+#endif
+		}
+
+		//*****************************************************************************************
+
+		void convertRowU8( PxRowLayout const & srcLayout
+			, uint8_t const * src
+			, PxRowLayout const & dstLayout
+			, uint8_t * dst
+			, Array< uint8_t, 4u > const & defaults
+			, size_t count )
+		{
+			size_t done = 0u;
+#if CU_SimdSSE2
+			done = pxrow::convertU8SSE2( srcLayout, src, dstLayout, dst, defaults, count );
+#elif CU_SimdNEON
+			done = pxrow::convertU8NEON( srcLayout, src, dstLayout, dst, defaults, count );
+#endif
+			pxrow::convertScalar( srcLayout
+				, src + done * srcLayout.count
+				, dstLayout
+				, dst + done * dstLayout.count
+				, defaults
+				, count - done
+				, pxrow::castU8 );
+		}
+
+		void convertRowF32ToF16( PxRowLayout const & srcLayout
+			, float const * src
+			, PxRowLayout const & dstLayout
+			, int16_t * dst
+			, Array< int16_t, 4u > const & defaults
+			, size_t count )
+		{
+			size_t done = 0u;
+#if CU_SimdSSE2
+			done = pxrow::convertF32ToF16SSE2( srcLayout, src, dstLayout, dst, defaults, count );
+#elif CU_SimdNEON
+			done = pxrow::convertF32ToF16NEON( srcLayout, src, dstLayout, dst, defaults, count );
+#endif
+			pxrow::convertScalar( srcLayout
+				, src + done * srcLayout.count
+				, dstLayout
+				, dst + done * dstLayout.count
+				, defaults
+				, count - done
+				, pxrow::castF16 );
+		}
+
+		void convertRowF16ToF32( PxRowLayout const & srcLayout
+			, int16_t const * src
+			, PxRowLayout const & dstLayout
+			, float * dst
+			, Array< float, 4u > const & defaults
+			, size_t count )
+		{
+			size_t done = 0u;
+#if CU_SimdSSE2
+			done = pxrow::convertF16ToF32SSE2( srcLayout, src, dstLayout, dst, count );
+#elif CU_SimdNEON
+			done = pxrow::convertF16ToF32NEON( srcLayout, src, dstLayout, dst, count );
+#endif
+			pxrow::convertScalar( srcLayout
+				, src + done * srcLayout.count
+				, dstLayout
+				, dst + done * dstLayout.count
+				, defaults
+				, count - done
+				, pxrow::castF32 );
+		}
+
+		void convertRowBands( PxBufferConvertOptions const * options
+			, Size const & dimensions
+			, size_t count
+			, Function< void( size_t, size_t ) > const & convertRange )
+		{
+			if ( !options
+				|| !options->jobs
+				|| count < pxrow::MinParallelPixels )
+			{
+				convertRange( 0u, count );
+				return;
+			}
+
+			auto width = std::max( 1u, dimensions.getWidth() );
+			auto bandRows = std::max( 1u, pxrow::BandPixels / width );
+			options->jobs->parallelFor( count
+				, convertRange
+				, size_t( bandRows ) * width );
+		}
+
+		//*****************************************************************************************
+	}
+}
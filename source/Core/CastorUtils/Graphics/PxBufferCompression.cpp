@@ -3,6 +3,7 @@
 #include "CastorUtils/Align/Aligned.hpp"
 #include "CastorUtils/Graphics/PixelBufferBase.hpp"
 #include "CastorUtils/Graphics/Size.hpp"
+#include "CastorUtils/Multithreading/JobSystem.hpp"
 
 #include <ashes/common/Format.hpp>
 
@@ -73,67 +74,145 @@ namespace castor
 			linePtr += ( x + 3 >= w ) ? 0 : srcPixelSize;
 		}
 
+		// Blocks count for a tile, kept as a multiple of cvtt::NumParallelBlocks.
+		static uint32_t constexpr TileBlocks = 64u * uint32_t( cvtt::NumParallelBlocks );
+
 		template< typename TypeT, typename GetRT, typename GetGT, typename GetBT, typename GetAT >
-		static Vector< BlockTypeT< TypeT > > extractBlocks( std::atomic_bool const * interrupt
-			, Size const & srcDimensions
+		static void extractBlocks( Size const & srcDimensions
 			, uint32_t srcPixelSize
 			, uint8_t const * srcBuffer
 			, CU_UnusedParam( uint32_t, srcSize )
+			, uint32_t first
+			, uint32_t count
 			, GetRT getR
 			, GetGT getG
 			, GetBT getB
-			, GetAT getA )
+			, GetAT getA
+			, Vector< BlockTypeT< TypeT > > & result )
 		{
-#if !defined( NDEBUG )
-			auto origin = srcBuffer;
-#endif
 			auto w = srcDimensions.getWidth();
 			auto h = srcDimensions.getHeight();
-			Vector< BlockTypeT< TypeT > > result;
-			auto bw = uint32_t( ashes::getAlignedSize( w, 4u ) );
-			auto bh = uint32_t( ashes::getAlignedSize( h, 4u ) );
-			result.reserve( ( bw * bh ) / 16u );
+			auto widthInBlocks = ( w + 3u ) / 4u;
+			auto blockCount = widthInBlocks * ( ( h + 3u ) / 4u );
 			auto srcLineSize = w * srcPixelSize;
+			result.resize( count );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto & block = result[i];
+				auto index = first + i;
+
+				if ( index >= blockCount )
+				{
+					// Padding up to cvtt::NumParallelBlocks.
+					block = {};
+					continue;
+				}
+
+				auto x = ( index % widthInBlocks ) * 4u;
+				auto y = ( index / widthInBlocks ) * 4u;
+
+				// Same lines addressing as when the blocks were extracted row after row.
+				for ( uint32_t line = 0u; line < 4u; ++line )
+				{
+					auto linePtr = srcBuffer
+						+ ( y + std::min( line, h - y ) ) * srcLineSize
+						+ x * srcPixelSize;
+					assert( ptrdiff_t( linePtr - srcBuffer ) <= srcSize );
+					getLinePixels< TypeT >( block, x, w, srcPixelSize, line, linePtr, getR, getG, getB, getA );
+				}
+			}
+		}
+
+		static bool isThreadSafe( PixelFormat dstFormat )
+		{
+			// ETC2 encoders share CVTTOptions::etc2CompressionData.
+			switch ( dstFormat )
+			{
+			case PixelFormat::eETC2_R8G8B8_UNORM_BLOCK:
+			case PixelFormat::eETC2_R8G8B8_SRGB_BLOCK:
+			case PixelFormat::eETC2_R8G8B8A1_UNORM_BLOCK:
+			case PixelFormat::eETC2_R8G8B8A1_SRGB_BLOCK:
+			case PixelFormat::eETC2_R8G8B8A8_UNORM_BLOCK:
+			case PixelFormat::eETC2_R8G8B8A8_SRGB_BLOCK:
+				return false;
+			default:
+				return true;
+			}
+		}
 
-			for ( uint32_t y = 0; y < bh; y += 4u )
+		template< typename TypeT, typename GetterT >
+		static void compressTiles( PxBufferConvertOptions const & options
+			, std::atomic_bool const * interrupt
+			, Size const & srcDimensions
+			, uint32_t srcPixelSize
+			, uint8_t const * srcBuffer
+			, uint32_t srcSize
+			, GetterT getR
+			, GetterT getG
+			, GetterT getB
+			, GetterT getA
+			, PixelFormat dstFormat
+			, uint8_t * dstBuffer
+			, CU_UnusedParam( uint32_t, dstSize ) )
+		{
+			auto & cvttOptions = *reinterpret_cast< CVTTOptions const * >( options.additionalOptions );
+			auto blockCount = ( ( srcDimensions.getWidth() + 3u ) / 4u )
+				* ( ( srcDimensions.getHeight() + 3u ) / 4u );
+			auto alignedCount = uint32_t( ashes::getAlignedSize( blockCount, uint32_t( cvtt::NumParallelBlocks ) ) );
+			auto tileCount = ( alignedCount + TileBlocks - 1u ) / TileBlocks;
+			auto blockSize = uint32_t( getBytesPerPixel( dstFormat ) );
+			assert( alignedCount * blockSize <= dstSize );
+			std::atomic_uint32_t done{};
+
+			auto compressRange = [&]( size_t begin, size_t end )
 			{
-				auto line0Ptr = srcBuffer;
-				srcBuffer += ( y + 0 >= h ) ? 0 : srcLineSize;
-				assert( ptrdiff_t( srcBuffer - origin ) <= srcSize );
-				auto line1Ptr = srcBuffer;
-				srcBuffer += ( y + 1 >= h ) ? 0 : srcLineSize;
-				assert( ptrdiff_t( srcBuffer - origin ) <= srcSize );
-				auto line2Ptr = srcBuffer;
-				srcBuffer += ( y + 2 >= h ) ? 0 : srcLineSize;
-				assert( ptrdiff_t( srcBuffer - origin ) <= srcSize );
-				auto line3Ptr = srcBuffer;
-				srcBuffer += ( y + 3 >= h ) ? 0 : srcLineSize;
-				assert( ptrdiff_t( srcBuffer - origin ) <= srcSize );
-
-				for ( uint32_t x = 0; x < bw; x += 4u )
+				Vector< BlockTypeT< TypeT > > blocks;
+
+				for ( auto tile = uint32_t( begin ); tile < uint32_t( end ); ++tile )
 				{
 					if ( interrupt && *interrupt )
 					{
-						return result;
+						return;
 					}
 
-					BlockTypeT< TypeT > block;
-					getLinePixels< TypeT >( block, x, w, srcPixelSize, 0u, line0Ptr, getR, getG, getB, getA );
-					getLinePixels< TypeT >( block, x, w, srcPixelSize, 1u, line1Ptr, getR, getG, getB, getA );
-					getLinePixels< TypeT >( block, x, w, srcPixelSize, 2u, line2Ptr, getR, getG, getB, getA );
-					getLinePixels< TypeT >( block, x, w, srcPixelSize, 3u, line3Ptr, getR, getG, getB, getA );
-					result.push_back( block );
+					auto first = tile * TileBlocks;
+					auto count = std::min( TileBlocks, alignedCount - first );
+					extractBlocks< TypeT >( srcDimensions
+						, srcPixelSize
+						, srcBuffer
+						, srcSize
+						, first
+						, count
+						, getR
+						, getG
+						, getB
+						, getA
+						, blocks );
+					compressBlocks( cvttOptions
+						, interrupt
+						, blocks
+						, dstFormat
+						, dstBuffer + first * blockSize
+						, count * blockSize );
+
+					if ( options.progress )
+					{
+						options.progress( std::min( blockCount, done += count ), blockCount );
+					}
 				}
-			}
+			};
 
-			auto aligned = ashes::getAlignedSize( result.size(), cvtt::NumParallelBlocks );
-
-			while ( result.size() < aligned )
+			if ( options.jobs
+				&& tileCount > 1u
+				&& isThreadSafe( dstFormat ) )
 			{
-				result.push_back( {} );
+				options.jobs->parallelFor( tileCount, compressRange, 1u );
+			}
+			else
+			{
+				compressRange( 0u, tileCount );
 			}
-
-			return result;
 		}
 
 		static void * allocETC2( CU_UnusedParam( void *, context ), size_t size )
@@ -172,7 +251,8 @@ namespace castor
 
 	//*****************************************************************************************
 
-	Vector< cvtt::PixelBlockU8 > createBlocksU8( std::atomic_bool const * interrupt
+	void compressBufferU8( PxBufferConvertOptions const & options
+		, std::atomic_bool const * interrupt
 		, Size const & srcDimensions
 		, uint32_t srcPixelSize
 		, uint8_t const * srcBuffer
@@ -180,9 +260,13 @@ namespace castor
 		, X8UGetter getR
 		, X8UGetter getG
 		, X8UGetter getB
-		, X8UGetter getA )
+		, X8UGetter getA
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize )
 	{
-		return pxcomp::extractBlocks< uint8_t >( interrupt
+		pxcomp::compressTiles< uint8_t >( options
+			, interrupt
 			, srcDimensions
 			, srcPixelSize
 			, srcBuffer
@@ -190,10 +274,14 @@ namespace castor
 			, getR
 			, getG
 			, getB
-			, getA );
+			, getA
+			, dstFormat
+			, dstBuffer
+			, dstSize );
 	}
 
-	Vector< cvtt::PixelBlockS8 > createBlocksS8( std::atomic_bool const * interrupt
+	void compressBufferS8( PxBufferConvertOptions const & options
+		, std::atomic_bool const * interrupt
 		, Size const & srcDimensions
 		, uint32_t srcPixelSize
 		, uint8_t const * srcBuffer
@@ -201,9 +289,13 @@ namespace castor
 		, X8SGetter getR
 		, X8SGetter getG
 		, X8SGetter getB
-		, X8SGetter getA )
+		, X8SGetter getA
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize )
 	{
-		return pxcomp::extractBlocks< int8_t >( interrupt
+		pxcomp::compressTiles< int8_t >( options
+			, interrupt
 			, srcDimensions
 			, srcPixelSize
 			, srcBuffer
@@ -211,10 +303,14 @@ namespace castor
 			, getR
 			, getG
 			, getB
-			, getA );
+			, getA
+			, dstFormat
+			, dstBuffer
+			, dstSize );
 	}
 
-	Vector< cvtt::PixelBlockF16 > createBlocksF16( std::atomic_bool const * interrupt
+	void compressBufferF16( PxBufferConvertOptions const & options
+		, std::atomic_bool const * interrupt
 		, Size const & srcDimensions
 		, uint32_t srcPixelSize
 		, uint8_t const * srcBuffer
@@ -222,9 +318,13 @@ namespace castor
 		, X16FGetter getR
 		, X16FGetter getG
 		, X16FGetter getB
-		, X16FGetter getA )
+		, X16FGetter getA
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize )
 	{
-		return pxcomp::extractBlocks< int16_t >( interrupt
+		pxcomp::compressTiles< int16_t >( options
+			, interrupt
 			, srcDimensions
 			, srcPixelSize
 			, srcBuffer
@@ -232,7 +332,10 @@ namespace castor
 			, getR
 			, getG
 			, getB
-			, getA );
+			, getA
+			, dstFormat
+			, dstBuffer
+			, dstSize );
 	}
 
 	uint32_t compressBlocks( CVTTOptions  const & options
@@ -39,7 +39,8 @@ namespace castor
 		cvtt::BC7EncodingPlan encodingPlan;
 	};
 
-	Vector< cvtt::PixelBlockU8 > createBlocksU8( std::atomic_bool const * interrupt
+	void compressBufferU8( PxBufferConvertOptions const & options
+		, std::atomic_bool const * interrupt
 		, Size const & srcDimensions
 		, uint32_t srcPixelSize
 		, uint8_t const * srcBuffer
@@ -47,8 +48,12 @@ namespace castor
 		, X8UGetter getR
 		, X8UGetter getG
 		, X8UGetter getB
-		, X8UGetter getA );
-	Vector< cvtt::PixelBlockS8 > createBlocksS8( std::atomic_bool const * interrupt
+		, X8UGetter getA
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize );
+	void compressBufferS8( PxBufferConvertOptions const & options
+		, std::atomic_bool const * interrupt
 		, Size const & srcDimensions
 		, uint32_t srcPixelSize
 		, uint8_t const * srcBuffer
@@ -56,8 +61,12 @@ namespace castor
 		, X8SGetter getR
 		, X8SGetter getG
 		, X8SGetter getB
-		, X8SGetter getA );
-	Vector< cvtt::PixelBlockF16 > createBlocksF16( std::atomic_bool const * interrupt
+		, X8SGetter getA
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize );
+	void compressBufferF16( PxBufferConvertOptions const & options
+		, std::atomic_bool const * interrupt
 		, Size const & srcDimensions
 		, uint32_t srcPixelSize
 		, uint8_t const * srcBuffer
@@ -65,7 +74,10 @@ namespace castor
 		, X16FGetter getR
 		, X16FGetter getG
 		, X16FGetter getB
-		, X16FGetter getA );
+		, X16FGetter getA
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize );
 
 	uint32_t compressBlocks( CVTTOptions  const & options
 		, std::atomic_bool const * interrupt
@@ -92,7 +104,7 @@ namespace castor
 		CVTTCompressorU( PxBufferConvertOptions const * poptionsData
 			, std::atomic_bool const * pinterrupt
 			, uint32_t psrcPixelSize )
-			: options{ reinterpret_cast< CVTTOptions * >( poptionsData->additionalOptions ) }
+			: options{ poptionsData }
 			, interrupt{ pinterrupt }
 			, srcPixelSize{ psrcPixelSize }
 		{
@@ -106,7 +118,8 @@ namespace castor
 			, uint8_t * dstBuffer
 			, uint32_t dstSize )
 		{
-			auto blocks = createBlocksU8( interrupt
+			compressBufferU8( *options
+				, interrupt
 				, srcDimensions
 				, srcPixelSize
 				, srcBuffer
@@ -114,17 +127,14 @@ namespace castor
 				, getR8U< PFSrc >
 				, getG8U< PFSrc >
 				, getB8U< PFSrc >
-				, getA8U< PFSrc > );
-			compressBlocks( *options
-				, interrupt
-				, blocks
+				, getA8U< PFSrc >
 				, dstFormat
 				, dstBuffer
 				, dstSize );
 		}
 
 	private:
-		CVTTOptions const * options;
+		PxBufferConvertOptions const * options;
 		std::atomic_bool const * interrupt;
 		uint32_t const srcPixelSize;
 	};
@@ -135,7 +145,7 @@ namespace castor
 		CVTTCompressorS( PxBufferConvertOptions const * poptionsData
 			, std::atomic_bool const * pinterrupt
 			, uint32_t psrcPixelSize )
-			: options{ reinterpret_cast< CVTTOptions * >( poptionsData->additionalOptions ) }
+			: options{ poptionsData }
 			, interrupt{ pinterrupt }
 			, srcPixelSize{ psrcPixelSize }
 		{
@@ -149,7 +159,8 @@ namespace castor
 			, uint8_t * dstBuffer
 			, uint32_t dstSize )
 		{
-			auto blocks = createBlocksS8( interrupt
+			compressBufferS8( *options
+				, interrupt
 				, srcDimensions
 				, srcPixelSize
 				, srcBuffer
@@ -157,17 +168,14 @@ namespace castor
 				, getR8S< PFSrc >
 				, getG8S< PFSrc >
 				, getB8S< PFSrc >
-				, getA8S< PFSrc > );
-			compressBlocks( *options
-				, interrupt
-				, blocks
+				, getA8S< PFSrc >
 				, dstFormat
 				, dstBuffer
 				, dstSize );
 		}
 
 	private:
-		CVTTOptions const * options;
+		PxBufferConvertOptions const * options;
 		std::atomic_bool const * interrupt;
 		uint32_t const srcPixelSize;
 	};
@@ -178,7 +186,7 @@ namespace castor
 		CVTTCompressorF( PxBufferConvertOptions const * poptionsData
 			, std::atomic_bool const * pinterrupt
 			, uint32_t psrcPixelSize )
-			: options{ reinterpret_cast< CVTTOptions * >( poptionsData->additionalOptions ) }
+			: options{ poptionsData }
 			, interrupt{ pinterrupt }
 			, srcPixelSize{ psrcPixelSize }
 		{
@@ -192,7 +200,8 @@ namespace castor
 			, uint8_t * dstBuffer
 			, uint32_t dstSize )
 		{
-			auto blocks = createBlocksF16( interrupt
+			compressBufferF16( *options
+				, interrupt
 				, srcDimensions
 				, srcPixelSize
 				, srcBuffer
@@ -200,17 +209,14 @@ namespace castor
 				, getR16F< PFSrc >
 				, getG16F< PFSrc >
 				, getB16F< PFSrc >
-				, getA16F< PFSrc > );
-			compressBlocks( *options
-				, interrupt
-				, blocks
+				, getA16F< PFSrc >
 				, dstFormat
 				, dstBuffer
 				, dstSize );
 		}
 
 	private:
-		CVTTOptions const * options;
+		PxBufferConvertOptions const * options;
 		std::atomic_bool const * interrupt;
 		uint32_t const srcPixelSize;
 	};
@@ -0,0 +1,137 @@
+#include "CastorUtils/Graphics/SkylinePacker.hpp"
+
+namespace castor
+{
+	SkylinePacker::SkylinePacker( uint32_t width
+		, uint32_t height )
+		: m_width{ width }
+		, m_height{ height }
+	{
+		clear();
+	}
+
+	bool SkylinePacker::insert( Size const & size
+		, Position & position )
+	{
+		auto bestBottom = std::numeric_limits< uint32_t >::max();
+		auto bestWidth = std::numeric_limits< uint32_t >::max();
+		auto bestIndex = m_skyline.size();
+
+		for ( size_t index = 0u; index < m_skyline.size(); ++index )
+		{
+			uint32_t y{};
+
+			if ( doFit( index, size, y ) )
+			{
+				auto bottom = y + size.getHeight();
+				auto & level = m_skyline[index];
+
+				if ( bottom < bestBottom
+					|| ( bottom == bestBottom && level.width < bestWidth ) )
+				{
+					bestBottom = bottom;
+					bestWidth = level.width;
+					bestIndex = index;
+					position = Position{ int32_t( level.x ), int32_t( y ) };
+				}
+			}
+		}
+
+		if ( bestIndex == m_skyline.size() )
+		{
+			return false;
+		}
+
+		doAddLevel( bestIndex, position, size );
+		m_usedHeight = std::max( m_usedHeight, bestBottom );
+		return true;
+	}
+
+	void SkylinePacker::grow( uint32_t height )
+	{
+		CU_Require( height >= m_height );
+		m_height = height;
+	}
+
+	void SkylinePacker::clear()
+	{
+		m_skyline.clear();
+		m_skyline.push_back( { 0u, 0u, m_width } );
+		m_usedHeight = 0u;
+	}
+
+	bool SkylinePacker::doFit( size_t index
+		, Size const & size
+		, uint32_t & y )const
+	{
+		auto x = m_skyline[index].x;
+
+		if ( x + size.getWidth() > m_width )
+		{
+			return false;
+		}
+
+		// The rectangle lies on the highest level it spans.
+		auto remaining = int64_t( size.getWidth() );
+		y = 0u;
+
+		while ( remaining > 0 )
+		{
+			CU_Require( index < m_skyline.size() );
+			auto & level = m_skyline[index];
+			y = std::max( y, level.y );
+
+			if ( y + size.getHeight() > m_height )
+			{
+				return false;
+			}
+
+			remaining -= int64_t( level.width );
+			++index;
+		}
+
+		return true;
+	}
+
+	void SkylinePacker::doAddLevel( size_t index
+		, Position const & position
+		, Size const & size )
+	{
+		auto it = m_skyline.insert( std::next( m_skyline.begin(), ptrdiff_t( index ) )
+			, Level{ uint32_t( position.x() )
+				, uint32_t( position.y() ) + size.getHeight()
+				, size.getWidth() } );
+		auto right = it->x + it->width;
+		auto next = std::next( it );
+
+		// Shrink or remove the levels now hidden by the new one.
+		while ( next != m_skyline.end()
+			&& next->x < right )
+		{
+			auto shrink = right - next->x;
+
+			if ( shrink < next->width )
+			{
+				next->x += shrink;
+				next->width -= shrink;
+				break;
+			}
+
+			next = m_skyline.erase( next );
+		}
+
+		// Merge the neighbour levels sharing the same height.
+		for ( size_t i = 0u; i + 1u < m_skyline.size(); )
+		{
+			if ( m_skyline[i].y == m_skyline[i + 1u].y )
+			{
+				m_skyline[i].width += m_skyline[i + 1u].width;
+				m_skyline.erase( std::next( m_skyline.begin(), ptrdiff_t( i + 1u ) ) );
+			}
+			else
+			{
+				++i;
+			}
+		}
+	}
+}
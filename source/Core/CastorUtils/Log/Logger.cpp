@@ -80,6 +80,31 @@ namespace castor
 		return getSingleton().m_instance->getLevel();
 	}
 
+	void Logger::setOverflowPolicy( LogOverflowPolicy policy )
+	{
+		CU_Require( getSingleton().m_instance );
+		getSingleton().m_instance->setOverflowPolicy( policy );
+	}
+
+	uint64_t Logger::getDroppedCount()
+	{
+		CU_Require( getSingleton().m_instance );
+		return getSingleton().m_instance->getDroppedCount();
+	}
+
+	size_t Logger::getQueueDepth()
+	{
+		CU_Require( getSingleton().m_instance );
+		return getSingleton().m_instance->getQueueDepth();
+	}
+
+	void Logger::logDeferred( LogType type
+		, castor::Function< MbString() > formatter )
+	{
+		CU_Require( getSingleton().m_instance );
+		getSingleton().m_instance->pushDeferredMessage( type, castor::move( formatter ) );
+	}
+
 	void Logger::doLogMessage( LogType type, MbString const & msg, bool addNL )
 	{
 		CU_Require( getSingleton().m_instance );
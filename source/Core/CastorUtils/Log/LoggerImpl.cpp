@@ -149,6 +149,8 @@ namespace castor
 
 	void LoggerImpl::doPrintMessage( LogType logLevel, MbString const & message, bool newLine )
 	{
+		auto lock( makeUniqueLock( m_mutexConsole ) );
+
 		if ( message.find( cuT( '\n' ) ) != String::npos )
 		{
 			auto array = string::split( message, "\n", uint32_t( std::count( message.begin(), message.end(), '\n' ) + 1 ) );
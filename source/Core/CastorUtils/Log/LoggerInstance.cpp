@@ -12,6 +12,9 @@ namespace castor
 		, m_impl{ castor::move( rhs.m_impl ) }
 		, m_headers{ castor::move( rhs.m_headers ) }
 		, m_queue{ castor::move( rhs.m_queue ) }
+		, m_pending{ castor::move( rhs.m_pending ) }
+		, m_overflowPolicy{ rhs.m_overflowPolicy.load() }
+		, m_dropped{ rhs.m_dropped.load() }
 		, m_logThread{ castor::move( rhs.m_logThread ) }
 		, m_initialised{ rhs.m_initialised.load() }
 		, m_stopped{ rhs.m_stopped.load() }
@@ -28,6 +31,9 @@ namespace castor
 		m_impl = castor::move( rhs.m_impl );
 		m_headers = castor::move( rhs.m_headers );
 		m_queue = castor::move( rhs.m_queue );
+		m_pending = castor::move( rhs.m_pending );
+		m_overflowPolicy = rhs.m_overflowPolicy.load();
+		m_dropped = rhs.m_dropped.load();
 		m_logThread = castor::move( rhs.m_logThread );
 		m_initialised = rhs.m_initialised.load();
 		m_stopped = rhs.m_stopped.load();
@@ -47,6 +53,7 @@ namespace castor
 		, LogType logType )
 		: m_logLevel{ logType }
 		, m_impl{ console, logType, *this }
+		, m_queue{ castor::make_unique< MessageRing >( QueueCapacity ) }
 	{
 		doInitialiseThread();
 	}
@@ -66,6 +73,7 @@ namespace castor
 	{
 		m_impl.setFileName( logFilePath, logType );
 		m_initialised = true;
+		doWakeWriter();
 	}
 
 	LogType LoggerInstance::getLevel()const
@@ -73,68 +81,174 @@ namespace castor
 		return m_logLevel;
 	}
 
+	void LoggerInstance::pushDeferredMessage( LogType type
+		, castor::Function< MbString() > formatter
+		, bool addLF )
+	{
+		if ( type >= m_logLevel )
+		{
+			doEnqueue( Message{ type, castor::move( formatter ), addLF } );
+		}
+	}
+
 	void LoggerInstance::flushQueue()
 	{
-		MessageQueue queue;
-		[&queue, this]()
+		auto lock( makeUniqueLock( m_mutexFlush ) );
+		Message message;
+		bool popped{};
+
+		while ( m_queue->tryPop( message ) )
+		{
+			if ( message.m_formatter )
+			{
+				message.m_message = message.m_formatter();
+				message.m_formatter = nullptr;
+#if !defined( NDEBUG )
+				m_impl.printMessage( message.m_type, message.m_message, message.m_newLine );
+#endif
+			}
+
+			m_pending.push_back( castor::move( message ) );
+			popped = true;
+		}
+
+		if ( popped )
 		{
-			auto lock( makeUniqueLock( m_mutexQueue ) );
-			castor::swap( queue, m_queue );
-		}();
+			// Wakes the producers blocked on a full queue.
+			auto spaceLock( makeUniqueLock( m_mutexSpace ) );
+			m_space.notify_all();
+		}
 
-		if ( !queue.empty() )
+		if ( m_initialised && !m_pending.empty() )
 		{
+			MessageQueue queue;
+			castor::swap( queue, m_pending );
 			m_impl.logMessageQueue( queue );
 		}
 	}
 
+	size_t LoggerInstance::getQueueDepth()const noexcept
+	{
+		return m_queue->size();
+	}
+
+	size_t LoggerInstance::getQueueCapacity()const noexcept
+	{
+		return m_queue->capacity();
+	}
+
 	void LoggerInstance::doInitialiseThread()
 	{
 		m_logThread = std::thread( [this]()
 			{
-				while ( !m_initialised && !m_stopped )
-				{
-					std::this_thread::sleep_for( Milliseconds( 10 ) );
-				}
-
 				while ( !m_stopped )
 				{
-					flushQueue();
-					std::this_thread::sleep_for( Milliseconds( 100 ) );
-				}
+					{
+						auto lock( makeUniqueLock( m_mutexWake ) );
+						m_wake.wait( lock
+							, [this]()
+							{
+								return m_stopped || m_wakeRequested;
+							} );
+						m_wakeRequested = false;
+					}
 
-				if ( m_initialised )
-				{
 					flushQueue();
 				}
 
+				flushQueue();
 				m_threadEnded = true;
 			} );
 	}
 
 	void LoggerInstance::doCleanupThread()
 	{
-		if ( !m_stopped )
+		if ( !m_stopped && m_logThread.joinable() )
 		{
 			m_stopped = true;
+			doWakeWriter();
+			m_logThread.join();
+			auto lock( makeUniqueLock( m_mutexSpace ) );
+			m_space.notify_all();
+		}
+	}
+
+	void LoggerInstance::doWakeWriter()
+	{
+		if ( !m_wakeRequested.exchange( true ) )
+		{
+			auto lock( makeUniqueLock( m_mutexWake ) );
+			m_wake.notify_one();
+		}
+	}
+
+	void LoggerInstance::doWaitForSpace()
+	{
+		auto lock( makeUniqueLock( m_mutexSpace ) );
+		m_space.wait( lock
+			, [this]()
+			{
+				return m_stopped
+					|| m_queue->size() < m_queue->capacity();
+			} );
+	}
+
+	bool LoggerInstance::doDropOnOverflow( LogType type )const
+	{
+		// The writer thread can't wait for itself, nor can anyone wait for a stopped writer.
+		if ( m_stopped || std::this_thread::get_id() == m_logThread.get_id() )
+		{
+			return true;
+		}
+
+		switch ( m_overflowPolicy.load() )
+		{
+		case LogOverflowPolicy::eDrop:
+			return true;
+		case LogOverflowPolicy::eSample:
+			return type < LogType::eWarning;
+		default:
+			return false;
+		}
+	}
+
+	void LoggerInstance::doEnqueue( Message message )
+	{
+		auto type = message.m_type;
+
+		if ( m_overflowPolicy == LogOverflowPolicy::eSample
+			&& type < LogType::eWarning
+			&& m_queue->size() >= m_queue->capacity() / 2u
+			&& ( m_sampled++ % LogSampleRate ) != 0u )
+		{
+			++m_dropped;
+			return;
+		}
 
-			while ( !m_threadEnded )
+		while ( !m_queue->tryPush( message ) )
+		{
+			if ( doDropOnOverflow( type ) )
 			{
-				std::this_thread::sleep_for( 1_ms );
+				++m_dropped;
+				return;
 			}
 
-			m_logThread.join();
+			doWakeWriter();
+			doWaitForSpace();
 		}
+
+		// The writer is only notified when it sleeps, the messages pushed meanwhile are written in the same batch.
+		doWakeWriter();
 	}
 
-	void LoggerInstance::doLockedPushMessage( LogType logLevel, MbString const & message, bool newLine )
+	void LoggerInstance::doPushMessage( LogType logLevel, MbString const & message, bool newLine )
 	{
 		if ( logLevel >= m_logLevel )
 		{
 #if !defined( NDEBUG )
 			m_impl.printMessage( logLevel, message, newLine );
 #endif
-			m_queue.emplace_back( logLevel, message, newLine );
+			doEnqueue( Message{ logLevel, message, newLine } );
 		}
 	}
 }
@@ -0,0 +1,138 @@
+#include "CastorUtils/Math/VertexPacking.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace castor::packing
+{
+	namespace vtxpack
+	{
+		static uint32_t roundToNearestEven( uint32_t truncated
+			, uint32_t mantissa
+			, uint32_t shift )noexcept
+		{
+			auto halfway = 1u << ( shift - 1u );
+			auto remainder = mantissa & ( ( 1u << shift ) - 1u );
+			return ( remainder > halfway || ( remainder == halfway && ( truncated & 1u ) ) )
+				? truncated + 1u
+				: truncated;
+		}
+	}
+
+	int16_t toSnorm16( float value )noexcept
+	{
+		return int16_t( std::round( std::clamp( value, -1.0f, 1.0f ) * 32767.0f ) );
+	}
+
+	float fromSnorm16( int16_t value )noexcept
+	{
+		return std::max( float( value ) / 32767.0f, -1.0f );
+	}
+
+	uint8_t toUnorm8( float value )noexcept
+	{
+		return uint8_t( std::round( std::clamp( value, 0.0f, 1.0f ) * 255.0f ) );
+	}
+
+	uint16_t toHalf( float value )noexcept
+	{
+		uint32_t bits{};
+		std::memcpy( &bits, &value, sizeof( float ) );
+		auto sign = uint32_t( ( bits >> 16u ) & 0x8000u );
+		auto exponent = int32_t( ( bits >> 23u ) & 0xFFu ) - 127 + 15;
+		auto mantissa = bits & 0x007FFFFFu;
+
+		if ( exponent >= 31 )
+		{
+			// Overflow and infinity give infinity, NaN stays NaN.
+			auto isNaN = ( ( bits >> 23u ) & 0xFFu ) == 0xFFu && mantissa != 0u;
+			return uint16_t( sign | 0x7C00u | ( isNaN ? 0x0200u : 0u ) );
+		}
+
+		if ( exponent <= 0 )
+		{
+			if ( exponent < -10 )
+			{
+				return uint16_t( sign );
+			}
+
+			// Subnormal half.
+			mantissa |= 0x00800000u;
+			auto shift = uint32_t( 14 - exponent );
+			return uint16_t( sign | vtxpack::roundToNearestEven( mantissa >> shift, mantissa, shift ) );
+		}
+
+		// Rounding may carry into the exponent, which gives the right value.
+		return uint16_t( sign | vtxpack::roundToNearestEven( ( uint32_t( exponent ) << 10u ) | ( mantissa >> 13u ), mantissa, 13u ) );
+	}
+
+	float fromHalf( uint16_t value )noexcept
+	{
+		auto sign = uint32_t( value & 0x8000u ) << 16u;
+		auto exponent = uint32_t( ( value >> 10u ) & 0x1Fu );
+		auto mantissa = uint32_t( value & 0x03FFu );
+		uint32_t bits{};
+
+		if ( exponent == 0x1Fu )
+		{
+			// Infinity or NaN.
+			bits = sign | 0x7F800000u | ( mantissa << 13u );
+		}
+		else if ( exponent != 0u )
+		{
+			bits = sign | ( ( exponent + 127u - 15u ) << 23u ) | ( mantissa << 13u );
+		}
+		else if ( mantissa != 0u )
+		{
+			// Subnormal half, normalised in the float.
+			exponent = 127u - 15u + 1u;
+
+			while ( !( mantissa & 0x0400u ) )
+			{
+				mantissa <<= 1u;
+				--exponent;
+			}
+
+			bits = sign | ( exponent << 23u ) | ( ( mantissa & 0x03FFu ) << 13u );
+		}
+		else
+		{
+			bits = sign;
+		}
+
+		float result{};
+		std::memcpy( &result, &bits, sizeof( float ) );
+		return result;
+	}
+
+	Array< int16_t, 2u > encodeOctahedral( float x, float y, float z )noexcept
+	{
+		auto length = std::abs( x ) + std::abs( y ) + std::abs( z );
+
+		if ( length > 0.0f )
+		{
+			x /= length;
+			y /= length;
+
+			if ( z < 0.0f )
+			{
+				auto ox = ( 1.0f - std::abs( y ) ) * ( x >= 0.0f ? 1.0f : -1.0f );
+				y = ( 1.0f - std::abs( x ) ) * ( y >= 0.0f ? 1.0f : -1.0f );
+				x = ox;
+			}
+		}
+
+		return { toSnorm16( x ), toSnorm16( y ) };
+	}
+
+	Point3f decodeOctahedral( int16_t u, int16_t v )noexcept
+	{
+		Point3f result{ fromSnorm16( u ), fromSnorm16( v ), 0.0f };
+		result->z = 1.0f - std::abs( result->x ) - std::abs( result->y );
+		auto t = std::max( -result->z, 0.0f );
+		result->x += result->x >= 0.0f ? -t : t;
+		result->y += result->y >= 0.0f ? -t : t;
+		point::normalise( result );
+		return result;
+	}
+}
@@ -3,6 +3,13 @@
 #include "CastorUtils/Exception/Assertion.hpp"
 #include "CastorUtils/Miscellaneous/StringUtils.hpp"
 
+#if defined( CU_ArchX86_64 ) || defined( CU_ArchX86_32 )
+#	if defined( CU_CompilerMSVC )
+#		include <intrin.h>
+#		include <immintrin.h>
+#	endif
+#endif
+
 namespace castor
 {
 	namespace platform
@@ -12,11 +19,85 @@ namespace castor
 		String getCPUVendor();
 	}
 
+	namespace cpuinfo
+	{
+#if defined( CU_ArchX86_64 ) || defined( CU_ArchX86_32 )
+#	if defined( CU_CompilerMSVC )
+
+		static bool hasSSE2()
+		{
+			Array< int, 4 > data{};
+			__cpuid( data.data(), 1 );
+			return ( data[3] & ( 1 << 26 ) ) != 0;
+		}
+
+		static bool hasAVX2()
+		{
+			Array< int, 4 > data{};
+			__cpuid( data.data(), 0 );
+
+			if ( data[0] < 7 )
+			{
+				return false;
+			}
+
+			// AVX registers must be enabled by the OS (OSXSAVE + XCR0 YMM state).
+			__cpuid( data.data(), 1 );
+
+			if ( ( data[2] & ( 1 << 27 ) ) == 0
+				|| ( data[2] & ( 1 << 28 ) ) == 0
+				|| ( _xgetbv( 0 ) & 0x06u ) != 0x06u )
+			{
+				return false;
+			}
+
+			__cpuidex( data.data(), 7, 0 );
+			return ( data[1] & ( 1 << 5 ) ) != 0;
+		}
+
+#	else
+
+		static bool hasSSE2()
+		{
+			__builtin_cpu_init();
+			return __builtin_cpu_supports( "sse2" ) != 0;
+		}
+
+		static bool hasAVX2()
+		{
+			__builtin_cpu_init();
+			return __builtin_cpu_supports( "avx2" ) != 0;
+		}
+
+#	endif
+#else
+
+		static bool hasSSE2()
+		{
+			return false;
+		}
+
+		static bool hasAVX2()
+		{
+			return false;
+		}
+
+#endif
+
+		static bool hasNEON()
+		{
+			return CU_SimdNEON != 0;
+		}
+	}
+
 	CpuInformations::CpuInformationsInternal::CpuInformationsInternal()
 	{
 		m_coreCount = platform::getCoreCount();
 		m_model = platform::getCPUModel();
 		m_vendor = platform::getCPUVendor();
+		m_hasSSE2 = cpuinfo::hasSSE2();
+		m_hasAVX2 = cpuinfo::hasAVX2();
+		m_hasNEON = cpuinfo::hasNEON();
 
 		if ( m_vendor == cuT( "GenuineIntel" ) )
 		{
@@ -35,7 +116,10 @@ namespace castor
 		stream << "CPU informations:" << std::endl;
 		stream << "    Vendor: " << object.getVendor() << std::endl;
 		stream << "    Model: " << object.getModel() << std::endl;
-		stream << "    Core count: " << object.getCoreCount();
+		stream << "    Core count: " << object.getCoreCount() << std::endl;
+		stream << "    SSE2: " << object.hasSSE2() << std::endl;
+		stream << "    AVX2: " << object.hasAVX2() << std::endl;
+		stream << "    NEON: " << object.hasNEON();
 		return stream;
 	}
 }
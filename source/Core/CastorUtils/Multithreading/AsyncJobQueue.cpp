@@ -5,88 +5,37 @@
 namespace castor
 {
 	AsyncJobQueue::AsyncJobQueue( size_t count )
-		: m_pool{ count }
-		, m_worker{ [this](){ doRun(); } }
+		: m_jobs{ count }
 	{
 	}
 
 	AsyncJobQueue::~AsyncJobQueue()noexcept
 	{
 		m_ended = true;
-		m_pool.waitAll( Milliseconds( 0xFFFFFFFFFFFFFFFF ) );
-		m_worker.join();
+		m_jobs.waitAll();
 	}
 
 	void AsyncJobQueue::pushJob( Job job )
 	{
-		auto lock( makeUniqueLock( m_mutex ) );
 		if ( !m_ended )
 		{
-			m_pending.emplace_back( castor::move( job ) );
+			m_jobs.pushJob( castor::move( job ) );
 		}
 	}
 
 	void AsyncJobQueue::waitAll()
 	{
-		while ( !doCheckEnded() )
-		{
-			std::this_thread::sleep_for( 5_ms );
-		}
-
-		m_pool.waitAll( Milliseconds{ Milliseconds::max() } );
+		m_jobs.waitAll();
 	}
 
 	void AsyncJobQueue::finish()
 	{
 		m_ended = true;
-		m_pool.waitAll( Milliseconds{ Milliseconds::max() } );
+		m_jobs.waitAll();
 	}
 
 	void AsyncJobQueue::reset()
 	{
-		if ( m_ended )
-		{
-			m_worker.join();
-			m_ended = false;
-			m_worker = std::thread{ [this]() { doRun(); } };
-		}
-	}
-
-	void AsyncJobQueue::doRun()
-	{
-		while ( !m_ended )
-		{
-			while ( !m_ended && doCheckEnded() )
-			{
-				std::this_thread::sleep_for( 5_ms );
-			}
-
-			m_pool.pushJob( doPopJob() );
-		}
-	}
-
-	AsyncJobQueue::Job AsyncJobQueue::doPopJob()
-	{
-		auto lock( makeUniqueLock( m_mutex ) );
-
-		if ( !m_pending.empty() )
-		{
-			auto job = m_pending.front();
-			m_pending.erase( m_pending.begin() );
-			return job;
-		}
-
-		// Should never happen, but let's do this just in case.
-		static Job dummy = []()
-		{
-			std::this_thread::sleep_for( 5_ms );
-		};
-		return dummy;
-	}
-
-	bool AsyncJobQueue::doCheckEnded()
-	{
-		auto lock( makeUniqueLock( m_mutex ) );
-		return m_pending.empty();
+		m_ended = false;
 	}
 }
@@ -0,0 +1,470 @@
+#include "CastorUtils/Multithreading/JobSystem.hpp"
+
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+
+namespace castor
+{
+	//*********************************************************************************************
+
+	namespace details
+	{
+		struct JobState
+		{
+			JobState( JobSystem::Job pjob
+				, uint32_t dependencies )
+				: job{ castor::move( pjob ) }
+				, remaining{ dependencies }
+			{
+			}
+
+			JobSystem::Job job;
+			std::atomic_uint32_t remaining;
+			std::atomic_bool done{ false };
+			castor::Mutex mutex;
+			Vector< JobStatePtr > continuations;
+		};
+	}
+
+	//*********************************************************************************************
+
+	namespace jobsys
+	{
+		static size_t constexpr NoWorker = ~size_t{};
+		static Milliseconds constexpr InfiniteWait{ std::chrono::hours{ 24 } };
+
+		struct WorkerInfo
+		{
+			JobSystem const * system{};
+			size_t index{ NoWorker };
+		};
+
+		static thread_local WorkerInfo currentWorker;
+
+		static details::JobStatePtr popFront( Deque< details::JobStatePtr > & jobs )
+		{
+			auto result = castor::move( jobs.front() );
+			jobs.pop_front();
+			return result;
+		}
+
+		static details::JobStatePtr popBack( Deque< details::JobStatePtr > & jobs )
+		{
+			auto result = castor::move( jobs.back() );
+			jobs.pop_back();
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	bool JobHandle::isDone()const noexcept
+	{
+		return !m_state || m_state->done.load();
+	}
+
+	//*********************************************************************************************
+
+	JobSystem::JobSystem( size_t count )
+	{
+		m_queues.reserve( count );
+		m_threads.reserve( count );
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			m_queues.push_back( castor::make_unique< JobQueue >() );
+		}
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			m_threads.emplace_back( [this, i]()
+				{
+					doRun( i );
+				} );
+		}
+	}
+
+	JobSystem::~JobSystem()noexcept
+	{
+		waitAll();
+
+		{
+			auto lock( makeUniqueLock( m_wakeMutex ) );
+			m_terminate = true;
+		}
+
+		m_wakeCondition.notify_all();
+
+		for ( auto & thread : m_threads )
+		{
+			thread.join();
+		}
+	}
+
+	JobHandle JobSystem::pushJob( Job job )
+	{
+		auto result = doCreateJob( castor::move( job ) );
+		doSchedule( result.m_state );
+		return result;
+	}
+
+	JobHandle JobSystem::pushJob( Vector< JobHandle > const & dependencies
+		, Job job )
+	{
+		auto result = doCreateJob( castor::move( job ) );
+		auto & state = *result.m_state;
+
+		for ( auto & dependency : dependencies )
+		{
+			if ( dependency.m_state )
+			{
+				auto & depState = *dependency.m_state;
+				auto lock( makeUniqueLock( depState.mutex ) );
+
+				if ( !depState.done )
+				{
+					++state.remaining;
+					depState.continuations.push_back( result.m_state );
+				}
+			}
+		}
+
+		// Release the guard dependency taken in doCreateJob.
+		if ( --state.remaining == 0u )
+		{
+			doSchedule( result.m_state );
+		}
+
+		return result;
+	}
+
+	JobHandle JobSystem::then( JobHandle const & dependency
+		, Job job )
+	{
+		return pushJob( Vector< JobHandle >{ dependency }, castor::move( job ) );
+	}
+
+	void JobSystem::parallelFor( size_t count
+		, RangeJob const & job
+		, size_t grain )
+	{
+		if ( count == 0u )
+		{
+			return;
+		}
+
+		if ( grain == 0u )
+		{
+			grain = std::max( size_t{ 1u }, count / ( 4u * ( getCount() + 1u ) ) );
+		}
+
+		auto chunks = ( count + grain - 1u ) / grain;
+
+		if ( chunks == 1u || m_threads.empty() )
+		{
+			job( 0u, count );
+			return;
+		}
+
+		std::atomic_size_t next{};
+		// The first error, from any thread, is rethrown on the calling thread once all the chunks are done.
+		std::exception_ptr error;
+		Mutex errorMutex;
+		auto process = [&next, &job, &error, &errorMutex, chunks, grain, count]()
+		{
+			try
+			{
+				for ( auto chunk = next++; chunk < chunks; chunk = next++ )
+				{
+					auto begin = chunk * grain;
+					job( begin, std::min( count, begin + grain ) );
+				}
+			}
+			catch ( ... )
+			{
+				auto lock( makeUniqueLock( errorMutex ) );
+
+				if ( !error )
+				{
+					error = std::current_exception();
+				}
+
+				// The remaining chunks are skipped.
+				next = chunks;
+			}
+		};
+
+		Vector< JobHandle > helpers;
+		auto helpersCount = std::min( chunks - 1u, getCount() );
+		helpers.reserve( helpersCount );
+
+		for ( size_t i = 0u; i < helpersCount; ++i )
+		{
+			helpers.push_back( pushJob( process ) );
+		}
+
+		process();
+
+		// The helpers reference local data, they must end before rethrowing.
+		for ( auto & helper : helpers )
+		{
+			wait( helper );
+		}
+
+		if ( error )
+		{
+			std::rethrow_exception( error );
+		}
+	}
+
+	void JobSystem::wait( JobHandle const & handle )
+	{
+		while ( !handle.isDone() )
+		{
+			if ( !doRunPendingJob() )
+			{
+				++m_waiting;
+
+				{
+					auto lock( makeUniqueLock( m_doneMutex ) );
+					m_doneCondition.wait( lock, [this, &handle]()
+						{
+							return handle.isDone() || m_queued > 0u;
+						} );
+				}
+
+				--m_waiting;
+			}
+		}
+	}
+
+	bool JobSystem::waitAll( Milliseconds const & timeout )const
+	{
+		auto isDone = [this]()
+		{
+			return m_pending == 0u;
+		};
+		bool result = isDone();
+
+		if ( !result )
+		{
+			++m_waiting;
+
+			{
+				auto lock( makeUniqueLock( m_doneMutex ) );
+
+				if ( timeout >= jobsys::InfiniteWait )
+				{
+					m_doneCondition.wait( lock, isDone );
+					result = true;
+				}
+				else
+				{
+					result = m_doneCondition.wait_for( lock, timeout, isDone );
+				}
+			}
+
+			--m_waiting;
+		}
+
+		return result;
+	}
+
+	void JobSystem::waitAll()const
+	{
+		waitAll( Milliseconds::max() );
+	}
+
+	bool JobSystem::isWorkerThread()const noexcept
+	{
+		return jobsys::currentWorker.system == this;
+	}
+
+	void JobSystem::doRun( size_t index )
+	{
+		jobsys::currentWorker = { this, index };
+
+		while ( !m_terminate )
+		{
+			if ( auto job = doPopJob( index ) )
+			{
+				doExecute( job );
+			}
+			else
+			{
+				auto lock( makeUniqueLock( m_wakeMutex ) );
+				++m_sleeping;
+				m_wakeCondition.wait( lock, [this]()
+					{
+						return m_terminate || m_queued > 0u;
+					} );
+				--m_sleeping;
+			}
+		}
+
+		jobsys::currentWorker = {};
+	}
+
+	JobHandle JobSystem::doCreateJob( Job job )
+	{
+		++m_pending;
+		// The job is created with a guard dependency, released when it is scheduled.
+		return JobHandle{ castor::make_shared< details::JobState >( castor::move( job ), 1u ) };
+	}
+
+	void JobSystem::doSchedule( details::JobStatePtr job )
+	{
+		job->remaining = 0u;
+
+		if ( m_threads.empty() )
+		{
+			doExecute( job );
+			return;
+		}
+
+		auto & queue = isWorkerThread()
+			? *m_queues[jobsys::currentWorker.index]
+			: m_shared;
+
+		{
+			auto lock( makeUniqueLock( queue.mutex ) );
+			queue.jobs.push_back( castor::move( job ) );
+			++m_queued;
+		}
+
+		if ( m_sleeping > 0u )
+		{
+			{
+				auto lock( makeUniqueLock( m_wakeMutex ) );
+			}
+			m_wakeCondition.notify_one();
+		}
+
+		if ( m_waiting > 0u )
+		{
+			// Waiting threads may help running this job.
+			doNotifyWaiters();
+		}
+	}
+
+	details::JobStatePtr JobSystem::doPopJob( size_t index )
+	{
+		if ( m_queued == 0u )
+		{
+			return nullptr;
+		}
+
+		// First look in own queue, most recent job first.
+		if ( index < m_queues.size() )
+		{
+			auto & queue = *m_queues[index];
+			auto lock( makeUniqueLock( queue.mutex ) );
+
+			if ( !queue.jobs.empty() )
+			{
+				--m_queued;
+				return jobsys::popBack( queue.jobs );
+			}
+		}
+
+		// Then in shared queue.
+		{
+			auto lock( makeUniqueLock( m_shared.mutex ) );
+
+			if ( !m_shared.jobs.empty() )
+			{
+				--m_queued;
+				return jobsys::popFront( m_shared.jobs );
+			}
+		}
+
+		// Then steal from other workers, oldest job first.
+		auto count = m_queues.size();
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			auto victim = index < count
+				? ( index + i + 1u ) % count
+				: i;
+
+			if ( victim != index )
+			{
+				auto & queue = *m_queues[victim];
+				auto lock( makeUniqueLock( queue.mutex ) );
+
+				if ( !queue.jobs.empty() )
+				{
+					--m_queued;
+					return jobsys::popFront( queue.jobs );
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool JobSystem::doRunPendingJob()
+	{
+		auto job = doPopJob( isWorkerThread()
+			? jobsys::currentWorker.index
+			: jobsys::NoWorker );
+
+		if ( !job )
+		{
+			return false;
+		}
+
+		doExecute( job );
+		return true;
+	}
+
+	void JobSystem::doExecute( details::JobStatePtr const & job )
+	{
+		try
+		{
+			job->job();
+		}
+		catch ( std::exception & exc )
+		{
+			Logger::logError( makeStringStream() << cuT( "JobSystem - Job failed: " ) << exc.what() );
+		}
+		catch ( ... )
+		{
+			Logger::logError( cuT( "JobSystem - Job failed: Unknown error" ) );
+		}
+
+		job->job = {};
+		Vector< details::JobStatePtr > continuations;
+
+		{
+			auto lock( makeUniqueLock( job->mutex ) );
+			job->done = true;
+			std::swap( continuations, job->continuations );
+		}
+
+		for ( auto & continuation : continuations )
+		{
+			if ( --continuation->remaining == 0u )
+			{
+				doSchedule( continuation );
+			}
+		}
+
+		--m_pending;
+
+		if ( m_waiting > 0u )
+		{
+			doNotifyWaiters();
+		}
+	}
+
+	void JobSystem::doNotifyWaiters()
+	{
+		{
+			auto lock( makeUniqueLock( m_doneMutex ) );
+		}
+		m_doneCondition.notify_all();
+	}
+
+	//*********************************************************************************************
+}
@@ -4,6 +4,11 @@
 
 namespace castor
 {
+	namespace wkthd
+	{
+		static Milliseconds constexpr InfiniteWait{ std::chrono::hours{ 24 } };
+	}
+
 	WorkerThread::WorkerThread()
 		: m_thread{ [this]()
 			{
@@ -14,16 +19,27 @@ namespace castor
 
 	WorkerThread::~WorkerThread()noexcept
 	{
-		m_terminate = true;
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			m_terminate = true;
+		}
+
+		m_startCondition.notify_all();
+		m_endCondition.notify_all();
 		m_thread.join();
 		m_currentJob = {};
 	}
 
 	void WorkerThread::feed( Job job )
 	{
-		CU_Require( m_start == false );
-		m_currentJob = castor::move( job );
-		m_start = true;
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			CU_Require( m_start == false );
+			m_currentJob = castor::move( job );
+			m_start = true;
+		}
+
+		m_startCondition.notify_one();
 	}
 
 	bool WorkerThread::isEnded()const
@@ -33,38 +49,46 @@ namespace castor
 
 	bool WorkerThread::wait( Milliseconds const & timeout )const
 	{
-		bool result = isEnded() && !m_terminate;
-
-		if ( !result )
+		auto isDone = [this]()
 		{
-			auto begin = std::chrono::high_resolution_clock::now();
-			Milliseconds wait{ 0 };
+			return isEnded() || m_terminate;
+		};
+		auto lock( makeUniqueLock( m_mutex ) );
 
-			do
-			{
-				std::this_thread::sleep_for( Milliseconds( 1 ) );
-				result = isEnded();
-				wait = std::chrono::duration_cast< Milliseconds >( std::chrono::high_resolution_clock::now() - begin );
-			}
-			while ( wait < timeout && !result && !m_terminate );
+		if ( timeout >= wkthd::InfiniteWait )
+		{
+			m_endCondition.wait( lock, isDone );
+		}
+		else
+		{
+			m_endCondition.wait_for( lock, timeout, isDone );
 		}
 
-		return result;
+		return isEnded();
 	}
 
 	void WorkerThread::doRun()
 	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
 		while ( !m_terminate )
 		{
-			if ( m_start )
+			m_startCondition.wait( lock, [this]()
+				{
+					return m_start || m_terminate;
+				} );
+
+			if ( m_start && !m_terminate )
 			{
-				m_currentJob();
+				auto job = castor::move( m_currentJob );
+				lock.unlock();
+				job();
+				lock.lock();
 				m_start = false;
+				lock.unlock();
+				m_endCondition.notify_all();
 				onEnded( *this );
-			}
-			else
-			{
-				std::this_thread::sleep_for( Milliseconds( 1 ) );
+				lock.lock();
 			}
 		}
 	}
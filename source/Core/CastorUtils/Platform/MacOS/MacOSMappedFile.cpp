@@ -0,0 +1,61 @@
+#include "CastorUtils/Config/PlatformConfig.hpp"
+
+#if defined( CU_PlatformApple )
+
+#include "CastorUtils/Data/MappedFile.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace castor
+{
+	void MappedFile::doMap()noexcept
+	{
+		auto fd = ::open( toUtf8( m_path ).c_str(), O_RDONLY );
+
+		if ( fd < 0 )
+		{
+			Logger::logDebug( cuT( "Can't map file [" ) + m_path + cuT( "]: Couldn't open it." ) );
+			return;
+		}
+
+		struct stat fileStat{};
+
+		if ( ::fstat( fd, &fileStat ) != 0
+			|| fileStat.st_size <= 0 )
+		{
+			::close( fd );
+			return;
+		}
+
+		// The mapping stays valid once the descriptor is closed.
+		auto data = ::mmap( nullptr, size_t( fileStat.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+		::close( fd );
+
+		if ( data == MAP_FAILED )
+		{
+			Logger::logDebug( cuT( "Can't map file [" ) + m_path + cuT( "]: mmap failed." ) );
+			return;
+		}
+
+		// The whole file is read once, sequentially, by the decoders.
+		::madvise( data, size_t( fileStat.st_size ), MADV_SEQUENTIAL );
+		m_data = static_cast< uint8_t const * >( data );
+		m_size = uint64_t( fileStat.st_size );
+	}
+
+	void MappedFile::doUnmap()noexcept
+	{
+		if ( m_data )
+		{
+			::munmap( const_cast< uint8_t * >( m_data ), size_t( m_size ) );
+			m_data = nullptr;
+			m_size = 0u;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,86 @@
+#include "CastorUtils/Config/PlatformConfig.hpp"
+
+#if defined( CU_PlatformWindows )
+
+#include "CastorUtils/Data/MappedFile.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+#include "CastorUtils/Miscellaneous/Utils.hpp"
+
+#include <Windows.h>
+
+namespace castor
+{
+	void MappedFile::doMap()noexcept
+	{
+		auto file = ::CreateFileA( toUtf8( m_path ).c_str()
+			, GENERIC_READ
+			, FILE_SHARE_READ
+			, nullptr
+			, OPEN_EXISTING
+			, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN
+			, nullptr );
+
+		if ( file == INVALID_HANDLE_VALUE )
+		{
+			Logger::logDebug( cuT( "Can't map file [" ) + m_path + cuT( "]: " ) + system::getLastErrorText() );
+			return;
+		}
+
+		LARGE_INTEGER size{};
+
+		if ( !::GetFileSizeEx( file, &size )
+			|| size.QuadPart <= 0 )
+		{
+			::CloseHandle( file );
+			return;
+		}
+
+		auto mapping = ::CreateFileMappingA( file, nullptr, PAGE_READONLY, 0u, 0u, nullptr );
+
+		if ( !mapping )
+		{
+			Logger::logDebug( cuT( "Can't map file [" ) + m_path + cuT( "]: " ) + system::getLastErrorText() );
+			::CloseHandle( file );
+			return;
+		}
+
+		auto data = ::MapViewOfFile( mapping, FILE_MAP_READ, 0u, 0u, 0u );
+
+		if ( !data )
+		{
+			Logger::logDebug( cuT( "Can't map file [" ) + m_path + cuT( "]: " ) + system::getLastErrorText() );
+			::CloseHandle( mapping );
+			::CloseHandle( file );
+			return;
+		}
+
+		m_file = file;
+		m_mapping = mapping;
+		m_data = static_cast< uint8_t const * >( data );
+		m_size = uint64_t( size.QuadPart );
+	}
+
+	void MappedFile::doUnmap()noexcept
+	{
+		if ( m_data )
+		{
+			::UnmapViewOfFile( m_data );
+			m_data = nullptr;
+			m_size = 0u;
+		}
+
+		if ( m_mapping )
+		{
+			::CloseHandle( m_mapping );
+			m_mapping = nullptr;
+		}
+
+		if ( m_file )
+		{
+			::CloseHandle( m_file );
+			m_file = nullptr;
+		}
+	}
+}
+
+#endif
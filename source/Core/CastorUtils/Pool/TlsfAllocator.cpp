@@ -0,0 +1,443 @@
+#include "CastorUtils/Pool/TlsfAllocator.hpp"
+
+#include <bit>
+#include <numeric>
+
+namespace castor
+{
+	namespace tlsf
+	{
+		static uint32_t getMsb( uint64_t value )noexcept
+		{
+			return 63u - uint32_t( std::countl_zero( value ) );
+		}
+
+		static uint32_t getMsb( uint32_t value )noexcept
+		{
+			return 31u - uint32_t( std::countl_zero( value ) );
+		}
+
+		static uint32_t getLsb( uint64_t value )noexcept
+		{
+			return uint32_t( std::countr_zero( value ) );
+		}
+
+		static uint32_t getLsb( uint32_t value )noexcept
+		{
+			return uint32_t( std::countr_zero( value ) );
+		}
+
+		static uint64_t alignUp( uint64_t value
+			, uint64_t alignment )noexcept
+		{
+			return ( ( value + alignment - 1u ) / alignment ) * alignment;
+		}
+	}
+
+	//*********************************************************************************************
+
+	TlsfAllocator::TlsfAllocator( uint64_t size
+		, uint64_t granularity )
+		: m_totalSize{ size - ( size % std::max( granularity, uint64_t{ 1u } ) ) }
+		, m_granularity{ std::max( granularity, uint64_t{ 1u } ) }
+	{
+		clear();
+	}
+
+	uint64_t TlsfAllocator::allocate( uint64_t size
+		, uint64_t alignment )
+	{
+		auto units = std::max( uint64_t{ 1u }, tlsf::alignUp( size, m_granularity ) / m_granularity );
+		alignment = alignment == 0u
+			? m_granularity
+			: std::lcm( alignment, m_granularity );
+		// In the worst case, the found block needs a padding of alignment - granularity.
+		auto index = doFindFreeBlock( units + ( alignment / m_granularity ) - 1u );
+
+		if ( index == InvalidIndex )
+		{
+			return InvalidOffset;
+		}
+
+		doRemoveFree( index );
+
+		if ( auto aligned = tlsf::alignUp( m_blocks[index].offset, alignment );
+			aligned != m_blocks[index].offset )
+		{
+			auto next = doSplit( index, aligned - m_blocks[index].offset );
+			doInsertFree( index );
+			index = next;
+		}
+
+		size = units * m_granularity;
+
+		if ( m_blocks[index].size > size )
+		{
+			doInsertFree( doSplit( index, size ) );
+		}
+
+		auto & block = m_blocks[index];
+		m_usedSize += block.size;
+		m_allocated.emplace( block.offset, index );
+		return block.offset;
+	}
+
+	bool TlsfAllocator::deallocate( uint64_t offset )
+	{
+		auto it = m_allocated.find( offset );
+
+		if ( it == m_allocated.end() )
+		{
+			return false;
+		}
+
+		auto index = it->second;
+		m_allocated.erase( it );
+		m_usedSize -= m_blocks[index].size;
+
+		if ( auto prev = m_blocks[index].prevPhys;
+			prev != InvalidIndex && m_blocks[prev].free )
+		{
+			doRemoveFree( prev );
+			doMerge( prev, index );
+			index = prev;
+		}
+
+		if ( auto next = m_blocks[index].nextPhys;
+			next != InvalidIndex && m_blocks[next].free )
+		{
+			doRemoveFree( next );
+			doMerge( index, next );
+		}
+
+		doInsertFree( index );
+		return true;
+	}
+
+	void TlsfAllocator::clear()
+	{
+		m_usedSize = 0u;
+		m_freeBlockCount = 0u;
+		m_blocks.clear();
+		m_unusedBlocks.clear();
+		m_allocated.clear();
+		m_flBitmap = 0u;
+		m_slBitmaps.fill( 0u );
+		m_freeHeads.fill( InvalidIndex );
+
+		if ( m_totalSize )
+		{
+			doInsertFree( doCreateBlock( 0u, m_totalSize ) );
+		}
+	}
+
+	bool TlsfAllocator::hasAvailable( uint64_t size
+		, uint64_t alignment )const
+	{
+		auto units = std::max( uint64_t{ 1u }, tlsf::alignUp( size, m_granularity ) / m_granularity );
+		alignment = alignment == 0u
+			? m_granularity
+			: std::lcm( alignment, m_granularity );
+		return doFindFreeBlock( units + ( alignment / m_granularity ) - 1u ) != InvalidIndex;
+	}
+
+	uint64_t TlsfAllocator::getAllocationSize( uint64_t offset )const
+	{
+		auto it = m_allocated.find( offset );
+		return it == m_allocated.end()
+			? 0u
+			: m_blocks[it->second].size;
+	}
+
+	TlsfStatistics TlsfAllocator::getStatistics()const
+	{
+		TlsfStatistics result{};
+		result.totalSize = m_totalSize;
+		result.usedSize = m_usedSize;
+		result.freeSize = m_totalSize - m_usedSize;
+		result.allocationCount = uint32_t( m_allocated.size() );
+		result.freeBlockCount = m_freeBlockCount;
+
+		if ( m_flBitmap )
+		{
+			auto fl = tlsf::getMsb( m_flBitmap );
+			auto sl = tlsf::getMsb( m_slBitmaps[fl] );
+
+			for ( auto index = m_freeHeads[fl * SLCount + sl];
+				index != InvalidIndex;
+				index = m_blocks[index].nextFree )
+			{
+				result.largestFreeBlock = std::max( result.largestFreeBlock, m_blocks[index].size );
+			}
+		}
+
+		return result;
+	}
+
+	bool TlsfAllocator::checkConsistency()const
+	{
+		uint64_t offset{};
+		uint64_t used{};
+		uint32_t freeCount{};
+		uint32_t allocatedCount{};
+		bool prevFree{};
+		auto index = m_blocks.empty() ? InvalidIndex : 0u;
+		auto prev = InvalidIndex;
+
+		while ( index != InvalidIndex )
+		{
+			auto & block = m_blocks[index];
+
+			if ( block.offset != offset
+				|| block.size == 0u
+				|| block.size % m_granularity
+				|| block.prevPhys != prev
+				|| ( block.free && prevFree ) )
+			{
+				return false;
+			}
+
+			if ( block.free )
+			{
+				auto [fl, sl] = doMapInsert( block.size / m_granularity );
+				auto found = false;
+
+				for ( auto free = m_freeHeads[fl * SLCount + sl];
+					free != InvalidIndex && !found;
+					free = m_blocks[free].nextFree )
+				{
+					found = free == index;
+				}
+
+				if ( !found )
+				{
+					return false;
+				}
+
+				++freeCount;
+			}
+			else
+			{
+				auto it = m_allocated.find( block.offset );
+
+				if ( it == m_allocated.end() || it->second != index )
+				{
+					return false;
+				}
+
+				used += block.size;
+				++allocatedCount;
+			}
+
+			prevFree = block.free;
+			offset += block.size;
+			prev = index;
+			index = block.nextPhys;
+		}
+
+		return offset == m_totalSize
+			&& used == m_usedSize
+			&& freeCount == m_freeBlockCount
+			&& allocatedCount == m_allocated.size();
+	}
+
+	TlsfAllocator::Mapping TlsfAllocator::doMapInsert( uint64_t units )const noexcept
+	{
+		if ( units < SLCount )
+		{
+			return { 0u, uint32_t( units ) };
+		}
+
+		auto msb = tlsf::getMsb( units );
+		return { msb - SLLog2 + 1u
+			, uint32_t( units >> ( msb - SLLog2 ) ) ^ SLCount };
+	}
+
+	TlsfAllocator::Mapping TlsfAllocator::doMapSearch( uint64_t units )const noexcept
+	{
+		if ( units >= SLCount )
+		{
+			// Round up to the next class, so that any block of the found class fits.
+			auto round = ( uint64_t{ 1u } << ( tlsf::getMsb( units ) - SLLog2 ) ) - 1u;
+
+			if ( units > ~uint64_t{} - round )
+			{
+				return { FLCount, 0u };
+			}
+
+			units += round;
+		}
+
+		return doMapInsert( units );
+	}
+
+	uint32_t TlsfAllocator::doFindFreeBlock( uint64_t units )const noexcept
+	{
+		if ( units > m_totalSize / m_granularity )
+		{
+			return InvalidIndex;
+		}
+
+		auto [fl, sl] = doMapSearch( units );
+
+		if ( fl < FLCount )
+		{
+			auto slMap = m_slBitmaps[fl] & ( ~0u << sl );
+
+			if ( !slMap )
+			{
+				auto flMap = m_flBitmap & ( ~uint64_t{} << ( fl + 1u ) );
+
+				if ( flMap )
+				{
+					fl = tlsf::getLsb( flMap );
+					slMap = m_slBitmaps[fl];
+				}
+			}
+
+			if ( slMap )
+			{
+				return m_freeHeads[fl * SLCount + tlsf::getLsb( slMap )];
+			}
+		}
+
+		// The rounded up search can miss a block of the exact class that would still fit,
+		// which matters when the range is almost full, so look in that class only.
+		auto [exactFl, exactSl] = doMapInsert( units );
+		auto size = units * m_granularity;
+
+		for ( auto index = m_freeHeads[exactFl * SLCount + exactSl];
+			index != InvalidIndex;
+			index = m_blocks[index].nextFree )
+		{
+			if ( m_blocks[index].size >= size )
+			{
+				return index;
+			}
+		}
+
+		return InvalidIndex;
+	}
+
+	uint32_t TlsfAllocator::doCreateBlock( uint64_t offset
+		, uint64_t size )
+	{
+		uint32_t result;
+
+		if ( m_unusedBlocks.empty() )
+		{
+			result = uint32_t( m_blocks.size() );
+			m_blocks.emplace_back();
+		}
+		else
+		{
+			result = m_unusedBlocks.back();
+			m_unusedBlocks.pop_back();
+		}
+
+		auto & block = m_blocks[result];
+		block = Block{};
+		block.offset = offset;
+		block.size = size;
+		return result;
+	}
+
+	void TlsfAllocator::doReleaseBlock( uint32_t index )noexcept
+	{
+		m_blocks[index] = Block{};
+		m_unusedBlocks.push_back( index );
+	}
+
+	void TlsfAllocator::doInsertFree( uint32_t index )noexcept
+	{
+		auto & block = m_blocks[index];
+		auto [fl, sl] = doMapInsert( block.size / m_granularity );
+		auto & head = m_freeHeads[fl * SLCount + sl];
+		block.free = true;
+		block.prevFree = InvalidIndex;
+		block.nextFree = head;
+
+		if ( head != InvalidIndex )
+		{
+			m_blocks[head].prevFree = index;
+		}
+
+		head = index;
+		m_slBitmaps[fl] |= 1u << sl;
+		m_flBitmap |= uint64_t{ 1u } << fl;
+		++m_freeBlockCount;
+	}
+
+	void TlsfAllocator::doRemoveFree( uint32_t index )noexcept
+	{
+		auto & block = m_blocks[index];
+		auto [fl, sl] = doMapInsert( block.size / m_granularity );
+
+		if ( block.prevFree != InvalidIndex )
+		{
+			m_blocks[block.prevFree].nextFree = block.nextFree;
+		}
+
+		if ( block.nextFree != InvalidIndex )
+		{
+			m_blocks[block.nextFree].prevFree = block.prevFree;
+		}
+
+		if ( auto & head = m_freeHeads[fl * SLCount + sl];
+			head == index )
+		{
+			head = block.nextFree;
+
+			if ( head == InvalidIndex )
+			{
+				m_slBitmaps[fl] &= ~( 1u << sl );
+
+				if ( !m_slBitmaps[fl] )
+				{
+					m_flBitmap &= ~( uint64_t{ 1u } << fl );
+				}
+			}
+		}
+
+		block.free = false;
+		block.prevFree = InvalidIndex;
+		block.nextFree = InvalidIndex;
+		--m_freeBlockCount;
+	}
+
+	uint32_t TlsfAllocator::doSplit( uint32_t index
+		, uint64_t size )
+	{
+		auto result = doCreateBlock( m_blocks[index].offset + size
+			, m_blocks[index].size - size );
+		auto & block = m_blocks[index];
+		auto & split = m_blocks[result];
+		split.prevPhys = index;
+		split.nextPhys = block.nextPhys;
+
+		if ( block.nextPhys != InvalidIndex )
+		{
+			m_blocks[block.nextPhys].prevPhys = result;
+		}
+
+		block.nextPhys = result;
+		block.size = size;
+		return result;
+	}
+
+	void TlsfAllocator::doMerge( uint32_t into
+		, uint32_t other )noexcept
+	{
+		auto & block = m_blocks[into];
+		auto & merged = m_blocks[other];
+		block.size += merged.size;
+		block.nextPhys = merged.nextPhys;
+
+		if ( merged.nextPhys != InvalidIndex )
+		{
+			m_blocks[merged.nextPhys].prevPhys = into;
+		}
+
+		doReleaseBlock( other );
+	}
+}
@@ -646,7 +646,7 @@ namespace castor3d::exporter
 						{
 							castor::BinaryFile animFile{ normalizePath( options.path / ( options.name + cuT( "-" ) + animation.first + cuT( ".cska" ) ) )
 								, castor::File::OpenMode::eWrite };
-							result = castor3d::BinaryWriter< SkeletonAnimation >{}.write( static_cast< SkeletonAnimation const & >( *animation.second ), animFile );
+							result = castor3d::BinaryWriter< SkeletonAnimation >{}.write( static_cast< SkeletonAnimation const & >( *animation.second ), animFile, options.options.cmsh );
 						}
 					}
 				}
@@ -671,7 +671,7 @@ namespace castor3d::exporter
 						{
 							castor::BinaryFile animFile{ normalizePath( options.path / ( options.name + cuT( "-" ) + animation.first + cuT( ".csna" ) ) )
 								, castor::File::OpenMode::eWrite };
-							result = castor3d::BinaryWriter< SceneNodeAnimation >{}.write( static_cast< SceneNodeAnimation const & >( *animation.second ), animFile );
+							result = castor3d::BinaryWriter< SceneNodeAnimation >{}.write( static_cast< SceneNodeAnimation const & >( *animation.second ), animFile, options.options.cmsh );
 						}
 					}
 				}
@@ -791,7 +791,7 @@ namespace castor3d::exporter
 
 							castor::BinaryFile file{ newPath, castor::File::OpenMode::eWrite };
 							castor3d::BinaryWriter< castor3d::Mesh > writer;
-							result = writer.write( *mesh, file );
+							result = writer.write( *mesh, file, options.options.cmsh );
 
 							if ( carryOn( result, options ) )
 							{
@@ -813,7 +813,7 @@ namespace castor3d::exporter
 					{
 						castor::BinaryFile file{ newPath, castor::File::OpenMode::eWrite };
 						castor3d::BinaryWriter< castor3d::Mesh > writer;
-						result = writer.write( options.object, file );
+						result = writer.write( options.object, file, options.options.cmsh );
 					}
 
 					for ( auto & animation : options.object.getAnimations() )
@@ -822,7 +822,7 @@ namespace castor3d::exporter
 						{
 							castor::BinaryFile animFile{ normalizePath( options.path / ( options.object.getName() + cuT( "-" ) + animation.first + cuT( ".cmsa" ) ) )
 								, castor::File::OpenMode::eWrite };
-							result = castor3d::BinaryWriter< MeshAnimation >{}.write( static_cast< MeshAnimation const & >( *animation.second ), animFile );
+							result = castor3d::BinaryWriter< MeshAnimation >{}.write( static_cast< MeshAnimation const & >( *animation.second ), animFile, options.options.cmsh );
 						}
 					}
 				}
@@ -845,7 +845,7 @@ namespace castor3d::exporter
 				auto newPath = normalizePath( options.path / ( options.name + cuT( ".cskl" ) ) );
 				castor::BinaryFile file{ newPath, castor::File::OpenMode::eWrite };
 				castor3d::BinaryWriter< castor3d::Skeleton > writer;
-				auto result = writer.write( options.object, file );
+				auto result = writer.write( options.object, file, options.options.cmsh );
 
 				if ( carryOn( result, options ) )
 				{
@@ -35,6 +35,7 @@ namespace Testing
 		doRegisterTest( "BinaryExportTest::SimpleMesh", std::bind( &BinaryExportTest::SimpleMesh, this ) );
 		doRegisterTest( "BinaryExportTest::ImportExport", std::bind( &BinaryExportTest::ImportExport, this ) );
 		doRegisterTest( "BinaryExportTest::AnimatedMesh", std::bind( &BinaryExportTest::AnimatedMesh, this ) );
+		doRegisterTest( "BinaryExportTest::CompressedMesh", std::bind( &BinaryExportTest::CompressedMesh, this ) );
 	}
 
 	void BinaryExportTest::SimpleMesh()
@@ -70,6 +71,33 @@ namespace Testing
 		doTestMeshFile( cuT( "AnimTestMesh" ) );
 	}
 
+	void BinaryExportTest::CompressedMesh()
+	{
+		castor::String name = cuT( "CompressedTestMesh" );
+		castor3d::Scene scene{ cuT( "TestScene" ), m_engine };
+
+		auto src = scene.addNewMesh( name, scene );
+		CT_REQUIRE( src != nullptr );
+		castor3d::Parameters parameters;
+		parameters.add( cuT( "width" ), cuT( "1.0" ) );
+		parameters.add( cuT( "height" ), cuT( "1.0" ) );
+		parameters.add( cuT( "depth" ), cuT( "1.0" ) );
+		m_engine.getMeshFactory().create( cuT( "cube" ) )->generate( *src, parameters );
+
+		// The cube's normals and tangents are axis aligned, and its positions and texcoords
+		// fit in 16 bits, so the quantised data is expected to come back within the comparison epsilon.
+		castor3d::CmshWriteOptions options;
+		options.compress = true;
+		options.compressionLevel = 9;
+		options.compressionThreshold = 0u;
+		options.encode = true;
+		options.quantise = true;
+		doTestMesh( *src, options );
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
 	void BinaryExportTest::doTestMeshFile( castor::String const & name )
 	{
 		castor::Path path{ name + cuT( ".cmsh" ) };
@@ -103,7 +131,8 @@ namespace Testing
 		m_engine.getRenderLoop().renderSyncFrame();
 	}
 
-	void BinaryExportTest::doTestMesh( castor3d::Mesh & src )
+	void BinaryExportTest::doTestMesh( castor3d::Mesh & src
+		, castor3d::CmshWriteOptions const & options )
 	{
 		auto & renderSystem = *m_engine.getRenderSystem();
 		auto surface = renderSystem.getInstance().createSurface( renderSystem.getPhysicalDevice()
@@ -121,13 +150,13 @@ namespace Testing
 		{
 			castor::BinaryFile mshfile{ path, castor::File::OpenMode::eWrite };
 			castor3d::BinaryWriter< castor3d::Mesh > writer;
-			auto result = CT_CHECK( writer.write( src, mshfile ) );
+			auto result = CT_CHECK( writer.write( src, mshfile, options ) );
 			auto skeleton = src.getSkeleton();
 
 			if ( result && skeleton )
 			{
 				castor::BinaryFile sklfile{ castor::Path{ path.getFileName() + cuT( ".cskl" ) }, castor::File::OpenMode::eWrite };
-				result = CT_CHECK( castor3d::BinaryWriter< castor3d::Skeleton >().write( *skeleton, sklfile ) );
+				result = CT_CHECK( castor3d::BinaryWriter< castor3d::Skeleton >().write( *skeleton, sklfile, options ) );
 			}
 		}
 
@@ -4,6 +4,8 @@
 
 #include "Castor3DTestPrerequisites.hpp"
 
+#include <Castor3D/Binary/BinaryChunk.hpp>
+
 #include <cstring>
 
 namespace Testing
@@ -21,8 +23,10 @@ namespace Testing
 		void SimpleMesh();
 		void ImportExport();
 		void AnimatedMesh();
+		void CompressedMesh();
 		void doTestMeshFile( castor::String const & name );
-		void doTestMesh( castor3d::Mesh & src );
+		void doTestMesh( castor3d::Mesh & src
+			, castor3d::CmshWriteOptions const & options = {} );
 	};
 }
 
@@ -0,0 +1,225 @@
+#include "FrustumCullingTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		void initialiseFrustum( castor3d::Frustum & frustum )
+		{
+			castor::Matrix4x4f projection;
+			castor::Matrix4x4f view;
+			castor::matrix::perspective( projection, castor::Angle::fromDegrees( 60.0f ), 1.5f, 0.1f, 300.0f );
+			castor::matrix::lookAt( view
+				, castor::Point3f{ 0.0f, 0.0f, -50.0f }
+				, castor::Point3f{ 10.0f, 5.0f, 100.0f }
+				, castor::Point3f{ 0.0f, 1.0f, 0.0f } );
+			frustum.update( projection, view );
+		}
+
+		std::vector< CullingTestNode > makeNodes( size_t count )
+		{
+			std::mt19937 rng{ uint32_t( count ) };
+			std::uniform_real_distribution< float > position{ -200.0f, 200.0f };
+			std::uniform_real_distribution< float > extent{ 0.1f, 20.0f };
+			std::uniform_real_distribution< float > scale{ 0.2f, 3.0f };
+			std::uniform_real_distribution< float > angle{ 0.0f, 360.0f };
+			std::vector< CullingTestNode > result;
+			result.reserve( count );
+
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				castor::Point3f halfSize{ extent( rng ), extent( rng ), extent( rng ) };
+				CullingTestNode node{ castor::BoundingSphere{ castor::Point3f{}, float( castor::point::length( halfSize ) ) }
+					, castor::BoundingBox{ -halfSize, halfSize }
+					, castor::Matrix4x4f{}
+					, castor::Point3f{ scale( rng ), scale( rng ), scale( rng ) } };
+				castor::matrix::setTransform( node.transform
+					, castor::Point3f{ position( rng ), position( rng ), position( rng ) + 100.0f }
+					, node.scale
+					, castor::Quaternion::fromAxisAngle( castor::Point3f{ 0.0f, 1.0f, 0.0f }, castor::Angle::fromDegrees( angle( rng ) ) ) );
+				result.push_back( node );
+			}
+
+			return result;
+		}
+
+		bool isVisible( castor3d::Frustum const & frustum
+			, CullingTestNode const & node )
+		{
+			return frustum.isVisible( node.sphere, node.transform, node.scale )
+				&& frustum.isVisible( node.box, node.transform );
+		}
+
+		void gatherVolumes( std::vector< CullingTestNode > const & nodes
+			, size_t begin
+			, size_t end
+			, castor3d::CullingVolumes & volumes )
+		{
+			for ( auto i = begin; i < end; ++i )
+			{
+				auto & node = nodes[i];
+				volumes.set( i, node.sphere, node.box, node.transform, node.scale );
+			}
+		}
+
+		castor3d::CullingVolumes makeVolumes( std::vector< CullingTestNode > const & nodes )
+		{
+			castor3d::CullingVolumes result;
+			result.resize( nodes.size() );
+			gatherVolumes( nodes, 0u, nodes.size(), result );
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	FrustumCullingTest::FrustumCullingTest( castor3d::Engine & engine )
+		: C3DTestCase{ "FrustumCullingTest", engine }
+	{
+	}
+
+	void FrustumCullingTest::doRegisterTests()
+	{
+		doRegisterTest( "FrustumCullingTest::KernelsMatchFrustum", std::bind( &FrustumCullingTest::KernelsMatchFrustum, this ) );
+		doRegisterTest( "FrustumCullingTest::BatchRanges", std::bind( &FrustumCullingTest::BatchRanges, this ) );
+	}
+
+	void FrustumCullingTest::KernelsMatchFrustum()
+	{
+		castor3d::Viewport viewport{ m_engine };
+		castor3d::Frustum frustum{ viewport };
+		initialiseFrustum( frustum );
+		auto nodes = makeNodes( 10007u );
+		auto volumes = makeVolumes( nodes );
+		std::vector< uint8_t > expected;
+		expected.reserve( nodes.size() );
+
+		for ( auto & node : nodes )
+		{
+			expected.push_back( isVisible( frustum, node ) ? 1u : 0u );
+		}
+
+		CT_CHECK( std::find( expected.begin(), expected.end(), 0u ) != expected.end() );
+		CT_CHECK( std::find( expected.begin(), expected.end(), 1u ) != expected.end() );
+
+		for ( auto kernel = castor3d::CullingKernel::eMin; kernel <= castor3d::CullingKernel::eMax; kernel = castor3d::CullingKernel( uint8_t( kernel ) + 1u ) )
+		{
+			if ( castor3d::isSupported( kernel ) )
+			{
+				CT_ON( castor::toUtf8( castor3d::getName( kernel ) ) );
+				std::vector< uint8_t > visible( nodes.size() );
+				castor3d::cullVolumes( frustum.getPlanes(), volumes, 0u, nodes.size(), visible.data(), kernel );
+				CT_CHECK( visible == expected );
+			}
+		}
+	}
+
+	void FrustumCullingTest::BatchRanges()
+	{
+		castor3d::Viewport viewport{ m_engine };
+		castor3d::Frustum frustum{ viewport };
+		initialiseFrustum( frustum );
+		auto nodes = makeNodes( 1000u );
+		auto volumes = makeVolumes( nodes );
+		auto kernel = castor3d::getBestCullingKernel();
+		std::vector< uint8_t > expected( nodes.size() );
+		castor3d::cullVolumes( frustum.getPlanes(), volumes, 0u, nodes.size(), expected.data(), kernel );
+
+		// Ranges not aligned on the SIMD width.
+		for ( size_t grain : { 1u, 3u, 7u, 13u, 999u } )
+		{
+			std::vector< uint8_t > visible( nodes.size(), 2u );
+
+			for ( size_t begin = 0u; begin < nodes.size(); begin += grain )
+			{
+				auto end = std::min( nodes.size(), begin + grain );
+				castor3d::cullVolumes( frustum.getPlanes(), volumes, begin, end, visible.data() + begin, kernel );
+			}
+
+			CT_CHECK( visible == expected );
+		}
+	}
+
+	//*********************************************************************************************
+
+	FrustumCullingBench::FrustumCullingBench( castor3d::Engine & engine )
+		: BenchCase{ "FrustumCullingBench" }
+		, m_engine{ engine }
+		, m_viewport{ engine }
+		, m_frustum{ m_viewport }
+	{
+		initialiseFrustum( m_frustum );
+	}
+
+	void FrustumCullingBench::Execute()
+	{
+		doBenchCount( 10000u, 100u );
+		doBenchCount( 100000u, 20u );
+		doBenchCount( 1000000u, 5u );
+		m_nodes = {};
+		m_volumes = {};
+		m_visible = {};
+	}
+
+	void FrustumCullingBench::doBenchCount( size_t count
+		, uint64_t calls )
+	{
+		auto suffix = std::to_string( count );
+		m_nodes = makeNodes( count );
+		m_volumes.resize( count );
+		m_visible.resize( count );
+
+		// Current path: one node at a time.
+		doBench( "Scalar" + suffix
+			, [this]()
+			{
+				for ( size_t i = 0u; i < m_nodes.size(); ++i )
+				{
+					m_visible[i] = isVisible( m_frustum, m_nodes[i] ) ? 1u : 0u;
+				}
+
+				doNotOptimizeAway( m_visible.back() );
+			}
+			, calls );
+
+		// Batch path, as done by FrustumCuller: gathering and culling, spread on the frame jobs.
+		doBench( "Batch" + suffix
+			, [this]()
+			{
+				m_engine.getFrameJobs().parallelFor( m_nodes.size()
+					, [this]( size_t begin, size_t end )
+					{
+						gatherVolumes( m_nodes, begin, end, m_volumes );
+						castor3d::cullVolumes( m_frustum.getPlanes(), m_volumes, begin, end, m_visible.data() + begin, castor3d::getBestCullingKernel() );
+					}
+					, 1024u );
+				doNotOptimizeAway( m_visible.back() );
+			}
+			, calls );
+
+		// Planes tests only, for each kernel.
+		gatherVolumes( m_nodes, 0u, m_nodes.size(), m_volumes );
+
+		for ( auto kernel = castor3d::CullingKernel::eMin; kernel <= castor3d::CullingKernel::eMax; kernel = castor3d::CullingKernel( uint8_t( kernel ) + 1u ) )
+		{
+			if ( castor3d::isSupported( kernel ) )
+			{
+				doBench( "Kernel" + castor::toUtf8( castor3d::getName( kernel ) ) + suffix
+					, [this, kernel]()
+					{
+						castor3d::cullVolumes( m_frustum.getPlanes(), m_volumes, 0u, m_nodes.size(), m_visible.data(), kernel );
+						doNotOptimizeAway( m_visible.back() );
+					}
+					, calls );
+			}
+		}
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,55 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_FRUSTUM_CULLING_TEST_H___
+#define ___C3DT_FRUSTUM_CULLING_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Render/Frustum.hpp>
+#include <Castor3D/Render/Culling/CullingVolumes.hpp>
+
+namespace Testing
+{
+	struct CullingTestNode
+	{
+		castor::BoundingSphere sphere;
+		castor::BoundingBox box;
+		castor::Matrix4x4f transform;
+		castor::Point3f scale;
+	};
+
+	class FrustumCullingTest
+		: public C3DTestCase
+	{
+	public:
+		explicit FrustumCullingTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void KernelsMatchFrustum();
+		void BatchRanges();
+	};
+
+	class FrustumCullingBench
+		: public BenchCase
+	{
+	public:
+		explicit FrustumCullingBench( castor3d::Engine & engine );
+		void Execute()override;
+
+	private:
+		void doBenchCount( size_t count
+			, uint64_t calls );
+
+	private:
+		castor3d::Engine & m_engine;
+		castor3d::Viewport m_viewport;
+		castor3d::Frustum m_frustum;
+		std::vector< CullingTestNode > m_nodes;
+		castor3d::CullingVolumes m_volumes;
+		std::vector< uint8_t > m_visible;
+	};
+}
+
+#endif
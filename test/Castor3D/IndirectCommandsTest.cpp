@@ -0,0 +1,227 @@
+#include "IndirectCommandsTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Render/Node/QueueRenderNodes.hpp>
+
+#include <algorithm>
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		// Stands for a sorted node, the commands it gives only depend on its kind.
+		struct TestNode
+		{
+			enum Kind
+			{
+				eMeshlets,
+				eIndexed,
+				eNonIndexed,
+			};
+
+			Kind kind;
+			uint32_t meshTasksCount;
+			uint32_t id;
+		};
+
+		using TestRange = std::vector< TestNode >;
+
+		struct TestCommands
+		{
+			std::vector< uint32_t > msh;
+			std::vector< uint32_t > idx;
+			std::vector< uint32_t > nidx;
+			std::vector< std::vector< uint32_t > > pipelines;
+			uint32_t objectCount{};
+
+			explicit TestCommands( std::vector< TestRange > const & ranges )
+			{
+				size_t count{};
+
+				for ( auto & range : ranges )
+				{
+					pipelines.emplace_back( range.size(), 0u );
+					count += range.size();
+				}
+
+				// Filled with a value no node has, to spot the holes.
+				msh.resize( count * 4u, ~0u );
+				idx.resize( count, ~0u );
+				nidx.resize( count, ~0u );
+			}
+		};
+
+		std::vector< TestRange > makeRanges( std::vector< uint32_t > const & sizes )
+		{
+			std::mt19937 rng{ 42u };
+			std::uniform_int_distribution< uint32_t > kind{ 0u, 2u };
+			std::uniform_int_distribution< uint32_t > meshTasks{ 1u, 4u };
+			std::vector< TestRange > result;
+			uint32_t id{};
+
+			for ( auto size : sizes )
+			{
+				auto & range = result.emplace_back();
+
+				for ( uint32_t i = 0u; i < size; ++i )
+				{
+					range.push_back( { TestNode::Kind( kind( rng ) ), meshTasks( rng ), id++ } );
+				}
+			}
+
+			return result;
+		}
+
+		void fillNode( TestNode const & node
+			, uint32_t *& msh
+			, uint32_t *& idx
+			, uint32_t *& nidx
+			, uint32_t *& pipelines )
+		{
+			switch ( node.kind )
+			{
+			case TestNode::eMeshlets:
+				for ( uint32_t i = 0u; i < node.meshTasksCount; ++i )
+				{
+					*msh++ = node.id;
+				}
+				break;
+			case TestNode::eIndexed:
+				*idx++ = node.id;
+				break;
+			default:
+				*nidx++ = node.id;
+				break;
+			}
+
+			*pipelines++ = node.id;
+		}
+
+		void fillSerial( std::vector< TestRange > const & ranges
+			, TestCommands & commands )
+		{
+			auto msh = commands.msh.data();
+			auto idx = commands.idx.data();
+			auto nidx = commands.nidx.data();
+
+			for ( size_t rangeIndex = 0u; rangeIndex < ranges.size(); ++rangeIndex )
+			{
+				auto pipelines = commands.pipelines[rangeIndex].data();
+
+				for ( auto & node : ranges[rangeIndex] )
+				{
+					fillNode( node, msh, idx, nidx, pipelines );
+					++commands.objectCount;
+				}
+			}
+		}
+
+		castor3d::IndirectCommandsBatch fillParallel( castor::JobSystem & jobs
+			, std::vector< TestRange > const & ranges
+			, TestCommands & commands
+			, castor::Vector< castor3d::IndirectCommandsBatch > & batches )
+		{
+			batches.clear();
+
+			for ( uint32_t rangeIndex = 0u; rangeIndex < ranges.size(); ++rangeIndex )
+			{
+				castor3d::addIndirectCommandsBatches( rangeIndex
+					, uint32_t( ranges[rangeIndex].size() )
+					, commands.pipelines[rangeIndex].data()
+					, batches );
+			}
+
+			auto result = castor3d::fillIndirectCommandsBatches( jobs
+				, batches
+				, [&ranges]( castor3d::IndirectCommandsBatch & batch )
+				{
+					auto & range = ranges[batch.range];
+
+					for ( auto index = batch.first; index < batch.first + batch.count; ++index )
+					{
+						auto & node = range[index];
+						batch.mshOffset += node.kind == TestNode::eMeshlets ? node.meshTasksCount : 0u;
+						batch.idxOffset += node.kind == TestNode::eIndexed ? 1u : 0u;
+						batch.nidxOffset += node.kind == TestNode::eNonIndexed ? 1u : 0u;
+						++batch.visible.objectCount;
+					}
+				}
+				, [&ranges, &commands]( castor3d::IndirectCommandsBatch const & batch )
+				{
+					auto & range = ranges[batch.range];
+					auto msh = commands.msh.data() + batch.mshOffset;
+					auto idx = commands.idx.data() + batch.idxOffset;
+					auto nidx = commands.nidx.data() + batch.nidxOffset;
+					auto pipelines = batch.pipelinesBuffer;
+
+					for ( auto index = batch.first; index < batch.first + batch.count; ++index )
+					{
+						fillNode( range[index], msh, idx, nidx, pipelines );
+					}
+				} );
+			commands.objectCount = result.visible.objectCount;
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	IndirectCommandsTest::IndirectCommandsTest( castor3d::Engine & engine )
+		: C3DTestCase{ "IndirectCommandsTest", engine }
+	{
+	}
+
+	void IndirectCommandsTest::doRegisterTests()
+	{
+		doRegisterTest( "IndirectCommandsTest::BatchesSplit", std::bind( &IndirectCommandsTest::BatchesSplit, this ) );
+		doRegisterTest( "IndirectCommandsTest::ParallelMatchesSerial", std::bind( &IndirectCommandsTest::ParallelMatchesSerial, this ) );
+	}
+
+	void IndirectCommandsTest::BatchesSplit()
+	{
+		auto constexpr BatchSize = castor3d::IndirectCommandsBatchSize;
+		castor::Vector< castor3d::IndirectCommandsBatch > batches;
+		std::vector< uint32_t > pipelines( 3u * BatchSize );
+		castor3d::addIndirectCommandsBatches( 0u, 1u, pipelines.data(), batches );
+		castor3d::addIndirectCommandsBatches( 1u, BatchSize, pipelines.data(), batches );
+		castor3d::addIndirectCommandsBatches( 2u, 2u * BatchSize + 1u, pipelines.data(), batches );
+		CT_REQUIRE( batches.size() == 5u );
+		CT_EQUAL( batches[0].range, 0u );
+		CT_EQUAL( batches[0].count, 1u );
+		CT_EQUAL( batches[1].range, 1u );
+		CT_EQUAL( batches[1].count, BatchSize );
+		// A range is split in batches, which don't go beyond it.
+		CT_EQUAL( batches[2].range, 2u );
+		CT_EQUAL( batches[2].first, 0u );
+		CT_EQUAL( batches[3].first, BatchSize );
+		CT_EQUAL( batches[4].first, 2u * BatchSize );
+		CT_EQUAL( batches[4].count, 1u );
+		CT_CHECK( batches[4].pipelinesBuffer == pipelines.data() + 2u * BatchSize );
+	}
+
+	void IndirectCommandsTest::ParallelMatchesSerial()
+	{
+		auto constexpr BatchSize = castor3d::IndirectCommandsBatchSize;
+		auto ranges = makeRanges( { 1u, 7u, BatchSize - 1u, BatchSize, BatchSize + 1u, 5u * BatchSize + 13u, 2u } );
+		TestCommands expected{ ranges };
+		fillSerial( ranges, expected );
+		castor::Vector< castor3d::IndirectCommandsBatch > batches;
+
+		// The batches are reused, as the queues do, from a frame to the next one.
+		for ( uint32_t frame = 0u; frame < 3u; ++frame )
+		{
+			TestCommands commands{ ranges };
+			auto total = fillParallel( m_engine.getFrameJobs(), ranges, commands, batches );
+			CT_CHECK( commands.msh == expected.msh );
+			CT_CHECK( commands.idx == expected.idx );
+			CT_CHECK( commands.nidx == expected.nidx );
+			CT_CHECK( commands.pipelines == expected.pipelines );
+			CT_EQUAL( commands.objectCount, expected.objectCount );
+			// The total offsets are the commands counts.
+			CT_EQUAL( total.idxOffset, uint32_t( std::count_if( expected.idx.begin(), expected.idx.end(), []( uint32_t v ){ return v != ~0u; } ) ) );
+			CT_EQUAL( total.nidxOffset, uint32_t( std::count_if( expected.nidx.begin(), expected.nidx.end(), []( uint32_t v ){ return v != ~0u; } ) ) );
+			CT_EQUAL( total.mshOffset, uint32_t( std::count_if( expected.msh.begin(), expected.msh.end(), []( uint32_t v ){ return v != ~0u; } ) ) );
+		}
+	}
+}
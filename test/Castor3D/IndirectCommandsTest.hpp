@@ -0,0 +1,24 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_INDIRECT_COMMANDS_TEST_H___
+#define ___C3DT_INDIRECT_COMMANDS_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class IndirectCommandsTest
+		: public C3DTestCase
+	{
+	public:
+		explicit IndirectCommandsTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void BatchesSplit();
+		void ParallelMatchesSerial();
+	};
+}
+
+#endif
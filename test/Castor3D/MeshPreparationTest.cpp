@@ -0,0 +1,537 @@
+#include "MeshPreparationTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Miscellaneous/Parameter.hpp>
+#include <Castor3D/Model/Vertex.hpp>
+#include <Castor3D/Model/VertexGroup.hpp>
+#include <Castor3D/Model/Mesh/Mesh.hpp>
+#include <Castor3D/Model/Mesh/MeshPreparer.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Submesh.hpp>
+#include <Castor3D/Model/Mesh/Submesh/SubmeshUtils.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/BaseDataComponent.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/LodComponent.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/MeshletComponent.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp>
+#include <Castor3D/Material/Material.hpp>
+#include <Castor3D/Render/RenderLoop.hpp>
+#include <Castor3D/Render/Viewport.hpp>
+#include <Castor3D/Render/Node/SubmeshRenderNode.hpp>
+#include <Castor3D/Scene/Camera.hpp>
+#include <Castor3D/Scene/Geometry.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+#include <Castor3D/Scene/SceneNode.hpp>
+#include <Castor3D/Shader/Ubos/UbosModule.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		using TrianglePositions = std::array< castor::Point3f, 3u >;
+
+		castor::Point3f gridPosition( uint32_t i
+			, uint32_t j
+			, uint32_t gridSize )
+		{
+			auto x = float( i ) / float( gridSize );
+			auto y = float( j ) / float( gridSize );
+			return castor::Point3f{ x, y, 0.1f * std::sin( 20.0f * x ) * std::cos( 15.0f * y ) };
+		}
+
+		// A bumpy grid, with shuffled triangles, so that the preparation has some work to do.
+		void makeGrid( uint32_t gridSize
+			, uint32_t seed
+			, castor::Vector< castor3d::InterleavedVertex > & points
+			, castor::Vector< castor3d::FaceIndices > & faces )
+		{
+			auto vertexCount = gridSize + 1u;
+			points.clear();
+			faces.clear();
+			points.reserve( size_t( vertexCount ) * vertexCount );
+			faces.reserve( size_t( gridSize ) * gridSize * 2u );
+
+			for ( uint32_t i = 0u; i < vertexCount; ++i )
+			{
+				for ( uint32_t j = 0u; j < vertexCount; ++j )
+				{
+					points.emplace_back()
+						.position( gridPosition( i, j, gridSize ) )
+						.normal( castor::Point3f{ 0.0f, 0.0f, 1.0f } )
+						.texcoord( castor::Point3f{ float( i ) / float( gridSize ), float( j ) / float( gridSize ), 0.0f } );
+				}
+			}
+
+			for ( uint32_t i = 0u; i < gridSize; ++i )
+			{
+				for ( uint32_t j = 0u; j < gridSize; ++j )
+				{
+					auto a = i * vertexCount + j;
+					auto b = a + vertexCount;
+					faces.push_back( castor3d::FaceIndices{ a, b, a + 1u } );
+					faces.push_back( castor3d::FaceIndices{ a + 1u, b, b + 1u } );
+				}
+			}
+
+			std::mt19937 rng{ seed };
+			std::shuffle( faces.begin(), faces.end(), rng );
+		}
+
+		void makeGrid( uint32_t gridSize
+			, uint32_t seed
+			, castor::Point3fArray & positions
+			, castor3d::FaceArray & faces )
+		{
+			castor::Vector< castor3d::InterleavedVertex > points;
+			castor::Vector< castor3d::FaceIndices > indices;
+			makeGrid( gridSize, seed, points, indices );
+			positions.clear();
+			faces.clear();
+			positions.reserve( points.size() );
+			faces.reserve( indices.size() );
+
+			for ( auto & point : points )
+			{
+				positions.push_back( point.pos );
+			}
+
+			for ( auto & face : indices )
+			{
+				faces.emplace_back( face.m_index[0], face.m_index[1], face.m_index[2] );
+			}
+		}
+
+		void addGridSubmesh( castor3d::Mesh & mesh
+			, uint32_t gridSize
+			, uint32_t seed )
+		{
+			castor::Vector< castor3d::InterleavedVertex > points;
+			castor::Vector< castor3d::FaceIndices > faces;
+			makeGrid( gridSize, seed, points, faces );
+			auto submesh = mesh.createDefaultSubmesh();
+			submesh->addPoints( points );
+			auto indexMapping = submesh->createComponent< castor3d::TriFaceMapping >();
+			indexMapping->getData().addFaceGroup( faces );
+			indexMapping->computeTangents();
+		}
+
+		// The normals computation, as it was done before being vectorised.
+		void computeReferenceNormals( castor::Point3fArray const & positions
+			, castor::Point3fArray & normals
+			, castor3d::FaceArray const & faces
+			, bool reverted )
+		{
+			std::fill( normals.begin(), normals.end(), castor::Point3f{} );
+
+			for ( auto const & face : faces )
+			{
+				auto & pt1 = positions[face[0]];
+				auto & pt2 = positions[reverted ? face[2] : face[1]];
+				auto & pt3 = positions[reverted ? face[1] : face[2]];
+				auto normal = castor::point::cross( pt3 - pt1, pt2 - pt1 );
+				normals[face[0]] += normal;
+				normals[reverted ? face[2] : face[1]] += normal;
+				normals[reverted ? face[1] : face[2]] += normal;
+			}
+
+			for ( auto & normal : normals )
+			{
+				castor::point::normalise( normal );
+			}
+		}
+
+		castor::Vector< TrianglePositions > listTriangles( castor3d::Submesh const & submesh )
+		{
+			auto & positions = submesh.getPositions();
+			auto & faces = static_cast< castor3d::TriFaceMapping const & >( *submesh.getIndexMapping() ).getData().getFaces();
+			auto less = []( castor::Point3f const & lhs, castor::Point3f const & rhs )
+			{
+				return std::lexicographical_compare( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() );
+			};
+			castor::Vector< TrianglePositions > result;
+			result.reserve( faces.size() );
+
+			for ( auto & face : faces )
+			{
+				// The preparation can rotate the triangles vertices, so their positions are sorted.
+				TrianglePositions triangle{ positions[face[0]], positions[face[1]], positions[face[2]] };
+				std::sort( triangle.begin(), triangle.end(), less );
+				result.push_back( triangle );
+			}
+
+			std::sort( result.begin()
+				, result.end()
+				, [&less]( TrianglePositions const & lhs, TrianglePositions const & rhs )
+				{
+					return std::lexicographical_compare( lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), less );
+				} );
+			return result;
+		}
+
+		// Three levels, which errors give the thresholds 500, 50 and 5 pixels, for a pixel error of 1.
+		castor3d::LodComponent::ComponentData & addLods( castor3d::Submesh & submesh )
+		{
+			auto lods = submesh.createComponent< castor3d::LodComponent >();
+			auto & data = lods->getData();
+			auto & faces = static_cast< castor3d::TriFaceMapping const & >( *submesh.getIndexMapping() ).getData().getFaces();
+			auto faceCount = faces.size();
+
+			for ( auto error : { 0.001f, 0.01f, 0.1f } )
+			{
+				faceCount /= 2u;
+				data.getLods().push_back( castor3d::SubmeshLod{ castor3d::FaceArray( faces.begin(), faces.begin() + ptrdiff_t( faceCount ) ), error } );
+			}
+
+			data.setPixelError( 1.0f );
+			return data;
+		}
+	}
+
+	//*********************************************************************************************
+
+	MeshPreparationTest::MeshPreparationTest( castor3d::Engine & engine )
+		: C3DTestCase{ "MeshPreparationTest", engine }
+	{
+	}
+
+	void MeshPreparationTest::doRegisterTests()
+	{
+		doRegisterTest( "MeshPreparationTest::ComputeNormals", std::bind( &MeshPreparationTest::ComputeNormals, this ) );
+		doRegisterTest( "MeshPreparationTest::PrepareKeepsTriangles", std::bind( &MeshPreparationTest::PrepareKeepsTriangles, this ) );
+		doRegisterTest( "MeshPreparationTest::LodChain", std::bind( &MeshPreparationTest::LodChain, this ) );
+		doRegisterTest( "MeshPreparationTest::LodSelection", std::bind( &MeshPreparationTest::LodSelection, this ) );
+		doRegisterTest( "MeshPreparationTest::SelectNodeLod", std::bind( &MeshPreparationTest::SelectNodeLod, this ) );
+	}
+
+	void MeshPreparationTest::ComputeNormals()
+	{
+		// 4, 9 and 10201 vertices, to cover the SIMD loop and its scalar tail.
+		for ( uint32_t gridSize : { 1u, 2u, 100u } )
+		{
+			castor::Point3fArray positions;
+			castor3d::FaceArray faces;
+			makeGrid( gridSize, gridSize, positions, faces );
+
+			for ( auto reverted : { false, true } )
+			{
+				CT_ON( std::to_string( gridSize ) + ( reverted ? " reverted" : "" ) );
+				castor::Point3fArray expected( positions.size() );
+				computeReferenceNormals( positions, expected, faces, reverted );
+				castor::Point3fArray normals( positions.size() );
+				castor3d::SubmeshUtils::computeNormals( positions, normals, faces, reverted );
+				CT_REQUIRE( normals.size() == expected.size() );
+
+				for ( size_t i = 0u; i < normals.size(); ++i )
+				{
+					CT_CHECK( castor::point::length( normals[i] - expected[i] ) < 1.0e-5 );
+				}
+			}
+		}
+	}
+
+	void MeshPreparationTest::PrepareKeepsTriangles()
+	{
+		castor3d::Scene scene{ cuT( "TestScene" ), m_engine };
+		auto mesh = scene.addNewMesh( cuT( "PreparedMesh" ), scene );
+		CT_REQUIRE( mesh != nullptr );
+
+		for ( uint32_t i = 0u; i < 8u; ++i )
+		{
+			addGridSubmesh( *mesh, 10u + i * 5u, i );
+		}
+
+		castor::Vector< castor::Vector< TrianglePositions > > expected;
+
+		for ( auto & submesh : *mesh )
+		{
+			expected.push_back( listTriangles( *submesh ) );
+		}
+
+		CT_CHECK( castor3d::MeshPreparer::prepare( *mesh, castor3d::Parameters{} ) );
+		CT_REQUIRE( mesh->getSubmeshCount() == expected.size() );
+
+		for ( uint32_t i = 0u; i < mesh->getSubmeshCount(); ++i )
+		{
+			auto & submesh = *mesh->getSubmesh( i );
+			CT_CHECK( submesh.getNormals().size() == submesh.getPositions().size() );
+			CT_CHECK( submesh.getTexcoords0().size() == submesh.getPositions().size() );
+			CT_CHECK( listTriangles( submesh ) == expected[i] );
+		}
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	void MeshPreparationTest::LodChain()
+	{
+		castor3d::Scene scene{ cuT( "TestScene" ), m_engine };
+		auto mesh = scene.addNewMesh( cuT( "LodMesh" ), scene );
+		CT_REQUIRE( mesh != nullptr );
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			addGridSubmesh( *mesh, 30u + i * 10u, i );
+		}
+
+		castor3d::Parameters parameters;
+		parameters.add( cuT( "lod_count" ), 4u );
+		parameters.add( cuT( "lod_ratio" ), 0.5f );
+		parameters.add( cuT( "lod_error" ), 0.05f );
+		CT_CHECK( castor3d::MeshPreparer::prepare( *mesh, parameters ) );
+
+		for ( auto & submesh : *mesh )
+		{
+			CT_ON( std::to_string( submesh->getId() ) );
+			auto lods = submesh->getComponent< castor3d::LodComponent >();
+
+			if ( submesh->hasComponent( castor3d::MeshletComponent::TypeName ) )
+			{
+				// The meshlets replace the levels of detail.
+				CT_CHECK( lods == nullptr );
+				continue;
+			}
+
+			CT_REQUIRE( lods != nullptr );
+			auto const & data = lods->getData();
+			CT_REQUIRE( data.hasData() );
+			CT_CHECK( data.getLevelsCount() <= 4u );
+			auto vertexCount = uint32_t( submesh->getPositions().size() );
+			auto submeshCount = submesh->getIndexCount();
+			auto totalCount = submeshCount + data.getIndexCount();
+			auto previousCount = submeshCount;
+			float previousError{};
+			CT_EQUAL( data.getFirstIndex( 0u ), 0u );
+			CT_EQUAL( data.getIndexCount( 0u ), submeshCount );
+			CT_EQUAL( data.getFirstIndex( 1u ), submeshCount );
+
+			for ( uint32_t level = 1u; level <= data.getLevelsCount(); ++level )
+			{
+				auto & lod = data.getLods()[level - 1u];
+				auto first = data.getFirstIndex( level );
+				auto count = data.getIndexCount( level );
+				// Each level is coarser than the previous one, and its error doesn't decrease.
+				CT_CHECK( count > 0u );
+				CT_CHECK( count < previousCount );
+				CT_CHECK( lod.error >= previousError );
+				CT_CHECK( first + count <= totalCount );
+
+				if ( level > 1u )
+				{
+					CT_EQUAL( first, data.getFirstIndex( level - 1u ) + data.getIndexCount( level - 1u ) );
+				}
+
+				CT_CHECK( std::all_of( lod.faces.begin()
+					, lod.faces.end()
+					, [vertexCount]( castor3d::Face const & face )
+					{
+						return face[0] < vertexCount
+							&& face[1] < vertexCount
+							&& face[2] < vertexCount;
+					} ) );
+				previousCount = count;
+				previousError = lod.error;
+			}
+
+			CT_EQUAL( data.getFirstIndex( data.getLevelsCount() ) + data.getIndexCount( data.getLevelsCount() ), totalCount );
+			// Out of range levels fall back to the full detail indices.
+			CT_EQUAL( data.getFirstIndex( data.getLevelsCount() + 1u ), 0u );
+			CT_EQUAL( data.getIndexCount( data.getLevelsCount() + 1u ), submeshCount );
+		}
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	void MeshPreparationTest::LodSelection()
+	{
+		castor3d::Scene scene{ cuT( "TestScene" ), m_engine };
+		auto mesh = scene.addNewMesh( cuT( "LodMesh" ), scene );
+		CT_REQUIRE( mesh != nullptr );
+		addGridSubmesh( *mesh, 20u, 0u );
+		auto & data = addLods( *mesh->getSubmesh( 0u ) );
+		CT_EQUAL( data.getLevelsCount(), 3u );
+		// Around each threshold.
+		CT_EQUAL( data.selectLevel( 1.0e6f ), 0u );
+		CT_EQUAL( data.selectLevel( 600.0f ), 0u );
+		CT_EQUAL( data.selectLevel( 400.0f ), 1u );
+		CT_EQUAL( data.selectLevel( 60.0f ), 1u );
+		CT_EQUAL( data.selectLevel( 40.0f ), 2u );
+		CT_EQUAL( data.selectLevel( 6.0f ), 2u );
+		CT_EQUAL( data.selectLevel( 4.0f ), 3u );
+		CT_EQUAL( data.selectLevel( 0.0f ), 3u );
+
+		// The bigger the projected size, the finer the level.
+		auto previous = data.getLevelsCount();
+
+		for ( float pixelRadius = 1.0f; pixelRadius < 2000.0f; pixelRadius *= 1.25f )
+		{
+			auto level = data.selectLevel( pixelRadius );
+			CT_CHECK( level <= previous );
+			previous = level;
+		}
+
+		// A larger pixel error allows coarser levels.
+		data.setPixelError( 10.0f );
+		CT_EQUAL( data.selectLevel( 400.0f ), 2u );
+		CT_EQUAL( data.selectLevel( 40.0f ), 3u );
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	void MeshPreparationTest::SelectNodeLod()
+	{
+		castor3d::Scene scene{ cuT( "TestScene" ), m_engine };
+		auto mesh = scene.addNewMesh( cuT( "LodMesh" ), scene );
+		CT_REQUIRE( mesh != nullptr );
+		addGridSubmesh( *mesh, 20u, 0u );
+		auto & submesh = *mesh->getSubmesh( 0u );
+		auto & data = addLods( submesh );
+		mesh->computeContainers();
+		auto material = m_engine.getDefaultMaterial();
+		CT_REQUIRE( material != nullptr && material->getPassCount() > 0u );
+
+		// The geometry node stays at the origin, the camera looks at it from the Z axis.
+		auto geometryNode = scene.addNewSceneNode( cuT( "GeometryNode" ) );
+		geometryNode->attachTo( *scene.getObjectRootNode() );
+		castor3d::Geometry geometry{ cuT( "LodGeometry" ), scene, *geometryNode, mesh };
+		castor3d::ModelBufferConfiguration modelData{};
+		castor3d::SubmeshRenderNode node{ *material->getPass( 0u ), submesh, geometry, modelData };
+		auto cameraNode = scene.addNewSceneNode( cuT( "CameraNode" ) );
+		cameraNode->attachTo( *scene.getCameraRootNode() );
+		castor3d::Camera camera{ cuT( "LodCamera" ), scene, *cameraNode, castor3d::Viewport{ m_engine } };
+		camera.resize( 1024u, 1024u );
+		auto & sphere = geometry.getBoundingSphere( submesh );
+		auto lookAt = [&]( float distance )
+		{
+			cameraNode->setPosition( sphere.getCenter() + castor::Point3f{ 0.0f, 0.0f, distance } );
+			return node.selectLod( &camera );
+		};
+
+		CT_EQUAL( node.selectLod( nullptr ), 0u );
+		// The orthographic projections don't reduce the projected size with the distance.
+		CT_EQUAL( lookAt( 1000.0f ), 0u );
+		camera.getViewport().setPerspective( 45.0_degrees, 1.0f, 0.1f, 10000.0f );
+		camera.getViewport().update();
+
+		if constexpr ( C3D_UseVisibilityBuffer != 0 )
+		{
+			// The visibility buffer always uses the full detail indices.
+			CT_EQUAL( lookAt( 1000.0f ), 0u );
+		}
+		else
+		{
+			auto scale = camera.getViewport().getProjectionScale();
+			// Inside the bounding sphere.
+			CT_EQUAL( lookAt( sphere.getRadius() * 0.5f ), 0u );
+			auto previous = 0u;
+
+			for ( float distance = sphere.getRadius() * 2.0f; distance < 5000.0f; distance *= 1.5f )
+			{
+				CT_ON( std::to_string( distance ) );
+				auto level = lookAt( distance );
+				CT_EQUAL( level, data.selectLevel( sphere.getRadius() * scale / distance ) );
+				CT_CHECK( level >= previous );
+				CT_CHECK( level <= data.getLevelsCount() );
+				// The selected level is always drawable from the node indices.
+				CT_CHECK( data.getFirstIndex( level ) + data.getIndexCount( level ) <= submesh.getIndexCount() + data.getIndexCount() );
+				previous = level;
+			}
+
+			// Far enough, the coarsest level is used.
+			CT_EQUAL( previous, data.getLevelsCount() );
+		}
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	//*********************************************************************************************
+
+	MeshPreparationBench::MeshPreparationBench( castor3d::Engine & engine )
+		: BenchCase{ "MeshPreparationBench" }
+		, m_engine{ engine }
+	{
+	}
+
+	void MeshPreparationBench::Execute()
+	{
+		doBenchNormals( 100u, 100u );
+		doBenchNormals( 1000u, 10u );
+		// Stands for a large imported scene: many big submeshes.
+		doBenchPrepare( 16u, 250u, 5u );
+		m_positions = {};
+		m_normals = {};
+		m_faces = {};
+	}
+
+	void MeshPreparationBench::doBenchNormals( uint32_t gridSize
+		, uint64_t calls )
+	{
+		auto suffix = std::to_string( gridSize );
+		makeGrid( gridSize, gridSize, m_positions, m_faces );
+		m_normals.resize( m_positions.size() );
+
+		doBench( "ReferenceNormals" + suffix
+			, [this]()
+			{
+				computeReferenceNormals( m_positions, m_normals, m_faces, false );
+				doNotOptimizeAway( m_normals.back() );
+			}
+			, calls );
+
+		doBench( "Normals" + suffix
+			, [this]()
+			{
+				castor3d::SubmeshUtils::computeNormals( m_positions, m_normals, m_faces );
+				doNotOptimizeAway( m_normals.back() );
+			}
+			, calls );
+	}
+
+	void MeshPreparationBench::doBenchPrepare( uint32_t submeshCount
+		, uint32_t gridSize
+		, uint64_t calls )
+	{
+		auto suffix = std::to_string( submeshCount ) + "x" + std::to_string( gridSize );
+		castor3d::Scene scene{ cuT( "BenchScene" ), m_engine };
+		auto mesh = scene.addNewMesh( cuT( "BenchMesh" ), scene );
+
+		for ( uint32_t i = 0u; i < submeshCount; ++i )
+		{
+			addGridSubmesh( *mesh, gridSize, i );
+		}
+
+		// The preparation is done in place, hence the first call works on shuffled data,
+		// and the next ones on already prepared data, for both cases.
+		castor3d::Parameters parameters;
+
+		doBench( "PrepareSerial" + suffix
+			, [&mesh, &parameters]()
+			{
+				for ( auto & submesh : *mesh )
+				{
+					castor3d::MeshPreparer::prepare( *submesh, parameters );
+				}
+
+				doNotOptimizeAway( mesh->getSubmesh( 0u )->getPositions().back() );
+			}
+			, calls );
+
+		doBench( "PrepareParallel" + suffix
+			, [&mesh, &parameters]()
+			{
+				castor3d::MeshPreparer::prepare( *mesh, parameters );
+				doNotOptimizeAway( mesh->getSubmesh( 0u )->getPositions().back() );
+			}
+			, calls );
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,51 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_MESH_PREPARATION_TEST_H___
+#define ___C3DT_MESH_PREPARATION_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Model/Mesh/Submesh/Component/ComponentModule.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/Face.hpp>
+
+namespace Testing
+{
+	class MeshPreparationTest
+		: public C3DTestCase
+	{
+	public:
+		explicit MeshPreparationTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void ComputeNormals();
+		void PrepareKeepsTriangles();
+		void LodChain();
+		void LodSelection();
+		void SelectNodeLod();
+	};
+
+	class MeshPreparationBench
+		: public BenchCase
+	{
+	public:
+		explicit MeshPreparationBench( castor3d::Engine & engine );
+		void Execute()override;
+
+	private:
+		void doBenchNormals( uint32_t gridSize
+			, uint64_t calls );
+		void doBenchPrepare( uint32_t submeshCount
+			, uint32_t gridSize
+			, uint64_t calls );
+
+	private:
+		castor3d::Engine & m_engine;
+		castor::Point3fArray m_positions;
+		castor::Point3fArray m_normals;
+		castor3d::FaceArray m_faces;
+	};
+}
+
+#endif
@@ -0,0 +1,322 @@
+#include "SceneNodeTransformsTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Render/RenderLoop.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+#include <Castor3D/Scene/SceneNode.hpp>
+#include <Castor3D/Scene/SceneNodeTransforms.hpp>
+
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		struct RandomTransforms
+		{
+			explicit RandomTransforms( uint32_t seed )
+				: rng{ seed }
+			{
+			}
+
+			void apply( castor3d::SceneNode & node )
+			{
+				node.setPosition( castor::Point3f{ position( rng ), position( rng ), position( rng ) } );
+				node.setScale( castor::Point3f{ scale( rng ), scale( rng ), scale( rng ) } );
+				node.setOrientation( castor::Quaternion::fromAxisAngle( castor::Point3f{ 0.0f, 1.0f, 0.0f }
+					, castor::Angle::fromDegrees( angle( rng ) ) ) );
+			}
+
+			std::mt19937 rng;
+			std::uniform_real_distribution< float > position{ -10.0f, 10.0f };
+			std::uniform_real_distribution< float > scale{ 0.8f, 1.2f };
+			std::uniform_real_distribution< float > angle{ 0.0f, 360.0f };
+		};
+
+		// Random recursive tree: each node's parent is one of the previously created nodes.
+		castor::Vector< castor3d::SceneNode * > makeHierarchy( castor3d::Scene & scene
+			, uint32_t count
+			, uint32_t seed )
+		{
+			castor::Vector< castor3d::SceneNode * > result;
+			result.reserve( count );
+			RandomTransforms transforms{ seed };
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto node = scene.addNewSceneNode( cuT( "Node" ) + castor::string::toString( i ) );
+				auto parent = i == 0u
+					? scene.getObjectRootNode()
+					: result[transforms.rng() % i];
+				node->attachTo( *parent );
+				transforms.apply( *node );
+				result.push_back( node );
+			}
+
+			return result;
+		}
+
+		castor::Vector< castor3d::SceneNode * > listNodes( castor3d::Scene & scene
+			, castor::Vector< castor3d::SceneNode * > const & nodes )
+		{
+			castor::Vector< castor3d::SceneNode * > result{ scene.getRootNode()
+				, scene.getObjectRootNode()
+				, scene.getCameraRootNode() };
+			result.insert( result.end(), nodes.begin(), nodes.end() );
+			return result;
+		}
+
+		// The transforms computation, as done by SceneNode, going up the parents chain.
+		castor::Matrix4x4f referenceWorld( castor3d::SceneNode const & node )
+		{
+			castor::Matrix4x4f local;
+			castor::matrix::setTransform( local, node.getPosition(), node.getScale(), node.getOrientation() );
+
+			if ( auto parent = node.getParent() )
+			{
+				return referenceWorld( *parent ) * local;
+			}
+
+			return local;
+		}
+
+		castor::Quaternion referenceOrientation( castor3d::SceneNode const & node )
+		{
+			if ( auto parent = node.getParent() )
+			{
+				return node.getOrientation() * referenceOrientation( *parent );
+			}
+
+			return node.getOrientation();
+		}
+
+		bool isClose( float lhs
+			, float rhs )
+		{
+			return std::abs( lhs - rhs ) <= 1.0e-3f * std::max( 1.0f, std::abs( rhs ) );
+		}
+
+		bool isClose( castor::Matrix4x4f const & lhs
+			, castor::Matrix4x4f const & rhs )
+		{
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				if ( !isClose( lhs.constPtr()[i], rhs.constPtr()[i] ) )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool checkNodes( castor::Vector< castor3d::SceneNode * > const & nodes )
+		{
+			return std::all_of( nodes.begin()
+				, nodes.end()
+				, []( castor3d::SceneNode const * node )
+				{
+					auto world = referenceWorld( *node );
+					auto orientation = referenceOrientation( *node );
+					auto derivedOrientation = node->getDerivedOrientation();
+					auto derivedPosition = node->getDerivedPosition();
+					return !node->isModified()
+						&& isClose( node->getDerivedTransformationMatrix(), world )
+						&& isClose( derivedPosition->x, world[3][0] )
+						&& isClose( derivedPosition->y, world[3][1] )
+						&& isClose( derivedPosition->z, world[3][2] )
+						&& isClose( derivedOrientation->x, orientation->x )
+						&& isClose( derivedOrientation->y, orientation->y )
+						&& isClose( derivedOrientation->z, orientation->z )
+						&& isClose( derivedOrientation->w, orientation->w );
+				} );
+		}
+	}
+
+	//*********************************************************************************************
+
+	SceneNodeTransformsTest::SceneNodeTransformsTest( castor3d::Engine & engine )
+		: C3DTestCase{ "SceneNodeTransformsTest", engine }
+	{
+	}
+
+	void SceneNodeTransformsTest::doRegisterTests()
+	{
+		doRegisterTest( "SceneNodeTransformsTest::MultiplyMatchesMatrix", std::bind( &SceneNodeTransformsTest::MultiplyMatchesMatrix, this ) );
+		doRegisterTest( "SceneNodeTransformsTest::WorldTransforms", std::bind( &SceneNodeTransformsTest::WorldTransforms, this ) );
+		doRegisterTest( "SceneNodeTransformsTest::DirtyPropagation", std::bind( &SceneNodeTransformsTest::DirtyPropagation, this ) );
+	}
+
+	void SceneNodeTransformsTest::MultiplyMatchesMatrix()
+	{
+		std::mt19937 rng{ 42u };
+		std::uniform_real_distribution< float > value{ -10.0f, 10.0f };
+
+		for ( uint32_t i = 0u; i < 1000u; ++i )
+		{
+			castor::Matrix4x4f lhs;
+			castor::Matrix4x4f rhs;
+
+			for ( uint32_t j = 0u; j < 16u; ++j )
+			{
+				lhs.ptr()[j] = value( rng );
+				rhs.ptr()[j] = value( rng );
+			}
+
+			castor::Matrix4x4f result;
+			castor3d::SceneNodeTransforms::multiply( lhs, rhs, result );
+			CT_CHECK( isClose( result, lhs * rhs ) );
+			// The result can be one of the operands.
+			castor3d::SceneNodeTransforms::multiply( lhs, rhs, lhs );
+			CT_CHECK( isClose( lhs, result ) );
+		}
+	}
+
+	void SceneNodeTransformsTest::WorldTransforms()
+	{
+		castor3d::Scene scene{ cuT( "TestScene" ), m_engine };
+		auto nodes = listNodes( scene, makeHierarchy( scene, 2000u, 1u ) );
+		castor3d::SceneNodeTransforms transforms;
+		transforms.update( m_engine.getCpuJobs(), *scene.getRootNode(), nodes, true );
+		CT_EQUAL( transforms.getNodeCount(), nodes.size() );
+		CT_CHECK( checkNodes( nodes ) );
+
+		// Each level only holds nodes from the same depth, parents first.
+		for ( auto & node : nodes )
+		{
+			auto index = transforms.getIndex( *node );
+			CT_REQUIRE( index != castor3d::SceneNodeTransforms::InvalidIndex );
+
+			if ( auto parent = node->getParent() )
+			{
+				CT_CHECK( transforms.getIndex( *parent ) < index );
+			}
+		}
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	void SceneNodeTransformsTest::DirtyPropagation()
+	{
+		castor3d::Scene scene{ cuT( "TestScene" ), m_engine };
+		auto created = makeHierarchy( scene, 2000u, 2u );
+		auto nodes = listNodes( scene, created );
+		castor3d::SceneNodeTransforms transforms;
+		transforms.update( m_engine.getCpuJobs(), *scene.getRootNode(), nodes, true );
+		RandomTransforms random{ 3u };
+
+		// Only the modified nodes are given, their descendants are updated through their index.
+		castor::Vector< castor3d::SceneNode * > dirty;
+
+		for ( uint32_t i = 0u; i < created.size(); i += 97u )
+		{
+			random.apply( *created[i] );
+			dirty.push_back( created[i] );
+		}
+
+		transforms.update( m_engine.getCpuJobs(), *scene.getRootNode(), dirty, false );
+		CT_CHECK( checkNodes( nodes ) );
+
+		// Reparenting sorts the nodes again (a node's parent is always created before it, so no cycle).
+		created[1500]->attachTo( *created[10] );
+		created[10]->setPosition( castor::Point3f{ 1.0f, 2.0f, 3.0f } );
+		transforms.update( m_engine.getCpuJobs(), *scene.getRootNode(), { created[10], created[1500] }, true );
+		CT_CHECK( checkNodes( nodes ) );
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	//*********************************************************************************************
+
+	SceneNodeTransformsBench::SceneNodeTransformsBench( castor3d::Engine & engine )
+		: BenchCase{ "SceneNodeTransformsBench" }
+		, m_engine{ engine }
+	{
+	}
+
+	void SceneNodeTransformsBench::Execute()
+	{
+		doBenchCount( 10000u, 20u );
+		doBenchCount( 100000u, 5u );
+	}
+
+	void SceneNodeTransformsBench::doBenchCount( uint32_t count
+		, uint64_t calls )
+	{
+		auto suffix = std::to_string( count );
+		castor3d::Scene scene{ cuT( "BenchScene" ), m_engine };
+		auto created = makeHierarchy( scene, count, count );
+		auto nodes = listNodes( scene, created );
+		auto & jobs = m_engine.getFrameJobs();
+		castor3d::SceneNodeTransforms transforms;
+		transforms.update( jobs, *scene.getRootNode(), nodes, true );
+		// Both cases animate all the nodes, then update their transforms.
+		auto animate = [&created]()
+		{
+			for ( auto node : created )
+			{
+				node->translate( castor::Point3f{ 0.0f, 0.001f, 0.0f } );
+			}
+		};
+
+		// Former path: nodes grouped by depth, each one updated on its own.
+		doBench( "PerNode" + suffix
+			, [&animate, &nodes, &jobs]()
+			{
+				animate();
+				castor::Vector< castor::Vector< castor3d::SceneNode * > > levels;
+
+				for ( auto node : nodes )
+				{
+					uint32_t depth{};
+
+					for ( auto parent = node->getParent(); parent; parent = parent->getParent() )
+					{
+						++depth;
+					}
+
+					if ( levels.size() <= depth )
+					{
+						levels.resize( depth + 1u );
+					}
+
+					levels[depth].push_back( node );
+				}
+
+				for ( auto const & level : levels )
+				{
+					jobs.parallelFor( level.size()
+						, [&level]( size_t begin, size_t end )
+						{
+							for ( auto i = begin; i < end; ++i )
+							{
+								level[i]->update();
+							}
+						}
+						, 256u );
+				}
+
+				doNotOptimizeAway( nodes.back()->getDerivedTransformationMatrix() );
+			}
+			, calls );
+
+		doBench( "Transforms" + suffix
+			, [&animate, &nodes, &jobs, &transforms, &scene]()
+			{
+				animate();
+				transforms.update( jobs, *scene.getRootNode(), nodes, false );
+				doNotOptimizeAway( nodes.back()->getDerivedTransformationMatrix() );
+			}
+			, calls );
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	//*********************************************************************************************
+}
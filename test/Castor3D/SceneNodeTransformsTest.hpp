@@ -0,0 +1,40 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_SCENE_NODE_TRANSFORMS_TEST_H___
+#define ___C3DT_SCENE_NODE_TRANSFORMS_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class SceneNodeTransformsTest
+		: public C3DTestCase
+	{
+	public:
+		explicit SceneNodeTransformsTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void MultiplyMatchesMatrix();
+		void WorldTransforms();
+		void DirtyPropagation();
+	};
+
+	class SceneNodeTransformsBench
+		: public BenchCase
+	{
+	public:
+		explicit SceneNodeTransformsBench( castor3d::Engine & engine );
+		void Execute()override;
+
+	private:
+		void doBenchCount( uint32_t count
+			, uint64_t calls );
+
+	private:
+		castor3d::Engine & m_engine;
+	};
+}
+
+#endif
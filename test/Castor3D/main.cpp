@@ -1,7 +1,11 @@
 #include "Castor3DTestPrerequisites.hpp"
 
 #include "BinaryExportTest.hpp"
+#include "FrustumCullingTest.hpp"
+#include "IndirectCommandsTest.hpp"
+#include "MeshPreparationTest.hpp"
 #include "SceneExportTest.hpp"
+#include "SceneNodeTransformsTest.hpp"
 
 #include <Castor3D/Engine.hpp>
 #include <Castor3D/Cache/PluginCache.hpp>
@@ -139,6 +143,13 @@ int main( int argc, char const * argv[] )
 		// Test cases.
 		Testing::registerType( castor::make_unique< Testing::BinaryExportTest >( *engine ) );
 		Testing::registerType( castor::make_unique< Testing::SceneExportTest >( *engine ) );
+		Testing::registerType( castor::make_unique< Testing::FrustumCullingTest >( *engine ) );
+		Testing::registerType( castor::make_unique< Testing::FrustumCullingBench >( *engine ) );
+		Testing::registerType( castor::make_unique< Testing::IndirectCommandsTest >( *engine ) );
+		Testing::registerType( castor::make_unique< Testing::MeshPreparationTest >( *engine ) );
+		Testing::registerType( castor::make_unique< Testing::MeshPreparationBench >( *engine ) );
+		Testing::registerType( castor::make_unique< Testing::SceneNodeTransformsTest >( *engine ) );
+		Testing::registerType( castor::make_unique< Testing::SceneNodeTransformsBench >( *engine ) );
 
 		// Tests loop.
 		BENCHLOOP( count, result )
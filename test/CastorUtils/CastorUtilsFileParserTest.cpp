@@ -0,0 +1,273 @@
+#include "CastorUtilsFileParserTest.hpp"
+
+#include <CastorUtils/Data/TextFile.hpp>
+#include <CastorUtils/FileParser/FileParser.hpp>
+#include <CastorUtils/FileParser/FileParserContext.hpp>
+#include <CastorUtils/FileParser/ParserParameter.hpp>
+
+namespace Testing
+{
+	namespace
+	{
+		enum class TestSection
+			: castor::SectionId
+		{
+			eRoot = CU_MakeSectionName( 'R', 'O', 'O', 'T' ),
+			eObject = CU_MakeSectionName( 'O', 'B', 'J', 'T' ),
+		};
+
+		struct ParseResults
+		{
+			castor::StringArray objects;
+			uint64_t sum{};
+		};
+
+		class TestParser
+			: public castor::FileParser
+		{
+		public:
+			explicit TestParser( ParseResults & results )
+				: castor::FileParser{ castor::SectionId( TestSection::eRoot ) }
+				, m_results{ results }
+			{
+				addParser( castor::SectionId( TestSection::eRoot )
+					, castor::SectionId( TestSection::eObject )
+					, cuT( "object" )
+					, [&results]( castor::FileParserContext & context
+						, void *
+						, castor::ParserParameterArray const & params )
+					{
+						results.objects.push_back( params[0]->get< castor::String >() );
+						context.pendingSection = castor::SectionId( TestSection::eObject );
+						context.pendingBlock = nullptr;
+						return true;
+					}
+					, { castor::makeParameter< castor::ParameterType::eName >() } );
+				addParser( castor::SectionId( TestSection::eObject )
+					, cuT( "value" )
+					, [&results]( castor::FileParserContext &
+						, void *
+						, castor::ParserParameterArray const & params )
+					{
+						results.sum += params[0]->get< uint32_t >();
+						return false;
+					}
+					, { castor::makeParameter< castor::ParameterType::eUInt32 >() } );
+			}
+
+		private:
+			void doCleanupParser( castor::PreprocessedFile & )override
+			{
+			}
+
+			void doValidate( castor::PreprocessedFile & )override
+			{
+			}
+
+			castor::String doGetSectionName( castor::SectionId section )const override
+			{
+				return section == castor::SectionId( TestSection::eObject )
+					? castor::String{ cuT( "object" ) }
+					: castor::String{ cuT( "root" ) };
+			}
+
+			castor::RawUniquePtr< castor::FileParser > doCreateParser()const override
+			{
+				return castor::make_unique< TestParser >( m_results );
+			}
+
+		private:
+			ParseResults & m_results;
+		};
+
+		castor::String makeObjects( castor::String const & prefix
+			, uint32_t count
+			, uint32_t values )
+		{
+			castor::StringStream stream{ castor::makeStringStream() };
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				stream << cuT( "// Object " ) << i << cuT( "\n" );
+				stream << cuT( "object \"" ) << prefix << i << cuT( "\"\n" );
+				stream << cuT( "{\n" );
+
+				for ( uint32_t j = 0u; j < values; ++j )
+				{
+					stream << cuT( "\tvalue " ) << ( j + 1u ) << cuT( "\n" );
+				}
+
+				stream << cuT( "}\n\n" );
+			}
+
+			return stream.str();
+		}
+
+		void writeFile( castor::Path const & path
+			, castor::String const & content )
+		{
+			castor::TextFile file{ path, castor::File::OpenMode::eWrite };
+			file.writeText( content );
+		}
+
+		/**
+		 *\~english
+		 *\brief		Writes a main file including two files, the first one including a third one.
+		 *\~french
+		 *\brief		Ecrit un fichier principal incluant deux fichiers, le premier en incluant un troisième.
+		 */
+		castor::Path writeIncludes( castor::Path const & folder
+			, uint32_t count
+			, uint32_t values )
+		{
+			if ( !castor::File::directoryExists( folder ) )
+			{
+				castor::File::directoryCreate( folder );
+			}
+
+			writeFile( folder / cuT( "third.cscn" ), makeObjects( cuT( "third" ), count, values ) );
+			writeFile( folder / cuT( "first.cscn" ), makeObjects( cuT( "first" ), count, values )
+				+ cuT( "include \"third.cscn\"\n" ) );
+			writeFile( folder / cuT( "second.cscn" ), makeObjects( cuT( "second" ), count, values ) );
+			writeFile( folder / cuT( "main.cscn" ), cuT( "include \"first.cscn\"\n" )
+				+ makeObjects( cuT( "main" ), count, values )
+				+ cuT( "include \"second.cscn\"\n" ) );
+			return folder / cuT( "main.cscn" );
+		}
+
+		void removeIncludes( castor::Path const & folder )
+		{
+			castor::File::directoryDelete( folder );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsFileParserTest::CastorUtilsFileParserTest()
+		: TestCase( "CastorUtilsFileParserTest" )
+	{
+	}
+
+	void CastorUtilsFileParserTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsFileParserTest::ParseContent", std::bind( &CastorUtilsFileParserTest::ParseContent, this ) );
+		doRegisterTest( "CastorUtilsFileParserTest::Defines", std::bind( &CastorUtilsFileParserTest::Defines, this ) );
+		doRegisterTest( "CastorUtilsFileParserTest::Includes", std::bind( &CastorUtilsFileParserTest::Includes, this ) );
+		doRegisterTest( "CastorUtilsFileParserTest::ParallelIncludes", std::bind( &CastorUtilsFileParserTest::ParallelIncludes, this ) );
+	}
+
+	void CastorUtilsFileParserTest::ParseContent()
+	{
+		ParseResults results;
+		TestParser parser{ results };
+		CT_CHECK( parser.parseFile( castor::Path{ cuT( "test.cscn" ) }
+			, cuT( "object \"a\" // comment\r\n" )
+			cuT( "{\r\n" )
+			cuT( "\tvalue 1\r\n" )
+			cuT( "\t/* value 10\r\n" )
+			cuT( "\tvalue 100 */\r\n" )
+			cuT( "\tvalue 2\r\n" )
+			cuT( "}\r\n" )
+			cuT( "object \"b\" { value 3 }\n" ) ) );
+		CT_EQUAL( results.objects.size(), 2u );
+		CT_EQUAL( results.objects[0], cuT( "a" ) );
+		CT_EQUAL( results.objects[1], cuT( "b" ) );
+		CT_EQUAL( results.sum, 6u );
+	}
+
+	void CastorUtilsFileParserTest::Defines()
+	{
+		ParseResults results;
+		TestParser parser{ results };
+		CT_CHECK( parser.parseFile( castor::Path{ cuT( "test.cscn" ) }
+			, cuT( "define FIVE 5\n" )
+			cuT( "object \"a\"\n" )
+			cuT( "{\n" )
+			cuT( "\tvalue FIVE\n" )
+			cuT( "}\n" ) ) );
+		CT_EQUAL( results.objects.size(), 1u );
+		CT_EQUAL( results.sum, 5u );
+	}
+
+	void CastorUtilsFileParserTest::Includes()
+	{
+		auto folder = castor::File::getExecutableDirectory() / cuT( "FileParserIncludes" );
+		auto path = writeIncludes( folder, 4u, 4u );
+		ParseResults results;
+		TestParser parser{ results };
+		CT_CHECK( parser.parseFile( path ) );
+		CT_EQUAL( results.objects.size(), 16u );
+		CT_EQUAL( results.objects.front(), cuT( "first0" ) );
+		CT_EQUAL( results.objects[4], cuT( "third0" ) );
+		CT_EQUAL( results.objects[8], cuT( "main0" ) );
+		CT_EQUAL( results.objects.back(), cuT( "second3" ) );
+		CT_EQUAL( results.sum, 16u * 10u );
+		removeIncludes( folder );
+	}
+
+	void CastorUtilsFileParserTest::ParallelIncludes()
+	{
+		auto folder = castor::File::getExecutableDirectory() / cuT( "FileParserParallelIncludes" );
+		auto path = writeIncludes( folder, 4u, 4u );
+		ParseResults sequential;
+		{
+			TestParser parser{ sequential };
+			CT_CHECK( parser.parseFile( path ) );
+		}
+		ParseResults parallel;
+		{
+			castor::JobSystem jobs{ 4u };
+			TestParser parser{ parallel };
+			parser.setJobSystem( &jobs );
+			CT_CHECK( parser.parseFile( path ) );
+		}
+		CT_EQUAL( parallel.objects, sequential.objects );
+		CT_EQUAL( parallel.sum, sequential.sum );
+		removeIncludes( folder );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsFileParserBench::CastorUtilsFileParserBench()
+		: BenchCase( "CastorUtilsFileParserBench" )
+		, m_content{ makeObjects( cuT( "object" ), 1000u, 16u ) }
+		, m_folder{ castor::File::getExecutableDirectory() / cuT( "FileParserBench" ) }
+		, m_jobs{ 4u }
+	{
+		writeIncludes( m_folder, 250u, 16u );
+	}
+
+	CastorUtilsFileParserBench::~CastorUtilsFileParserBench()
+	{
+		removeIncludes( m_folder );
+	}
+
+	void CastorUtilsFileParserBench::Execute()
+	{
+		BENCHMARK( ParseContent, 20 );
+		BENCHMARK( ParseIncludesSequential, 20 );
+		BENCHMARK( ParseIncludesParallel, 20 );
+	}
+
+	void CastorUtilsFileParserBench::ParseContent()
+	{
+		ParseResults results;
+		TestParser parser{ results };
+		doNotOptimizeAway( parser.parseFile( castor::Path{ cuT( "bench.cscn" ) }, m_content ) );
+	}
+
+	void CastorUtilsFileParserBench::ParseIncludesSequential()
+	{
+		ParseResults results;
+		TestParser parser{ results };
+		doNotOptimizeAway( parser.parseFile( m_folder / cuT( "main.cscn" ) ) );
+	}
+
+	void CastorUtilsFileParserBench::ParseIncludesParallel()
+	{
+		ParseResults results;
+		TestParser parser{ results };
+		parser.setJobSystem( &m_jobs );
+		doNotOptimizeAway( parser.parseFile( m_folder / cuT( "main.cscn" ) ) );
+	}
+}
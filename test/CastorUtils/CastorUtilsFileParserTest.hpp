@@ -0,0 +1,47 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsFileParserTest_H___
+#define ___CUT_CastorUtilsFileParserTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
+namespace Testing
+{
+	class CastorUtilsFileParserTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsFileParserTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void ParseContent();
+		void Defines();
+		void Includes();
+		void ParallelIncludes();
+	};
+
+	class CastorUtilsFileParserBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsFileParserBench();
+		~CastorUtilsFileParserBench()override;
+		void Execute()override;
+
+	private:
+		void ParseContent();
+		void ParseIncludesSequential();
+		void ParseIncludesParallel();
+
+	private:
+		castor::String m_content;
+		castor::Path m_folder;
+		castor::JobSystem m_jobs;
+	};
+}
+
+#endif
@@ -0,0 +1,245 @@
+#include "CastorUtilsGlyphAtlasTest.hpp"
+
+#include <CastorUtils/Graphics/GlyphAtlas.hpp>
+#include <CastorUtils/Graphics/Glyph.hpp>
+
+namespace Testing
+{
+	namespace
+	{
+		// 64x64 atlas, growing by pages of 16 lines, the glyphs take 16x16 texels with their padding,
+		// hence 4 glyphs per page and 16 glyphs at most.
+		static uint32_t constexpr AtlasWidth = 64u;
+		static uint32_t constexpr PageHeight = 16u;
+		static uint32_t constexpr MaxHeight = 64u;
+		static uint32_t constexpr GlyphSize = 15u;
+
+		struct Glyphs
+		{
+			Glyphs()
+			{
+				for ( auto c : castor::U32String{ U"?ABCDEFGHIJKLMNOPQRSTUVWXYZ" } )
+				{
+					// Each glyph bitmap is filled with its character, to check the atlas content.
+					glyphs.try_emplace( c
+						, c
+						, castor::Point2f{ float( GlyphSize ), float( GlyphSize ) }
+						, castor::Point2f{}
+						, float( GlyphSize )
+						, castor::Size{ GlyphSize, GlyphSize }
+						, castor::ByteArray( GlyphSize * GlyphSize, uint8_t( c ) ) );
+				}
+			}
+
+			castor::GlyphAtlas makeAtlas()const
+			{
+				return castor::GlyphAtlas{ [this]( char32_t c )
+						{
+							auto it = glyphs.find( c );
+							return it == glyphs.end()
+								? nullptr
+								: &it->second;
+						}
+					, castor::PixelFormat::eR8_UNORM
+					, AtlasWidth
+					, PageHeight
+					, MaxHeight
+					, true };
+			}
+
+			castor::Map< char32_t, castor::Glyph > glyphs;
+		};
+
+		bool isWritten( castor::GlyphAtlas const & atlas
+			, char32_t c
+			, castor::Position const & position )
+		{
+			auto & data = atlas.getData();
+			auto x = uint32_t( position.x() );
+			auto y = uint32_t( position.y() );
+			return data[y * AtlasWidth + x] == uint8_t( c )
+				&& data[( y + GlyphSize - 1u ) * AtlasWidth + x + GlyphSize - 1u] == uint8_t( c );
+		}
+
+		bool checkPublished( castor::GlyphAtlas const & atlas
+			, castor::U32String const & text )
+		{
+			castor::Vector< castor::Position > positions;
+
+			for ( auto c : text )
+			{
+				auto position = atlas.getPosition( c );
+
+				if ( !position
+					|| !isWritten( atlas, c, *position ) )
+				{
+					return false;
+				}
+
+				for ( auto & other : positions )
+				{
+					if ( other == *position )
+					{
+						return false;
+					}
+				}
+
+				positions.push_back( *position );
+			}
+
+			return true;
+		}
+	}
+
+	CastorUtilsGlyphAtlasTest::CastorUtilsGlyphAtlasTest()
+		: TestCase{ "CastorUtilsGlyphAtlasTest" }
+	{
+	}
+
+	void CastorUtilsGlyphAtlasTest::doRegisterTests()
+	{
+		doRegisterTest( "AddAndPublish", std::bind( &CastorUtilsGlyphAtlasTest::AddAndPublish, this ) );
+		doRegisterTest( "GrowWaitsForRefresh", std::bind( &CastorUtilsGlyphAtlasTest::GrowWaitsForRefresh, this ) );
+		doRegisterTest( "EvictUnused", std::bind( &CastorUtilsGlyphAtlasTest::EvictUnused, this ) );
+		doRegisterTest( "KeepUsed", std::bind( &CastorUtilsGlyphAtlasTest::KeepUsed, this ) );
+	}
+
+	void CastorUtilsGlyphAtlasTest::AddAndPublish()
+	{
+		Glyphs glyphs;
+		auto atlas = glyphs.makeAtlas();
+		CT_CHECK( atlas.addGlyphs( U"?ABCDE" ) );
+		CT_EQUAL( atlas.getSize().getHeight(), 2u * PageHeight );
+		CT_CHECK( atlas.isResident( U'E' ) );
+		CT_CHECK( atlas.getPosition( U'E' ) == nullptr );
+		// The first refresh has no texture to replace.
+		atlas.beginRefresh();
+		CT_CHECK( !atlas.isRefreshing() );
+		CT_CHECK( checkPublished( atlas, U"?ABCDE" ) );
+		// Unknown glyphs are ignored.
+		CT_CHECK( !atlas.addGlyphs( U"a" ) );
+		CT_CHECK( !atlas.isResident( U'a' ) );
+		// Without layout change, the new glyphs are published and go in the front region.
+		CT_CHECK( !atlas.addGlyphs( U"F" ) );
+		CT_CHECK( checkPublished( atlas, U"F" ) );
+		auto & region = atlas.getFrontRegion();
+		auto position = atlas.getPosition( U'F' );
+		CT_REQUIRE( position != nullptr );
+		CT_EQUAL( region.left, uint32_t( position->x() ) );
+		CT_EQUAL( region.top, uint32_t( position->y() ) );
+		CT_EQUAL( region.right, uint32_t( position->x() ) + GlyphSize );
+		CT_EQUAL( region.bottom, uint32_t( position->y() ) + GlyphSize );
+		atlas.clearFrontRegion();
+		CT_CHECK( atlas.getFrontRegion().empty() );
+	}
+
+	void CastorUtilsGlyphAtlasTest::GrowWaitsForRefresh()
+	{
+		Glyphs glyphs;
+		auto atlas = glyphs.makeAtlas();
+		atlas.addGlyphs( U"?ABC" );
+		atlas.publish();
+		auto before = *atlas.getPosition( U'A' );
+		// The atlas grows, the new glyph is not in the displayed texture.
+		CT_CHECK( atlas.useGlyphs( U"D" ) );
+		CT_EQUAL( atlas.getSize().getHeight(), 2u * PageHeight );
+		CT_CHECK( atlas.getPosition( U'D' ) == nullptr );
+		CT_CHECK( *atlas.getPosition( U'A' ) == before );
+		CT_CHECK( atlas.getFrontRegion().empty() );
+		atlas.beginRefresh();
+		CT_CHECK( atlas.isRefreshing() );
+		// Added during the refresh, without layout change: goes to the back texture.
+		CT_CHECK( !atlas.useGlyphs( U"E" ) );
+		CT_CHECK( atlas.getPosition( U'E' ) == nullptr );
+		CT_CHECK( !atlas.endRefresh() );
+		CT_CHECK( checkPublished( atlas, U"?ABCDE" ) );
+		// Only the glyph added after the back texture creation remains to upload.
+		CT_EQUAL( atlas.getFrontRegion().top, uint32_t( atlas.getPosition( U'E' )->y() ) );
+		CT_EQUAL( atlas.getFrontRegion().right - atlas.getFrontRegion().left, GlyphSize );
+
+		// The atlas grows again during a refresh: another refresh is needed.
+		atlas.clearFrontRegion();
+		CT_CHECK( !atlas.useGlyphs( U"F" ) );
+		atlas.beginRefresh();
+		CT_CHECK( !atlas.useGlyphs( U"GHI" ) );
+		CT_EQUAL( atlas.getSize().getHeight(), 3u * PageHeight );
+		CT_CHECK( atlas.endRefresh() );
+		CT_CHECK( checkPublished( atlas, U"?ABCDEF" ) );
+		CT_CHECK( atlas.getPosition( U'I' ) == nullptr );
+		atlas.beginRefresh();
+		CT_CHECK( !atlas.endRefresh() );
+		CT_CHECK( checkPublished( atlas, U"?ABCDEFGHI" ) );
+	}
+
+	void CastorUtilsGlyphAtlasTest::EvictUnused()
+	{
+		Glyphs glyphs;
+		auto atlas = glyphs.makeAtlas();
+		atlas.addGlyphs( U"?ABCDEFGHIJKLMN" );
+		atlas.publish();
+		CT_CHECK( atlas.useGlyphs( U"AB" ) == false );
+		castor::Map< char32_t, castor::Position > before;
+
+		for ( auto c : castor::U32String{ U"?ABCDEFGHIJKLMN" } )
+		{
+			before.emplace( c, *atlas.getPosition( c ) );
+		}
+
+		// The last free place, uploaded through the front region.
+		CT_CHECK( !atlas.addGlyphs( U"O" ) );
+		CT_EQUAL( atlas.getSize().getHeight(), MaxHeight );
+		CT_CHECK( atlas.getPosition( U'O' ) != nullptr );
+		CT_CHECK( !atlas.getFrontRegion().empty() );
+
+		// The atlas is full, the glyphs that are not used are evicted.
+		CT_CHECK( atlas.useGlyphs( U"Z" ) );
+		CT_CHECK( atlas.isResident( U'Z' ) );
+		CT_CHECK( atlas.isResident( U'?' ) );
+		CT_CHECK( atlas.isResident( U'A' ) );
+		CT_CHECK( atlas.isResident( U'B' ) );
+		CT_CHECK( !atlas.isResident( U'C' ) );
+		CT_CHECK( atlas.isEvicted( U'C' ) );
+		CT_CHECK( atlas.isEvicted( U'O' ) );
+		CT_CHECK( !atlas.isEvicted( U'A' ) );
+		// The displayed texture keeps its layout until the refresh.
+		for ( auto & [c, position] : before )
+		{
+			CT_CHECK( atlas.getPosition( c ) != nullptr
+				&& *atlas.getPosition( c ) == position );
+		}
+
+		// The glyph that was not uploaded yet is withdrawn from it.
+		CT_CHECK( atlas.getPosition( U'O' ) == nullptr );
+		CT_CHECK( atlas.getFrontRegion().empty() );
+		CT_CHECK( atlas.getPosition( U'Z' ) == nullptr );
+		atlas.beginRefresh();
+		CT_CHECK( !atlas.endRefresh() );
+		CT_CHECK( checkPublished( atlas, U"?ABZ" ) );
+		CT_CHECK( atlas.getPosition( U'C' ) == nullptr );
+
+		// An evicted glyph comes back when used again.
+		CT_CHECK( !atlas.useGlyphs( U"C" ) );
+		CT_CHECK( !atlas.isEvicted( U'C' ) );
+		CT_CHECK( checkPublished( atlas, U"?ABCZ" ) );
+	}
+
+	void CastorUtilsGlyphAtlasTest::KeepUsed()
+	{
+		Glyphs glyphs;
+		auto atlas = glyphs.makeAtlas();
+		atlas.useGlyphs( U"ABCDEFGHIJKLMNO" );
+		atlas.addGlyphs( U"?" );
+		atlas.publish();
+		// All the glyphs are used, the new one doesn't get in, and the layout doesn't change.
+		CT_CHECK( !atlas.useGlyphs( U"Z" ) );
+		CT_CHECK( !atlas.isResident( U'Z' ) );
+		CT_CHECK( !atlas.isEvicted( U'A' ) );
+		CT_CHECK( checkPublished( atlas, U"?ABCDEFGHIJKLMNO" ) );
+		// Once released, they can be evicted.
+		atlas.releaseGlyphs( U"CDEFGHIJKLMNO" );
+		CT_CHECK( atlas.useGlyphs( U"Z" ) );
+		CT_CHECK( atlas.isResident( U'Z' ) );
+		CT_CHECK( atlas.isEvicted( U'C' ) );
+		CT_CHECK( atlas.isResident( U'A' ) );
+	}
+}
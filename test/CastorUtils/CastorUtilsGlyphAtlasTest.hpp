@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsGlyphAtlasTest___
+#define ___CUT_CastorUtilsGlyphAtlasTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsGlyphAtlasTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsGlyphAtlasTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void AddAndPublish();
+		void GrowWaitsForRefresh();
+		void EvictUnused();
+		void KeepUsed();
+	};
+}
+
+#endif
@@ -0,0 +1,266 @@
+#include "CastorUtilsImageCacheTest.hpp"
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/File.hpp>
+#include <CastorUtils/Graphics/ImageCache.hpp>
+#include <CastorUtils/Graphics/ImageLoader.hpp>
+#include <CastorUtils/Graphics/PixelBufferBase.hpp>
+#include <CastorUtils/Log/Logger.hpp>
+#include <CastorUtils/Log/LoggerInstance.hpp>
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
+#include <atomic>
+#include <cstring>
+
+namespace Testing
+{
+	namespace
+	{
+		// A minimal image format: the width and the height, followed by the RGBA8 pixels.
+		class TestImageLoader
+			: public castor::ImageLoaderImpl
+		{
+		public:
+			explicit TestImageLoader( std::atomic_uint32_t & loadCount )
+				: m_loadCount{ loadCount }
+			{
+			}
+
+			castor::ImageLayout load( castor::String const & imageFormat
+				, uint8_t const * data
+				, uint32_t size
+				, castor::PxBufferBaseUPtr & buffer )const override
+			{
+				++m_loadCount;
+				uint32_t extent[2]{};
+				std::memcpy( extent, data, sizeof( extent ) );
+				CU_Require( size >= sizeof( extent ) + extent[0] * extent[1] * 4u );
+				buffer = castor::PxBufferBase::create( castor::Size{ extent[0], extent[1] }
+					, castor::PixelFormat::eR8G8B8A8_UNORM
+					, data + sizeof( extent )
+					, castor::PixelFormat::eR8G8B8A8_UNORM );
+				return castor::ImageLayout{ *buffer };
+			}
+
+		private:
+			std::atomic_uint32_t & m_loadCount;
+		};
+
+		castor::ByteArray makeImageData( uint32_t width
+			, uint32_t height
+			, uint8_t seed )
+		{
+			castor::ByteArray result( 2u * sizeof( uint32_t ) + width * height * 4u );
+			std::memcpy( result.data(), &width, sizeof( uint32_t ) );
+			std::memcpy( result.data() + sizeof( uint32_t ), &height, sizeof( uint32_t ) );
+
+			for ( size_t i = 2u * sizeof( uint32_t ); i < result.size(); ++i )
+			{
+				result[i] = uint8_t( i * 7u + seed );
+			}
+
+			return result;
+		}
+
+		castor::ImageCreateParams makeParams( castor::ByteArray data )
+		{
+			return castor::ImageCreateParams{ cuT( "tst" ), castor::move( data ), castor::ImageLoaderConfig{} };
+		}
+
+		bool hasPixels( castor::Image const & image
+			, castor::ByteArray const & data )
+		{
+			auto pixels = data.data() + 2u * sizeof( uint32_t );
+			auto size = data.size() - 2u * sizeof( uint32_t );
+			return image.hasBuffer()
+				&& image.getPxBuffer().getSize() == size
+				&& std::memcmp( image.getPxBuffer().getConstPtr(), pixels, size ) == 0;
+		}
+
+		castor::Path prepareFolder( castor::String const & name )
+		{
+			castor::Path result{ name };
+
+			if ( castor::File::directoryExists( result ) )
+			{
+				castor::File::directoryDelete( result );
+			}
+
+			castor::File::directoryCreate( result );
+			return result;
+		}
+
+		castor::PathArray listCacheFiles( castor::Path const & folder )
+		{
+			castor::PathArray result;
+			castor::File::listDirectoryFiles( folder, result );
+			return result;
+		}
+
+		struct CacheFixture
+		{
+			CacheFixture()
+				: logger{ castor::Logger::createInstance( castor::LogType::eWarning ) }
+			{
+				loader.registerLoader( cuT( "tst" )
+					, castor::ImageLoaderPtr{ new TestImageLoader{ loadCount } } );
+			}
+
+			~CacheFixture()noexcept
+			{
+				loader.unregisterLoader( cuT( "tst" ) );
+			}
+
+			castor::Image const * load( castor::Path const & folder
+				, castor::String const & name
+				, castor::ByteArray data )
+			{
+				castor::ImageCache cache{ *logger, loader };
+				cache.setDiskCacheFolder( folder );
+				auto image = cache.add( name, makeParams( castor::move( data ) ) );
+				// The cache owns the images, hence a copy is kept.
+				result = castor::makeUnique< castor::Image >( *image );
+				return result.get();
+			}
+
+			std::atomic_uint32_t loadCount{};
+			castor::LoggerInstancePtr logger;
+			castor::ImageLoader loader;
+			castor::ImageUPtr result;
+		};
+	}
+
+	CastorUtilsImageCacheTest::CastorUtilsImageCacheTest()
+		: TestCase{ "CastorUtilsImageCacheTest" }
+	{
+	}
+
+	void CastorUtilsImageCacheTest::doRegisterTests()
+	{
+		doRegisterTest( "DiskCacheRoundTrip", std::bind( &CastorUtilsImageCacheTest::DiskCacheRoundTrip, this ) );
+		doRegisterTest( "DiskCacheRejectsCorrupt", std::bind( &CastorUtilsImageCacheTest::DiskCacheRejectsCorrupt, this ) );
+		doRegisterTest( "LoadAsync", std::bind( &CastorUtilsImageCacheTest::LoadAsync, this ) );
+	}
+
+	void CastorUtilsImageCacheTest::DiskCacheRoundTrip()
+	{
+		CacheFixture fixture;
+		auto folder = prepareFolder( cuT( "ImageCacheRoundTrip" ) );
+		auto data = makeImageData( 16u, 8u, 3u );
+
+		auto loaded = fixture.load( folder, cuT( "Image" ), data );
+		CT_EQUAL( fixture.loadCount.load(), 1u );
+		CT_CHECK( hasPixels( *loaded, data ) );
+		CT_EQUAL( listCacheFiles( folder ).size(), 1u );
+
+		// A new cache reads the image from the disk, without decoding it.
+		auto cached = fixture.load( folder, cuT( "Image" ), data );
+		CT_EQUAL( fixture.loadCount.load(), 1u );
+		CT_CHECK( hasPixels( *cached, data ) );
+		CT_EQUAL( cached->getWidth(), 16u );
+		CT_EQUAL( cached->getHeight(), 8u );
+		CT_CHECK( cached->getPixelFormat() == castor::PixelFormat::eR8G8B8A8_UNORM );
+
+		// Another content gets another entry.
+		auto other = makeImageData( 16u, 8u, 5u );
+		auto otherLoaded = fixture.load( folder, cuT( "Other" ), other );
+		CT_EQUAL( fixture.loadCount.load(), 2u );
+		CT_CHECK( hasPixels( *otherLoaded, other ) );
+		CT_EQUAL( listCacheFiles( folder ).size(), 2u );
+		castor::File::directoryDelete( folder );
+	}
+
+	void CastorUtilsImageCacheTest::DiskCacheRejectsCorrupt()
+	{
+		// The header is 12 uint32_t: magic, version, type, format, width, height, depth, layers, levels, alignment, flipped, padding, then the uint64_t data size.
+		static size_t constexpr FormatOffset = 3u * sizeof( uint32_t );
+		static size_t constexpr LevelsOffset = 8u * sizeof( uint32_t );
+		static size_t constexpr SizeOffset = 12u * sizeof( uint32_t );
+		static size_t constexpr HeaderSize = SizeOffset + sizeof( uint64_t );
+		CacheFixture fixture;
+		auto folder = prepareFolder( cuT( "ImageCacheCorrupt" ) );
+		auto data = makeImageData( 16u, 16u, 1u );
+		fixture.load( folder, cuT( "Image" ), data );
+		auto cacheFile = listCacheFiles( folder ).front();
+		castor::ByteArray content;
+		{
+			castor::BinaryFile file{ cacheFile, castor::File::OpenMode::eRead };
+			content.resize( size_t( file.getLength() ) );
+			file.readArray( content.data(), content.size() );
+		}
+		CT_REQUIRE( content.size() == HeaderSize + 16u * 16u * 4u );
+
+		auto checkRejected = [&]( castor::ByteArray const & corrupt )
+		{
+			{
+				castor::BinaryFile file{ cacheFile, castor::File::OpenMode::eWrite };
+				file.writeArray( corrupt.data(), corrupt.size() );
+			}
+			auto count = fixture.loadCount.load();
+			auto image = fixture.load( folder, cuT( "Image" ), data );
+			return fixture.loadCount == count + 1u
+				&& hasPixels( *image, data );
+		};
+
+		// A data size matching the truncated file, but too small for the layout.
+		auto truncated = castor::ByteArray( content.begin(), content.begin() + ptrdiff_t( HeaderSize + 16u ) );
+		uint64_t truncatedSize = 16u;
+		std::memcpy( truncated.data() + SizeOffset, &truncatedSize, sizeof( uint64_t ) );
+		CT_CHECK( checkRejected( truncated ) );
+
+		auto badFormat = content;
+		uint32_t format = 0xFFFFu;
+		std::memcpy( badFormat.data() + FormatOffset, &format, sizeof( uint32_t ) );
+		CT_CHECK( checkRejected( badFormat ) );
+
+		auto badLevels = content;
+		uint32_t levels = 6u;
+		std::memcpy( badLevels.data() + LevelsOffset, &levels, sizeof( uint32_t ) );
+		CT_CHECK( checkRejected( badLevels ) );
+
+		// The rejected files have been replaced by valid ones.
+		auto count = fixture.loadCount.load();
+		fixture.load( folder, cuT( "Image" ), data );
+		CT_EQUAL( fixture.loadCount.load(), count );
+		castor::File::directoryDelete( folder );
+	}
+
+	void CastorUtilsImageCacheTest::LoadAsync()
+	{
+		CacheFixture fixture;
+		castor::JobSystem jobs( 2u );
+		castor::ImageCache cache{ *fixture.logger, fixture.loader };
+		cache.setJobSystem( &jobs );
+		castor::Vector< castor::ByteArray > datas;
+		castor::Vector< castor::ImageLoadHandle > handles;
+
+		for ( uint8_t i = 0u; i < 4u; ++i )
+		{
+			datas.push_back( makeImageData( 8u, 8u, i ) );
+			handles.push_back( cache.loadAsync( cuT( "Image" ) + castor::string::toString( i )
+				, makeParams( datas.back() ) ) );
+		}
+
+		for ( uint8_t i = 0u; i < 4u; ++i )
+		{
+			auto image = handles[i].wait();
+			CT_REQUIRE( image != nullptr );
+			CT_CHECK( handles[i].isDone() );
+			CT_CHECK( hasPixels( *image, datas[i] ) );
+			CT_CHECK( cache.find( cuT( "Image" ) + castor::string::toString( i ) ) == image );
+		}
+
+		CT_EQUAL( fixture.loadCount.load(), 4u );
+
+		// An image already in the cache is not loaded again.
+		auto again = cache.loadAsync( cuT( "Image0" ), makeParams( datas.front() ) );
+		CT_CHECK( again.wait() == handles.front().wait() );
+		CT_EQUAL( fixture.loadCount.load(), 4u );
+
+		// The loading errors are given back to the waiting thread.
+		auto failed = cache.loadAsync( cuT( "Failed" )
+			, castor::ImageCreateParams{ cuT( "unknown" ), datas.front(), castor::ImageLoaderConfig{} } );
+		CT_CHECK_THROW( failed.wait() );
+		CT_CHECK( !cache.has( cuT( "Failed" ) ) );
+	}
+}
@@ -0,0 +1,25 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsImageCacheTest___
+#define ___CUT_CastorUtilsImageCacheTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsImageCacheTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsImageCacheTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void DiskCacheRoundTrip();
+		void DiskCacheRejectsCorrupt();
+		void LoadAsync();
+	};
+}
+
+#endif
@@ -0,0 +1,191 @@
+#include "CastorUtilsJobSystemTest.hpp"
+
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+namespace Testing
+{
+	CastorUtilsJobSystemTest::CastorUtilsJobSystemTest()
+		: TestCase( "CastorUtilsJobSystemTest" )
+	{
+	}
+
+	void CastorUtilsJobSystemTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsJobSystemTest::ManyJobs", std::bind( &CastorUtilsJobSystemTest::ManyJobs, this ) );
+		doRegisterTest( "CastorUtilsJobSystemTest::Continuations", std::bind( &CastorUtilsJobSystemTest::Continuations, this ) );
+		doRegisterTest( "CastorUtilsJobSystemTest::NestedJobs", std::bind( &CastorUtilsJobSystemTest::NestedJobs, this ) );
+		doRegisterTest( "CastorUtilsJobSystemTest::ParallelFor", std::bind( &CastorUtilsJobSystemTest::ParallelFor, this ) );
+		doRegisterTest( "CastorUtilsJobSystemTest::ParallelForException", std::bind( &CastorUtilsJobSystemTest::ParallelForException, this ) );
+	}
+
+	void CastorUtilsJobSystemTest::ManyJobs()
+	{
+		static constexpr int count = 10000;
+		castor::JobSystem jobs( 4u );
+		std::atomic_int value{ 0 };
+
+		for ( int i = 0; i < count; ++i )
+		{
+			jobs.pushJob( [&value]()
+				{
+					++value;
+				} );
+		}
+
+		CT_CHECK( jobs.waitAll( std::chrono::milliseconds( 0xFFFFFFFF ) ) );
+		CT_CHECK( jobs.getPendingCount() == 0u );
+		CT_CHECK( value == count );
+	}
+
+	void CastorUtilsJobSystemTest::Continuations()
+	{
+		castor::JobSystem jobs( 4u );
+		castor::Vector< int > order;
+		castor::Mutex mutex;
+		auto push = [&order, &mutex]( int value )
+		{
+			auto lock( castor::makeUniqueLock( mutex ) );
+			order.push_back( value );
+		};
+
+		auto first = jobs.pushJob( [&push]()
+			{
+				std::this_thread::sleep_for( 10_ms );
+				push( 0 );
+			} );
+		auto second = jobs.pushJob( [&push]()
+			{
+				push( 1 );
+			} );
+		auto third = jobs.pushJob( { first, second }, [&push]()
+			{
+				push( 2 );
+			} );
+		auto fourth = jobs.then( third, [&push]()
+			{
+				push( 3 );
+			} );
+		jobs.wait( fourth );
+
+		CT_CHECK( first.isDone() );
+		CT_CHECK( second.isDone() );
+		CT_CHECK( third.isDone() );
+		CT_CHECK( fourth.isDone() );
+		CT_REQUIRE( order.size() == 4u );
+		CT_CHECK( order[2] == 2 );
+		CT_CHECK( order[3] == 3 );
+
+		// Continuation on an already finished job.
+		auto fifth = jobs.then( first, [&push]()
+			{
+				push( 4 );
+			} );
+		jobs.wait( fifth );
+		CT_CHECK( order.size() == 5u );
+	}
+
+	void CastorUtilsJobSystemTest::NestedJobs()
+	{
+		static constexpr int count = 64;
+		castor::JobSystem jobs( 2u );
+		std::atomic_int value{ 0 };
+
+		auto root = jobs.pushJob( [&jobs, &value]()
+			{
+				castor::Vector< castor::JobHandle > children;
+
+				for ( int i = 0; i < count; ++i )
+				{
+					children.push_back( jobs.pushJob( [&value]()
+						{
+							++value;
+						} ) );
+				}
+
+				// Waiting from a worker thread must not dead lock.
+				for ( auto & child : children )
+				{
+					jobs.wait( child );
+				}
+			} );
+		jobs.wait( root );
+
+		CT_CHECK( value == count );
+	}
+
+	void CastorUtilsJobSystemTest::ParallelFor()
+	{
+		static constexpr size_t count = 100000u;
+		castor::JobSystem jobs( 4u );
+		castor::Vector< uint32_t > data( count, 0u );
+
+		jobs.parallelFor( count
+			, [&data]( size_t begin, size_t end )
+			{
+				for ( auto i = begin; i < end; ++i )
+				{
+					data[i] += uint32_t( i );
+				}
+			} );
+
+		bool valid = true;
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			valid = valid && data[i] == uint32_t( i );
+		}
+
+		CT_CHECK( valid );
+	}
+
+	void CastorUtilsJobSystemTest::ParallelForException()
+	{
+		static constexpr size_t count = 1000u;
+		castor::JobSystem jobs( 4u );
+		auto caller = std::this_thread::get_id();
+		std::atomic_size_t processed{};
+
+		// The errors thrown from the worker threads reach the calling thread.
+		CT_CHECK_THROW( jobs.parallelFor( count
+			, [&processed, caller]( size_t begin, size_t end )
+			{
+				std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+
+				if ( std::this_thread::get_id() != caller )
+				{
+					throw std::runtime_error{ "Worker error" };
+				}
+
+				processed += end - begin;
+			}
+			, 10u ) );
+		CT_CHECK( processed < count );
+
+		// And the ones thrown from the calling thread too.
+		CT_CHECK_THROW( jobs.parallelFor( count
+			, [caller]( size_t, size_t )
+			{
+				std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+
+				if ( std::this_thread::get_id() == caller )
+				{
+					throw std::runtime_error{ "Caller error" };
+				}
+			}
+			, 10u ) );
+
+		// The job system is still usable afterwards.
+		processed = 0u;
+		jobs.parallelFor( count
+			, [&processed]( size_t begin, size_t end )
+			{
+				processed += end - begin;
+			}
+			, 10u );
+		CT_EQUAL( processed.load(), count );
+	}
+}
@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_JobSystemTest_H___
+#define ___CUT_JobSystemTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsJobSystemTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsJobSystemTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void ManyJobs();
+		void Continuations();
+		void NestedJobs();
+		void ParallelFor();
+		void ParallelForException();
+	};
+}
+
+#endif
@@ -0,0 +1,262 @@
+#include "CastorUtilsLoggerTest.hpp"
+
+#include <CastorUtils/Data/File.hpp>
+#include <CastorUtils/Log/Logger.hpp>
+#include <CastorUtils/Log/LoggerInstance.hpp>
+#include <CastorUtils/Multithreading/MpscRingBuffer.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr ProducerCount = 4u;
+	}
+
+	CastorUtilsLoggerTest::CastorUtilsLoggerTest()
+		: TestCase( "CastorUtilsLoggerTest" )
+	{
+	}
+
+	void CastorUtilsLoggerTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsLoggerTest::RingBufferCapacity", std::bind( &CastorUtilsLoggerTest::RingBufferCapacity, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::RingBufferConcurrentPush", std::bind( &CastorUtilsLoggerTest::RingBufferConcurrentPush, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::OrderedDelivery", std::bind( &CastorUtilsLoggerTest::OrderedDelivery, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::DeferredFormatting", std::bind( &CastorUtilsLoggerTest::DeferredFormatting, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::DropPolicy", std::bind( &CastorUtilsLoggerTest::DropPolicy, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::BlockPolicy", std::bind( &CastorUtilsLoggerTest::BlockPolicy, this ) );
+	}
+
+	void CastorUtilsLoggerTest::RingBufferCapacity()
+	{
+		castor::MpscRingBufferT< uint32_t > ring{ 100u };
+		CT_EQUAL( ring.capacity(), 128u );
+		CT_CHECK( ring.empty() );
+		uint32_t value{};
+
+		for ( uint32_t i = 0u; i < ring.capacity(); ++i )
+		{
+			value = i;
+			CT_CHECK( ring.tryPush( value ) );
+		}
+
+		value = 1000u;
+		CT_CHECK( !ring.tryPush( value ) );
+		CT_EQUAL( value, 1000u );
+		CT_EQUAL( ring.size(), ring.capacity() );
+
+		for ( uint32_t i = 0u; i < ring.capacity(); ++i )
+		{
+			CT_CHECK( ring.tryPop( value ) );
+			CT_EQUAL( value, i );
+		}
+
+		CT_CHECK( !ring.tryPop( value ) );
+		CT_CHECK( ring.empty() );
+	}
+
+	void CastorUtilsLoggerTest::RingBufferConcurrentPush()
+	{
+		static uint32_t constexpr count = 100000u;
+		castor::MpscRingBufferT< uint64_t > ring{ 256u };
+		castor::Vector< std::thread > producers;
+
+		for ( uint32_t producer = 0u; producer < ProducerCount; ++producer )
+		{
+			producers.emplace_back( [&ring, producer]()
+				{
+					for ( uint32_t i = 0u; i < count; ++i )
+					{
+						uint64_t value = ( uint64_t( producer ) << 32u ) | i;
+
+						while ( !ring.tryPush( value ) )
+						{
+							std::this_thread::yield();
+						}
+					}
+				} );
+		}
+
+		castor::Array< uint32_t, ProducerCount > next{};
+		uint32_t popped{};
+		bool ordered{ true };
+		uint64_t value{};
+
+		while ( popped < ProducerCount * count )
+		{
+			if ( ring.tryPop( value ) )
+			{
+				auto producer = uint32_t( value >> 32u );
+				ordered = ordered && ( uint32_t( value ) == next[producer] );
+				++next[producer];
+				++popped;
+			}
+		}
+
+		for ( auto & producer : producers )
+		{
+			producer.join();
+		}
+
+		CT_CHECK( ordered );
+		CT_CHECK( ring.empty() );
+	}
+
+	void CastorUtilsLoggerTest::OrderedDelivery()
+	{
+		static uint32_t constexpr count = 250u;
+		auto logger = castor::Logger::createInstance( castor::LogType::eTrace );
+		castor::Vector< castor::MbString > received;
+		castor::Mutex mutex;
+		logger->registerCallback( [&received, &mutex]( castor::MbString const & text, castor::LogType, bool )
+			{
+				auto lock( castor::makeUniqueLock( mutex ) );
+				received.push_back( text );
+			}
+			, this );
+		logger->setFileName( castor::File::getExecutableDirectory() / cuT( "LoggerTest.log" ) );
+		castor::Vector< std::thread > producers;
+
+		for ( uint32_t producer = 0u; producer < ProducerCount; ++producer )
+		{
+			producers.emplace_back( [&logger, producer]()
+				{
+					for ( uint32_t i = 0u; i < count; ++i )
+					{
+						logger->logTrace( std::to_string( producer ) + " " + std::to_string( i ) );
+					}
+				} );
+		}
+
+		for ( auto & producer : producers )
+		{
+			producer.join();
+		}
+
+		logger->flushQueue();
+		CT_EQUAL( logger->getQueueDepth(), 0u );
+		CT_EQUAL( logger->getDroppedCount(), 0u );
+		auto lock( castor::makeUniqueLock( mutex ) );
+		CT_EQUAL( received.size(), ProducerCount * count );
+		castor::Array< uint32_t, ProducerCount > next{};
+		bool ordered{ true };
+
+		for ( auto & text : received )
+		{
+			auto split = text.find( ' ' );
+			auto producer = uint32_t( std::stoul( text.substr( 0u, split ) ) );
+			ordered = ordered && ( uint32_t( std::stoul( text.substr( split + 1u ) ) ) == next[producer] );
+			++next[producer];
+		}
+
+		CT_CHECK( ordered );
+		logger->unregisterCallback( this );
+	}
+
+	void CastorUtilsLoggerTest::DeferredFormatting()
+	{
+		auto logger = castor::Logger::createInstance( castor::LogType::eWarning );
+		castor::Vector< castor::MbString > received;
+		castor::Mutex mutex;
+		logger->registerCallback( [&received, &mutex]( castor::MbString const & text, castor::LogType, bool )
+			{
+				auto lock( castor::makeUniqueLock( mutex ) );
+				received.push_back( text );
+			}
+			, this );
+		logger->setFileName( castor::File::getExecutableDirectory() / cuT( "LoggerTest.log" ) );
+		std::atomic_bool filteredCalled{ false };
+		logger->pushDeferredMessage( castor::LogType::eDebug
+			, [&filteredCalled]()
+			{
+				filteredCalled = true;
+				return castor::MbString{ "Filtered" };
+			} );
+		logger->pushDeferredMessage( castor::LogType::eWarning
+			, []()
+			{
+				return castor::MbString{ "Deferred" };
+			} );
+		logger->flushQueue();
+		CT_CHECK( !filteredCalled );
+		auto lock( castor::makeUniqueLock( mutex ) );
+		CT_EQUAL( received.size(), 1u );
+		CT_CHECK( !received.empty() && received.front() == "Deferred" );
+		logger->unregisterCallback( this );
+	}
+
+	void CastorUtilsLoggerTest::DropPolicy()
+	{
+		auto logger = castor::Logger::createInstance( castor::LogType::eTrace );
+		logger->setOverflowPolicy( castor::LogOverflowPolicy::eDrop );
+		// Whether the writer thread keeps up or not, each message is either delivered or counted as dropped.
+		auto pushed = uint32_t( logger->getQueueCapacity() * 4u );
+		std::atomic_uint32_t delivered{};
+		logger->registerCallback( [&delivered]( castor::MbString const &, castor::LogType, bool )
+			{
+				++delivered;
+			}
+			, this );
+
+		for ( uint32_t i = 0u; i < pushed; ++i )
+		{
+			logger->pushDeferredMessage( castor::LogType::eTrace
+				, []()
+				{
+					return castor::MbString{ "Dropped ?" };
+				} );
+		}
+
+		CT_CHECK( logger->getQueueDepth() <= logger->getQueueCapacity() );
+		logger->setFileName( castor::File::getExecutableDirectory() / cuT( "LoggerTest.log" ) );
+		logger->flushQueue();
+		CT_EQUAL( logger->getQueueDepth(), 0u );
+		CT_EQUAL( delivered + logger->getDroppedCount(), pushed );
+		logger->unregisterCallback( this );
+	}
+
+	void CastorUtilsLoggerTest::BlockPolicy()
+	{
+		auto logger = castor::Logger::createInstance( castor::LogType::eTrace );
+		logger->setOverflowPolicy( castor::LogOverflowPolicy::eBlock );
+		logger->setFileName( castor::File::getExecutableDirectory() / cuT( "LoggerTest.log" ) );
+		// Several times the queue capacity, the producers wait for the writer thread instead of dropping messages.
+		auto count = uint32_t( logger->getQueueCapacity() );
+		std::atomic_uint32_t delivered{};
+		logger->registerCallback( [&delivered]( castor::MbString const &, castor::LogType, bool )
+			{
+				++delivered;
+			}
+			, this );
+		castor::Vector< std::thread > producers;
+
+		for ( uint32_t producer = 0u; producer < ProducerCount; ++producer )
+		{
+			producers.emplace_back( [&logger, count]()
+				{
+					for ( uint32_t i = 0u; i < count; ++i )
+					{
+						logger->pushDeferredMessage( castor::LogType::eTrace
+							, []()
+							{
+								return castor::MbString{ "Blocked" };
+							} );
+					}
+				} );
+		}
+
+		for ( auto & producer : producers )
+		{
+			producer.join();
+		}
+
+		logger->flushQueue();
+		CT_EQUAL( logger->getQueueDepth(), 0u );
+		CT_EQUAL( logger->getDroppedCount(), 0u );
+		CT_EQUAL( delivered.load(), ProducerCount * count );
+		logger->unregisterCallback( this );
+	}
+}
@@ -0,0 +1,28 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_LoggerTest_H___
+#define ___CUT_LoggerTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsLoggerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsLoggerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void RingBufferCapacity();
+		void RingBufferConcurrentPush();
+		void OrderedDelivery();
+		void DeferredFormatting();
+		void DropPolicy();
+		void BlockPolicy();
+	};
+}
+
+#endif
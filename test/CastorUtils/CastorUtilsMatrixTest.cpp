@@ -35,6 +35,76 @@ namespace Testing
 
 	//*********************************************************************************************
 
+	namespace
+	{
+		static uint32_t constexpr BatchSize = 1024u;
+
+		// Plain scalar versions, used as references for the float SIMD paths.
+		void multiplyScalar( Matrix4x4f const & lhs
+			, Matrix4x4f const & rhs
+			, Matrix4x4f & result )
+		{
+			for ( uint32_t col = 0u; col < 4u; ++col )
+			{
+				for ( uint32_t row = 0u; row < 4u; ++row )
+				{
+					result[col][row] = lhs[0][row] * rhs[col][0]
+						+ lhs[1][row] * rhs[col][1]
+						+ lhs[2][row] * rhs[col][2]
+						+ lhs[3][row] * rhs[col][3];
+				}
+			}
+		}
+
+		void transposeScalar( Matrix4x4f & matrix )
+		{
+			for ( uint32_t col = 0u; col < 4u; ++col )
+			{
+				for ( uint32_t row = col + 1u; row < 4u; ++row )
+				{
+					std::swap( matrix[col][row], matrix[row][col] );
+				}
+			}
+		}
+
+		Point3f transformScalar( Matrix4x4f const & matrix
+			, Point3f const & point )
+		{
+			Point4f result;
+
+			for ( uint32_t row = 0u; row < 4u; ++row )
+			{
+				result[row] = matrix[0][row] * point[0]
+					+ matrix[1][row] * point[1]
+					+ matrix[2][row] * point[2]
+					+ matrix[3][row];
+			}
+
+			return Point3f{ result[0] / result[3], result[1] / result[3], result[2] / result[3] };
+		}
+
+		Matrix4x4f randomTransform()
+		{
+			Point3f position;
+			randomInit( position.ptr(), 3u );
+			Point3f scale;
+			randomInit( scale.ptr(), 3u );
+			scale += Point3f{ 0.5f, 0.5f, 0.5f };
+			Point3f axis;
+			randomInit( axis.ptr(), 3u );
+			float degrees;
+			randomInit( &degrees, 1u );
+			Matrix4x4f result;
+			matrix::setTransform( result
+				, position
+				, scale
+				, Quaternion::fromAxisAngle( axis, Angle::fromDegrees( degrees * 360.0f ) ) );
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
 	CastorUtilsMatrixTest::CastorUtilsMatrixTest()
 		: TestCase( "CastorUtilsMatrixTest" )
 	{
@@ -44,6 +114,10 @@ namespace Testing
 	{
 		doRegisterTest( "MatrixInversion", std::bind( &CastorUtilsMatrixTest::MatrixInversion, this ) );
 		doRegisterTest( "TransformDecompose", std::bind( &CastorUtilsMatrixTest::TransformDecompose, this ) );
+		doRegisterTest( "MatrixMultiplicationFloat", std::bind( &CastorUtilsMatrixTest::MatrixMultiplicationFloat, this ) );
+		doRegisterTest( "MatrixInversionFloat", std::bind( &CastorUtilsMatrixTest::MatrixInversionFloat, this ) );
+		doRegisterTest( "MatrixTransposeFloat", std::bind( &CastorUtilsMatrixTest::MatrixTransposeFloat, this ) );
+		doRegisterTest( "PointTransformFloat", std::bind( &CastorUtilsMatrixTest::PointTransformFloat, this ) );
 
 #if defined( CASTOR_USE_GLM )
 
@@ -181,6 +255,75 @@ namespace Testing
 
 	}
 
+	void CastorUtilsMatrixTest::MatrixMultiplicationFloat()
+	{
+		for ( int i = 0; i < 100; ++i )
+		{
+			Matrix4x4f lhs;
+			randomInit( lhs.ptr(), 16u );
+			Matrix4x4f rhs;
+			randomInit( rhs.ptr(), 16u );
+			Matrix4x4f reference;
+			multiplyScalar( lhs, rhs, reference );
+			CT_EQUAL( lhs * rhs, reference );
+			CT_EQUAL( Matrix4x4f{ Matrix4x4d{ lhs } * Matrix4x4d{ rhs } }, reference );
+			// The operands can be the result.
+			Matrix4x4f result{ lhs };
+			result *= rhs;
+			CT_EQUAL( result, reference );
+			multiplyScalar( lhs, lhs, reference );
+			lhs *= lhs;
+			CT_EQUAL( lhs, reference );
+		}
+	}
+
+	void CastorUtilsMatrixTest::MatrixInversionFloat()
+	{
+		Matrix4x4f identity{ 1.0f };
+
+		for ( int i = 0; i < 100; ++i )
+		{
+			auto transform = randomTransform();
+			Matrix4x4f inverse{ transform.getInverse() };
+			CT_EQUAL( inverse, Matrix4x4f{ Matrix4x4d{ transform }.getInverse() } );
+			CT_EQUAL( transform * inverse, identity );
+			transform.invert();
+			CT_EQUAL( transform, inverse );
+		}
+	}
+
+	void CastorUtilsMatrixTest::MatrixTransposeFloat()
+	{
+		for ( int i = 0; i < 100; ++i )
+		{
+			Matrix4x4f matrix;
+			randomInit( matrix.ptr(), 16u );
+			Matrix4x4f reference{ matrix };
+			transposeScalar( reference );
+			CT_EQUAL( matrix.getTransposed(), reference );
+			matrix.transpose();
+			CT_EQUAL( matrix, reference );
+		}
+	}
+
+	void CastorUtilsMatrixTest::PointTransformFloat()
+	{
+		for ( int i = 0; i < 100; ++i )
+		{
+			auto transform = randomTransform();
+			Point3f point;
+			randomInit( point.ptr(), 3u );
+			CT_EQUAL( matrix::getTransformed( transform, point ), transformScalar( transform, point ) );
+			Point4f result = transform * Point4f{ point[0], point[1], point[2], 1.0f };
+			CT_EQUAL( Point3f( result[0], result[1], result[2] ), transformScalar( transform, point ) );
+			Point4f sum = result + Point4f{ 1.0f, 2.0f, 3.0f, 4.0f };
+			sum *= 2.0f;
+			sum -= result;
+			CT_EQUAL( Point3f( sum[0], sum[1], sum[2] ), Point3f( result[0] + 2.0f, result[1] + 4.0f, result[2] + 6.0f ) );
+			CT_CHECK( std::abs( sum[3] - ( result[3] + 8.0f ) ) < 0.001f );
+		}
+	}
+
 #if defined( CASTOR_USE_GLM )
 
 	void CastorUtilsMatrixTest::MatrixInversionComparison()
@@ -366,6 +509,16 @@ namespace Testing
 		m_mtx1glm[3][3] = 1.0f;
 		randomInit( m_mtx2.ptr(), &m_mtx2glm[0][0], 16 );
 #endif
+		m_batch.resize( BatchSize );
+		m_batchResult.resize( BatchSize );
+		m_points.resize( BatchSize );
+		m_pointsResult.resize( BatchSize );
+
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_batch[i] = randomTransform();
+			randomInit( m_points[i].ptr(), 3u );
+		}
 	}
 
 	void CastorUtilsMatrixBench::Execute()
@@ -382,6 +535,14 @@ namespace Testing
 #if defined( CASTOR_USE_GLM )
 		BENCHMARK( MatrixCopyGlm, NB_TESTS );
 #endif
+		// Batches of BatchSize operations, so that the call overhead doesn't hide the computations.
+		BENCHMARK( MatrixBatchMultiplicationsScalar, NB_TESTS / BatchSize );
+		BENCHMARK( MatrixBatchMultiplicationsCastor, NB_TESTS / BatchSize );
+		BENCHMARK( MatrixBatchInversionCastor, NB_TESTS / BatchSize );
+		BENCHMARK( MatrixBatchTransposeScalar, NB_TESTS / BatchSize );
+		BENCHMARK( MatrixBatchTransposeCastor, NB_TESTS / BatchSize );
+		BENCHMARK( PointBatchTransformScalar, NB_TESTS / BatchSize );
+		BENCHMARK( PointBatchTransformCastor, NB_TESTS / BatchSize );
 	}
 
 	void CastorUtilsMatrixBench::MatrixMultiplicationsCastor()
@@ -399,6 +560,76 @@ namespace Testing
 		doNotOptimizeAway( m_mtx2 = m_mtx1 );
 	}
 
+	void CastorUtilsMatrixBench::MatrixBatchMultiplicationsScalar()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			multiplyScalar( m_mtx1, m_batch[i], m_batchResult[i] );
+		}
+
+		doNotOptimizeAway( m_batchResult );
+	}
+
+	void CastorUtilsMatrixBench::MatrixBatchMultiplicationsCastor()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_batchResult[i] = m_mtx1 * m_batch[i];
+		}
+
+		doNotOptimizeAway( m_batchResult );
+	}
+
+	void CastorUtilsMatrixBench::MatrixBatchInversionCastor()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_batchResult[i] = m_batch[i].getInverse();
+		}
+
+		doNotOptimizeAway( m_batchResult );
+	}
+
+	void CastorUtilsMatrixBench::MatrixBatchTransposeScalar()
+	{
+		for ( auto & matrix : m_batch )
+		{
+			transposeScalar( matrix );
+		}
+
+		doNotOptimizeAway( m_batch );
+	}
+
+	void CastorUtilsMatrixBench::MatrixBatchTransposeCastor()
+	{
+		for ( auto & matrix : m_batch )
+		{
+			matrix.transpose();
+		}
+
+		doNotOptimizeAway( m_batch );
+	}
+
+	void CastorUtilsMatrixBench::PointBatchTransformScalar()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_pointsResult[i] = transformScalar( m_mtx1, m_points[i] );
+		}
+
+		doNotOptimizeAway( m_pointsResult );
+	}
+
+	void CastorUtilsMatrixBench::PointBatchTransformCastor()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_pointsResult[i] = matrix::getTransformed( m_mtx1, m_points[i] );
+		}
+
+		doNotOptimizeAway( m_pointsResult );
+	}
+
 #if defined( CASTOR_USE_GLM )
 
 	void CastorUtilsMatrixBench::MatrixMultiplicationsGlm()
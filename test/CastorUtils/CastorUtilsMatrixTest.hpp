@@ -43,6 +43,10 @@ namespace Testing
 	private:
 		void MatrixInversion();
 		void TransformDecompose();
+		void MatrixMultiplicationFloat();
+		void MatrixInversionFloat();
+		void MatrixTransposeFloat();
+		void PointTransformFloat();
 
 #if defined( CASTOR_USE_GLM )
 
@@ -76,10 +80,22 @@ namespace Testing
 		void MatrixInversionGlm();
 		void MatrixCopyCastor();
 		void MatrixCopyGlm();
+		void MatrixBatchMultiplicationsScalar();
+		void MatrixBatchMultiplicationsCastor();
+		void MatrixBatchInversionScalar();
+		void MatrixBatchInversionCastor();
+		void MatrixBatchTransposeScalar();
+		void MatrixBatchTransposeCastor();
+		void PointBatchTransformScalar();
+		void PointBatchTransformCastor();
 
 	private:
 		castor::Matrix4x4f m_mtx1;
 		castor::Matrix4x4f m_mtx2;
+		castor::Vector< castor::Matrix4x4f > m_batch;
+		castor::Vector< castor::Matrix4x4f > m_batchResult;
+		castor::Vector< castor::Point3f > m_points;
+		castor::Vector< castor::Point3f > m_pointsResult;
 
 #if defined( CASTOR_USE_GLM )
 
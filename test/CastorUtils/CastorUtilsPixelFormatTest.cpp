@@ -1,6 +1,10 @@
 #include "CastorUtilsPixelFormatTest.hpp"
 
 #include <CastorUtils/Graphics/PixelBuffer.hpp>
+#include <CastorUtils/Multithreading/JobSystem.hpp>
+
+#include <atomic>
+#include <random>
 
 namespace
 {
@@ -430,6 +434,109 @@ namespace
 	{
 		BufferConversionChecker< PF >()();
 	}
+
+	template< castor::PixelFormat PF >
+	castor::ByteArray createRandomPixels( size_t count )
+	{
+		std::mt19937 rng{ uint32_t( count ) };
+		castor::ByteArray result( count * getBytesPerPixel( PF ) );
+
+		if constexpr ( castor::is32FComponentsV< PF > )
+		{
+			std::uniform_real_distribution< float > distribution{ -1.0f, 1.0f };
+			auto data = reinterpret_cast< float * >( result.data() );
+
+			for ( size_t i = 0u; i < result.size() / sizeof( float ); ++i )
+			{
+				data[i] = distribution( rng );
+			}
+		}
+		else
+		{
+			for ( auto & value : result )
+			{
+				value = uint8_t( rng() );
+			}
+		}
+
+		return result;
+	}
+
+	template< castor::PixelFormat PFSrc, castor::PixelFormat PFDst >
+	bool checkRowConversion( size_t count )
+	{
+		static_assert( castor::details::RowConverter< PFSrc, PFDst >::Specialised );
+		auto src = createRandomPixels< PFSrc >( count );
+		castor::ByteArray expected( count * getBytesPerPixel( PFDst ) );
+		castor::ByteArray result( expected.size() );
+		uint8_t const * srcBuffer = src.data();
+		uint8_t * dstBuffer = expected.data();
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			castor::details::PixelConverter< PFSrc, PFDst >()( srcBuffer, dstBuffer );
+		}
+
+		castor::details::RowConverter< PFSrc, PFDst >()( src.data(), result.data(), count );
+		return result == expected;
+	}
+
+	template< castor::PixelFormat PFSrc, castor::PixelFormat PFDst >
+	bool checkParallelConversion( castor::PxBufferConvertOptions const & options )
+	{
+		castor::Size size{ 1024u, 513u };
+		auto src = createRandomPixels< PFSrc >( size_t( size.getWidth() ) * size.getHeight() );
+		castor::ByteArray expected( size_t( size.getWidth() ) * size.getHeight() * getBytesPerPixel( PFDst ) );
+		castor::ByteArray result( expected.size() );
+		castor::convertBuffer( nullptr, size, size
+			, PFSrc, src.data(), uint32_t( src.size() )
+			, PFDst, expected.data(), uint32_t( expected.size() ) );
+		castor::convertBuffer( &options, size, size
+			, PFSrc, src.data(), uint32_t( src.size() )
+			, PFDst, result.data(), uint32_t( result.size() ) );
+		return result == expected;
+	}
+
+	template< castor::PixelFormat PFSrc >
+	bool checkParallelCompression( castor::PxBufferConvertOptions & options
+		, castor::PixelFormat dstFormat )
+	{
+		// Not a multiple of the blocks size, and several tiles of blocks.
+		castor::Size size{ 257u, 131u };
+		auto blockCount = ( ( size.getWidth() + 3u ) / 4u ) * ( ( size.getHeight() + 3u ) / 4u );
+		// Room for the blocks added to reach a multiple of the parallel blocks count.
+		auto alignedCount = ( blockCount + 63u ) & ~63u;
+		auto src = createRandomPixels< PFSrc >( size_t( size.getWidth() ) * size.getHeight() );
+		castor::ByteArray expected( size_t( alignedCount ) * getBytesPerPixel( dstFormat ) );
+		castor::ByteArray result( expected.size() );
+		auto jobs = options.jobs;
+		options.jobs = nullptr;
+		castor::compressBuffer( &options, nullptr, size, size
+			, PFSrc, src.data(), uint32_t( src.size() )
+			, dstFormat, expected.data(), uint32_t( expected.size() ) );
+		options.jobs = jobs;
+		std::atomic_uint32_t done{};
+		std::atomic_uint32_t total{};
+		options.progress = [&done, &total]( uint32_t tileDone, uint32_t tileTotal )
+		{
+			// The tiles may end in any order.
+			auto current = done.load();
+
+			while ( current < tileDone
+				&& !done.compare_exchange_weak( current, tileDone ) )
+			{
+			}
+
+			total = tileTotal;
+		};
+		castor::compressBuffer( &options, nullptr, size, size
+			, PFSrc, src.data(), uint32_t( src.size() )
+			, dstFormat, result.data(), uint32_t( result.size() ) );
+		options.progress = {};
+		// The fallback compressors don't report their progress.
+		return result == expected
+			&& ( total == 0u || ( total == blockCount && done == blockCount ) );
+	}
 }
 
 namespace Testing
@@ -443,6 +550,9 @@ namespace Testing
 	{
 		doRegisterTest( "TestPixelConversions", [this](){ TestPixelConversions(); } );
 		doRegisterTest( "TestBufferConversions", [this](){ TestBufferConversions(); } );
+		doRegisterTest( "TestRowConversions", [this](){ TestRowConversions(); } );
+		doRegisterTest( "TestParallelBufferConversions", [this](){ TestParallelBufferConversions(); } );
+		doRegisterTest( "TestParallelBufferCompressions", [this](){ TestParallelBufferCompressions(); } );
 	}
 
 	void CastorUtilsPixelFormatTest::TestPixelConversions()
@@ -480,4 +590,51 @@ namespace Testing
 		CheckBufferConversions< castor::PixelFormat::eD24_UNORM_S8_UINT >();
 		CheckBufferConversions< castor::PixelFormat::eS8_UINT >();
 	}
+	void CastorUtilsPixelFormatTest::TestRowConversions()
+	{
+		using castor::PixelFormat;
+
+		// Counts not aligned on the kernels widths.
+		for ( size_t count : { 1u, 3u, 4u, 5u, 16u, 17u, 1001u } )
+		{
+			CT_ON( std::to_string( count ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR8G8B8_UNORM, PixelFormat::eR8G8B8A8_UNORM >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR8G8B8A8_UNORM, PixelFormat::eR8G8B8_UNORM >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eB8G8R8A8_UNORM, PixelFormat::eR8G8B8A8_UNORM >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR8G8B8A8_UNORM, PixelFormat::eB8G8R8A8_UNORM >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eB8G8R8_UNORM, PixelFormat::eR8G8B8A8_SRGB >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR8G8B8A8_SRGB, PixelFormat::eR8G8B8A8_UNORM >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR8_UNORM, PixelFormat::eR8G8B8A8_UNORM >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR8G8B8A8_UNORM, PixelFormat::eR8_UNORM >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR32_SFLOAT, PixelFormat::eR16G16B16A16_SFLOAT >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR32G32B32A32_SFLOAT, PixelFormat::eR16G16B16A16_SFLOAT >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR16G16B16A16_SFLOAT, PixelFormat::eR32_SFLOAT >( count ) ) );
+			CT_CHECK( ( checkRowConversion< PixelFormat::eR16G16B16A16_SFLOAT, PixelFormat::eR32G32B32A32_SFLOAT >( count ) ) );
+		}
+	}
+
+	void CastorUtilsPixelFormatTest::TestParallelBufferConversions()
+	{
+		using castor::PixelFormat;
+		castor::JobSystem jobs{ 4u };
+		castor::PxBufferConvertOptions options{ castor::PxCompressionSupport{} };
+		options.jobs = &jobs;
+		CT_CHECK( ( checkParallelConversion< PixelFormat::eR8G8B8_UNORM, PixelFormat::eR8G8B8A8_UNORM >( options ) ) );
+		CT_CHECK( ( checkParallelConversion< PixelFormat::eR32G32B32A32_SFLOAT, PixelFormat::eR16G16B16A16_SFLOAT >( options ) ) );
+		// Not handled by a row kernel.
+		CT_CHECK( ( checkParallelConversion< PixelFormat::eR8G8B8_UNORM, PixelFormat::eR32G32B32A32_SFLOAT >( options ) ) );
+	}
+
+	void CastorUtilsPixelFormatTest::TestParallelBufferCompressions()
+	{
+		using castor::PixelFormat;
+		castor::JobSystem jobs{ 4u };
+		castor::PxBufferConvertOptions options{ castor::PxCompressionSupport{ true, true, true, true, true } };
+		options.jobs = &jobs;
+		CT_CHECK( checkParallelCompression< PixelFormat::eR8G8B8A8_UNORM >( options, PixelFormat::eBC1_RGBA_UNORM_BLOCK ) );
+		CT_CHECK( checkParallelCompression< PixelFormat::eR8G8B8A8_UNORM >( options, PixelFormat::eBC3_UNORM_BLOCK ) );
+		CT_CHECK( checkParallelCompression< PixelFormat::eR8G8B8A8_UNORM >( options, PixelFormat::eBC7_UNORM_BLOCK ) );
+		CT_CHECK( checkParallelCompression< PixelFormat::eR8G8_UNORM >( options, PixelFormat::eBC5_UNORM_BLOCK ) );
+		CT_CHECK( checkParallelCompression< PixelFormat::eR32G32B32A32_SFLOAT >( options, PixelFormat::eBC6H_SFLOAT_BLOCK ) );
+	}
 }
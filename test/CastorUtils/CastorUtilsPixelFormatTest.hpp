@@ -18,6 +18,9 @@ namespace Testing
 	private:
 		void TestPixelConversions();
 		void TestBufferConversions();
+		void TestRowConversions();
+		void TestParallelBufferConversions();
+		void TestParallelBufferCompressions();
 	};
 }
 
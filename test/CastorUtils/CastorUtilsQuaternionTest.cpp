@@ -26,10 +26,44 @@ namespace Testing
 	using castor::Point4f;
 	using castor::Point4d;
 	using Quaternion = castor::QuaternionT< float >;
+	using Quaterniond = castor::QuaternionT< double >;
 	using castor::StringStream;
 
 	//*********************************************************************************************
 
+	namespace
+	{
+		static uint32_t constexpr BatchSize = 1024u;
+
+		Quaternion randomQuaternion()
+		{
+			Point3f axis;
+			randomInit( axis.ptr(), 3u );
+			float degrees;
+			randomInit( &degrees, 1u );
+			return Quaternion::fromAxisAngle( axis, Angle::fromDegrees( degrees * 360.0f ) );
+		}
+
+		bool isClose( Quaternion const & lhs, Quaterniond const & rhs )
+		{
+			double epsilon = 0.0001;
+			return std::abs( lhs->x - rhs->x ) < epsilon
+				&& std::abs( lhs->y - rhs->y ) < epsilon
+				&& std::abs( lhs->z - rhs->z ) < epsilon
+				&& std::abs( lhs->w - rhs->w ) < epsilon;
+		}
+
+		bool isClose( Point3f const & lhs, Point3d const & rhs )
+		{
+			double epsilon = 0.0001;
+			return std::abs( lhs[0] - rhs[0] ) < epsilon
+				&& std::abs( lhs[1] - rhs[1] ) < epsilon
+				&& std::abs( lhs[2] - rhs[2] ) < epsilon;
+		}
+	}
+
+	//*********************************************************************************************
+
 	CastorUtilsQuaternionTest::CastorUtilsQuaternionTest()
 		: TestCase( "CastorUtilsQuaternionTest" )
 	{
@@ -37,6 +71,10 @@ namespace Testing
 
 	void CastorUtilsQuaternionTest::doRegisterTests()
 	{
+		doRegisterTest( "QuaternionMultiplicationFloat", std::bind( &CastorUtilsQuaternionTest::QuaternionMultiplicationFloat, this ) );
+		doRegisterTest( "QuaternionSlerpFloat", std::bind( &CastorUtilsQuaternionTest::QuaternionSlerpFloat, this ) );
+		doRegisterTest( "QuaternionTransformFloat", std::bind( &CastorUtilsQuaternionTest::QuaternionTransformFloat, this ) );
+
 #if defined( CASTOR_USE_GLM )
 
 		doRegisterTest( "TransformationMatrixComparison", std::bind( &CastorUtilsQuaternionTest::TransformationMatrixComparison, this ) );
@@ -44,6 +82,54 @@ namespace Testing
 #endif
 	}
 
+	void CastorUtilsQuaternionTest::QuaternionMultiplicationFloat()
+	{
+		for ( int i = 0; i < 100; ++i )
+		{
+			auto lhs = randomQuaternion();
+			auto rhs = randomQuaternion();
+			Quaterniond reference = Quaterniond{ lhs.constPtr() } * Quaterniond{ rhs.constPtr() };
+			CT_CHECK( isClose( lhs * rhs, reference ) );
+			lhs *= rhs;
+			CT_CHECK( isClose( lhs, reference ) );
+		}
+	}
+
+	void CastorUtilsQuaternionTest::QuaternionSlerpFloat()
+	{
+		for ( int i = 0; i < 100; ++i )
+		{
+			auto source = randomQuaternion();
+			auto target = randomQuaternion();
+			float factor;
+			randomInit( &factor, 1u );
+			Quaterniond sourced{ source.constPtr() };
+			Quaterniond targetd{ target.constPtr() };
+			CT_CHECK( isClose( source.slerp( target, factor ), sourced.slerp( targetd, factor ) ) );
+			CT_CHECK( isClose( source.slerp( target, double( factor ) ), sourced.slerp( targetd, double( factor ) ) ) );
+			// Very close quaternions use the linear interpolation.
+			CT_CHECK( isClose( source.slerp( source, factor ), sourced ) );
+		}
+	}
+
+	void CastorUtilsQuaternionTest::QuaternionTransformFloat()
+	{
+		for ( int i = 0; i < 100; ++i )
+		{
+			auto quat = randomQuaternion();
+			Point3f point;
+			randomInit( point.ptr(), 3u );
+			Point3d reference;
+			Quaterniond{ quat.constPtr() }.transform( Point3d{ point }, reference );
+			Point3f result;
+			quat.transform( point, result );
+			CT_CHECK( isClose( result, reference ) );
+			// The input can be the result.
+			quat.transform( point, point );
+			CT_CHECK( isClose( point, reference ) );
+		}
+	}
+
 #if defined( CASTOR_USE_GLM )
 
 	bool CastorUtilsQuaternionTest::compare( Matrix4x4f const & lhs, glm::mat4x4 const & rhs )
@@ -157,4 +243,102 @@ namespace Testing
 #endif
 
 	//*********************************************************************************************
+
+	CastorUtilsQuaternionBench::CastorUtilsQuaternionBench()
+		: BenchCase( "CastorUtilsQuaternionBench" )
+	{
+		m_quats.resize( BatchSize );
+		m_quatsResult.resize( BatchSize );
+		m_points.resize( BatchSize );
+		m_pointsResult.resize( BatchSize );
+
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_quats[i] = randomQuaternion();
+			randomInit( m_points[i].ptr(), 3u );
+		}
+	}
+
+	void CastorUtilsQuaternionBench::Execute()
+	{
+		// Batches of BatchSize operations, so that the call overhead doesn't hide the computations.
+		BENCHMARK( QuaternionBatchMultiplicationsDouble, NB_TESTS / BatchSize );
+		BENCHMARK( QuaternionBatchMultiplicationsCastor, NB_TESTS / BatchSize );
+		BENCHMARK( QuaternionBatchSlerpDouble, NB_TESTS / BatchSize );
+		BENCHMARK( QuaternionBatchSlerpCastor, NB_TESTS / BatchSize );
+		BENCHMARK( QuaternionBatchTransformDouble, NB_TESTS / BatchSize );
+		BENCHMARK( QuaternionBatchTransformCastor, NB_TESTS / BatchSize );
+	}
+
+	void CastorUtilsQuaternionBench::QuaternionBatchMultiplicationsDouble()
+	{
+		Quaterniond lhs{ m_quats[0].constPtr() };
+
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			Quaterniond result = lhs * Quaterniond{ m_quats[i].constPtr() };
+			m_quatsResult[i] = Quaternion{ result.constPtr() };
+		}
+
+		doNotOptimizeAway( m_quatsResult );
+	}
+
+	void CastorUtilsQuaternionBench::QuaternionBatchMultiplicationsCastor()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_quatsResult[i] = m_quats[0] * m_quats[i];
+		}
+
+		doNotOptimizeAway( m_quatsResult );
+	}
+
+	void CastorUtilsQuaternionBench::QuaternionBatchSlerpDouble()
+	{
+		Quaterniond source{ m_quats[0].constPtr() };
+
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			auto result = source.slerp( Quaterniond{ m_quats[i].constPtr() }, 0.3f );
+			m_quatsResult[i] = Quaternion{ result.constPtr() };
+		}
+
+		doNotOptimizeAway( m_quatsResult );
+	}
+
+	void CastorUtilsQuaternionBench::QuaternionBatchSlerpCastor()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_quatsResult[i] = m_quats[0].slerp( m_quats[i], 0.3f );
+		}
+
+		doNotOptimizeAway( m_quatsResult );
+	}
+
+	void CastorUtilsQuaternionBench::QuaternionBatchTransformDouble()
+	{
+		Quaterniond quat{ m_quats[0].constPtr() };
+
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			Point3d result;
+			quat.transform( Point3d{ m_points[i] }, result );
+			m_pointsResult[i] = Point3f{ result };
+		}
+
+		doNotOptimizeAway( m_pointsResult );
+	}
+
+	void CastorUtilsQuaternionBench::QuaternionBatchTransformCastor()
+	{
+		for ( uint32_t i = 0u; i < BatchSize; ++i )
+		{
+			m_quats[0].transform( m_points[i], m_pointsResult[i] );
+		}
+
+		doNotOptimizeAway( m_pointsResult );
+	}
+
+	//*********************************************************************************************
 }
@@ -30,6 +30,9 @@ namespace Testing
 #endif
 
 	private:
+		void QuaternionMultiplicationFloat();
+		void QuaternionSlerpFloat();
+		void QuaternionTransformFloat();
 
 #if defined( CASTOR_USE_GLM )
 
@@ -87,6 +90,28 @@ namespace Testing
 		}
 
 	};
+
+	class CastorUtilsQuaternionBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsQuaternionBench();
+		void Execute()override;
+
+	private:
+		void QuaternionBatchMultiplicationsDouble();
+		void QuaternionBatchMultiplicationsCastor();
+		void QuaternionBatchSlerpDouble();
+		void QuaternionBatchSlerpCastor();
+		void QuaternionBatchTransformDouble();
+		void QuaternionBatchTransformCastor();
+
+	private:
+		castor::Vector< castor::Quaternion > m_quats;
+		castor::Vector< castor::Quaternion > m_quatsResult;
+		castor::Vector< castor::Point3f > m_points;
+		castor::Vector< castor::Point3f > m_pointsResult;
+	};
 }
 
 #endif
@@ -0,0 +1,160 @@
+#include "CastorUtilsRadixSortTest.hpp"
+
+#include <CastorUtils/Miscellaneous/RadixSort.hpp>
+
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		struct Item
+		{
+			uint64_t key;
+			uint32_t index;
+		};
+
+		castor::Vector< Item > makeItems( uint32_t count
+			, uint64_t keyMask
+			, uint32_t seed )
+		{
+			std::mt19937_64 rng{ seed };
+			castor::Vector< Item > result;
+			result.reserve( count );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				result.push_back( { rng() & keyMask, i } );
+			}
+
+			return result;
+		}
+
+		castor::Vector< Item > referenceSort( castor::Vector< Item > items )
+		{
+			std::stable_sort( items.begin()
+				, items.end()
+				, []( Item const & lhs, Item const & rhs )
+				{
+					return lhs.key < rhs.key;
+				} );
+			return items;
+		}
+
+		bool areEqual( castor::Vector< Item > const & lhs
+			, castor::Vector< Item > const & rhs )
+		{
+			return lhs.size() == rhs.size()
+				&& std::equal( lhs.begin()
+					, lhs.end()
+					, rhs.begin()
+					, []( Item const & l, Item const & r )
+					{
+						return l.key == r.key && l.index == r.index;
+					} );
+		}
+
+		uint64_t getKey( Item const & item )
+		{
+			return item.key;
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsRadixSortTest::CastorUtilsRadixSortTest()
+		: TestCase{ "CastorUtilsRadixSortTest" }
+	{
+	}
+
+	void CastorUtilsRadixSortTest::doRegisterTests()
+	{
+		doRegisterTest( "SortKeys", std::bind( &CastorUtilsRadixSortTest::SortKeys, this ) );
+		doRegisterTest( "SortIsStable", std::bind( &CastorUtilsRadixSortTest::SortIsStable, this ) );
+		doRegisterTest( "SortAgain", std::bind( &CastorUtilsRadixSortTest::SortAgain, this ) );
+	}
+
+	void CastorUtilsRadixSortTest::SortKeys()
+	{
+		castor::Vector< Item > scratch;
+
+		for ( uint32_t count : { 0u, 1u, 2u, 17u, 1000u, 10000u } )
+		{
+			auto items = makeItems( count, ~0ULL, count );
+			auto reference = referenceSort( items );
+			castor::radixSort( items, scratch, getKey );
+			CT_CHECK( areEqual( items, reference ) );
+		}
+
+		castor::Vector< uint32_t > keys{ 5u, 0xFFFFFFFFu, 0u, 256u, 255u, 65536u };
+		castor::Vector< uint32_t > keysScratch;
+		castor::radixSort( keys, keysScratch, []( uint32_t key ){ return key; } );
+		CT_CHECK( std::is_sorted( keys.begin(), keys.end() ) );
+	}
+
+	void CastorUtilsRadixSortTest::SortIsStable()
+	{
+		castor::Vector< Item > scratch;
+		// Few distinct keys, and only some bytes used, to get skipped passes.
+		auto items = makeItems( 5000u, 0x0F000000000000F0ULL, 42u );
+		auto reference = referenceSort( items );
+		castor::radixSort( items, scratch, getKey );
+		CT_CHECK( areEqual( items, reference ) );
+	}
+
+	void CastorUtilsRadixSortTest::SortAgain()
+	{
+		castor::Vector< Item > scratch;
+		auto items = makeItems( 5000u, ~0ULL, 7u );
+		castor::radixSort( items, scratch, getKey );
+		auto reference = items;
+		castor::radixSort( items, scratch, getKey );
+		CT_CHECK( areEqual( items, reference ) );
+
+		// Only a few keys change between two sorts.
+		for ( uint32_t i = 0u; i < items.size(); i += 100u )
+		{
+			items[i].key ^= 0xFFFFULL;
+		}
+
+		reference = referenceSort( items );
+		castor::radixSort( items, scratch, getKey );
+		CT_CHECK( areEqual( items, reference ) );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsRadixSortBench::CastorUtilsRadixSortBench()
+		: BenchCase{ "CastorUtilsRadixSortBench" }
+	{
+		std::mt19937_64 rng{ 1u };
+		m_source.resize( 10000u );
+
+		for ( auto & key : m_source )
+		{
+			key = rng();
+		}
+	}
+
+	void CastorUtilsRadixSortBench::Execute()
+	{
+		BENCHMARK( StableSort, NB_TESTS / 10000u );
+		BENCHMARK( RadixSort, NB_TESTS / 10000u );
+	}
+
+	void CastorUtilsRadixSortBench::StableSort()
+	{
+		m_keys = m_source;
+		std::stable_sort( m_keys.begin(), m_keys.end() );
+		doNotOptimizeAway( m_keys );
+	}
+
+	void CastorUtilsRadixSortBench::RadixSort()
+	{
+		m_keys = m_source;
+		castor::radixSort( m_keys, m_scratch, []( uint64_t key ){ return key; } );
+		doNotOptimizeAway( m_keys );
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,42 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsRadixSortTest___
+#define ___CUT_CastorUtilsRadixSortTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsRadixSortTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsRadixSortTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void SortKeys();
+		void SortIsStable();
+		void SortAgain();
+	};
+
+	class CastorUtilsRadixSortBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsRadixSortBench();
+		void Execute()override;
+
+	private:
+		void StableSort();
+		void RadixSort();
+
+	private:
+		castor::Vector< uint64_t > m_source;
+		castor::Vector< uint64_t > m_keys;
+		castor::Vector< uint64_t > m_scratch;
+	};
+}
+
+#endif
@@ -0,0 +1,156 @@
+#include "CastorUtilsSkylinePackerTest.hpp"
+
+#include <CastorUtils/Graphics/Position.hpp>
+#include <CastorUtils/Graphics/Size.hpp>
+#include <CastorUtils/Graphics/SkylinePacker.hpp>
+
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		struct Rect
+		{
+			castor::Position position;
+			castor::Size size;
+		};
+
+		bool intersect( Rect const & lhs
+			, Rect const & rhs )
+		{
+			return lhs.position.x() < rhs.position.x() + int32_t( rhs.size.getWidth() )
+				&& rhs.position.x() < lhs.position.x() + int32_t( lhs.size.getWidth() )
+				&& lhs.position.y() < rhs.position.y() + int32_t( rhs.size.getHeight() )
+				&& rhs.position.y() < lhs.position.y() + int32_t( lhs.size.getHeight() );
+		}
+
+		bool isInside( Rect const & rect
+			, castor::SkylinePacker const & packer )
+		{
+			return rect.position.x() >= 0
+				&& rect.position.y() >= 0
+				&& rect.position.x() + rect.size.getWidth() <= packer.getWidth()
+				&& rect.position.y() + rect.size.getHeight() <= packer.getHeight()
+				&& rect.position.y() + rect.size.getHeight() <= packer.getUsedHeight();
+		}
+
+		bool checkRects( castor::Vector< Rect > const & rects
+			, castor::SkylinePacker const & packer )
+		{
+			for ( size_t i = 0u; i < rects.size(); ++i )
+			{
+				if ( !isInside( rects[i], packer ) )
+				{
+					return false;
+				}
+
+				for ( size_t j = i + 1u; j < rects.size(); ++j )
+				{
+					if ( intersect( rects[i], rects[j] ) )
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		// Glyph like sizes, inserted until the packer is full.
+		castor::Vector< Rect > fill( castor::SkylinePacker & packer
+			, std::mt19937 & rng )
+		{
+			std::uniform_int_distribution< uint32_t > width{ 2u, 24u };
+			std::uniform_int_distribution< uint32_t > height{ 8u, 32u };
+			castor::Vector< Rect > result;
+			Rect rect{};
+			rect.size = castor::Size{ width( rng ), height( rng ) };
+
+			while ( packer.insert( rect.size, rect.position ) )
+			{
+				result.push_back( rect );
+				rect.size = castor::Size{ width( rng ), height( rng ) };
+			}
+
+			return result;
+		}
+
+		uint64_t getArea( castor::Vector< Rect > const & rects )
+		{
+			uint64_t result{};
+
+			for ( auto & rect : rects )
+			{
+				result += uint64_t( rect.size.getWidth() ) * rect.size.getHeight();
+			}
+
+			return result;
+		}
+	}
+
+	CastorUtilsSkylinePackerTest::CastorUtilsSkylinePackerTest()
+		: TestCase{ "CastorUtilsSkylinePackerTest" }
+	{
+	}
+
+	void CastorUtilsSkylinePackerTest::doRegisterTests()
+	{
+		doRegisterTest( "InsertNoOverlap", std::bind( &CastorUtilsSkylinePackerTest::InsertNoOverlap, this ) );
+		doRegisterTest( "InsertWhenFull", std::bind( &CastorUtilsSkylinePackerTest::InsertWhenFull, this ) );
+		doRegisterTest( "Grow", std::bind( &CastorUtilsSkylinePackerTest::Grow, this ) );
+		doRegisterTest( "Clear", std::bind( &CastorUtilsSkylinePackerTest::Clear, this ) );
+	}
+
+	void CastorUtilsSkylinePackerTest::InsertNoOverlap()
+	{
+		std::mt19937 rng{ 42u };
+		castor::SkylinePacker packer{ 256u, 256u };
+		auto rects = fill( packer, rng );
+		CT_REQUIRE( !rects.empty() );
+		CT_CHECK( checkRects( rects, packer ) );
+		// Glyph like sizes must fill most of the space.
+		CT_CHECK( getArea( rects ) * 10u >= 256u * 256u * 7u );
+	}
+
+	void CastorUtilsSkylinePackerTest::InsertWhenFull()
+	{
+		castor::SkylinePacker packer{ 64u, 32u };
+		castor::Position position;
+		CT_CHECK( !packer.insert( castor::Size{ 65u, 1u }, position ) );
+		CT_CHECK( !packer.insert( castor::Size{ 1u, 33u }, position ) );
+		CT_CHECK( packer.insert( castor::Size{ 64u, 16u }, position ) );
+		CT_CHECK( position == castor::Position( 0, 0 ) );
+		CT_CHECK( packer.insert( castor::Size{ 32u, 16u }, position ) );
+		CT_CHECK( position == castor::Position( 0, 16 ) );
+		CT_CHECK( packer.insert( castor::Size{ 32u, 16u }, position ) );
+		CT_CHECK( position == castor::Position( 32, 16 ) );
+		CT_EQUAL( packer.getUsedHeight(), 32u );
+		CT_CHECK( !packer.insert( castor::Size{ 1u, 1u }, position ) );
+	}
+
+	void CastorUtilsSkylinePackerTest::Grow()
+	{
+		std::mt19937 rng{ 7u };
+		castor::SkylinePacker packer{ 128u, 128u };
+		auto rects = fill( packer, rng );
+		packer.grow( 256u );
+		CT_EQUAL( packer.getHeight(), 256u );
+		auto added = fill( packer, rng );
+		CT_CHECK( !added.empty() );
+		rects.insert( rects.end(), added.begin(), added.end() );
+		CT_CHECK( checkRects( rects, packer ) );
+	}
+
+	void CastorUtilsSkylinePackerTest::Clear()
+	{
+		std::mt19937 rng{ 3u };
+		castor::SkylinePacker packer{ 128u, 128u };
+		auto rects = fill( packer, rng );
+		packer.clear();
+		CT_EQUAL( packer.getUsedHeight(), 0u );
+		castor::Position position;
+		CT_CHECK( packer.insert( castor::Size{ 128u, 128u }, position ) );
+		CT_CHECK( position == castor::Position( 0, 0 ) );
+	}
+}
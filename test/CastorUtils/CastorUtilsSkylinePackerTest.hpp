@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsSkylinePackerTest___
+#define ___CUT_CastorUtilsSkylinePackerTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsSkylinePackerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsSkylinePackerTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void InsertNoOverlap();
+		void InsertWhenFull();
+		void Grow();
+		void Clear();
+	};
+}
+
+#endif
@@ -0,0 +1,419 @@
+#include "CastorUtilsTlsfAllocatorTest.hpp"
+
+#include <CastorUtils/Pool/TlsfAllocator.hpp>
+
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		uint64_t constexpr TraceRangeSize = 64ull * 1024ull * 1024ull;
+		uint64_t constexpr TraceGranularity = 16u;
+
+		/**
+		*\brief
+		*	Builds an allocation trace mimicking geometry streaming:
+		*	meshes of varied sizes are loaded and unloaded in random order,
+		*	the pool staying between half and almost full.
+		*/
+		castor::Vector< TlsfTraceOp > makeStreamingTrace( uint32_t opCount
+			, uint64_t rangeSize )
+		{
+			castor::Vector< TlsfTraceOp > result;
+			result.reserve( opCount );
+			std::mt19937 engine{ 42u };
+			// Small meshes dominate, with a long tail of big ones.
+			std::lognormal_distribution< double > sizes{ 9.0, 1.5 };
+			castor::Vector< std::pair< uint32_t, uint64_t > > live;
+			uint64_t liveSize{};
+			uint32_t nextId{};
+
+			while ( result.size() < opCount )
+			{
+				auto size = std::clamp( uint64_t( sizes( engine ) ), uint64_t{ 1u }, rangeSize / 64u );
+				bool release = !live.empty()
+					&& ( liveSize + size > rangeSize * 3u / 4u
+						|| std::uniform_int_distribution< uint32_t >{ 0u, 2u }( engine ) == 0u );
+
+				if ( release )
+				{
+					auto index = std::uniform_int_distribution< size_t >{ 0u, live.size() - 1u }( engine );
+					result.push_back( { false, live[index].first, live[index].second } );
+					liveSize -= live[index].second;
+					live[index] = live.back();
+					live.pop_back();
+				}
+				else
+				{
+					result.push_back( { true, nextId, size } );
+					live.emplace_back( nextId++, size );
+					liveSize += size;
+				}
+			}
+
+			return result;
+		}
+		/**
+		*\brief
+		*	The previous GpuBufferPackedAllocator behaviour, first fit in an uncoalesced free list.
+		*/
+		class LinearFitAllocator
+		{
+		public:
+			explicit LinearFitAllocator( uint64_t size )
+				: m_size{ size }
+			{
+			}
+
+			uint64_t allocate( uint64_t size )
+			{
+				if ( auto it = std::find_if( m_free.begin()
+					, m_free.end()
+					, [size]( std::pair< uint64_t, uint64_t > const & lookup )
+					{
+						return lookup.second >= size;
+					} );
+					it != m_free.end() )
+				{
+					auto result = it->first;
+
+					if ( it->second > size )
+					{
+						it->first += size;
+						it->second -= size;
+					}
+					else
+					{
+						m_free.erase( it );
+					}
+
+					m_allocated.emplace( result, size );
+					return result;
+				}
+
+				if ( m_end + size > m_size )
+				{
+					return castor::TlsfAllocator::InvalidOffset;
+				}
+
+				auto result = m_end;
+				m_end += size;
+				m_allocated.emplace( result, size );
+				return result;
+			}
+
+			void deallocate( uint64_t offset )
+			{
+				auto it = m_allocated.find( offset );
+				m_free.emplace_back( it->first, it->second );
+				m_allocated.erase( it );
+			}
+
+		private:
+			uint64_t m_size;
+			uint64_t m_end{};
+			castor::Map< uint64_t, uint64_t > m_allocated;
+			castor::Vector< std::pair< uint64_t, uint64_t > > m_free;
+		};
+
+		template< typename AllocatorT >
+		uint32_t replay( AllocatorT & allocator
+			, castor::Vector< TlsfTraceOp > const & trace )
+		{
+			castor::UnorderedMap< uint32_t, uint64_t > offsets;
+			uint32_t failures{};
+
+			for ( auto & op : trace )
+			{
+				if ( op.allocate )
+				{
+					auto offset = allocator.allocate( op.size );
+
+					if ( offset == castor::TlsfAllocator::InvalidOffset )
+					{
+						++failures;
+					}
+					else
+					{
+						offsets.emplace( op.id, offset );
+					}
+				}
+				else if ( auto it = offsets.find( op.id );
+					it != offsets.end() )
+				{
+					allocator.deallocate( it->second );
+					offsets.erase( it );
+				}
+			}
+
+			return failures;
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsTlsfAllocatorTest::CastorUtilsTlsfAllocatorTest()
+		: TestCase{ "CastorUtilsTlsfAllocatorTest" }
+	{
+	}
+
+	void CastorUtilsTlsfAllocatorTest::doRegisterTests()
+	{
+		doRegisterTest( "AllocationTest", std::bind( &CastorUtilsTlsfAllocatorTest::AllocationTest, this ) );
+		doRegisterTest( "DeallocationTest", std::bind( &CastorUtilsTlsfAllocatorTest::DeallocationTest, this ) );
+		doRegisterTest( "CoalescingTest", std::bind( &CastorUtilsTlsfAllocatorTest::CoalescingTest, this ) );
+		doRegisterTest( "AlignmentTest", std::bind( &CastorUtilsTlsfAllocatorTest::AlignmentTest, this ) );
+		doRegisterTest( "StatisticsTest", std::bind( &CastorUtilsTlsfAllocatorTest::StatisticsTest, this ) );
+		doRegisterTest( "StreamingTraceTest", std::bind( &CastorUtilsTlsfAllocatorTest::StreamingTraceTest, this ) );
+	}
+
+	void CastorUtilsTlsfAllocatorTest::AllocationTest()
+	{
+		{
+			CT_ON( "	Whole range" );
+			castor::TlsfAllocator allocator{ 1024u };
+			CT_CHECK( allocator.hasAvailable( 1024u ) );
+			CT_CHECK( !allocator.hasAvailable( 1025u ) );
+			CT_EQUAL( allocator.allocate( 1024u ), 0u );
+			CT_CHECK( !allocator.hasAvailable( 1u ) );
+			CT_EQUAL( allocator.allocate( 1u ), castor::TlsfAllocator::InvalidOffset );
+			CT_CHECK( allocator.checkConsistency() );
+		}
+		{
+			CT_ON( "	Granularity" );
+			castor::TlsfAllocator allocator{ 1000u, 16u };
+			CT_EQUAL( allocator.getTotalSize(), 992u );
+			auto buf1 = allocator.allocate( 1u );
+			auto buf2 = allocator.allocate( 17u );
+			auto buf3 = allocator.allocate( 16u );
+			CT_EQUAL( buf1, 0u );
+			CT_EQUAL( buf2, 16u );
+			CT_EQUAL( buf3, 48u );
+			CT_EQUAL( allocator.getAllocationSize( buf2 ), 32u );
+			CT_EQUAL( allocator.getUsedSize(), 64u );
+			CT_CHECK( allocator.checkConsistency() );
+		}
+		{
+			CT_ON( "	Many small blocks" );
+			castor::TlsfAllocator allocator{ 256u, 4u };
+
+			for ( auto i = 0u; i < 64u; ++i )
+			{
+				CT_EQUAL( allocator.allocate( 4u ), i * 4u );
+			}
+
+			CT_EQUAL( allocator.allocate( 4u ), castor::TlsfAllocator::InvalidOffset );
+			CT_CHECK( allocator.checkConsistency() );
+		}
+		{
+			CT_ON( "	Almost full range, exact class fallback" );
+			castor::TlsfAllocator allocator{ 1000u };
+			auto buf1 = allocator.allocate( 100u );
+			CT_NEQUAL( buf1, castor::TlsfAllocator::InvalidOffset );
+			CT_CHECK( allocator.hasAvailable( 900u ) );
+			CT_EQUAL( allocator.allocate( 900u ), 100u );
+			CT_CHECK( allocator.checkConsistency() );
+		}
+	}
+
+	void CastorUtilsTlsfAllocatorTest::DeallocationTest()
+	{
+		{
+			castor::TlsfAllocator allocator{ 1024u };
+			auto buf1 = allocator.allocate( 1024u );
+			CT_CHECK( allocator.deallocate( buf1 ) );
+			CT_CHECK( !allocator.deallocate( buf1 ) );
+			CT_CHECK( !allocator.deallocate( 12u ) );
+			CT_EQUAL( allocator.allocate( 1024u ), 0u );
+			CT_CHECK( allocator.checkConsistency() );
+		}
+		{
+			castor::TlsfAllocator allocator{ 1024u };
+			auto buf1 = allocator.allocate( 256u );
+			auto buf2 = allocator.allocate( 256u );
+			auto buf3 = allocator.allocate( 256u );
+			CT_CHECK( allocator.deallocate( buf2 ) );
+			// The hole is reused.
+			CT_EQUAL( allocator.allocate( 200u ), buf2 );
+			CT_CHECK( allocator.deallocate( buf1 ) );
+			CT_CHECK( allocator.deallocate( buf3 ) );
+			CT_CHECK( allocator.checkConsistency() );
+			allocator.clear();
+			CT_EQUAL( allocator.getUsedSize(), 0u );
+			CT_EQUAL( allocator.allocate( 1024u ), 0u );
+		}
+	}
+
+	void CastorUtilsTlsfAllocatorTest::CoalescingTest()
+	{
+		castor::TlsfAllocator allocator{ 4096u, 16u };
+		castor::Vector< uint64_t > buffers;
+
+		for ( auto i = 0u; i < 16u; ++i )
+		{
+			buffers.push_back( allocator.allocate( 256u ) );
+		}
+
+		CT_CHECK( !allocator.hasAvailable( 16u ) );
+
+		// Free every other block: no contiguous space bigger than one block.
+		for ( auto i = 0u; i < 16u; i += 2u )
+		{
+			CT_CHECK( allocator.deallocate( buffers[i] ) );
+		}
+
+		auto stats = allocator.getStatistics();
+		CT_EQUAL( stats.freeBlockCount, 8u );
+		CT_CHECK( !allocator.hasAvailable( 512u ) );
+
+		// Freeing the remaining ones merges everything, whatever the order.
+		for ( auto i = 15u; i < 16u; i -= 2u )
+		{
+			CT_CHECK( allocator.deallocate( buffers[i] ) );
+			CT_CHECK( allocator.checkConsistency() );
+		}
+
+		stats = allocator.getStatistics();
+		CT_EQUAL( stats.freeBlockCount, 1u );
+		CT_EQUAL( stats.largestFreeBlock, 4096u );
+		CT_EQUAL( allocator.allocate( 4096u ), 0u );
+	}
+
+	void CastorUtilsTlsfAllocatorTest::AlignmentTest()
+	{
+		castor::TlsfAllocator allocator{ 4096u, 16u };
+		auto buf1 = allocator.allocate( 16u );
+		auto buf2 = allocator.allocate( 100u, 256u );
+		CT_EQUAL( buf1, 0u );
+		CT_EQUAL( buf2, 256u );
+		// The padding is given back to the free lists.
+		CT_EQUAL( allocator.allocate( 200u ), 16u );
+		// Non power of two alignment, combined with the granularity.
+		auto buf3 = allocator.allocate( 10u, 24u );
+		CT_EQUAL( buf3 % 48u, 0u );
+		CT_CHECK( allocator.checkConsistency() );
+		CT_CHECK( !allocator.hasAvailable( 4096u, 256u ) );
+		CT_CHECK( allocator.deallocate( buf2 ) );
+		CT_CHECK( allocator.checkConsistency() );
+	}
+
+	void CastorUtilsTlsfAllocatorTest::StatisticsTest()
+	{
+		castor::TlsfAllocator allocator{ 1024u };
+		auto stats = allocator.getStatistics();
+		CT_EQUAL( stats.totalSize, 1024u );
+		CT_EQUAL( stats.usedSize, 0u );
+		CT_EQUAL( stats.freeSize, 1024u );
+		CT_EQUAL( stats.largestFreeBlock, 1024u );
+		CT_EQUAL( stats.freeBlockCount, 1u );
+		CT_EQUAL( stats.getFragmentation(), 0.0f );
+
+		auto buf1 = allocator.allocate( 256u );
+		auto buf2 = allocator.allocate( 256u );
+		auto buf3 = allocator.allocate( 256u );
+		allocator.deallocate( buf1 );
+		stats = allocator.getStatistics();
+		CT_EQUAL( stats.usedSize, 512u );
+		CT_EQUAL( stats.allocationCount, 2u );
+		CT_EQUAL( stats.freeBlockCount, 2u );
+		CT_EQUAL( stats.largestFreeBlock, 256u );
+		CT_EQUAL( stats.getFragmentation(), 0.5f );
+
+		allocator.deallocate( buf2 );
+		stats = allocator.getStatistics();
+		CT_EQUAL( stats.freeSize, 768u );
+		CT_EQUAL( stats.largestFreeBlock, 512u );
+		CT_CHECK( std::abs( stats.getFragmentation() - 1.0f / 3.0f ) < 0.0001f );
+
+		allocator.deallocate( buf3 );
+		stats = allocator.getStatistics();
+		CT_EQUAL( stats.largestFreeBlock, 1024u );
+		CT_EQUAL( stats.freeBlockCount, 1u );
+		CT_EQUAL( stats.getFragmentation(), 0.0f );
+	}
+
+	void CastorUtilsTlsfAllocatorTest::StreamingTraceTest()
+	{
+		auto trace = makeStreamingTrace( 20000u, TraceRangeSize );
+		castor::TlsfAllocator allocator{ TraceRangeSize, TraceGranularity };
+		castor::UnorderedMap< uint32_t, uint64_t > offsets;
+		castor::Map< uint64_t, uint64_t > ranges;
+		uint32_t failures{};
+		bool overlap{};
+
+		for ( auto & op : trace )
+		{
+			if ( op.allocate )
+			{
+				auto offset = allocator.allocate( op.size );
+
+				if ( offset == castor::TlsfAllocator::InvalidOffset )
+				{
+					++failures;
+					continue;
+				}
+
+				auto size = allocator.getAllocationSize( offset );
+				auto next = ranges.lower_bound( offset );
+				overlap = overlap
+					|| ( next != ranges.end() && next->first < offset + size )
+					|| ( next != ranges.begin() && std::prev( next )->first + std::prev( next )->second > offset );
+				ranges.emplace( offset, size );
+				offsets.emplace( op.id, offset );
+			}
+			else if ( auto it = offsets.find( op.id );
+				it != offsets.end() )
+			{
+				ranges.erase( it->second );
+				allocator.deallocate( it->second );
+				offsets.erase( it );
+			}
+		}
+
+		CT_CHECK( !overlap );
+		CT_EQUAL( failures, 0u );
+		CT_CHECK( allocator.checkConsistency() );
+
+		for ( auto & [id, offset] : offsets )
+		{
+			allocator.deallocate( offset );
+		}
+
+		auto stats = allocator.getStatistics();
+		CT_EQUAL( stats.usedSize, 0u );
+		CT_EQUAL( stats.freeBlockCount, 1u );
+		CT_EQUAL( stats.largestFreeBlock, allocator.getTotalSize() );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsTlsfAllocatorBench::CastorUtilsTlsfAllocatorBench()
+		: BenchCase( "CastorUtilsTlsfAllocatorBench" )
+		, m_trace{ makeStreamingTrace( 50000u, TraceRangeSize ) }
+	{
+		// Align the trace sizes once, so both allocators get the same requests.
+		for ( auto & op : m_trace )
+		{
+			op.size = ( ( op.size + TraceGranularity - 1u ) / TraceGranularity ) * TraceGranularity;
+		}
+	}
+
+	void CastorUtilsTlsfAllocatorBench::Execute()
+	{
+		BENCHMARK( ReplayTlsf, 20 );
+		BENCHMARK( ReplayLinearFit, 5 );
+	}
+
+	void CastorUtilsTlsfAllocatorBench::ReplayTlsf()
+	{
+		castor::TlsfAllocator allocator{ TraceRangeSize, TraceGranularity };
+		doNotOptimizeAway( replay( allocator, m_trace ) );
+	}
+
+	void CastorUtilsTlsfAllocatorBench::ReplayLinearFit()
+	{
+		LinearFitAllocator allocator{ TraceRangeSize };
+		doNotOptimizeAway( replay( allocator, m_trace ) );
+	}
+}
@@ -0,0 +1,50 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsTlsfAllocatorTest_H___
+#define ___CUT_CastorUtilsTlsfAllocatorTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	struct TlsfTraceOp
+	{
+		bool allocate;
+		uint32_t id;
+		uint64_t size;
+	};
+
+	class CastorUtilsTlsfAllocatorTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsTlsfAllocatorTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void AllocationTest();
+		void DeallocationTest();
+		void CoalescingTest();
+		void AlignmentTest();
+		void StatisticsTest();
+		void StreamingTraceTest();
+	};
+
+	class CastorUtilsTlsfAllocatorBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsTlsfAllocatorBench();
+		void Execute()override;
+
+	private:
+		void ReplayTlsf();
+		void ReplayLinearFit();
+
+	private:
+		castor::Vector< TlsfTraceOp > m_trace;
+	};
+}
+
+#endif
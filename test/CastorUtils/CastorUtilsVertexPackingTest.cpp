@@ -0,0 +1,186 @@
+#include "CastorUtilsVertexPackingTest.hpp"
+
+#include <CastorUtils/Math/VertexPacking.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace Testing
+{
+	namespace
+	{
+		// Half floats have 10 explicit mantissa bits, so a rounded normal value is within 2^-11 relative error.
+		static float constexpr HalfRelativeError = 1.0f / 2048.0f;
+		// Half of a snorm16 step.
+		static float constexpr Snorm16Error = 0.5f / 32767.0f;
+
+		castor::Point3f makeDirection( float x, float y, float z )
+		{
+			castor::Point3f result{ x, y, z };
+			castor::point::normalise( result );
+			return result;
+		}
+
+		float getAngularError( castor::Point3f const & direction )
+		{
+			auto packed = castor::packing::encodeOctahedral( direction->x, direction->y, direction->z );
+			auto decoded = castor::packing::decodeOctahedral( packed[0], packed[1] );
+			return std::acos( std::min( 1.0f, float( castor::point::dot( direction, decoded ) ) ) );
+		}
+	}
+
+	CastorUtilsVertexPackingTest::CastorUtilsVertexPackingTest()
+		: TestCase{ "CastorUtilsVertexPackingTest" }
+	{
+	}
+
+	void CastorUtilsVertexPackingTest::doRegisterTests()
+	{
+		doRegisterTest( "HalfRoundTrip", std::bind( &CastorUtilsVertexPackingTest::HalfRoundTrip, this ) );
+		doRegisterTest( "HalfSpecialValues", std::bind( &CastorUtilsVertexPackingTest::HalfSpecialValues, this ) );
+		doRegisterTest( "Snorm16RoundTrip", std::bind( &CastorUtilsVertexPackingTest::Snorm16RoundTrip, this ) );
+		doRegisterTest( "OctahedralRoundTrip", std::bind( &CastorUtilsVertexPackingTest::OctahedralRoundTrip, this ) );
+	}
+
+	void CastorUtilsVertexPackingTest::HalfRoundTrip()
+	{
+		// Exactly representable values.
+		for ( auto value : { 0.0f, 1.0f, -1.0f, 0.5f, 2.0f, 1024.0f, 65504.0f, -65504.0f, 0.099975586f } )
+		{
+			CT_EQUAL( castor::packing::fromHalf( castor::packing::toHalf( value ) ), value );
+		}
+
+		CT_EQUAL( castor::packing::toHalf( 1.0f ), uint16_t( 0x3C00u ) );
+		CT_EQUAL( castor::packing::toHalf( -2.0f ), uint16_t( 0xC000u ) );
+		// Ties round to the nearest even mantissa.
+		CT_EQUAL( castor::packing::toHalf( 1.0f + 1.0f / 2048.0f ), uint16_t( 0x3C00u ) );
+		CT_EQUAL( castor::packing::toHalf( 1.0f + 3.0f / 2048.0f ), uint16_t( 0x3C02u ) );
+
+		// Every half value survives the round trip through float.
+		for ( uint32_t bits = 0u; bits < 0x7C00u; ++bits )
+		{
+			auto half = uint16_t( bits );
+			CT_EQUAL( castor::packing::toHalf( castor::packing::fromHalf( half ) ), half );
+			half |= 0x8000u;
+			CT_EQUAL( castor::packing::toHalf( castor::packing::fromHalf( half ) ), half );
+		}
+
+		// Normal values are within the half precision.
+		std::mt19937 generator{ 42u };
+		std::uniform_real_distribution< float > mantissa{ 1.0f, 2.0f };
+		std::uniform_int_distribution< int > exponent{ -14, 15 };
+
+		for ( uint32_t i = 0u; i < 10000u; ++i )
+		{
+			auto value = std::ldexp( mantissa( generator ), exponent( generator ) );
+
+			if ( value < 65504.0f )
+			{
+				auto result = castor::packing::fromHalf( castor::packing::toHalf( value ) );
+				CT_CHECK( std::abs( result - value ) <= value * HalfRelativeError );
+			}
+		}
+	}
+
+	void CastorUtilsVertexPackingTest::HalfSpecialValues()
+	{
+		auto infinity = std::numeric_limits< float >::infinity();
+		CT_EQUAL( castor::packing::toHalf( infinity ), uint16_t( 0x7C00u ) );
+		CT_EQUAL( castor::packing::toHalf( -infinity ), uint16_t( 0xFC00u ) );
+		CT_CHECK( std::isinf( castor::packing::fromHalf( 0x7C00u ) ) && !std::signbit( castor::packing::fromHalf( 0x7C00u ) ) );
+		CT_CHECK( std::isinf( castor::packing::fromHalf( 0xFC00u ) ) && std::signbit( castor::packing::fromHalf( 0xFC00u ) ) );
+		// Overflow gives infinity.
+		CT_EQUAL( castor::packing::toHalf( 1.0e6f ), uint16_t( 0x7C00u ) );
+		CT_EQUAL( castor::packing::toHalf( -1.0e6f ), uint16_t( 0xFC00u ) );
+		// NaN stays NaN.
+		CT_CHECK( std::isnan( castor::packing::fromHalf( castor::packing::toHalf( std::numeric_limits< float >::quiet_NaN() ) ) ) );
+		// Negative zero keeps its sign.
+		CT_EQUAL( castor::packing::toHalf( -0.0f ), uint16_t( 0x8000u ) );
+		CT_CHECK( std::signbit( castor::packing::fromHalf( 0x8000u ) ) );
+		// Subnormals.
+		auto smallest = std::ldexp( 1.0f, -24 );
+		CT_EQUAL( castor::packing::toHalf( smallest ), uint16_t( 0x0001u ) );
+		CT_EQUAL( castor::packing::fromHalf( 0x0001u ), smallest );
+		CT_EQUAL( castor::packing::toHalf( std::ldexp( 1.0f, -15 ) ), uint16_t( 0x0200u ) );
+		CT_EQUAL( castor::packing::fromHalf( 0x03FFu ), std::ldexp( 1023.0f, -24 ) );
+		// Underflow gives zero.
+		CT_EQUAL( castor::packing::toHalf( std::ldexp( 1.0f, -26 ) ), uint16_t( 0x0000u ) );
+	}
+
+	void CastorUtilsVertexPackingTest::Snorm16RoundTrip()
+	{
+		CT_EQUAL( castor::packing::toSnorm16( 0.0f ), int16_t( 0 ) );
+		CT_EQUAL( castor::packing::toSnorm16( 1.0f ), int16_t( 32767 ) );
+		CT_EQUAL( castor::packing::toSnorm16( -1.0f ), int16_t( -32767 ) );
+		// Out of range values are clamped.
+		CT_EQUAL( castor::packing::toSnorm16( 2.0f ), int16_t( 32767 ) );
+		CT_EQUAL( castor::packing::toSnorm16( -2.0f ), int16_t( -32767 ) );
+		// Both minimal values decode to -1.
+		CT_EQUAL( castor::packing::fromSnorm16( -32767 ), -1.0f );
+		CT_EQUAL( castor::packing::fromSnorm16( -32768 ), -1.0f );
+		CT_EQUAL( castor::packing::fromSnorm16( 32767 ), 1.0f );
+
+		for ( int32_t i = -32767; i <= 32767; ++i )
+		{
+			auto value = float( i ) / 32767.0f;
+			auto result = castor::packing::fromSnorm16( castor::packing::toSnorm16( value ) );
+			CT_CHECK( std::abs( result - value ) <= Snorm16Error );
+		}
+
+		std::mt19937 generator{ 42u };
+		std::uniform_real_distribution< float > distribution{ -1.0f, 1.0f };
+
+		for ( uint32_t i = 0u; i < 10000u; ++i )
+		{
+			auto value = distribution( generator );
+			auto result = castor::packing::fromSnorm16( castor::packing::toSnorm16( value ) );
+			CT_CHECK( std::abs( result - value ) <= Snorm16Error * 1.001f );
+		}
+	}
+
+	void CastorUtilsVertexPackingTest::OctahedralRoundTrip()
+	{
+		// With 16 bits per component, the angular error is a few thousandths of a degree.
+		static float constexpr MaxAngularError = 1.0e-3f;
+		float maxError{};
+
+		// The axes and the octahedron edges, on both hemispheres.
+		for ( auto & direction : { makeDirection( 1.0f, 0.0f, 0.0f )
+			, makeDirection( -1.0f, 0.0f, 0.0f )
+			, makeDirection( 0.0f, 1.0f, 0.0f )
+			, makeDirection( 0.0f, -1.0f, 0.0f )
+			, makeDirection( 0.0f, 0.0f, 1.0f )
+			, makeDirection( 0.0f, 0.0f, -1.0f )
+			, makeDirection( 1.0f, 1.0f, 1.0f )
+			, makeDirection( -1.0f, 1.0f, -1.0f )
+			, makeDirection( 1.0f, -1.0f, -1.0f )
+			, makeDirection( -1.0f, -1.0f, -1.0f )
+			, makeDirection( 1.0f, 0.0f, -1.0f )
+			, makeDirection( 0.0f, -1.0f, -1.0f ) } )
+		{
+			maxError = std::max( maxError, getAngularError( direction ) );
+		}
+
+		std::mt19937 generator{ 42u };
+		std::normal_distribution< float > distribution{};
+
+		for ( uint32_t i = 0u; i < 10000u; ++i )
+		{
+			auto x = distribution( generator );
+			auto y = distribution( generator );
+			auto z = distribution( generator );
+
+			if ( std::abs( x ) + std::abs( y ) + std::abs( z ) > 1.0e-3f )
+			{
+				maxError = std::max( maxError, getAngularError( makeDirection( x, y, z ) ) );
+			}
+		}
+
+		CT_CHECK( maxError < MaxAngularError );
+		// The null vector doesn't produce NaNs.
+		auto packed = castor::packing::encodeOctahedral( 0.0f, 0.0f, 0.0f );
+		auto decoded = castor::packing::decodeOctahedral( packed[0], packed[1] );
+		CT_CHECK( !std::isnan( decoded->x ) && !std::isnan( decoded->y ) && !std::isnan( decoded->z ) );
+	}
+}
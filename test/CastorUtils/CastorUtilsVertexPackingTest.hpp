@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsVertexPackingTest___
+#define ___CUT_CastorUtilsVertexPackingTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsVertexPackingTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsVertexPackingTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void HalfRoundTrip();
+		void HalfSpecialValues();
+		void Snorm16RoundTrip();
+		void OctahedralRoundTrip();
+	};
+}
+
+#endif
@@ -2,6 +2,7 @@
 
 #include <CastorUtils/Data/ZipArchive.hpp>
 #include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/Compression.hpp>
 #include <CastorUtils/Data/TextFile.hpp>
 
 #include <cstring>
@@ -16,6 +17,7 @@ namespace Testing
 	void CastorUtilsZipTest::doRegisterTests()
 	{
 		doRegisterTest( "ZipFile", std::bind( &CastorUtilsZipTest::ZipFile, this ) );
+		doRegisterTest( "DeflateBuffer", std::bind( &CastorUtilsZipTest::DeflateBuffer, this ) );
 	}
 
 	void CastorUtilsZipTest::ZipFile()
@@ -118,4 +120,32 @@ namespace Testing
 			std::cout << "	Couldn't create first folder" << std::endl;
 		}
 	}
+
+	void CastorUtilsZipTest::DeflateBuffer()
+	{
+		castor::ByteArray input( 256u * 1024u );
+
+		for ( size_t i = 0u; i < input.size(); ++i )
+		{
+			input[i] = uint8_t( ( i / 7u ) ^ ( i % 13u ) );
+		}
+
+		castor::ByteArray compressed;
+		CT_REQUIRE( castor::compressBuffer( input.data(), input.size(), compressed ) );
+		CT_CHECK( compressed.size() < input.size() );
+
+		castor::ByteArray output( input.size() );
+		CT_CHECK( castor::decompressBuffer( compressed.data(), compressed.size(), output.data(), output.size() ) );
+		CT_CHECK( output == input );
+
+		std::cout << "	Wrong expected size" << std::endl;
+		CT_CHECK( !castor::decompressBuffer( compressed.data(), compressed.size(), output.data(), output.size() - 1u ) );
+
+		std::cout << "	Truncated data" << std::endl;
+		CT_CHECK( !castor::decompressBuffer( compressed.data(), compressed.size() / 2u, output.data(), output.size() ) );
+
+		std::cout << "	Empty buffer" << std::endl;
+		CT_REQUIRE( castor::compressBuffer( nullptr, 0u, compressed ) );
+		CT_CHECK( castor::decompressBuffer( compressed.data(), compressed.size(), nullptr, 0u ) );
+	}
 }
@@ -17,6 +17,7 @@ namespace Testing
 
 	private:
 		void ZipFile();
+		void DeflateBuffer();
 	};
 }
 
@@ -2,16 +2,25 @@
 #include "CastorUtilsArrayViewTest.hpp"
 #include "CastorUtilsBuddyAllocatorTest.hpp"
 #include "CastorUtilsDynamicBitsetTest.hpp"
+#include "CastorUtilsFileParserTest.hpp"
+#include "CastorUtilsGlyphAtlasTest.hpp"
+#include "CastorUtilsImageCacheTest.hpp"
+#include "CastorUtilsJobSystemTest.hpp"
+#include "CastorUtilsLoggerTest.hpp"
 #include "CastorUtilsMatrixTest.hpp"
 #include "CastorUtilsPixelBufferExtractTest.hpp"
 #include "CastorUtilsPixelFormatTest.hpp"
 #include "CastorUtilsQuaternionTest.hpp"
+#include "CastorUtilsRadixSortTest.hpp"
 #include "CastorUtilsSignalTest.hpp"
+#include "CastorUtilsSkylinePackerTest.hpp"
 #include "CastorUtilsSpeedTest.hpp"
 #include "CastorUtilsStringTest.hpp"
 #include "CastorUtilsTextWriterTest.hpp"
 #include "CastorUtilsThreadPoolTest.hpp"
+#include "CastorUtilsTlsfAllocatorTest.hpp"
 #include "CastorUtilsUniqueTest.hpp"
+#include "CastorUtilsVertexPackingTest.hpp"
 #include "CastorUtilsWorkerThreadTest.hpp"
 #include "CastorUtilsZipTest.hpp"
 
@@ -43,9 +52,13 @@ int main( int argc, char const * argv[] )
 #endif
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsDynamicBitsetTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsBuddyAllocatorTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsTlsfAllocatorTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsTlsfAllocatorBench >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsSignalTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsWorkerThreadTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsThreadPoolTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsJobSystemTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsLoggerTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsArrayViewTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsUniqueTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsMatrixTest >() );
@@ -54,9 +67,18 @@ int main( int argc, char const * argv[] )
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsStringTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsZipTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsQuaternionTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsQuaternionBench >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsRadixSortTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsRadixSortBench >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsSkylinePackerTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsGlyphAtlasTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsVertexPackingTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsImageCacheTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsSpeedTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsTextWriterTest >() );
 	Testing::registerType( castor::make_unique< Testing::CastorUtilsPixelBufferExtractTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsFileParserTest >() );
+	Testing::registerType( castor::make_unique< Testing::CastorUtilsFileParserBench >() );
 	BENCHLOOP( iCount, iReturn );
 	castor::Logger::cleanup();
 	return int( iReturn );
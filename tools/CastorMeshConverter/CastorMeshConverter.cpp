@@ -43,7 +43,7 @@ namespace convert
 	{
 		std::cout << "Castor Mesh Converter is a tool that allows you to convert any mesh file to the CMSH file format." << std::endl;
 		std::cout << "Usage:" << std::endl;
-		std::cout << "CastorMeshConverter FILE [-o NAME] [-s] [-c] [-p DEGREES] [-y DEGREES] [-r DEGREES] [-a VALUE] [-m VALUE]" << std::endl;
+		std::cout << "CastorMeshConverter FILE [-o NAME] [-s] [-c] [-p DEGREES] [-y DEGREES] [-r DEGREES] [-a VALUE] [-m VALUE] [-q] [-u]" << std::endl;
 		std::cout << "Options:" << std::endl;
 		std::cout << "  -o NAME     Allows you to specify the output file name." << std::endl;
 		std::cout << "              NAME can omit the .cscn extension." << std::endl << std::endl;
@@ -59,6 +59,8 @@ namespace convert
 		std::cout << "              VALUE can be one of:" << std::endl;
 		std::cout << "              - phong : Phong" << std::endl;
 		std::cout << "              - pbr : PBR (default value)" << std::endl;
+		std::cout << "  -q          Quantises the vertex attributes (lossy, smaller files)." << std::endl;
+		std::cout << "  -u          Writes neither compressed nor encoded chunks." << std::endl;
 	}
 
 	static bool parseSwitchOption( castor::MbString const & option
@@ -177,6 +179,13 @@ namespace convert
 		options.options.splitPerMaterial = parseSwitchOption( "s", args );
 		options.options.recenter = parseSwitchOption( "c", args );
 		options.options.ignoreFailures = !parseSwitchOption( "f", args );
+		options.options.cmsh.quantise = parseSwitchOption( "q", args );
+
+		if ( parseSwitchOption( "u", args ) )
+		{
+			options.options.cmsh.compress = false;
+			options.options.cmsh.encode = false;
+		}
 
 		if ( args.empty() )
 		{
@@ -51,6 +51,7 @@ namespace
 	{
 		castor::Path input;
 		castor::Path output;
+		castor3d::CmshWriteOptions cmsh{};
 	};
 
 	void printUsage()
@@ -58,12 +59,28 @@ namespace
 		std::cout << "Castor Mesh Upgrader is a tool that allows you to upgrade your CMSH files to the latest CMSH version (works for CMSH and CSKL files)." << std::endl;
 		std::cout << "Note that if the .cmsh file contains a skeleton, it will be written in its own .cskl file." << std::endl;
 		std::cout << "Usage:" << std::endl;
-		std::cout << "CastorMeshUpgrader FILE [-o NAME]" << std::endl;
+		std::cout << "CastorMeshUpgrader FILE [-o NAME] [-q] [-u]" << std::endl;
 		std::cout << "  FILE must be a .cmsh or .cskl file." << std::endl;
 		std::cout << "Options:" << std::endl;
 		std::cout << "  -o NAME     Allows you to specify the output file name." << std::endl;
 		std::cout << "              If you don't use this option, the original file will be overwritten." << std::endl;
 		std::cout << "              NAME can omit the extension." << std::endl << std::endl;
+		std::cout << "  -q          Quantises the vertex attributes (lossy, smaller files)." << std::endl;
+		std::cout << "  -u          Writes neither compressed nor encoded chunks." << std::endl;
+	}
+
+	bool parseSwitchOption( castor::MbString const & option
+		, StringArray & args )
+	{
+		auto it = std::find( args.begin(), args.end(), "-" + option );
+		auto result = it != args.end();
+
+		if ( result )
+		{
+			args.erase( it );
+		}
+
+		return result;
 	}
 
 	bool doParseArgs( int argc
@@ -93,6 +110,21 @@ namespace
 			return false;
 		}
 
+		options.cmsh.quantise = parseSwitchOption( "q", args );
+
+		if ( parseSwitchOption( "u", args ) )
+		{
+			options.cmsh.compress = false;
+			options.cmsh.encode = false;
+		}
+
+		if ( args.empty() )
+		{
+			std::cerr << "Missing mesh file parameter." << std::endl << std::endl;
+			printUsage();
+			return false;
+		}
+
 		it = std::find( args.begin(), args.end(), "-o" );
 		options.input = castor::Path{ castor::makeString( args[0] ) };
 
@@ -208,10 +240,12 @@ namespace
 
 	template< typename T >
 	bool doWriteObject( castor::Path const & path
-		, T & object );
+		, T & object
+		, castor3d::CmshWriteOptions const & options );
 
 	bool doPostWrite( castor::Path const & path
-		, castor3d::Mesh & mesh )
+		, castor3d::Mesh & mesh
+		, castor3d::CmshWriteOptions const & options )
 	{
 		auto skeleton = mesh.getSkeleton();
 		bool result = true;
@@ -219,7 +253,7 @@ namespace
 		if ( skeleton )
 		{
 			auto newPath = path.getPath() / ( path.getFileName() + cuT( ".cskl" ) );
-			result = doWriteObject( newPath, *skeleton );
+			result = doWriteObject( newPath, *skeleton, options );
 		}
 
 		mesh.cleanup();
@@ -227,14 +261,16 @@ namespace
 	}
 
 	bool doPostWrite( castor::Path const & path
-		, castor3d::Skeleton & skeleton )
+		, castor3d::Skeleton & skeleton
+		, castor3d::CmshWriteOptions const & options )
 	{
 		return true;
 	}
 
 	template< typename T >
 	bool doWriteObject( castor::Path const & path
-		, T & object )
+		, T & object
+		, castor3d::CmshWriteOptions const & options )
 	{
 		bool result = false;
 
@@ -243,11 +279,11 @@ namespace
 			auto newPath = path.getPath() / ( path.getFileName() + cuT( "Upgraded." ) + path.getExtension() );
 			castor::BinaryFile file{ newPath, castor::File::OpenMode::eWrite };
 			castor3d::BinaryWriter< T > writer;
-			result = writer.write( object, file );
+			result = writer.write( object, file, options );
 
 			if ( result )
 			{
-				result = doPostWrite( path, object );
+				result = doPostWrite( path, object, options );
 			}
 		}
 		catch ( castor::Exception & exc )
@@ -331,7 +367,7 @@ int main( int argc, char * argv[] )
 
 				if ( doParseObject( device, inputPath, mesh ) )
 				{
-					doWriteObject( outputPath, mesh );
+					doWriteObject( outputPath, mesh, options.cmsh );
 				}
 			}
 			else if ( extension == cuT( "cskl" ) )
@@ -340,7 +376,7 @@ int main( int argc, char * argv[] )
 
 				if ( doParseObject( device, inputPath, skeleton ) )
 				{
-					doWriteObject( outputPath, skeleton );
+					doWriteObject( outputPath, skeleton, options.cmsh );
 				}
 			}
 
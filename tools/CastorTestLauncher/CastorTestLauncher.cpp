@@ -194,6 +194,8 @@ namespace test_launcher
 			, m_config.validate
 			, !m_config.disableRandom
 			, !m_config.disableUpdateOptimisations };
+		// The reference images need all the nodes to be drawn from the first frame.
+		config.enableAsyncShaderCompilation = false;
 		auto castor = castor::makeUnique< castor3d::Engine >( castor::move( config )
 			, * castor::Logger::getSingleton().getInstance() );
 		castor::PathArray arrayFiles;